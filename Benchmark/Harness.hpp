@@ -0,0 +1,116 @@
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// Copyright (C) 2025 by Agustin L. Alvarez. All rights reserved.
+//
+// This work is licensed under the terms of the MIT license.
+//
+// For a copy, see <https://opensource.org/licenses/MIT>.
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#pragma once
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [  HEADER  ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#include <Zyphryon.Base/Base.hpp>
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [   CODE   ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+namespace Gameplay::Benchmark
+{
+    /// \brief Runs named measurements and reports each one as a single JSON line on the standard output.
+    ///
+    /// Every measurement is sampled several times after a warm-up run, and the report carries the fastest and the
+    /// median time per operation so a comparison between two builds is not skewed by a single noisy sample.
+    class Harness final
+    {
+    public:
+
+        /// \brief Maximum number of samples taken per measurement.
+        static constexpr UInt32 kMaxSamples = 32;
+
+    public:
+
+        /// \brief Constructs a harness that runs every measurement whose name contains the filter.
+        ///
+        /// \param Filter  The substring a measurement name must contain to run, or empty to run all of them.
+        /// \param Samples The number of samples taken per measurement.
+        ZYPHRYON_INLINE Harness(ConstStr8 Filter, UInt32 Samples)
+            : mFilter  { Filter },
+              mSamples { std::clamp<UInt32>(Samples, 1, kMaxSamples) },
+              mSink    { 0.0 }
+        {
+        }
+
+        /// \brief Checks if a measurement with the given name is selected by the filter.
+        ///
+        /// \param Name The name of the measurement.
+        /// \return `true` if the measurement should run, `false` otherwise.
+        ZYPHRYON_INLINE Bool IsSelected(ConstStr8 Name) const
+        {
+            return mFilter.empty() || Name.find(mFilter) != ConstStr8::npos;
+        }
+
+        /// \brief Measures the given body and reports the time taken per operation.
+        ///
+        /// \param Name       The name of the measurement.
+        /// \param Parameter  The scale parameter of the measurement (for example, the number of active effects).
+        /// \param Operations The number of operations performed by a single call to the body.
+        /// \param Body       The function performing the operations.
+        template<typename Function>
+        ZYPHRYON_INLINE void Measure(ConstStr8 Name, UInt32 Parameter, UInt32 Operations, AnyRef<Function> Body)
+        {
+            if (!IsSelected(Name))
+            {
+                return;
+            }
+
+            // Warm caches and lazily allocated storage before sampling.
+            Body();
+
+            Array<Real64, kMaxSamples> Samples;
+
+            for (UInt32 Sample = 0; Sample < mSamples; ++Sample)
+            {
+                const auto Start = std::chrono::steady_clock::now();
+                Body();
+                const auto End   = std::chrono::steady_clock::now();
+
+                Samples[Sample] = std::chrono::duration<Real64, std::nano>(End - Start).count() / Operations;
+            }
+            Report(Name, Parameter, Operations, ConstSpan<Real64>(Samples.data(), mSamples));
+        }
+
+        /// \brief Keeps a computed value alive so the compiler cannot discard the work producing it.
+        ///
+        /// \param Value The value to consume.
+        ZYPHRYON_INLINE void Consume(Real64 Value)
+        {
+            mSink = mSink + Value;
+        }
+
+    private:
+
+        /// \brief Writes the result of a measurement as a JSON line.
+        ///
+        /// \param Name       The name of the measurement.
+        /// \param Parameter  The scale parameter of the measurement.
+        /// \param Operations The number of operations performed per sample.
+        /// \param Samples    The time per operation of each sample, in nanoseconds.
+        void Report(ConstStr8 Name, UInt32 Parameter, UInt32 Operations, ConstSpan<Real64> Samples) const;
+
+    private:
+
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+        ConstStr8       mFilter;
+        UInt32          mSamples;
+        volatile Real64 mSink;
+    };
+}
\ No newline at end of file
@@ -0,0 +1,437 @@
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// Copyright (C) 2025 by Agustin L. Alvarez. All rights reserved.
+//
+// This work is licensed under the terms of the MIT license.
+//
+// For a copy, see <https://opensource.org/licenses/MIT>.
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [  HEADER  ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#include "Harness.hpp"
+#include "Soak.hpp"
+#include "Gameplay/Arsenal/Arsenal.hpp"
+#include "Gameplay/Effect/EffectRepository.hpp"
+#include "Gameplay/Stat/StatLibrary.hpp"
+#include "Gameplay/Stat/StatRepository.hpp"
+#include "Gameplay/Token/TokenRepository.hpp"
+#include <cstdlib>
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [   CODE   ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+namespace Gameplay::Benchmark
+{
+    namespace
+    {
+        /// \brief Number of operations performed by a single sample of the cheap measurements.
+        constexpr UInt32 kOperations = 4'096;
+
+        /// \brief Root stats and the number of stats whose formula depends on each of them.
+        constexpr Array<UInt32, 3> kFanouts = { 8, 32, 128 };
+
+        /// \brief Depths of the token hierarchies used by the token measurements.
+        constexpr Array<UInt32, 3> kDepths  = { 1, 4, 8 };
+
+        /// \brief Number of active effects used by the poll measurements.
+        constexpr Array<UInt32, 3> kActives = { 16, 64, 240 };
+
+        /// \brief Handles of the effect archetypes created by the world setup.
+        constexpr Effect kInstant   = 1;
+        constexpr Effect kTemporary = 2;
+        constexpr Effect kStacking  = 3;
+        constexpr Effect kPeriodic  = 4;
+
+        /// \brief Generates the TOML text of a stat repository with a root per fan-out and its dependants.
+        ///
+        /// \return The generated TOML text.
+        Str8 GenerateStats()
+        {
+            Str8   Text;
+            UInt32 Next = kFanouts.size() + 1;
+
+            for (UInt32 Root = 1; Root <= kFanouts.size(); ++Root)
+            {
+                Text += "[[Stat]]\nID = " + std::to_string(Root) + "\nName = \"Root" + std::to_string(Root) + "\"\n";
+                Text += "Base = [\"Float\", 10.0]\n\n";
+
+                for (UInt32 Dependant = 0; Dependant < kFanouts[Root - 1]; ++Dependant, ++Next)
+                {
+                    Text += "[[Stat]]\nID = " + std::to_string(Next) + "\nName = \"Stat" + std::to_string(Next) + "\"\n";
+                    Text += "Base = [\"Float\", 1.0]\nFormula = \"Base + Target.Stat(" + std::to_string(Root) + ") * 0.5\"\n\n";
+                }
+            }
+            return Text;
+        }
+
+        /// \brief Generates the TOML text of an effect repository with the given number of effects.
+        ///
+        /// \param Count The number of effects to generate.
+        /// \return The generated TOML text.
+        Str8 GenerateEffects(UInt32 Count)
+        {
+            Str8 Text;
+
+            for (UInt32 Element = 1; Element <= Count; ++Element)
+            {
+                Text += "[[Effect]]\nID = " + std::to_string(Element) + "\nName = \"Effect" + std::to_string(Element) + "\"\n";
+                Text += "Duration = [\"Float\", 10.0]\nPeriod = [\"Float\", 1.0]\nLimit = " + std::to_string(Element % 4) + "\n\n";
+            }
+            return Text;
+        }
+
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+        /// \brief Creates an effect archetype used by the measurements.
+        ///
+        /// \param Handle      The handle of the effect.
+        /// \param Application The application policy of the effect.
+        /// \param Duration    The duration of the effect.
+        /// \param Period      The period of the effect.
+        /// \param Limit       The stack limit of the effect.
+        /// \param Bonus       The single bonus granted by the effect.
+        void CreateEffect(Effect Handle, EffectApplication Application, Real32 Duration, Real32 Period, UInt16 Limit, ConstRef<EffectModifier> Bonus)
+        {
+            EffectArchetype Archetype;
+            Archetype.SetHandle(Handle);
+            Archetype.SetName("Benchmark");
+            Archetype.SetApplication(Application);
+            Archetype.SetDuration(StatInput(Duration));
+            Archetype.SetPeriod(StatInput(Period));
+            Archetype.SetLimit(Limit);
+            Archetype.SetBonuses(ConstSpan<EffectModifier>(& Bonus, 1));
+
+            EffectRepository::Instance().Insert(Move(Archetype));
+        }
+
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+        /// \brief Populates the repositories with the synthetic world shared by every measurement.
+        void Setup()
+        {
+            World::LoadStats(GenerateStats());
+
+            EffectRepository::Instance().Clear();
+            CreateEffect(kInstant,   EffectApplication::Instant,   0.0f,  0.0f, 0, EffectModifier(1, StatMode::Snapshot, StatOp::Add,     StatInput(1.0f)));
+            CreateEffect(kTemporary, EffectApplication::Temporary, 10.0f, 0.0f, 0, EffectModifier(2, StatMode::Dynamic,  StatOp::Percent, StatInput(0.1f)));
+            CreateEffect(kStacking,  EffectApplication::Temporary, 10.0f, 0.0f, 8, EffectModifier(3, StatMode::Dynamic,  StatOp::Add,     StatInput(1.0f)));
+            CreateEffect(kPeriodic,  EffectApplication::Temporary, 10.0f, 1.0f, 0, EffectModifier(1, StatMode::Snapshot, StatOp::Add,     StatInput(1.0f)));
+
+            Ref<TokenRepository> Tokens = TokenRepository::Instance();
+
+            for (const UInt32 Depth : kDepths)
+            {
+                Str8 Name = "Benchmark";
+
+                for (UInt32 Level = 1; Level < Depth; ++Level)
+                {
+                    Name += ".Level" + std::to_string(Level);
+                }
+                Tokens.Insert(Name);
+            }
+        }
+
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+        /// \brief Measures `Arsenal::ApplyEffect` for instant, temporary and stacking effects.
+        ///
+        /// \param Harness The harness running the measurement.
+        void MeasureApplyEffect(Ref<Harness> Harness)
+        {
+            Arsenal Target;
+            Real64  Timestamp = 0.0;
+
+            Harness.Measure("Arsenal.ApplyEffect.Instant", kFanouts[0], kOperations, [&]
+            {
+                for (UInt32 Operation = 0; Operation < kOperations; ++Operation)
+                {
+                    Target.ApplyEffect(EffectSpec(kInstant, StatInput(1.0f), StatInput(1.0f)), Timestamp);
+                }
+            });
+
+            // Temporary effects never stack, so each application is paired with its revert to keep the set bounded.
+            Harness.Measure("Arsenal.ApplyEffect.Temporary", 1, kOperations, [&]
+            {
+                for (UInt32 Operation = 0; Operation < kOperations; ++Operation)
+                {
+                    Target.RevertEffect(Target.ApplyEffect(EffectSpec(kTemporary, StatInput(1.0f), StatInput(1.0f)), Timestamp), Timestamp);
+                }
+            });
+
+            Harness.Measure("Arsenal.ApplyEffect.Stacking", 8, kOperations, [&]
+            {
+                for (UInt32 Operation = 0; Operation < kOperations; ++Operation)
+                {
+                    Target.ApplyEffect(EffectSpec(kStacking, StatInput(1.0f), StatInput(1.0f)), Timestamp);
+                }
+            });
+
+            Harness.Consume(Target.GetStat(1) + Target.GetStat(2) + Target.GetStat(3));
+        }
+
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+        /// \brief Measures `EffectSet::Poll` with a growing number of active effects, a sixteenth of them due per poll.
+        ///
+        /// \param Harness The harness running the measurement.
+        void MeasurePoll(Ref<Harness> Harness)
+        {
+            constexpr Real64 kWindow = 16.0;
+
+            ConstRef<EffectArchetype> Archetype = EffectRepository::Instance().Get(kPeriodic);
+
+            for (const UInt32 Count : kActives)
+            {
+                EffectSet Effects;
+                Real64    Timestamp = 0.0;
+
+                for (UInt32 Element = 0; Element < Count; ++Element)
+                {
+                    Ref<EffectInstance> Instance = Effects.Create(Archetype);
+                    Instance.SetInterval(static_cast<Real64>(Element % static_cast<UInt32>(kWindow)));
+                    Instance.SetExpiration(std::numeric_limits<Real64>::max());
+
+                    Effects.Activate(Instance, [](Ref<EffectInstance>, EffectSet::Event)
+                    {
+                    });
+                }
+
+                Harness.Measure("EffectSet.Poll", Count, kOperations, [&]
+                {
+                    for (UInt32 Operation = 0; Operation < kOperations; ++Operation, Timestamp += 1.0)
+                    {
+                        Effects.Poll(Timestamp, [](Ref<EffectInstance> Instance)
+                        {
+                            Instance.SetInterval(Instance.GetInterval() + kWindow);
+                            return false;
+                        });
+                    }
+                });
+            }
+        }
+
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+        /// \brief Measures `StatRepository::NotifyDependency` for roots with a growing number of dependants.
+        ///
+        /// \param Harness The harness running the measurement.
+        void MeasureNotifyDependency(Ref<Harness> Harness)
+        {
+            ConstRef<StatRepository> Repository = StatRepository::Instance();
+
+            for (UInt32 Root = 1; Root <= kFanouts.size(); ++Root)
+            {
+                UInt32 Visits = 0;
+
+                Harness.Measure("StatRepository.NotifyDependency", kFanouts[Root - 1], kOperations, [&]
+                {
+                    for (UInt32 Operation = 0; Operation < kOperations; ++Operation)
+                    {
+                        Repository.NotifyDependency(Stat(Root), [&](Stat)
+                        {
+                            ++Visits;
+                            return true;
+                        });
+                    }
+                });
+
+                Harness.Consume(Visits);
+            }
+        }
+
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+        /// \brief Measures `TokenSet::Insert` and `TokenSet::Count` for tokens at a growing hierarchy depth.
+        ///
+        /// \param Harness The harness running the measurement.
+        void MeasureTokens(Ref<Harness> Harness)
+        {
+            ConstRef<TokenRepository> Repository = TokenRepository::Instance();
+
+            for (const UInt32 Depth : kDepths)
+            {
+                Str8 Name = "Benchmark";
+
+                for (UInt32 Level = 1; Level < Depth; ++Level)
+                {
+                    Name += ".Level" + std::to_string(Level);
+                }
+
+                const Token Handle = Repository.GetByName(Name);
+                TokenSet    Tokens;
+                UInt64      Total  = 0;
+
+                // Each insertion is paired with its removal to keep the counts bounded between samples.
+                Harness.Measure("TokenSet.Insert", Depth, kOperations, [&]
+                {
+                    for (UInt32 Operation = 0; Operation < kOperations; ++Operation)
+                    {
+                        Tokens.Insert(Handle, 1);
+                        Tokens.Remove(Handle, 1);
+                    }
+                });
+
+                Tokens.Insert(Handle, 1);
+
+                Harness.Measure("TokenSet.Count", Depth, kOperations, [&]
+                {
+                    for (UInt32 Operation = 0; Operation < kOperations; ++Operation)
+                    {
+                        Total += Tokens.Count(Handle);
+                    }
+                });
+
+                Harness.Consume(static_cast<Real64>(Total));
+            }
+        }
+
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+        /// \brief Measures `StatFormula::Calculate` for a component-only and a cross-context formula.
+        ///
+        /// \param Harness The harness running the measurement.
+        void MeasureFormula(Ref<Harness> Harness)
+        {
+            Ref<StatLibrary> Library = StatLibrary::Instance();
+
+            const ConstPtr<StatFormula> Components = Library.Compile("(Base + Flat) * (1 + Additive) * Multiplier");
+            const ConstPtr<StatFormula> References = Library.Compile("Source.Stat(1) * 0.5 + Target.Stat(2) * 0.25 + 3");
+
+            Arsenal       Source;
+            Arsenal       Target;
+            Real64        Total = 0.0;
+
+            Harness.Measure("StatFormula.Calculate.Components", 0, kOperations, [&]
+            {
+                for (UInt32 Operation = 0; Operation < kOperations; ++Operation)
+                {
+                    Total += Components->Calculate(Source, 10.0f, static_cast<Real32>(Operation), 0.5f, 1.5f);
+                }
+            });
+
+            Harness.Measure("StatFormula.Calculate.References", 2, kOperations, [&]
+            {
+                for (UInt32 Operation = 0; Operation < kOperations; ++Operation)
+                {
+                    Total += References->Calculate(Source, Target);
+                }
+            });
+
+            Harness.Consume(Total);
+        }
+
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+        /// \brief Measures loading the stat and effect repositories from TOML text.
+        ///
+        /// \note Runs last, as reloading replaces the archetypes every other measurement relies on.
+        ///
+        /// \param Harness The harness running the measurement.
+        void MeasureLoad(Ref<Harness> Harness)
+        {
+            const Str8 Stats   = GenerateStats();
+            const Str8 Effects = GenerateEffects(EffectRepository::kMaxArchetypes - 1);
+
+            Harness.Measure("StatRepository.Load", static_cast<UInt32>(Stats.size()), 1, [&]
+            {
+                World::LoadStats(Stats);
+            });
+
+            Harness.Measure("EffectRepository.Load", static_cast<UInt32>(Effects.size()), 1, [&]
+            {
+                World::LoadEffects(Effects);
+            });
+        }
+    }
+}
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+int main(int Count, char * Arguments[])
+{
+    using namespace Gameplay::Benchmark;
+
+    ConstStr8      Filter;
+    UInt32         Samples  = 9;
+    Bool           Scenario = false;
+    World::Scale   Scale;
+    Soak::Settings Settings;
+
+    using Numeric = std::pair<ConstStr8, Ptr<UInt32>>;
+
+    const Array<Numeric, 10> Options = {{
+        { "--samples",   & Samples            },
+        { "--stats",     & Scale.Stats        },
+        { "--effects",   & Scale.Effects      },
+        { "--abilities", & Scale.Abilities    },
+        { "--tokens",    & Scale.Tokens       },
+        { "--arsenals",  & Settings.Arsenals  },
+        { "--ticks",     & Settings.Ticks     },
+        { "--window",    & Settings.Window    },
+        { "--churn",     & Settings.Churn     },
+        { "--grants",    & Settings.Abilities },
+    }};
+
+    for (int Index = 1; Index < Count; ++Index)
+    {
+        const ConstStr8 Option = Arguments[Index];
+
+        if (Option == "--soak")
+        {
+            Scenario = true;
+            continue;
+        }
+
+        if (Index + 1 == Count)
+        {
+            break;
+        }
+
+        const ConstStr8 Value = Arguments[++Index];
+
+        if (Option == "--filter")
+        {
+            Filter = Value;
+        }
+        else if (Option == "--seed")
+        {
+            Scale.Seed = std::strtoull(Value.data(), nullptr, 10);
+        }
+        else if (const auto Iterator = std::ranges::find(Options, Option, & Numeric::first); Iterator != Options.end())
+        {
+            * Iterator->second = static_cast<UInt32>(std::strtoul(Value.data(), nullptr, 10));
+        }
+    }
+
+    if (Scenario)
+    {
+        World Generator(Scale);
+        Generator.Load();
+
+        Soak(Settings, Generator).Run();
+        return 0;
+    }
+
+    Harness Harness(Filter, Samples);
+
+    Setup();
+    MeasureApplyEffect(Harness);
+    MeasurePoll(Harness);
+    MeasureNotifyDependency(Harness);
+    MeasureTokens(Harness);
+    MeasureFormula(Harness);
+    MeasureLoad(Harness);
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,194 @@
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// Copyright (C) 2025 by Agustin L. Alvarez. All rights reserved.
+//
+// This work is licensed under the terms of the MIT license.
+//
+// For a copy, see <https://opensource.org/licenses/MIT>.
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [  HEADER  ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#include "Soak.hpp"
+#include "Gameplay/Token/TokenRepository.hpp"
+#include <chrono>
+#include <cstdio>
+
+#if defined(_WIN32)
+    #define WIN32_LEAN_AND_MEAN
+    #define NOMINMAX
+    #include <windows.h>
+    #include <psapi.h>
+#elif defined(__APPLE__)
+    #include <mach/mach.h>
+#elif defined(__linux__)
+    #include <unistd.h>
+#endif
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [   CODE   ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+namespace Gameplay::Benchmark
+{
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Soak::Soak(ConstRef<Settings> Settings, Ref<World> World)
+        : mSettings { Settings },
+          mWorld    { World },
+          mArsenals ( Settings.Arsenals )
+    {
+        mSettings.Window = std::max<UInt32>(mSettings.Window, 1);
+        mSettings.Churn  = std::max<UInt32>(mSettings.Churn,  1);
+
+        // Resolve every token name once, so the churn only pays for the token set itself.
+        ConstRef<TokenRepository> Repository = TokenRepository::Instance();
+
+        for (ConstRef<Str8> Name : mWorld.GetTokens())
+        {
+            mTokens.push_back(Repository.GetByName(Name));
+        }
+
+        // Grant each arsenal its own run of consecutive abilities.
+        const UInt32 Abilities = mWorld.GetScale().Abilities;
+
+        for (UInt32 Index = 0; Index < mArsenals.size(); ++Index)
+        {
+            for (UInt32 Element = 0; Element < mSettings.Abilities; ++Element)
+            {
+                mArsenals[Index].Grant(1 + (Index * mSettings.Abilities + Element) % Abilities);
+            }
+        }
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void Soak::Run()
+    {
+        Ref<Coordinator> Listener = Coordinator::Instance();
+
+        Vector<Real64> Latencies;
+        Latencies.reserve(mSettings.Window);
+
+        for (UInt32 Tick = 1; Tick <= mSettings.Ticks; ++Tick)
+        {
+            const Real64 Timestamp = Tick * mSettings.Delta;
+            const auto   Start     = std::chrono::steady_clock::now();
+
+            for (UInt32 Index = 0; Index < mArsenals.size(); ++Index)
+            {
+                Churn(Index, Timestamp);
+            }
+
+            for (Ref<Arsenal> Arsenal : mArsenals)
+            {
+                Arsenal.Tick(Timestamp, Listener);
+            }
+
+            const auto End = std::chrono::steady_clock::now();
+            Latencies.push_back(std::chrono::duration<Real64, std::micro>(End - Start).count());
+
+            if (Tick % mSettings.Window == 0 || Tick == mSettings.Ticks)
+            {
+                Report(Tick, Latencies);
+                Latencies.clear();
+            }
+        }
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void Soak::Churn(UInt32 Index, Real64 Timestamp)
+    {
+        Ref<Arsenal> Arsenal = mArsenals[Index];
+
+        if (mWorld.Next(mSettings.Churn) == 0)
+        {
+            const Effect Handle = 1 + mWorld.Next(mWorld.GetScale().Effects);
+            Arsenal.ApplyEffect(EffectSpec(Handle, StatInput(1.0f), StatInput(1.0f)), Timestamp);
+        }
+
+        if (mWorld.Next(mSettings.Churn * 4) == 0 && mSettings.Abilities > 0)
+        {
+            const Ability Handle = 1 + (Index * mSettings.Abilities + mWorld.Next(mSettings.Abilities)) % mWorld.GetScale().Abilities;
+            Arsenal.TryActivate(Handle, ConstSpan<Scene::Entity>(), Timestamp);
+        }
+
+        if (mWorld.Next(mSettings.Churn) == 0 && !mTokens.empty())
+        {
+            if (const Token Handle = mTokens[mWorld.Next(mTokens.size())]; Arsenal.GetToken(Handle) > 0)
+            {
+                Arsenal.RemoveToken(Handle);
+            }
+            else
+            {
+                Arsenal.InsertToken(Handle);
+            }
+        }
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void Soak::Report(UInt32 Tick, Ref<Vector<Real64>> Latencies)
+    {
+        const auto Percentile = [&](Real64 Rank)
+        {
+            const UInt Element = std::min<UInt>(Latencies.size() - 1, static_cast<UInt>(Rank * Latencies.size()));
+            std::nth_element(Latencies.begin(), Latencies.begin() + Element, Latencies.end());
+            return Latencies[Element];
+        };
+
+        UInt64 Effects = 0;
+
+        for (Ref<Arsenal> Arsenal : mArsenals)
+        {
+            Arsenal.ForEachEffect([&](ConstRef<EffectInstance>)
+            {
+                ++Effects;
+            });
+        }
+
+        const Real64 P50 = Percentile(0.50);
+        const Real64 P99 = Percentile(0.99);
+        const Real64 Max = * std::max_element(Latencies.begin(), Latencies.end());
+
+        std::printf("{\"name\":\"Soak\",\"tick\":%u,\"time\":%.3f,\"arsenals\":%zu,\"p50_us\":%.3f,\"p99_us\":%.3f,\"max_us\":%.3f,\"effects\":%llu,\"rss_kb\":%llu}\n",
+            Tick, Tick * mSettings.Delta, mArsenals.size(), P50, P99, Max, static_cast<unsigned long long>(Effects), static_cast<unsigned long long>(GetResidentMemory()));
+        std::fflush(stdout);
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    UInt64 Soak::GetResidentMemory()
+    {
+#if defined(_WIN32)
+        PROCESS_MEMORY_COUNTERS Counters;
+        return K32GetProcessMemoryInfo(GetCurrentProcess(), & Counters, sizeof(Counters)) ? Counters.WorkingSetSize / 1024 : 0;
+#elif defined(__APPLE__)
+        mach_task_basic_info_data_t Info;
+        mach_msg_type_number_t      Count = MACH_TASK_BASIC_INFO_COUNT;
+        return task_info(mach_task_self(), MACH_TASK_BASIC_INFO, reinterpret_cast<task_info_t>(& Info), & Count) == KERN_SUCCESS ? Info.resident_size / 1024 : 0;
+#elif defined(__linux__)
+        unsigned long long Pages    = 0;
+        unsigned long long Resident = 0;
+
+        if (FILE * File = std::fopen("/proc/self/statm", "r"))
+        {
+            if (std::fscanf(File, "%llu %llu", & Pages, & Resident) != 2)
+            {
+                Resident = 0;
+            }
+            std::fclose(File);
+        }
+        return Resident * static_cast<UInt64>(sysconf(_SC_PAGESIZE)) / 1024;
+#else
+        return 0;
+#endif
+    }
+}
\ No newline at end of file
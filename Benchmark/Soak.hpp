@@ -0,0 +1,95 @@
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// Copyright (C) 2025 by Agustin L. Alvarez. All rights reserved.
+//
+// This work is licensed under the terms of the MIT license.
+//
+// For a copy, see <https://opensource.org/licenses/MIT>.
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#pragma once
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [  HEADER  ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#include "World.hpp"
+#include "Gameplay/Arsenal/Arsenal.hpp"
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [   CODE   ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+namespace Gameplay::Benchmark
+{
+    /// \brief Drives a population of arsenals through a synthetic world over a long simulated uptime.
+    ///
+    /// Every tick each arsenal randomly applies effects, activates abilities and toggles tokens before being ticked.
+    /// The latency of whole world ticks is collected over a window, and each window is reported as a JSON line with
+    /// its percentiles, the number of live effects and the resident memory of the process.
+    class Soak final
+    {
+    public:
+
+        /// \brief Describes the population and the pace of the scenario.
+        struct Settings final
+        {
+            /// \brief The number of arsenals to simulate.
+            UInt32 Arsenals  = 1'024;
+
+            /// \brief The number of ticks to simulate.
+            UInt32 Ticks     = 36'000;
+
+            /// \brief The number of ticks per report window.
+            UInt32 Window    = 600;
+
+            /// \brief The simulated time between two ticks, in seconds.
+            Real64 Delta     = 1.0 / 60.0;
+
+            /// \brief The inverse chance per tick of each arsenal applying an effect or toggling a token.
+            UInt32 Churn     = 16;
+
+            /// \brief The number of abilities granted to each arsenal.
+            UInt32 Abilities = 8;
+        };
+
+    public:
+
+        /// \brief Constructs the scenario over an already loaded world.
+        ///
+        /// \param Settings The population and pace of the scenario.
+        /// \param World    The world the arsenals live in.
+        Soak(ConstRef<Settings> Settings, Ref<World> World);
+
+        /// \brief Runs the scenario to completion, reporting every window.
+        void Run();
+
+    private:
+
+        /// \brief Applies the random actions of a single arsenal for the current tick.
+        ///
+        /// \param Index     The index of the arsenal.
+        /// \param Timestamp The simulated time of the tick.
+        void Churn(UInt32 Index, Real64 Timestamp);
+
+        /// \brief Writes the statistics of a window as a JSON line.
+        ///
+        /// \param Tick      The last tick of the window.
+        /// \param Latencies The latency of each tick of the window, in microseconds, reordered by the call.
+        void Report(UInt32 Tick, Ref<Vector<Real64>> Latencies);
+
+        /// \brief Retrieves the resident memory of the process.
+        ///
+        /// \return The resident memory in kilobytes, or zero if the platform does not expose it.
+        static UInt64 GetResidentMemory();
+
+    private:
+
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+        Settings        mSettings;
+        Ref<World>      mWorld;
+        Vector<Arsenal> mArsenals;
+        Vector<Token>   mTokens;
+    };
+}
\ No newline at end of file
@@ -0,0 +1,245 @@
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// Copyright (C) 2025 by Agustin L. Alvarez. All rights reserved.
+//
+// This work is licensed under the terms of the MIT license.
+//
+// For a copy, see <https://opensource.org/licenses/MIT>.
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [  HEADER  ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#include "World.hpp"
+#include "Gameplay/Ability/AbilityRepository.hpp"
+#include "Gameplay/Effect/EffectRepository.hpp"
+#include "Gameplay/Stat/StatRepository.hpp"
+#include "Gameplay/Token/TokenRepository.hpp"
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [   CODE   ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+namespace Gameplay::Benchmark
+{
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    World::World(ConstRef<Scale> Scale)
+        : mScale { Scale },
+          mState { Scale.Seed ? Scale.Seed : 1 }
+    {
+        // Handle zero is reserved, so each repository holds one archetype less than its capacity.
+        mScale.Stats     = std::clamp<UInt32>(mScale.Stats,     1, StatRepository::kMaxArchetypes - 1);
+        mScale.Effects   = std::clamp<UInt32>(mScale.Effects,   1, EffectRepository::kMaxArchetypes - 1);
+        mScale.Abilities = std::clamp<UInt32>(mScale.Abilities, 1, AbilityRepository::kMaxArchetypes - 1);
+        mScale.Tokens    = std::clamp<UInt32>(mScale.Tokens,    1, TokenRepository::kMaxTokens - 1);
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void World::Load()
+    {
+        LoadStats(GenerateStats());
+        LoadEffects(GenerateEffects());
+        LoadAbilities(GenerateAbilities());
+
+        Ref<TokenRepository> Repository = TokenRepository::Instance();
+        Repository.Clear();
+
+        GenerateTokens();
+
+        for (ConstRef<Str8> Name : mTokens)
+        {
+            Repository.Insert(Name);
+        }
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void World::LoadStats(ConstStr8 Text)
+    {
+        Ref<StatRepository> Repository = StatRepository::Instance();
+        Repository.Clear();
+
+        TOMLParser      Parser(Text);
+        const TOMLArray Root = Parser.GetArray("Stat");
+
+        for (UInt32 Element = 0; Element < Root.GetSize(); ++Element)
+        {
+            Repository.Insert(StatArchetype(Root.GetSection(Element)));
+        }
+
+        // Insert dependencies after all archetypes have been loaded.
+        for (ConstRef<StatArchetype> Archetype : Repository.GetAll())
+        {
+            if (Archetype.IsValid())
+            {
+                Archetype.Traverse([&]<typename Type>(Type Dependency)
+                {
+                    Repository.InsertDependency(Archetype.GetHandle(), Dependency);
+                });
+            }
+        }
+        Repository.Rebuild();
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void World::LoadEffects(ConstStr8 Text)
+    {
+        Ref<EffectRepository> Repository = EffectRepository::Instance();
+        Repository.Clear();
+
+        TOMLParser      Parser(Text);
+        const TOMLArray Root = Parser.GetArray("Effect");
+
+        for (UInt32 Element = 0; Element < Root.GetSize(); ++Element)
+        {
+            Repository.Insert(EffectArchetype(Root.GetSection(Element)));
+        }
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void World::LoadAbilities(ConstStr8 Text)
+    {
+        Ref<AbilityRepository> Repository = AbilityRepository::Instance();
+        Repository.Clear();
+
+        TOMLParser      Parser(Text);
+        const TOMLArray Root = Parser.GetArray("Ability");
+
+        for (UInt32 Element = 0; Element < Root.GetSize(); ++Element)
+        {
+            Repository.Insert(AbilityArchetype(Root.GetSection(Element)));
+        }
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Str8 World::GenerateStats()
+    {
+        // The first stats are resources, the rest are attributes reading stats with a lower handle.
+        const UInt32 Resources = std::max<UInt32>(1, mScale.Stats / 8);
+
+        Str8 Text;
+
+        for (UInt32 ID = 1; ID <= mScale.Stats; ++ID)
+        {
+            Text += "[[Stat]]\nID = " + std::to_string(ID) + "\nName = \"Stat" + std::to_string(ID) + "\"\n";
+
+            if (ID <= Resources)
+            {
+                Text += "Kind = \"Resource\"\nBase = [\"Float\", 100.0]\n\n";
+                continue;
+            }
+
+            Str8 Formula = "(Base + Flat";
+
+            for (UInt32 Reference = Next(4); Reference > 0; --Reference)
+            {
+                Formula += " + Target.Stat(" + std::to_string(1 + Next(ID - 1)) + ") * 0." + std::to_string(1 + Next(9));
+            }
+            Formula += ") * (1 + Additive) * Multiplier";
+
+            Text += "Base = [\"Float\", " + std::to_string(1 + Next(20)) + ".0]\nFormula = \"" + Formula + "\"\n\n";
+        }
+        return Text;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Str8 World::GenerateEffects()
+    {
+        constexpr Array<ConstStr8, 2> kModes      = { "Snapshot", "Dynamic" };
+        constexpr Array<ConstStr8, 3> kOperations = { "Add", "Percent", "Scale" };
+
+        Str8 Text;
+
+        for (UInt32 ID = 1; ID <= mScale.Effects; ++ID)
+        {
+            // Permanent effects are left out, so the active set of a long running arsenal stays bounded.
+            const Bool Instant = (Next(5) == 0);
+
+            Text += "[[Effect]]\nID = " + std::to_string(ID) + "\nName = \"Effect" + std::to_string(ID) + "\"\n";
+            Text += "Duration = [\"Float\", " + std::to_string(1 + Next(20)) + ".0]\n";
+            Text += "Period = [\"Float\", " + std::to_string(Next(3) == 0 ? 0.5 * (1 + Next(4)) : 0.0) + "]\n";
+            Text += "Limit = " + std::to_string(Next(3) == 0 ? 1 + Next(5) : 0) + "\n";
+            Text += "Bonuses = [";
+
+            for (UInt32 Bonus = 0, Count = 1 + Next(3); Bonus < Count; ++Bonus)
+            {
+                const ConstStr8 Mode      = kModes[Next(kModes.size())];
+                const ConstStr8 Operation = kOperations[Next(kOperations.size())];
+                const Str8      Magnitude = (Operation == "Scale" ? "1.05" : Operation == "Percent" ? "0.1" : "2.0");
+
+                Text += (Bonus ? ", [" : "[") + std::to_string(1 + Next(mScale.Stats)) + ", \"" + Str8(Mode) + "\", \"";
+                Text += Str8(Operation) + "\", [\"Float\", " + Magnitude + "]]";
+            }
+            Text += "]\n\n[Effect.Policies]\nApplication = \"" + Str8(Instant ? "Instant" : "Temporary") + "\"\n\n";
+        }
+        return Text;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Str8 World::GenerateAbilities()
+    {
+        Str8 Text;
+
+        for (UInt32 ID = 1; ID <= mScale.Abilities; ++ID)
+        {
+            Text += "[[Ability]]\nID = " + std::to_string(ID) + "\nName = \"Ability" + std::to_string(ID) + "\"\n";
+            Text += "Effects = [";
+
+            for (UInt32 Element = 0, Count = 1 + Next(2); Element < Count; ++Element)
+            {
+                Text += (Element ? ", [" : "[") + std::to_string(1 + Next(mScale.Effects)) + ", [\"Float\", 1.0], [\"Float\", 1.0]]";
+            }
+            Text += "]\n\n[Ability.Cooldown]\nCooldown = [\"Float\", " + std::to_string(0.5 * (1 + Next(10))) + "]\n\n";
+        }
+        return Text;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void World::GenerateTokens()
+    {
+        constexpr UInt32 kMaxDepth = 8;
+
+        mTokens.clear();
+        mTokens.reserve(mScale.Tokens);
+
+        for (UInt32 Element = 0; Element < mScale.Tokens; ++Element)
+        {
+            const Str8 Name = "Token" + std::to_string(Element);
+
+            // Roughly one token in eight starts a new root, the rest extend a random existing token.
+            if (mTokens.empty() || Next(8) == 0)
+            {
+                mTokens.push_back(Name);
+                continue;
+            }
+
+            ConstRef<Str8> Parent = mTokens[Next(mTokens.size())];
+
+            if (std::ranges::count(Parent, '.') + 1 < kMaxDepth)
+            {
+                mTokens.push_back(Parent + "." + Name);
+            }
+            else
+            {
+                mTokens.push_back(Name);
+            }
+        }
+    }
+}
\ No newline at end of file
@@ -0,0 +1,136 @@
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// Copyright (C) 2025 by Agustin L. Alvarez. All rights reserved.
+//
+// This work is licensed under the terms of the MIT license.
+//
+// For a copy, see <https://opensource.org/licenses/MIT>.
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#pragma once
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [  HEADER  ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#include <Zyphryon.Base/Base.hpp>
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [   CODE   ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+namespace Gameplay::Benchmark
+{
+    /// \brief Generates a synthetic gameplay world and loads it into the repositories.
+    ///
+    /// Stats form a random dependency DAG (each attribute reads a few stats with a lower handle), effects carry
+    /// random policies and bonuses over those stats, abilities apply random effects, and tokens form a random
+    /// hierarchy. The same seed always yields the same world.
+    class World final
+    {
+    public:
+
+        /// \brief Describes the size of the generated world.
+        struct Scale final
+        {
+            /// \brief The number of stats to generate.
+            UInt32 Stats     = 255;
+
+            /// \brief The number of effects to generate.
+            UInt32 Effects   = 1'000;
+
+            /// \brief The number of abilities to generate.
+            UInt32 Abilities = 256;
+
+            /// \brief The number of tokens to generate.
+            UInt32 Tokens    = 4'000;
+
+            /// \brief The seed of the random generator.
+            UInt64 Seed      = 1;
+        };
+
+    public:
+
+        /// \brief Constructs a world generator of the given scale.
+        ///
+        /// \param Scale The size of the world to generate.
+        explicit World(ConstRef<Scale> Scale);
+
+        /// \brief Generates every archetype of the world and loads them into the repositories.
+        void Load();
+
+        /// \brief Retrieves the size of the world.
+        ///
+        /// \return The scale of the world.
+        ZYPHRYON_INLINE ConstRef<Scale> GetScale() const
+        {
+            return mScale;
+        }
+
+        /// \brief Retrieves the names of the generated tokens.
+        ///
+        /// \return A span of hierarchical token names.
+        ZYPHRYON_INLINE ConstSpan<Str8> GetTokens() const
+        {
+            return mTokens;
+        }
+
+        /// \brief Retrieves a pseudo-random number in the range `[0, Bound)`.
+        ///
+        /// \param Bound The exclusive upper bound, must be greater than zero.
+        /// \return The next pseudo-random number.
+        ZYPHRYON_INLINE UInt32 Next(UInt32 Bound)
+        {
+            // Xorshift64*, fast and good enough to shape synthetic content.
+            mState ^= mState >> 12;
+            mState ^= mState << 25;
+            mState ^= mState >> 27;
+            return static_cast<UInt32>(((mState * 0x2545F4914F6CDD1Dull) >> 32) % Bound);
+        }
+
+    public:
+
+        /// \brief Loads the stat repository from TOML text, following the same steps as the repository itself.
+        ///
+        /// \param Text The TOML text to load.
+        static void LoadStats(ConstStr8 Text);
+
+        /// \brief Loads the effect repository from TOML text, following the same steps as the repository itself.
+        ///
+        /// \param Text The TOML text to load.
+        static void LoadEffects(ConstStr8 Text);
+
+        /// \brief Loads the ability repository from TOML text, following the same steps as the repository itself.
+        ///
+        /// \param Text The TOML text to load.
+        static void LoadAbilities(ConstStr8 Text);
+
+    private:
+
+        /// \brief Generates the TOML text of the stats, forming a random dependency DAG.
+        ///
+        /// \return The generated TOML text.
+        Str8 GenerateStats();
+
+        /// \brief Generates the TOML text of the effects, with random policies and bonuses.
+        ///
+        /// \return The generated TOML text.
+        Str8 GenerateEffects();
+
+        /// \brief Generates the TOML text of the abilities, each applying a few random effects.
+        ///
+        /// \return The generated TOML text.
+        Str8 GenerateAbilities();
+
+        /// \brief Generates the names of the tokens, forming a random hierarchy.
+        void GenerateTokens();
+
+    private:
+
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+        Scale        mScale;
+        UInt64       mState;
+        Vector<Str8> mTokens;
+    };
+}
\ No newline at end of file
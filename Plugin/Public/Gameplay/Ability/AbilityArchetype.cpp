@@ -60,4 +60,46 @@ namespace Gameplay
             Spec.Save(Effects.AddArray());
         }
     }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void AbilityArchetype::Load(Ref<BakeReader> Reader)
+    {
+        mHandle = Reader.Read<UInt16>();
+        mKind   = Reader.Read<AbilityKind>();
+        mCategory.Load(Reader);
+        mName   = Reader.ReadString();
+        mCooldown.Load(Reader);
+        mCost.Load(Reader);
+        mTarget.Load(Reader);
+
+        mEffects.resize(Min<UInt32>(Reader.Read<UInt8>(), kMaxEffects));
+
+        for (Ref<EffectSpec> Spec : mEffects)
+        {
+            Spec.Load(Reader);
+        }
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void AbilityArchetype::Save(Ref<BakeWriter> Writer) const
+    {
+        Writer.Write(mHandle.GetID());
+        Writer.Write(mKind);
+        mCategory.Save(Writer);
+        Writer.WriteString(mName);
+        mCooldown.Save(Writer);
+        mCost.Save(Writer);
+        mTarget.Save(Writer);
+
+        Writer.Write(static_cast<UInt8>(mEffects.size()));
+
+        for (ConstRef<EffectSpec> Spec : mEffects)
+        {
+            Spec.Save(Writer);
+        }
+    }
 }
\ No newline at end of file
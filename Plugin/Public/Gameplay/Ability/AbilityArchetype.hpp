@@ -19,6 +19,10 @@
 #include "Gameplay/Ability/AbilityTarget.hpp"
 #include "Gameplay/Effect/EffectSpec.hpp"
 
+#ifndef GAMEPLAY_MAX_ABILITY_EFFECTS
+    #define GAMEPLAY_MAX_ABILITY_EFFECTS 4
+#endif
+
 // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 // [   CODE   ]
 // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
@@ -26,12 +30,15 @@
 namespace Gameplay
 {
     /// \brief Defines the archetype of an ability, including its properties and behavior policies.
+    ///
+    /// The fields read when abilities are validated and activated are packed at the front, so they share the
+    /// leading cache lines, while the name and the category only read when editing or saving are kept at the tail.
     class AbilityArchetype final
     {
     public:
 
         /// \brief Maximum number of effects an ability can have.
-        static constexpr UInt32 kMaxEffects = 4; // TODO: Macro Configurable
+        static constexpr UInt32 kMaxEffects = GAMEPLAY_MAX_ABILITY_EFFECTS;
 
     public:
 
@@ -49,6 +56,14 @@ namespace Gameplay
             Load(Section);
         }
 
+        /// \brief Constructs an ability archetype by loading data from a baked resource.
+        ///
+        /// \param Reader The baked resource to load from.
+        ZYPHRYON_INLINE AbilityArchetype(Ref<BakeReader> Reader)
+        {
+            Load(Reader);
+        }
+
         /// \brief Destruct an ability archetype.
         ZYPHRYON_INLINE ~AbilityArchetype()
         {
@@ -175,6 +190,14 @@ namespace Gameplay
             return mTarget;
         }
 
+        /// \brief Compiles the target requirement into its query against the current token hierarchy.
+        ///
+        /// \note Loading already compiles it, this is only needed after the token hierarchy is rebuilt.
+        ZYPHRYON_INLINE void Compile()
+        {
+            mTarget.Compile();
+        }
+
         /// \brief Sets the effects associated with this ability archetype.
         ///
         /// \param Effects A span of effect specifications to assign.
@@ -220,6 +243,16 @@ namespace Gameplay
         /// \param Section The TOML section to save to.
         void Save(TOMLSection Section) const;
 
+        /// \brief Loads the ability archetype data from a baked resource.
+        ///
+        /// \param Reader The baked resource to load from.
+        void Load(Ref<BakeReader> Reader);
+
+        /// \brief Saves the ability archetype data to a baked resource.
+        ///
+        /// \param Writer The baked resource to save to.
+        void Save(Ref<BakeWriter> Writer) const;
+
         /// \brief Generates a hash value for the ability archetype based on its handle.
         ///
         /// \return A hash value uniquely representing the ability archetype.
@@ -235,12 +268,12 @@ namespace Gameplay
 
         Ability                         mHandle;
         AbilityKind                     mKind;
-        TokenFamily                     mCategory;
-        Str8                            mName;
         AbilityCooldown                 mCooldown;
         AbilityCost                     mCost;
         AbilityTarget                   mTarget;
         Vector<EffectSpec, kMaxEffects> mEffects;
+        TokenFamily                     mCategory;
+        Str8                            mName;
 
         // TODO: Requirements?
         // TODO: Cast Time?
@@ -0,0 +1,131 @@
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// Copyright (C) 2025 by Agustin L. Alvarez. All rights reserved.
+//
+// This work is licensed under the terms of the MIT license.
+//
+// For a copy, see <https://opensource.org/licenses/MIT>.
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [  HEADER  ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#include "Gameplay/Ability/AbilityChannel.hpp"
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [   CODE   ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+namespace Gameplay
+{
+    namespace
+    {
+        /// \brief The size of the smallest block class, each following class doubles it.
+        constexpr UInt32 kSmallestBlock = 64;
+
+        /// \brief The number of block classes, frames larger than the last one use the general allocator.
+        constexpr UInt32 kBlockClasses  = 7;
+
+        /// \brief Holds the released blocks of a thread, one intrusive list per class.
+        struct Pool final
+        {
+            /// \brief A released block, linked to the next block of the same class.
+            struct Node final
+            {
+                Ptr<Node> Next;
+            };
+
+            /// \brief Returns every pooled block to the general allocator.
+            ~Pool()
+            {
+                for (Ptr<Node> Head : Lists)
+                {
+                    while (Head)
+                    {
+                        ::operator delete(std::exchange(Head, Head->Next));
+                    }
+                }
+            }
+
+            Array<Ptr<Node>, kBlockClasses> Lists { };
+        };
+
+        /// \brief Retrieves the pool of the calling thread.
+        ///
+        /// \return A reference to the pool of the calling thread.
+        ZYPHRYON_INLINE Ref<Pool> GetPool()
+        {
+            static thread_local Pool Current;
+            return Current;
+        }
+
+        /// \brief Retrieves the class a block size falls into.
+        ///
+        /// \param Size The size of the block in bytes.
+        /// \return The index of the class, or `kBlockClasses` if the block is too large to be pooled.
+        ZYPHRYON_INLINE UInt32 GetClass(std::size_t Size)
+        {
+            return Size <= kSmallestBlock ? 0 : std::bit_width((Size - 1) / kSmallestBlock);
+        }
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void AbilityChannel::Cancel()
+    {
+        if (!mCoroutine)
+        {
+            return;
+        }
+
+        // A script interrupting itself is still on the stack, its frame is destroyed once it suspends.
+        if (mCoroutine.promise().Running)
+        {
+            mCoroutine.promise().Cancelled = true;
+        }
+        else
+        {
+            Reset();
+        }
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Ptr<void> AbilityChannel::Allocate(std::size_t Size)
+    {
+        const UInt32 Class = GetClass(Size);
+
+        if (Class >= kBlockClasses)
+        {
+            return ::operator new(Size);
+        }
+
+        Ref<Ptr<Pool::Node>> Head = GetPool().Lists[Class];
+
+        if (Head)
+        {
+            return std::exchange(Head, Head->Next);
+        }
+        return ::operator new(kSmallestBlock << Class);
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void AbilityChannel::Release(Ptr<void> Block, std::size_t Size)
+    {
+        const UInt32 Class = GetClass(Size);
+
+        if (Class >= kBlockClasses)
+        {
+            ::operator delete(Block);
+            return;
+        }
+
+        // Blocks released on another thread than the one that allocated them simply join the local pool.
+        Ref<Ptr<Pool::Node>> Head = GetPool().Lists[Class];
+        Head = new (Block) Pool::Node { Head };
+    }
+}
\ No newline at end of file
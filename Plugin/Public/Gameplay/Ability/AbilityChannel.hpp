@@ -0,0 +1,453 @@
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// Copyright (C) 2025 by Agustin L. Alvarez. All rights reserved.
+//
+// This work is licensed under the terms of the MIT license.
+//
+// For a copy, see <https://opensource.org/licenses/MIT>.
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#pragma once
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [  HEADER  ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#include "Gameplay/Ability/Ability.hpp"
+#include "Gameplay/Stat/Stat.hpp"
+#include "Gameplay/Token/Token.hpp"
+#include <coroutine>
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [   CODE   ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+namespace Gameplay
+{
+    class Arsenal;
+
+    /// \brief Represents the script of a channeled ability, written as a coroutine over its stages.
+    ///
+    /// Scripts suspend on `co_await` until some time has passed, a token reaches a count or a stat crosses a
+    /// threshold. A suspended channel only keeps the condition it waits for, it is checked when its arsenal ticks
+    /// and its deadline is the only thing that wakes an idle arsenal up.
+    ///
+    /// Coroutine frames are drawn from per-thread pools of fixed size classes, so starting a channel does not
+    /// reach the general purpose allocator.
+    ///
+    /// Scripts reach their arsenal through `co_await AbilityChannel::Self()` rather than a captured reference, since
+    /// the arsenal may be relocated by the scene while the script is suspended.
+    class AbilityChannel final
+    {
+    public:
+
+        /// \brief Enumerates the conditions a suspended channel can wait for.
+        enum class Condition : UInt8
+        {
+            Time,       ///< Waits until the deadline.
+            Token,      ///< Waits until a token reaches a count.
+            Above,      ///< Waits until a stat reaches a threshold.
+            Below,      ///< Waits until a stat drops to a threshold.
+        };
+
+        /// \brief Structure describing what a suspended channel waits for.
+        struct Wait final
+        {
+            /// \brief The condition to wait for.
+            Condition Kind      = Condition::Time;
+
+            /// \brief The time to wait for, or the timeout of the other conditions, relative to the suspension.
+            Real64    Timeout   = kInfinity<Real64>;
+
+            /// \brief The token whose count is awaited.
+            Token     Tag;
+
+            /// \brief The stat whose value is awaited.
+            Stat      Target;
+
+            /// \brief The count or value to reach.
+            Real32    Threshold = 0.0f;
+        };
+
+        /// \brief Holds the state of a channel coroutine.
+        struct promise_type final
+        {
+            /// \brief The condition the channel is suspended on.
+            Wait         Pending;
+
+            /// \brief The absolute time at which the channel resumes regardless of its condition.
+            Real64       Deadline  = 0.0;
+
+            /// \brief The timestamp of the tick that resumed the channel.
+            Real64       Now       = 0.0;
+
+            /// \brief The arsenal that resumed the channel, only valid while it executes.
+            Ptr<Arsenal> Owner     = nullptr;
+
+            /// \brief Whether the condition was met when the channel resumed, `false` if it timed out.
+            Bool         Met       = true;
+
+            /// \brief Whether the channel is executing.
+            Bool         Running   = false;
+
+            /// \brief Whether the channel was interrupted while executing.
+            Bool         Cancelled = false;
+
+            /// \brief Creates the channel owning the coroutine.
+            ///
+            /// \return The channel owning the coroutine.
+            ZYPHRYON_INLINE AbilityChannel get_return_object()
+            {
+                return AbilityChannel(std::coroutine_handle<promise_type>::from_promise(* this));
+            }
+
+            /// \brief Suspends the script before its first stage, it starts once the arsenal takes it.
+            ///
+            /// \return An awaiter that always suspends.
+            ZYPHRYON_INLINE std::suspend_always initial_suspend() const
+            {
+                return { };
+            }
+
+            /// \brief Suspends the script after its last stage, so the channel observes its completion.
+            ///
+            /// \return An awaiter that always suspends.
+            ZYPHRYON_INLINE std::suspend_always final_suspend() const noexcept
+            {
+                return { };
+            }
+
+            /// \brief Completes the script.
+            ZYPHRYON_INLINE void return_void() const
+            {
+            }
+
+            /// \brief Aborts on any exception escaping the script.
+            ZYPHRYON_INLINE void unhandled_exception() const
+            {
+                std::terminate();
+            }
+
+            /// \brief Allocates a coroutine frame from the pool of the calling thread.
+            ///
+            /// \param Size The size of the frame in bytes.
+            /// \return A pointer to the allocated frame.
+            ZYPHRYON_INLINE static Ptr<void> operator new(std::size_t Size)
+            {
+                return Allocate(Size);
+            }
+
+            /// \brief Returns a coroutine frame to the pool of the calling thread.
+            ///
+            /// \param Frame The frame to release.
+            /// \param Size  The size of the frame in bytes.
+            ZYPHRYON_INLINE static void operator delete(Ptr<void> Frame, std::size_t Size)
+            {
+                Release(Frame, Size);
+            }
+        };
+
+        /// \brief Awaits a condition from within a channel script.
+        struct Awaiter final
+        {
+            /// \brief The condition to wait for.
+            Wait              Request;
+
+            /// \brief The state of the suspended channel, set once suspended.
+            Ptr<promise_type> Promise = nullptr;
+
+            /// \brief Always suspends, conditions are only checked when the arsenal ticks.
+            ///
+            /// \return Always `false`.
+            ZYPHRYON_INLINE Bool await_ready() const
+            {
+                return false;
+            }
+
+            /// \brief Records the condition and the deadline of the suspension.
+            ///
+            /// \param Coroutine The coroutine being suspended.
+            ZYPHRYON_INLINE void await_suspend(std::coroutine_handle<promise_type> Coroutine)
+            {
+                Promise = & Coroutine.promise();
+                Promise->Pending  = Request;
+                Promise->Deadline = Promise->Now + Request.Timeout;
+            }
+
+            /// \brief Reports whether the condition was met.
+            ///
+            /// \return `true` if the condition was met, `false` if the wait timed out.
+            ZYPHRYON_INLINE Bool await_resume() const
+            {
+                return Promise->Met;
+            }
+        };
+
+        /// \brief Retrieves the arsenal running a channel script, without suspending it.
+        struct Resolver final
+        {
+            /// \brief The arsenal running the channel, set once awaited.
+            Ptr<Arsenal> Owner = nullptr;
+
+            /// \brief Never ready, so the coroutine is reached through `await_suspend`.
+            ///
+            /// \return Always `false`.
+            ZYPHRYON_INLINE Bool await_ready() const
+            {
+                return false;
+            }
+
+            /// \brief Reads the arsenal running the channel and continues the script right away.
+            ///
+            /// \param Coroutine The coroutine awaiting its arsenal.
+            /// \return Always `false`, the script is not suspended.
+            ZYPHRYON_INLINE Bool await_suspend(std::coroutine_handle<promise_type> Coroutine)
+            {
+                Owner = Coroutine.promise().Owner;
+                return false;
+            }
+
+            /// \brief Returns the arsenal running the channel.
+            ///
+            /// \return A reference to the arsenal running the channel.
+            ZYPHRYON_INLINE Ref<Arsenal> await_resume() const
+            {
+                return (* Owner);
+            }
+        };
+
+    public:
+
+        /// \brief Default constructor, initializes an empty channel.
+        ZYPHRYON_INLINE AbilityChannel() = default;
+
+        /// \brief Takes over the coroutine of another channel.
+        ///
+        /// \param Other The channel to move from.
+        ZYPHRYON_INLINE AbilityChannel(AnyRef<AbilityChannel> Other)
+            : mCoroutine { std::exchange(Other.mCoroutine, nullptr) },
+              mAbility   { Other.mAbility }
+        {
+        }
+
+        /// \brief Destroys the coroutine frame, if any.
+        ZYPHRYON_INLINE ~AbilityChannel()
+        {
+            Reset();
+        }
+
+        /// \brief Takes over the coroutine of another channel, destroying the current one.
+        ///
+        /// \param Other The channel to move from.
+        /// \return A reference to this channel.
+        ZYPHRYON_INLINE Ref<AbilityChannel> operator=(AnyRef<AbilityChannel> Other)
+        {
+            if (this != & Other)
+            {
+                Reset();
+
+                mCoroutine = std::exchange(Other.mCoroutine, nullptr);
+                mAbility   = Other.mAbility;
+            }
+            return (* this);
+        }
+
+        /// \brief Copying a channel is not allowed.
+        AbilityChannel(ConstRef<AbilityChannel>) = delete;
+
+        /// \brief Copying a channel is not allowed.
+        Ref<AbilityChannel> operator=(ConstRef<AbilityChannel>) = delete;
+
+        /// \brief Sets the ability the channel belongs to.
+        ///
+        /// \param Handle The handle of the ability.
+        ZYPHRYON_INLINE void SetAbility(Ability Handle)
+        {
+            mAbility = Handle;
+        }
+
+        /// \brief Retrieves the ability the channel belongs to.
+        ///
+        /// \return The handle of the ability.
+        ZYPHRYON_INLINE Ability GetAbility() const
+        {
+            return mAbility;
+        }
+
+        /// \brief Checks if the script has completed or was interrupted.
+        ///
+        /// \return `true` if nothing is left to run, `false` otherwise.
+        ZYPHRYON_INLINE Bool IsDone() const
+        {
+            return !mCoroutine || mCoroutine.done() || mCoroutine.promise().Cancelled;
+        }
+
+        /// \brief Retrieves the time at which the channel resumes regardless of its condition.
+        ///
+        /// \return The deadline of the channel, or infinity if it is done or waits without a timeout.
+        ZYPHRYON_INLINE Real64 GetDeadline() const
+        {
+            return IsDone() ? kInfinity<Real64> : mCoroutine.promise().Deadline;
+        }
+
+        /// \brief Checks if the script is executing, which keeps its frame alive until it suspends.
+        ///
+        /// \return `true` if the script is on the stack, `false` otherwise.
+        ZYPHRYON_INLINE Bool IsRunning() const
+        {
+            return mCoroutine && mCoroutine.promise().Running;
+        }
+
+        /// \brief Checks if the channel should resume at the given time.
+        ///
+        /// \param Source    The context used to evaluate token and stat conditions.
+        /// \param Timestamp The current timestamp.
+        /// \return `true` if the condition is met or the deadline has passed, `false` otherwise.
+        template<typename Context>
+        ZYPHRYON_INLINE Bool IsDue(ConstRef<Context> Source, Real64 Timestamp) const
+        {
+            return !IsDone() && (Timestamp >= mCoroutine.promise().Deadline || IsMet(Source));
+        }
+
+        /// \brief Resumes the script until its next suspension.
+        ///
+        /// \note The script may start or interrupt other channels, including its own, and the channel object may
+        ///       move while it runs. Nothing of this object is touched once the script is resumed.
+        ///
+        /// \param Source    The arsenal running the script, used to evaluate token and stat conditions.
+        /// \param Timestamp The current timestamp.
+        template<typename Context>
+        ZYPHRYON_INLINE void Resume(Ref<Context> Source, Real64 Timestamp)
+        {
+            const std::coroutine_handle<promise_type> Coroutine = mCoroutine;
+            Ref<promise_type>                         Promise   = Coroutine.promise();
+
+            Promise.Met     = Promise.Pending.Kind == Condition::Time || IsMet(std::as_const(Source));
+            Promise.Now     = Timestamp;
+            Promise.Owner   = & Source;
+            Promise.Running = true;
+            Coroutine.resume();
+            Promise.Running = false;
+            Promise.Owner   = nullptr;
+        }
+
+        /// \brief Interrupts the script, destroying its frame unless the script is the one executing.
+        void Cancel();
+
+        /// \brief Destroys the coroutine frame, if any.
+        ZYPHRYON_INLINE void Reset()
+        {
+            if (mCoroutine)
+            {
+                mCoroutine.destroy();
+                mCoroutine = nullptr;
+            }
+        }
+
+    public:
+
+        /// \brief Retrieves the arsenal running the script.
+        ///
+        /// \note The reference must not be kept across a suspension, await it again after each one.
+        ///
+        /// \return An awaiter returning the arsenal without suspending the script.
+        ZYPHRYON_INLINE static Resolver Self()
+        {
+            return Resolver { };
+        }
+
+        /// \brief Suspends the script for a while.
+        ///
+        /// \param Seconds The time to wait in seconds.
+        /// \return An awaiter resuming the script once the time has passed.
+        ZYPHRYON_INLINE static Awaiter Delay(Real64 Seconds)
+        {
+            return Awaiter { Wait { Condition::Time, Seconds, Token(), Stat(), 0.0f } };
+        }
+
+        /// \brief Suspends the script until the arsenal holds a token at least a number of times.
+        ///
+        /// \param Handle  The token to wait for.
+        /// \param Count   The count to reach.
+        /// \param Timeout The maximum time to wait in seconds.
+        /// \return An awaiter resuming with `true` once the count is reached, or `false` on timeout.
+        ZYPHRYON_INLINE static Awaiter Until(Token Handle, UInt32 Count = 1, Real64 Timeout = kInfinity<Real64>)
+        {
+            return Awaiter { Wait { Condition::Token, Timeout, Handle, Stat(), static_cast<Real32>(Count) } };
+        }
+
+        /// \brief Suspends the script until a stat of the arsenal reaches a threshold.
+        ///
+        /// \param Handle    The stat to wait for.
+        /// \param Threshold The value to reach.
+        /// \param Timeout   The maximum time to wait in seconds.
+        /// \return An awaiter resuming with `true` once the stat is at or above the threshold, or `false` on timeout.
+        ZYPHRYON_INLINE static Awaiter UntilAbove(Stat Handle, Real32 Threshold, Real64 Timeout = kInfinity<Real64>)
+        {
+            return Awaiter { Wait { Condition::Above, Timeout, Token(), Handle, Threshold } };
+        }
+
+        /// \brief Suspends the script until a stat of the arsenal drops to a threshold.
+        ///
+        /// \param Handle    The stat to wait for.
+        /// \param Threshold The value to drop to.
+        /// \param Timeout   The maximum time to wait in seconds.
+        /// \return An awaiter resuming with `true` once the stat is at or below the threshold, or `false` on timeout.
+        ZYPHRYON_INLINE static Awaiter UntilBelow(Stat Handle, Real32 Threshold, Real64 Timeout = kInfinity<Real64>)
+        {
+            return Awaiter { Wait { Condition::Below, Timeout, Token(), Handle, Threshold } };
+        }
+
+    private:
+
+        /// \brief Takes ownership of a coroutine.
+        ///
+        /// \param Coroutine The coroutine to own.
+        ZYPHRYON_INLINE explicit AbilityChannel(std::coroutine_handle<promise_type> Coroutine)
+            : mCoroutine { Coroutine }
+        {
+        }
+
+        /// \brief Checks if the condition the channel waits for holds.
+        ///
+        /// \param Source The context used to evaluate token and stat conditions.
+        /// \return `true` if the condition holds, `false` otherwise or if the channel only waits for time.
+        template<typename Context>
+        ZYPHRYON_INLINE Bool IsMet(ConstRef<Context> Source) const
+        {
+            ConstRef<Wait> Pending = mCoroutine.promise().Pending;
+
+            switch (Pending.Kind)
+            {
+            case Condition::Time:
+                return false;
+            case Condition::Token:
+                return Source.GetToken(Pending.Tag) >= Pending.Threshold;
+            case Condition::Above:
+                return Source.GetStat(Pending.Target) >= Pending.Threshold;
+            case Condition::Below:
+                return Source.GetStat(Pending.Target) <= Pending.Threshold;
+            }
+            return false;
+        }
+
+        /// \brief Allocates a block from the pool of the calling thread.
+        ///
+        /// \param Size The size of the block in bytes.
+        /// \return A pointer to the allocated block.
+        static Ptr<void> Allocate(std::size_t Size);
+
+        /// \brief Returns a block to the pool of the calling thread.
+        ///
+        /// \param Block The block to release.
+        /// \param Size  The size of the block in bytes.
+        static void Release(Ptr<void> Block, std::size_t Size);
+
+    private:
+
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+        std::coroutine_handle<promise_type> mCoroutine;
+        Ability                             mAbility;
+    };
+}
\ No newline at end of file
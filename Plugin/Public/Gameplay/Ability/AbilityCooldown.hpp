@@ -194,6 +194,30 @@ namespace Gameplay
             }
         }
 
+        /// \brief Loads the ability cooldown data from a baked resource.
+        ///
+        /// \param Reader The baked resource to load from.
+        ZYPHRYON_INLINE void Load(Ref<BakeReader> Reader)
+        {
+            mInfluence = Reader.Read<Influence>();
+            mMechanism = Reader.Read<Mechanism>();
+            mCategory  = Reader.Read<UInt32>();
+            mCooldown.Load(Reader);
+            mLimit.Load(Reader);
+        }
+
+        /// \brief Saves the ability cooldown data to a baked resource.
+        ///
+        /// \param Writer The baked resource to save to.
+        ZYPHRYON_INLINE void Save(Ref<BakeWriter> Writer) const
+        {
+            Writer.Write(mInfluence);
+            Writer.Write(mMechanism);
+            Writer.Write(mCategory.GetID());
+            mCooldown.Save(Writer);
+            mLimit.Save(Writer);
+        }
+
     public:
 
         /// \brief Creates a time-based ability cooldown.
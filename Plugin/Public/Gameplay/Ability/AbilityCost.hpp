@@ -14,6 +14,10 @@
 
 #include "Gameplay/Stat/StatInput.hpp"
 
+#ifndef GAMEPLAY_MAX_ABILITY_COSTS
+    #define GAMEPLAY_MAX_ABILITY_COSTS 3
+#endif
+
 // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 // [   CODE   ]
 // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
@@ -26,7 +30,7 @@ namespace Gameplay
     public:
 
         /// \brief Maximum number of inputs an ability cost can have.
-        static constexpr UInt32 kMaxInput = 3; // TODO: Macro Configurable
+        static constexpr UInt32 kMaxInput = GAMEPLAY_MAX_ABILITY_COSTS;
 
         /// \brief Structure representing a cost input for an ability.
         struct Input
@@ -94,6 +98,24 @@ namespace Gameplay
                 Section.SetInteger("Target", Target.GetID());
                 Cost.Save(Section.SetArray("Cost"));
             }
+
+            /// \brief Loads the input data from a baked resource.
+            ///
+            /// \param Reader The baked resource to load from.
+            ZYPHRYON_INLINE void Load(Ref<BakeReader> Reader)
+            {
+                Target = Reader.Read<UInt16>();
+                Cost.Load(Reader);
+            }
+
+            /// \brief Saves the input data to a baked resource.
+            ///
+            /// \param Writer The baked resource to save to.
+            ZYPHRYON_INLINE void Save(Ref<BakeWriter> Writer) const
+            {
+                Writer.Write(Target.GetID());
+                Cost.Save(Writer);
+            }
         };
 
     public:
@@ -121,14 +143,40 @@ namespace Gameplay
         template<typename Context>
         ZYPHRYON_INLINE Bool CanAfford(ConstRef<Context> Source) const
         {
-            for (ConstRef<Input> Input : mInputs)
+            Array<Real32, kMaxInput> Costs;
+            return Resolve(Source, Costs);
+        }
+
+        /// \brief Resolves the cost of every input at once and checks if the source context can afford them all.
+        ///
+        /// \note Inputs that share a target are checked against their combined cost.
+        ///
+        /// \param Source The context used to evaluate the costs.
+        /// \param Costs  The resolved cost of each input, in input order.
+        /// \return `true` if the total cost can be afforded, `false` otherwise.
+        template<typename Context>
+        ZYPHRYON_INLINE Bool Resolve(ConstRef<Context> Source, Ref<Array<Real32, kMaxInput>> Costs) const
+        {
+            const UInt32 Count = mInputs.size();
+
+            for (UInt32 Index = 0; Index < Count; ++Index)
+            {
+                Costs[Index] = mInputs[Index].Cost.Resolve(Source);
+            }
+
+            Bool Affordable = true;
+
+            for (UInt32 Index = 0; Index < Count; ++Index)
             {
-                if (!Input.CanAfford(Source))
+                Real32 Total = 0.0f;
+
+                for (UInt32 Other = 0; Other < Count; ++Other)
                 {
-                    return false;
+                    Total += (mInputs[Other].Target == mInputs[Index].Target ? Costs[Other] : 0.0f);
                 }
+                Affordable = Affordable && Source.GetStat(mInputs[Index].Target) >= Total;
             }
-            return true;
+            return Affordable;
         }
 
         /// \brief Traverses all inputs, applying the provided action to each component.
@@ -165,6 +213,30 @@ namespace Gameplay
             }
         }
 
+        /// \brief Loads the ability cost data from a baked resource.
+        ///
+        /// \param Reader The baked resource to load from.
+        ZYPHRYON_INLINE void Load(Ref<BakeReader> Reader)
+        {
+            for (UInt8 Element = 0, Count = Reader.Read<UInt8>(); Element < Count; ++Element)
+            {
+                mInputs.emplace_back().Load(Reader);
+            }
+        }
+
+        /// \brief Saves the ability cost data to a baked resource.
+        ///
+        /// \param Writer The baked resource to save to.
+        ZYPHRYON_INLINE void Save(Ref<BakeWriter> Writer) const
+        {
+            Writer.Write(static_cast<UInt8>(mInputs.size()));
+
+            for (ConstRef<Input> Input : mInputs)
+            {
+                Input.Save(Writer);
+            }
+        }
+
     private:
 
         // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
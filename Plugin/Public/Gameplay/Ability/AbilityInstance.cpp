@@ -10,4 +10,48 @@
 // [  HEADER  ]
 // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 
-#include "Gameplay/Ability/AbilityInstance.hpp"
\ No newline at end of file
+#include "Gameplay/Ability/AbilityInstance.hpp"
+#include "Gameplay/Ability/AbilityRepository.hpp"
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [   CODE   ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+namespace Gameplay
+{
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void AbilityInstance::Load(Ref<BakeReader> Reader)
+    {
+        const UInt16 Archetype = Reader.Read<UInt16>();
+
+        mTime    = Reader.Read<Real64>();
+        mReady   = Reader.Read<Real64>();
+        mCharges = Reader.Read<UInt16>();
+        mToggled = Reader.Read<Bool>();
+
+        ConstRef<AbilityRepository> Repository = AbilityRepository::View();
+
+        if (Reader.IsValid() && Archetype < AbilityRepository::kMaxArchetypes && Repository.Get(Archetype).IsValid())
+        {
+            mArchetype = & Repository.Get(Archetype);
+        }
+        else
+        {
+            mArchetype = nullptr;
+        }
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void AbilityInstance::Save(Ref<BakeWriter> Writer) const
+    {
+        Writer.Write(mArchetype->GetHandle().GetID());
+        Writer.Write(mTime);
+        Writer.Write(mReady);
+        Writer.Write(mCharges);
+        Writer.Write(mToggled);
+    }
+}
\ No newline at end of file
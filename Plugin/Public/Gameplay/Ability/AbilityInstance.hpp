@@ -28,7 +28,10 @@ namespace Gameplay
         /// \brief Constructs an ability instance with default values.
         ZYPHRYON_INLINE AbilityInstance()
             : mArchetype { nullptr },
-              mTime      { 0.0 }
+              mTime      { 0.0 },
+              mReady     { 0.0 },
+              mCharges   { kFull },
+              mToggled   { false }
         {
         }
 
@@ -37,7 +40,10 @@ namespace Gameplay
         /// \param Archetype The archetype defining the ability's properties.
         ZYPHRYON_INLINE explicit AbilityInstance(ConstRef<AbilityArchetype> Archetype)
             : mArchetype { & Archetype },
-              mTime      { 0.0 }
+              mTime      { 0.0 },
+              mReady     { 0.0 },
+              mCharges   { kFull },
+              mToggled   { false }
         {
         }
 
@@ -65,6 +71,137 @@ namespace Gameplay
             return mTime;
         }
 
+        /// \brief Sets whether a toggle ability is switched on.
+        ///
+        /// \param Toggled `true` to switch the ability on, `false` to switch it off.
+        ZYPHRYON_INLINE void SetToggled(Bool Toggled)
+        {
+            mToggled = Toggled;
+        }
+
+        /// \brief Checks if a toggle ability is switched on.
+        ///
+        /// \return `true` if the ability is switched on, `false` otherwise.
+        ZYPHRYON_INLINE Bool IsToggled() const
+        {
+            return mToggled;
+        }
+
+        /// \brief Checks if the ability contributes its bonuses continuously, such as a passive or a toggle switched on.
+        ///
+        /// \return `true` if the bonuses of the ability should be aggregated into the stats, `false` otherwise.
+        ZYPHRYON_INLINE Bool IsSustained() const
+        {
+            return mArchetype->GetKind() == AbilityKind::Passive || (mArchetype->GetKind() == AbilityKind::Toggle && mToggled);
+        }
+
+        /// \brief Retrieves the time at which the cooldown ends, or the next charge is restored.
+        ///
+        /// \return The timestamp at which the ability becomes ready.
+        ZYPHRYON_INLINE Real64 GetReady() const
+        {
+            return mReady;
+        }
+
+        /// \brief Retrieves the number of uses available at the given time.
+        ///
+        /// \note Charges are derived from the last spend and the recharge period, nothing is ticked in between.
+        ///
+        /// \param Source    The context used to resolve the cooldown inputs.
+        /// \param Timestamp The current timestamp.
+        /// \return The number of charges available, or `1` for a timer cooldown that has elapsed.
+        template<typename Context>
+        ZYPHRYON_INLINE UInt32 GetCharges(ConstRef<Context> Source, Real64 Timestamp) const
+        {
+            ConstRef<AbilityCooldown> Cooldown = mArchetype->GetCooldown();
+
+            if (Cooldown.GetMechanism() == AbilityCooldown::Mechanism::Timer)
+            {
+                return Timestamp >= mReady ? 1 : 0;
+            }
+
+            UInt32 Charges;
+            Real64 Ready;
+            Recover(Source, Timestamp, Charges, Ready);
+            return Charges;
+        }
+
+        /// \brief Retrieves the time at which the next use becomes available.
+        ///
+        /// \param Source    The context used to resolve the cooldown inputs.
+        /// \param Timestamp The current timestamp.
+        /// \return The timestamp of the end of the cooldown or of the next charge, or infinity if every charge is held.
+        template<typename Context>
+        ZYPHRYON_INLINE Real64 GetNextReady(ConstRef<Context> Source, Real64 Timestamp) const
+        {
+            ConstRef<AbilityCooldown> Cooldown = mArchetype->GetCooldown();
+
+            if (Cooldown.GetMechanism() == AbilityCooldown::Mechanism::Timer)
+            {
+                return mReady;
+            }
+
+            UInt32 Charges;
+            Real64 Ready;
+            Recover(Source, Timestamp, Charges, Ready);
+            return Charges < static_cast<UInt32>(Cooldown.GetLimit().Resolve(Source)) ? Ready : kInfinity<Real64>;
+        }
+
+        /// \brief Checks if the ability is off cooldown or has a charge left.
+        ///
+        /// \param Source    The context used to resolve the cooldown inputs.
+        /// \param Timestamp The current timestamp.
+        /// \return `true` if the ability can be used, `false` otherwise.
+        template<typename Context>
+        ZYPHRYON_INLINE Bool IsReady(ConstRef<Context> Source, Real64 Timestamp) const
+        {
+            return GetCharges(Source, Timestamp) > 0;
+        }
+
+        /// \brief Starts the cooldown of the ability, or spends one of its charges.
+        ///
+        /// \note The ability must be ready, see `IsReady`.
+        ///
+        /// \param Source    The context used to resolve the cooldown inputs.
+        /// \param Timestamp The current timestamp.
+        template<typename Context>
+        ZYPHRYON_INLINE void Trigger(ConstRef<Context> Source, Real64 Timestamp)
+        {
+            ConstRef<AbilityCooldown> Cooldown = mArchetype->GetCooldown();
+
+            const Real32 Period = Cooldown.GetCooldown().Resolve(Source);
+
+            if (Cooldown.GetMechanism() == AbilityCooldown::Mechanism::Timer)
+            {
+                mReady = Timestamp + Period;
+            }
+            else
+            {
+                UInt32 Charges;
+                Recover(Source, Timestamp, Charges, mReady);
+
+                // The recharge starts with the first charge spent, a partial recharge keeps its progress.
+                if (Charges == static_cast<UInt32>(Cooldown.GetLimit().Resolve(Source)))
+                {
+                    mReady = Timestamp + Period;
+                }
+                mCharges = Charges - 1;
+            }
+            mTime = Timestamp;
+        }
+
+        /// \brief Loads the ability instance from a baked snapshot, resolving its archetype by handle.
+        ///
+        /// \note The archetype is left unset if it is no longer registered.
+        ///
+        /// \param Reader The baked snapshot to load from.
+        void Load(Ref<BakeReader> Reader);
+
+        /// \brief Saves the ability instance to a baked snapshot.
+        ///
+        /// \param Writer The baked snapshot to save to.
+        void Save(Ref<BakeWriter> Writer) const;
+
         /// \brief Checks equality between the ability instance and an ability handle.
         ///
         /// \param Handle The ability handle to compare with.
@@ -91,7 +228,46 @@ namespace Gameplay
             return mArchetype->Hash();
         }
 
-        // TODO: Activation / Resource Management / Etc
+    private:
+
+        /// \brief Computes the charges held at the given time from the last settled state, in constant time.
+        ///
+        /// \param Source    The context used to resolve the cooldown inputs.
+        /// \param Timestamp The current timestamp.
+        /// \param Charges   Receives the number of charges held.
+        /// \param Ready     Receives the time at which the next charge is restored.
+        template<typename Context>
+        ZYPHRYON_INLINE void Recover(ConstRef<Context> Source, Real64 Timestamp, Ref<UInt32> Charges, Ref<Real64> Ready) const
+        {
+            ConstRef<AbilityCooldown> Cooldown = mArchetype->GetCooldown();
+
+            const UInt32 Limit = static_cast<UInt32>(Cooldown.GetLimit().Resolve(Source));
+
+            Charges = Min<UInt32>(mCharges, Limit);
+            Ready   = mReady;
+
+            if (Charges >= Limit || Timestamp < Ready)
+            {
+                return;
+            }
+
+            if (const Real64 Period = Cooldown.GetCooldown().Resolve(Source); Period > 0.0)
+            {
+                const Real64 Recovered = Min<Real64>(1.0 + std::floor((Timestamp - Ready) / Period), Limit - Charges);
+
+                Charges += static_cast<UInt32>(Recovered);
+                Ready   += Recovered * Period;
+            }
+            else
+            {
+                Charges = Limit;
+            }
+        }
+
+    private:
+
+        /// \brief Sentinel charge count of an ability that has never been used, clamped to its limit on first use.
+        static constexpr UInt16 kFull = 0xFFFF;
 
     private:
 
@@ -100,6 +276,8 @@ namespace Gameplay
 
         ConstPtr<AbilityArchetype> mArchetype;
         Real64                     mTime;
-        // TODO: Charges?
+        Real64                     mReady;
+        UInt16                     mCharges;
+        Bool                       mToggled;
     };
 }
\ No newline at end of file
@@ -23,6 +23,8 @@ namespace Gameplay
 
     void AbilityRepository::Load(Ref<TOMLParser> Parser)
     {
+        LOG_ASSERT(!mFrozen, "Cannot modify the ability repository while it is frozen.");
+
         const TOMLArray Root = Parser.GetArray("Ability");
 
         for (UInt32 Element = 0; Element < Root.GetSize(); ++Element)
@@ -48,4 +50,80 @@ namespace Gameplay
             }
         }
     }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void AbilityRepository::Load(Ref<BakeReader> Reader)
+    {
+        LOG_ASSERT(!mFrozen, "Cannot modify the ability repository while it is frozen.");
+
+        if (!Reader.Open(BakeKind::Ability))
+        {
+            return;
+        }
+
+        for (UInt32 Element = 0, Count = BakeStream::Skip(Reader); Element < Count && Reader.IsValid(); ++Element)
+        {
+            mArchetypes.Acquire(Reader.Peek<UInt16>(), Reader);
+        }
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void AbilityRepository::Save(Ref<BakeWriter> Writer) const
+    {
+        BakeStream::Write(Writer, GetAll());
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Bool AbilityRepository::Stream(AnyRef<Blob> Data)
+    {
+        LOG_ASSERT(!mFrozen, "Cannot modify the ability repository while it is frozen.");
+
+        mArchetypes.Clear();
+
+        if (!mStream.Open(Move(Data), BakeKind::Ability, kMaxArchetypes))
+        {
+            LOG_WARNING("Failed to stream ability archetypes.");
+            return false;
+        }
+        return true;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void AbilityRepository::Recompile()
+    {
+        const UInt32 Generation = TokenRepository::View().GetGeneration();
+
+        if (Generation == mGeneration)
+        {
+            return;
+        }
+
+        for (Ref<AbilityArchetype> Archetype : mArchetypes.GetSpan())
+        {
+            if (Archetype.IsValid())
+            {
+                Archetype.Compile();
+            }
+        }
+        mGeneration = Generation;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void AbilityRepository::Measure(Ref<MemoryUsage> Usage) const
+    {
+        constexpr ConstStr8 kOwner = "AbilityRepository";
+
+        Usage.RecordBlock(kOwner, "Archetypes", mArchetypes, mArchetypes.GetSpan().size() * sizeof(AbilityArchetype));
+        mStream.Measure(Usage, kOwner);
+    }
 }
\ No newline at end of file
@@ -13,6 +13,12 @@
 // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 
 #include "Gameplay/Ability/AbilityArchetype.hpp"
+#include "Gameplay/Arsenal/GameplayContext.hpp"
+#include "Gameplay/Bake/BakeStream.hpp"
+
+#ifndef GAMEPLAY_MAX_ABILITY_ARCHETYPES
+    #define GAMEPLAY_MAX_ABILITY_ARCHETYPES 1'024
+#endif
 
 // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 // [   CODE   ]
@@ -21,12 +27,15 @@
 namespace Gameplay
 {
     /// \brief Manages a registry of ability archetypes, allowing loading and saving from/to TOML resources.
+    ///
+    /// Archetypes are either loaded up front, or streamed from a baked resource, in which case each one is read into
+    /// its slot the first time it is retrieved, and can be pinned by zones and evicted once no zone uses it.
     class AbilityRepository final
     {
     public:
 
         /// \brief Maximum number of ability archetypes that can be registered.
-        static constexpr UInt32 kMaxArchetypes = 1'024;  // TODO: Macro Configurable
+        static constexpr UInt32 kMaxArchetypes = GAMEPLAY_MAX_ABILITY_ARCHETYPES;
 
     public:
 
@@ -35,6 +44,8 @@ namespace Gameplay
         /// \return A reference to the newly allocated ability archetype.
         ZYPHRYON_INLINE Ref<AbilityArchetype> Allocate()
         {
+            LOG_ASSERT(!mFrozen, "Cannot modify the ability repository while it is frozen.");
+
             const Ability Handle = mArchetypes.Allocate();
 
             Ref<AbilityArchetype> Archetype = mArchetypes[Handle.GetID()];
@@ -42,11 +53,23 @@ namespace Gameplay
             return Archetype;
         }
 
+        /// \brief Inserts a parsed ability archetype into the slot of its handle.
+        ///
+        /// \param Archetype The ability archetype to insert.
+        ZYPHRYON_INLINE void Insert(AnyRef<AbilityArchetype> Archetype)
+        {
+            LOG_ASSERT(!mFrozen, "Cannot modify the ability repository while it is frozen.");
+            LOG_ASSERT(Archetype.GetHandle().IsValid(), "Cannot insert an ability archetype with an invalid handle.");
+
+            mArchetypes.Acquire(Archetype.GetHandle().GetID(), Move(Archetype));
+        }
+
         /// \brief Deletes a ability archetype from the repository.
         ///
         /// \param Archetype The ability archetype to delete.
         ZYPHRYON_INLINE void Delete(ConstRef<AbilityArchetype> Archetype)
         {
+            LOG_ASSERT(!mFrozen, "Cannot modify the ability repository while it is frozen.");
             LOG_ASSERT(Archetype.GetHandle().IsValid(), "Cannot delete an ability archetype with an invalid handle.");
 
             mArchetypes.Free(Archetype.GetHandle().GetID());
@@ -55,7 +78,40 @@ namespace Gameplay
         /// \brief Clears all ability archetypes from the repository.
         ZYPHRYON_INLINE void Clear()
         {
+            LOG_ASSERT(!mFrozen, "Cannot modify the ability repository while it is frozen.");
+
             mArchetypes.Clear();
+            mStream.Close();
+        }
+
+        /// \brief Freezes the repository, so it can be read from any thread without synchronization.
+        ///
+        /// \note While frozen, the repository cannot be modified until thawed, which must happen between ticks, when no
+        ///       other thread is reading.
+        ZYPHRYON_INLINE void Freeze()
+        {
+            Recompile();
+            mFrozen = true;
+        }
+
+        /// \brief Compiles the token queries of every archetype again if the token hierarchy was rebuilt since.
+        ///
+        /// \note Archetypes compile their queries when loaded, so registering tokens afterwards leaves them testing
+        ///       stale indices. Freezing recompiles them, otherwise this must be called once tokens are registered.
+        void Recompile();
+
+        /// \brief Thaws the repository, allowing it to be modified again.
+        ZYPHRYON_INLINE void Thaw()
+        {
+            mFrozen = false;
+        }
+
+        /// \brief Checks if the repository is frozen.
+        ///
+        /// \return `true` if the repository is read-only, `false` otherwise.
+        ZYPHRYON_INLINE Bool IsFrozen() const
+        {
+            return mFrozen;
         }
 
         /// \brief Retrieves an ability archetype by its handle.
@@ -64,9 +120,64 @@ namespace Gameplay
         /// \return The ability archetype associated with the given handle.
         ZYPHRYON_INLINE ConstRef<AbilityArchetype> Get(Ability Handle) const
         {
+            if (const UInt32 ID = Handle.GetID(); mStream.IsPending(ID))
+            {
+                mStream.Fault(ID, [this, ID](Ref<BakeReader> Reader)
+                {
+                    mArchetypes.Acquire(ID, Reader);
+                });
+            }
             return mArchetypes[Handle.GetID()];
         }
 
+        /// \brief Streams ability archetypes from a baked resource, replacing the archetypes of the repository.
+        ///
+        /// \note Only the index of the resource is read, archetypes are faulted in by `Get` on first use, from any
+        ///       thread. `GetAll` only covers the archetypes faulted in so far.
+        ///
+        /// \param Data The baked resource to stream from, kept alive while streaming.
+        /// \return `true` if the resource was opened, `false` if it is invalid and the repository was left empty.
+        Bool Stream(AnyRef<Blob> Data);
+
+        /// \brief Pins an ability archetype for a zone, faulting it in if needed, so eviction keeps it resident.
+        ///
+        /// \note Must be called at a sync point, where no other thread is reading.
+        ///
+        /// \param Zone   The zone pinning the archetype.
+        /// \param Handle The handle of the archetype to pin.
+        ZYPHRYON_INLINE void Acquire(UInt32 Zone, Ability Handle)
+        {
+            const UInt32 ID = Handle.GetID();
+
+            mStream.Acquire(Zone, ID, [this, ID](Ref<BakeReader> Reader)
+            {
+                mArchetypes.Acquire(ID, Reader);
+            });
+        }
+
+        /// \brief Drops every pin held by a zone, such as when the zone is unloaded.
+        ///
+        /// \note Must be called at a sync point, where no other thread is reading.
+        ///
+        /// \param Zone The zone to release.
+        ZYPHRYON_INLINE void Release(UInt32 Zone)
+        {
+            mStream.Release(Zone);
+        }
+
+        /// \brief Unloads every streamed archetype that no zone pins.
+        ///
+        /// \note Must be called at a sync point, once no live instance refers to an unpinned archetype.
+        ///
+        /// \return The number of archetypes unloaded.
+        ZYPHRYON_INLINE UInt32 Evict()
+        {
+            return mStream.Evict([this](UInt32 ID)
+            {
+                mArchetypes.Free(ID);
+            });
+        }
+
         /// \brief Retrieves all registered ability archetypes.
         ///
         /// \return A span containing all stat archetypes.
@@ -85,22 +196,47 @@ namespace Gameplay
         /// \param Parser The TOML resource to save ability archetype definitions into.
         void Save(Ref<TOMLParser> Parser) const;
 
+        /// \brief Loads ability archetypes from a baked resource.
+        ///
+        /// \param Reader The baked resource containing ability archetype definitions.
+        void Load(Ref<BakeReader> Reader);
+
+        /// \brief Saves ability archetypes to a baked resource.
+        ///
+        /// \param Writer The baked resource to save ability archetype definitions into.
+        void Save(Ref<BakeWriter> Writer) const;
+
     public:
 
-        /// \brief Retrieves the singleton instance of the repository.
+        /// \brief Retrieves the repository of the context current on the calling thread.
         ///
-        /// \return A reference to the singleton repository instance.
-        static Ref<AbilityRepository> Instance()
+        /// \return A reference to the repository of the current context.
+        ZYPHRYON_INLINE static Ref<AbilityRepository> Instance()
         {
-            static AbilityRepository Singleton;
-            return Singleton;
+            return GameplayContext::Current().GetAbilities();
         }
 
+        /// \brief Retrieves the read-only view of the repository, safe to share between threads once frozen.
+        ///
+        /// \return A constant reference to the singleton repository instance.
+        ZYPHRYON_INLINE static ConstRef<AbilityRepository> View()
+        {
+            return Instance();
+        }
+
+        /// \brief Records the memory held by the repository.
+        ///
+        /// \param Usage The report receiving the usage.
+        void Measure(Ref<MemoryUsage> Usage) const;
+
     private:
 
         // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
         // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 
-        Pool<AbilityArchetype, kMaxArchetypes> mArchetypes;
+        mutable Pool<AbilityArchetype, kMaxArchetypes> mArchetypes;
+        mutable BakeStream                             mStream;
+        Bool                                           mFrozen = false;
+        UInt32                                         mGeneration = 0;
     };
 }
\ No newline at end of file
@@ -10,4 +10,100 @@
 // [  HEADER  ]
 // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 
-#include "Gameplay/Ability/AbilitySet.hpp"
\ No newline at end of file
+#include "Gameplay/Ability/AbilitySet.hpp"
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [   CODE   ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+namespace Gameplay
+{
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void AbilitySet::Load(Ref<BakeReader> Reader)
+    {
+        ConstRef<TokenRepository> Repository = TokenRepository::View();
+
+        Clear();
+
+        for (UInt32 Element = 0, Count = Reader.Read<UInt32>(); Element < Count && Reader.IsValid(); ++Element)
+        {
+            AbilityInstance Instance;
+            Instance.Load(Reader);
+
+            if (const ConstPtr<AbilityArchetype> Archetype = Instance.GetArchetype())
+            {
+                mInstances.push_back(Instance);
+                mSlots[Archetype->GetHandle().GetID()] = mInstances.size();
+            }
+            else
+            {
+                LOG_WARNING("Discarding snapshot of an ability with an unknown archetype.");
+            }
+        }
+
+        // Categories are stored by token handle, their dense index may differ after a rebuild.
+        for (UInt32 Element = 0, Count = Reader.Read<UInt32>(); Element < Count && Reader.IsValid(); ++Element)
+        {
+            const Token  Category = Reader.Read<UInt32>();
+            const Real64 Ready    = Reader.Read<Real64>();
+
+            if (const UInt16 Index = Repository.GetIndex(Category); Index != 0)
+            {
+                mCategories[Index] = Ready;
+            }
+        }
+
+        for (UInt32 Element = 0, Count = Reader.Read<UInt32>(); Element < Count && Reader.IsValid(); ++Element)
+        {
+            const Stat Handle = Reader.Read<UInt16>();
+            mContributions[Handle] = Reader.Read<Contribution>();
+        }
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void AbilitySet::Save(Ref<BakeWriter> Writer) const
+    {
+        ConstRef<TokenRepository> Repository = TokenRepository::View();
+
+        Writer.Write(static_cast<UInt32>(mInstances.size()));
+
+        for (ConstRef<AbilityInstance> Instance : mInstances)
+        {
+            Instance.Save(Writer);
+        }
+
+        Writer.Write(static_cast<UInt32>(mCategories.size()));
+
+        for (const auto & [Index, Ready] : mCategories)
+        {
+            Writer.Write(Repository.GetByIndex(Index).GetID());
+            Writer.Write(Ready);
+        }
+
+        Writer.Write(static_cast<UInt32>(mContributions.size()));
+
+        for (const auto & [Handle, Total] : mContributions)
+        {
+            Writer.Write(Handle.GetID());
+            Writer.Write(Total);
+        }
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void AbilitySet::Measure(Ref<MemoryUsage> Usage) const
+    {
+        constexpr ConstStr8 kOwner = "AbilitySet";
+
+        Usage.RecordVector(kOwner, "Instances", mInstances);
+        Usage.RecordBlock(kOwner, "Slots", mSlots, mInstances.size() * sizeof(UInt16));
+        Usage.RecordTable(kOwner, "Categories", mCategories);
+        Usage.RecordTable(kOwner, "Contributions", mContributions);
+        Usage.RecordVector(kOwner, "Channels", mChannels);
+    }
+}
\ No newline at end of file
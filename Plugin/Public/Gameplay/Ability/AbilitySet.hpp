@@ -12,7 +12,11 @@
 // [  HEADER  ]
 // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 
+#include "Gameplay/Ability/AbilityChannel.hpp"
 #include "Gameplay/Ability/AbilityInstance.hpp"
+#include "Gameplay/Ability/AbilityRepository.hpp"
+#include "Gameplay/Arsenal/MemoryUsage.hpp"
+#include "Gameplay/Token/TokenRepository.hpp"
 
 // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 // [   CODE   ]
@@ -21,24 +25,102 @@
 namespace Gameplay
 {
     /// \brief Manages a collection of ability instances.
+    ///
+    /// Instances are kept packed in a dense array, with a table from ability identifier to slot, so granting,
+    /// revoking and looking up an ability are constant time and traversals scan contiguous memory.
+    ///
+    /// Cooldowns shared by a category are tracked once per category, keyed by the dense index of its token, so
+    /// checking or starting them never scans the abilities of the set.
     class AbilitySet final
     {
     public:
 
+        /// \brief Maximum number of abilities held by a set, one slot per ability archetype.
+        static constexpr UInt32 kCapacity = AbilityRepository::kMaxArchetypes;
+
+        /// \brief Represents the combined contribution of sustained abilities to a single stat.
+        struct Contribution final
+        {
+            /// \brief The sum of the flat modifiers.
+            Real32 Flat       = 0.0f;
+
+            /// \brief The sum of the percentage modifiers.
+            Real32 Additive   = 0.0f;
+
+            /// \brief The product of the scale modifiers.
+            Real32 Multiplier = 1.0f;
+
+            /// \brief Folds a modifier into the contribution.
+            ///
+            /// \param Operation The operation of the modifier, `StatOp::Set` cannot be aggregated and is ignored.
+            /// \param Magnitude The magnitude of the modifier.
+            ZYPHRYON_INLINE void Accumulate(StatOp Operation, Real32 Magnitude)
+            {
+                switch (Operation)
+                {
+                case StatOp::Add:
+                    Flat += Magnitude;
+                    break;
+                case StatOp::Percent:
+                    Additive += Magnitude;
+                    break;
+                case StatOp::Scale:
+                    Multiplier *= Magnitude;
+                    break;
+                case StatOp::Set:
+                    LOG_WARNING("Set modifiers of sustained abilities cannot be aggregated and are ignored.");
+                    break;
+                }
+            }
+        };
+
+    public:
+
+        /// \brief Default constructor, initializes an empty set.
+        ZYPHRYON_INLINE AbilitySet()
+            : mSlots { }
+        {
+        }
+
         /// \brief Inserts a new ability archetype into the set.
         ///
+        /// \note Inserting an ability that is already present keeps its current state.
+        ///
         /// \param Archetype The ability archetype to insert.
         ZYPHRYON_INLINE void Insert(ConstRef<AbilityArchetype> Archetype)
         {
-            mRegistry.emplace(Archetype);
+            if (Ref<UInt16> Slot = mSlots[Archetype.GetHandle().GetID()]; Slot == 0)
+            {
+                mInstances.emplace_back(Archetype);
+                Slot = mInstances.size();
+            }
         }
 
         /// \brief Removes an ability from the set by its handle.
         ///
+        /// \note The order of the remaining abilities is not preserved.
+        ///
         /// \param Handle The handle of the ability to remove.
         ZYPHRYON_INLINE void Remove(Ability Handle)
         {
-            mRegistry.erase(Handle);
+            Ref<UInt16> Slot = mSlots[Handle.GetID()];
+
+            if (Slot == 0)
+            {
+                return;
+            }
+
+            // Move the last instance into the vacated slot.
+            if (Slot != mInstances.size())
+            {
+                Ref<AbilityInstance> Last = mInstances.back();
+
+                mSlots[Last.GetArchetype()->GetHandle().GetID()] = Slot;
+                mInstances[Slot - 1] = Last;
+            }
+
+            mInstances.pop_back();
+            Slot = 0;
         }
 
         /// \brief Attempts to retrieve an ability by its handle.
@@ -47,26 +129,216 @@ namespace Gameplay
         /// \return A pointer to the ability if found, otherwise nullptr.
         ZYPHRYON_INLINE Ptr<AbilityInstance> TryGet(Ability Handle)
         {
-            if (const auto Iterator = mRegistry.find(Handle); Iterator != mRegistry.end())
+            const UInt16 Slot = mSlots[Handle.GetID()];
+            return Slot ? & mInstances[Slot - 1] : nullptr;
+        }
+
+        /// \brief Attempts to retrieve an ability by its handle.
+        ///
+        /// \param Handle The handle of the ability to retrieve.
+        /// \return A pointer to the ability if found, otherwise nullptr.
+        ZYPHRYON_INLINE ConstPtr<AbilityInstance> TryGet(Ability Handle) const
+        {
+            const UInt16 Slot = mSlots[Handle.GetID()];
+            return Slot ? & mInstances[Slot - 1] : nullptr;
+        }
+
+        /// \brief Checks if the cooldown shared by a category has elapsed.
+        ///
+        /// \param Category  The category token of the cooldown.
+        /// \param Timestamp The current timestamp.
+        /// \return `true` if no cooldown of the category is running, `false` otherwise.
+        ZYPHRYON_INLINE Bool IsReady(Token Category, Real64 Timestamp) const
+        {
+            return Timestamp >= GetReady(Category);
+        }
+
+        /// \brief Retrieves the time at which the cooldown shared by a category ends.
+        ///
+        /// \param Category The category token of the cooldown.
+        /// \return The timestamp at which the category becomes ready, or `0` if it never went on cooldown.
+        ZYPHRYON_INLINE Real64 GetReady(Token Category) const
+        {
+            const auto Iterator = mCategories.find(TokenRepository::View().GetIndex(Category));
+            return Iterator != mCategories.end() ? Iterator->second : 0.0;
+        }
+
+        /// \brief Starts the cooldown shared by a category, extending any cooldown already running.
+        ///
+        /// \param Category The category token of the cooldown.
+        /// \param Ready    The timestamp at which the category becomes ready.
+        ZYPHRYON_INLINE void Trigger(Token Category, Real64 Ready)
+        {
+            Ref<Real64> Current = mCategories[TokenRepository::View().GetIndex(Category)];
+            Current = Max(Current, Ready);
+        }
+
+        /// \brief Replaces the contributions applied by sustained abilities.
+        ///
+        /// \param Contributions The new contributions, keyed by stat.
+        /// \return The contributions that were applied until now.
+        ZYPHRYON_INLINE Table<Stat, Contribution> Exchange(AnyRef<Table<Stat, Contribution>> Contributions)
+        {
+            return std::exchange(mContributions, Move(Contributions));
+        }
+
+        /// \brief Retrieves the contributions applied by sustained abilities.
+        ///
+        /// \return The contributions, keyed by stat.
+        ZYPHRYON_INLINE ConstRef<Table<Stat, Contribution>> GetContributions() const
+        {
+            return mContributions;
+        }
+
+        /// \brief Starts the channeled script of an ability, interrupting any script the ability is running.
+        ///
+        /// \note The script runs up to its first suspension before this call returns.
+        ///
+        /// \param Handle    The handle of the ability being channeled.
+        /// \param Script    The script to run.
+        /// \param Source    The arsenal running the script, used to evaluate its conditions.
+        /// \param Timestamp The current timestamp.
+        template<typename Context>
+        ZYPHRYON_INLINE void Channel(Ability Handle, AnyRef<AbilityChannel> Script, Ref<Context> Source, Real64 Timestamp)
+        {
+            Interrupt(Handle);
+
+            Script.SetAbility(Handle);
+            mChannels.push_back(Move(Script));
+
+            // Resume by index, the script may start other channels and grow the vector under it.
+            mChannels[mChannels.size() - 1].Resume(Source, Timestamp);
+        }
+
+        /// \brief Interrupts the channeled script of an ability.
+        ///
+        /// \param Handle The handle of the ability.
+        /// \return `true` if the ability was channeling, `false` otherwise.
+        ZYPHRYON_INLINE Bool Interrupt(Ability Handle)
+        {
+            Bool Interrupted = false;
+
+            for (Ref<AbilityChannel> Channel : mChannels)
+            {
+                if (Channel.GetAbility() == Handle && !Channel.IsDone())
+                {
+                    Channel.Cancel();
+                    Interrupted = true;
+                }
+            }
+            return Interrupted;
+        }
+
+        /// \brief Checks if an ability is running a channeled script.
+        ///
+        /// \param Handle The handle of the ability.
+        /// \return `true` if the ability is channeling, `false` otherwise.
+        ZYPHRYON_INLINE Bool IsChanneling(Ability Handle) const
+        {
+            return std::ranges::any_of(mChannels, [Handle](ConstRef<AbilityChannel> Channel)
+            {
+                return Channel.GetAbility() == Handle && !Channel.IsDone();
+            });
+        }
+
+        /// \brief Checks if any channeled script is held by the set, including finished ones not yet reclaimed.
+        ///
+        /// \return `true` if the set holds channels, `false` otherwise.
+        ZYPHRYON_INLINE Bool HasChannels() const
+        {
+            return !mChannels.empty();
+        }
+
+        /// \brief Retrieves the earliest time at which a channeled script resumes regardless of its condition.
+        ///
+        /// \return The earliest deadline, or infinity if no script is waiting on one.
+        ZYPHRYON_INLINE Real64 GetDeadline() const
+        {
+            Real64 Deadline = kInfinity<Real64>;
+
+            for (ConstRef<AbilityChannel> Channel : mChannels)
+            {
+                Deadline = Min(Deadline, Channel.GetDeadline());
+            }
+            return Deadline;
+        }
+
+        /// \brief Resumes every channeled script whose condition is met or deadline has passed.
+        ///
+        /// \note Channels started while resuming have already run up to their first suspension and are left for
+        ///       the next call.
+        ///
+        /// \param Source    The arsenal running the scripts, used to evaluate their conditions.
+        /// \param Timestamp The current timestamp.
+        template<typename Context>
+        ZYPHRYON_INLINE void Resume(Ref<Context> Source, Real64 Timestamp)
+        {
+            // A script clearing the set shrinks the vector under the loop, the channels it kept are all cancelled.
+            for (UInt32 Index = 0, Count = mChannels.size(); Index < Count && Index < mChannels.size(); ++Index)
+            {
+                if (mChannels[Index].IsDue(std::as_const(Source), Timestamp))
+                {
+                    mChannels[Index].Resume(Source, Timestamp);
+                }
+            }
+
+            // Reclaim the frames of scripts that completed or were interrupted.
+            std::erase_if(mChannels, [](ConstRef<AbilityChannel> Channel)
+            {
+                return Channel.IsDone();
+            });
+        }
+
+        /// \brief Interrupts every channeled script, releasing the frames of those not executing.
+        ///
+        /// \note A script interrupting its own set is still on the stack, its frame is kept until it suspends.
+        ZYPHRYON_INLINE void Cancel()
+        {
+            for (Ref<AbilityChannel> Channel : mChannels)
             {
-                return const_cast<Ptr<AbilityInstance>>(&*Iterator);
+                Channel.Cancel();
             }
-            return nullptr;
+
+            std::erase_if(mChannels, [](ConstRef<AbilityChannel> Channel)
+            {
+                return !Channel.IsRunning();
+            });
         }
 
-        /// \brief Clears all abilities from the set.
+        /// \brief Clears all abilities, category cooldowns, contributions and channels from the set.
         ZYPHRYON_INLINE void Clear()
         {
-            mRegistry.clear();
+            mInstances.clear();
+            mSlots.fill(0);
+            mCategories.clear();
+            mContributions.clear();
+            Cancel();
         }
 
+        /// \brief Loads the abilities of the set from a baked snapshot, replacing its current content.
+        ///
+        /// \note Contributions are restored as saved, they are expected to be part of the restored stats.
+        ///
+        /// \param Reader The baked snapshot to load from.
+        void Load(Ref<BakeReader> Reader);
+
+        /// \brief Saves the abilities of the set to a baked snapshot.
+        ///
+        /// \param Writer The baked snapshot to save to.
+        void Save(Ref<BakeWriter> Writer) const;
+
+        /// \brief Records the memory held by the set.
+        ///
+        /// \param Usage The report receiving the usage.
+        void Measure(Ref<MemoryUsage> Usage) const;
+
         /// \brief Traverses all abilities in the set and invokes the provided action for each ability.
         ///
         /// \param Action The action to invoke for each ability.
         template<typename Function>
         ZYPHRYON_INLINE void Traverse(AnyRef<Function> Action) const
         {
-            for (ConstRef<AbilityInstance> Instance : mRegistry)
+            for (ConstRef<AbilityInstance> Instance : mInstances)
             {
                 Action(Instance);
             }
@@ -77,6 +349,10 @@ namespace Gameplay
         // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
         // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 
-        Set<AbilityInstance> mRegistry;
+        Vector<AbilityInstance>   mInstances;
+        Array<UInt16, kCapacity>  mSlots;
+        Table<UInt16, Real64>     mCategories;
+        Table<Stat, Contribution> mContributions;
+        Vector<AbilityChannel>    mChannels;
     };
 }
\ No newline at end of file
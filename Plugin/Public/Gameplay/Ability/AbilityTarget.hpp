@@ -12,7 +12,7 @@
 // [  HEADER  ]
 // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 
-#include "Gameplay/Token/TokenFamily.hpp"
+#include "Gameplay/Token/TokenQuery.hpp"
 
 // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 // [   CODE   ]
@@ -65,6 +65,7 @@ namespace Gameplay
         ZYPHRYON_INLINE void SetRequirement(AnyRef<TokenFamily> Requirement)
         {
             mRequirement = Requirement;
+            Compile();
         }
 
         /// \brief Retrieves the requirement token family for this ability.
@@ -75,6 +76,22 @@ namespace Gameplay
             return mRequirement;
         }
 
+        /// \brief Compiles the requirement into its query against the current token hierarchy.
+        ///
+        /// \note Called whenever the requirement changes, and must be called again once the hierarchy is rebuilt.
+        ZYPHRYON_INLINE void Compile()
+        {
+            mQuery.Compile(mRequirement, TokenQuery::Match::All);
+        }
+
+        /// \brief Retrieves the compiled requirement, so it can be matched against many candidates at once.
+        ///
+        /// \return A query requiring every token of the requirement family.
+        ZYPHRYON_INLINE ConstRef<TokenQuery> GetQuery() const
+        {
+            return mQuery;
+        }
+
         /// \brief Loads the ability target data from a TOML section.
         ///
         /// \param Section The TOML section to load from.
@@ -82,6 +99,7 @@ namespace Gameplay
         {
             mKind = Section.GetEnum("Kind", Kind::Any);
             mRequirement.Load(Section.GetArray("Requirement"));
+            Compile();
         }
 
         /// \brief Saves the ability target data to a TOML section.
@@ -93,6 +111,25 @@ namespace Gameplay
             mRequirement.Save(Section.SetArray("Requirement"));
         }
 
+        /// \brief Loads the ability target data from a baked resource.
+        ///
+        /// \param Reader The baked resource to load from.
+        ZYPHRYON_INLINE void Load(Ref<BakeReader> Reader)
+        {
+            mKind = Reader.Read<Kind>();
+            mRequirement.Load(Reader);
+            Compile();
+        }
+
+        /// \brief Saves the ability target data to a baked resource.
+        ///
+        /// \param Writer The baked resource to save to.
+        ZYPHRYON_INLINE void Save(Ref<BakeWriter> Writer) const
+        {
+            Writer.Write(mKind);
+            mRequirement.Save(Writer);
+        }
+
     private:
 
         // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
@@ -100,5 +137,6 @@ namespace Gameplay
 
         Kind        mKind;
         TokenFamily mRequirement;
+        TokenQuery  mQuery;
     };
 }
\ No newline at end of file
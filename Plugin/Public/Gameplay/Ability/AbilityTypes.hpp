@@ -28,4 +28,15 @@ namespace Gameplay
         Toggle,     ///< Can be turned on or off by the user.
         Channeled,  ///< Requires continuous activation to maintain effects.
     };
+
+    /// \brief Enumerates the outcomes of an ability activation attempt.
+    enum class AbilityResult : UInt8
+    {
+        Success,    ///< The ability was activated.
+        Missing,    ///< The ability is not granted to the arsenal.
+        Passive,    ///< The ability cannot be activated on demand.
+        Cooldown,   ///< The ability is on cooldown or has no charges left.
+        Cost,       ///< The arsenal cannot afford the cost of the ability.
+        Target,     ///< A target does not satisfy the requirements of the ability, or none was given.
+    };
 }
\ No newline at end of file
@@ -11,7 +11,6 @@
 // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 
 #include "Gameplay/Arsenal/Arsenal.hpp"
-#include "Gameplay/Arsenal/Coordinator.hpp"
 
 // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 // [   CODE   ]
@@ -22,195 +21,1116 @@ namespace Gameplay
     // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
     // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 
-    void Arsenal::Tick(ConstRef<Time> Time)
+    Bool Arsenal::IsReady(Ability Handle, Real64 Timestamp) const
     {
-        // Poll all effects and update their state based on the current time.
-        mEffects.Poll(Time, [&](Ref<EffectInstance> Instance)
+        const GameplayContext::Scope Guard(mContext);
+
+        const ConstPtr<AbilityInstance> Instance = mAbilities ? mAbilities->TryGet(Handle) : nullptr;
+
+        if (!Instance)
         {
-            return UpdateEffect(Instance, Time.GetAbsolute());
-        });
+            return false;
+        }
+
+        ConstRef<AbilityCooldown> Cooldown = Instance->GetArchetype()->GetCooldown();
+
+        if (Cooldown.GetInfluence() == AbilityCooldown::Influence::Category)
+        {
+            if (!mAbilities->IsReady(Cooldown.GetCategory(), Timestamp))
+            {
+                return false;
+            }
+        }
+        return Instance->IsReady(* this, Timestamp);
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    AbilityResult Arsenal::TryActivate(Ability Handle, ConstSpan<Scene::Entity> Targets, Real64 Timestamp)
+    {
+        const GameplayContext::Scope Guard(mContext);
+
+        const Ptr<AbilityInstance> Instance = mAbilities ? mAbilities->TryGet(Handle) : nullptr;
+
+        if (!Instance)
+        {
+            return AbilityResult::Missing;
+        }
+
+        ConstRef<AbilityArchetype> Archetype = * Instance->GetArchetype();
+
+        if (Archetype.GetKind() == AbilityKind::Passive)
+        {
+            return AbilityResult::Passive;
+        }
+
+        // Switching a toggle off is always allowed and has no cost.
+        if (Archetype.GetKind() == AbilityKind::Toggle && Instance->IsToggled())
+        {
+            Instance->SetToggled(false);
+            RebuildContributions();
+            return AbilityResult::Success;
+        }
+
+        ConstRef<AbilityCooldown> Cooldown = Archetype.GetCooldown();
+
+        if (Cooldown.GetInfluence() == AbilityCooldown::Influence::Category)
+        {
+            if (!mAbilities->IsReady(Cooldown.GetCategory(), Timestamp))
+            {
+                return AbilityResult::Cooldown;
+            }
+        }
+
+        if (!Instance->IsReady(* this, Timestamp))
+        {
+            return AbilityResult::Cooldown;
+        }
+
+        // Resolve every cost once, reading the cached effective value of its stat.
+        Array<Real32, AbilityCost::kMaxInput> Costs;
+
+        if (!Archetype.GetCost().Resolve(* this, Costs))
+        {
+            return AbilityResult::Cost;
+        }
+
+        // Validate the targets against the requirement of the ability.
+        const AbilityTarget::Kind Kind = Archetype.GetTarget().GetKind();
+        const Bool                Self = (Kind == AbilityTarget::Kind::Self || Kind == AbilityTarget::Kind::None);
+
+        if (!Self)
+        {
+            // A targeted ability without targets would pay its cost and start its cooldown for nothing.
+            if (Targets.empty())
+            {
+                return AbilityResult::Target;
+            }
+
+            ConstRef<TokenQuery> Query = Archetype.GetTarget().GetQuery();
+
+            for (const Scene::Entity Target : Targets)
+            {
+                if (!Target.IsValid() || !Target.Get<Arsenal>().Matches(Query))
+                {
+                    return AbilityResult::Target;
+                }
+            }
+        }
+
+        // Commit the activation, every check has passed.
+        PayCost(Archetype.GetCost().GetInputs(), Costs);
+
+        Instance->Trigger(* this, Timestamp);
+
+        // Timers shared by a category are started with a single write, every ability of the category reads it.
+        if (Cooldown.GetInfluence() == AbilityCooldown::Influence::Category)
+        {
+            if (Cooldown.GetMechanism() == AbilityCooldown::Mechanism::Timer)
+            {
+                mAbilities->Trigger(Cooldown.GetCategory(), Instance->GetReady());
+            }
+        }
+
+        // Toggles contribute their bonuses while switched on, like passives.
+        if (Archetype.GetKind() == AbilityKind::Toggle)
+        {
+            Instance->SetToggled(true);
+            RebuildContributions();
+            return AbilityResult::Success;
+        }
 
-        // Poll all tokens and notify the coordinator of any changes.
-        mTokens.Poll([this](Token Handle, UInt32 Previous, UInt32 Current)
+        for (ConstRef<EffectSpec> Specification : Archetype.GetEffects())
         {
-            Coordinator::Instance().Publish(Handle, mActor, Previous, Current);
+            if (Self)
+            {
+                ApplyEffect(mActor, Specification, Timestamp);
+            }
+            else
+            {
+                ApplyEffectBatch(mActor, Specification, Targets, Timestamp);
+            }
+        }
+        return AbilityResult::Success;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void Arsenal::Prefetch(ConstRef<Time> Time)
+    {
+        const GameplayContext::Scope Guard(mContext);
+
+        if (!mEffects)
+        {
+            return;
+        }
+
+        mEffects->ForEachDue(Time.GetAbsolute(), [this](ConstRef<EffectInstance> Instance)
+        {
+            if (const UInt64 Instigator = Instance.GetInstigator(); Instigator == 0 || Instigator == mActor.GetID())
+            {
+                return;
+            }
+
+            // Resolving the source also caches it on the instance for the upcoming tick.
+            ConstRef<Arsenal> Source = GetSource(Instance);
+
+            for (ConstRef<EffectModifier> Modifier : Instance.GetArchetype()->GetBonuses())
+            {
+                if (Modifier.GetMode() == StatMode::Dynamic)
+                {
+                    Modifier.GetMagnitude().Traverse([&]<typename Type>(Type Dependency)
+                    {
+                        if constexpr (std::is_same_v<Type, Stat>)
+                        {
+                            Source.mStats.Prefetch(Dependency);
+                        }
+                    }, StatScope::Source);
+                }
+            }
         });
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Bool Arsenal::Follow(ConstRef<Coordinator::ForwardEvent> Event)
+    {
+        const GameplayContext::Scope Guard(mContext);
+
+        Bool Found = false;
+
+        if (mEffects)
+        {
+            std::as_const(* mEffects).ForEachDependent(Event.Handle, StatScope::Source, [&](ConstRef<EffectInstance> Instance)
+            {
+                Found = Found || (Instance.GetInstigator() == Event.Instigator.GetID());
+            });
+        }
+
+        if (Found)
+        {
+            mForwarded.emplace_back(Event);
+        }
+        return Found;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void Arsenal::Detach()
+    {
+        const GameplayContext::Scope Guard(mContext);
+
+        mFollowers.clear();
+        mForwarded.clear();
+
+        if (mEffects)
+        {
+            std::as_const(* mEffects).Traverse([&](ConstRef<EffectInstance> Instance)
+            {
+                UnsubscribeDependents(Instance);
+            });
+        }
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void Arsenal::ApplyModifier(Stat Handle, StatOp Operation, Real32 Magnitude, UInt32 Source)
+    {
+        const GameplayContext::Scope Guard(mContext);
+
+        const ArsenalRecorder::Scope Nesting;
+
+        if (mRecorder && Nesting.IsOutermost())
+        {
+            mRecorder->RecordModifier(ArsenalRecorder::Command::ApplyModifier, mActor, Handle, Operation, Magnitude, Source);
+        }
+
+        ConstRef<StatArchetype> Archetype = StatRepository::View().Get(Handle);
+        StatInstance            Instance  = mStats.GetOrInsert(* this, Archetype);
+
+        // Notify dependencies only if the stat was successfully published.
+        if (mStats.Publish(Handle, Instance.GetEffective(* this)))
+        {
+            NotifyDependencies(Handle);
+        }
+
+        // Apply the modifier to the stat instance, or record it in the ledger of an aggregated attribute.
+        if (Archetype.IsAggregated())
+        {
+            mStats.Aggregate(* this, Instance, [&](Ref<StatLedger> Ledger)
+            {
+                Ledger.Insert(Source, Operation, Magnitude);
+            });
+        }
+        else
+        {
+            Instance.Apply(* this, Operation, Magnitude);
+        }
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void Arsenal::PayCost(ConstSpan<AbilityCost::Input> Inputs, ConstRef<Array<Real32, AbilityCost::kMaxInput>> Costs)
+    {
+        Vector<Stat, AbilityCost::kMaxInput> Published;
+
+        // Record the value of every target before any is spent, so their dependents are notified together.
+        for (ConstRef<AbilityCost::Input> Input : Inputs)
+        {
+            StatInstance Instance = mStats.GetOrInsert(* this, StatRepository::View().Get(Input.Target));
+
+            if (mStats.Publish(Input.Target, Instance.GetEffective(* this)))
+            {
+                Published.emplace_back(Input.Target);
+            }
+        }
+
+        if (!Published.empty())
+        {
+            NotifyDependencies(ConstSpan<Stat>(Published));
+        }
+
+        // Abilities are not recorded, their costs are logged as the untracked modifiers they amount to.
+        const ArsenalRecorder::Scope Nesting;
+
+        // Deduct every cost, aggregated attributes record it in their ledger like any untracked modifier.
+        for (UInt32 Index = 0; Index < Inputs.size(); ++Index)
+        {
+            if (mRecorder && Nesting.IsOutermost())
+            {
+                mRecorder->RecordModifier(ArsenalRecorder::Command::ApplyModifier, mActor, Inputs[Index].Target, StatOp::Add, -Costs[Index], 0);
+            }
+
+            ConstRef<StatArchetype> Archetype = StatRepository::View().Get(Inputs[Index].Target);
+            StatInstance            Instance  = mStats.GetOrInsert(* this, Archetype);
+
+            if (Archetype.IsAggregated())
+            {
+                mStats.Aggregate(* this, Instance, [&](Ref<StatLedger> Ledger)
+                {
+                    Ledger.Insert(0, StatOp::Add, -Costs[Index]);
+                });
+            }
+            else
+            {
+                Instance.Apply(* this, StatOp::Add, -Costs[Index]);
+            }
+        }
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void Arsenal::RevertModifier(Stat Handle, StatOp Operation, Real32 Magnitude, UInt32 Source)
+    {
+        const GameplayContext::Scope Guard(mContext);
+
+        const ArsenalRecorder::Scope Nesting;
+
+        if (mRecorder && Nesting.IsOutermost())
+        {
+            mRecorder->RecordModifier(ArsenalRecorder::Command::RevertModifier, mActor, Handle, Operation, Magnitude, Source);
+        }
+
+        ConstRef<StatArchetype> Archetype = StatRepository::View().Get(Handle);
+        StatInstance            Instance  = mStats.GetOrInsert(* this, Archetype);
+
+        // Notify dependencies only if the stat was successfully published.
+        if (mStats.Publish(Handle, Instance.GetEffective(* this)))
+        {
+            NotifyDependencies(Handle);
+        }
+
+        // Revert the modifier from the stat instance, or drop it from the ledger of an aggregated attribute.
+        if (Archetype.IsAggregated())
+        {
+            mStats.Aggregate(* this, Instance, [&](Ref<StatLedger> Ledger)
+            {
+                Ledger.Remove(Source, Operation, Magnitude);
+            });
+        }
+        else
+        {
+            Instance.Revert(* this, Operation, Magnitude);
+        }
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void Arsenal::ExchangeModifier(Stat Handle, StatOp Operation, Real32 Previous, Real32 Current, UInt32 Source)
+    {
+        const GameplayContext::Scope Guard(mContext);
+
+        ConstRef<StatArchetype> Archetype = StatRepository::View().Get(Handle);
+        StatInstance            Instance  = mStats.GetOrInsert(* this, Archetype);
+
+        if (Instance.IsNeutral(Operation, Previous, Current))
+        {
+            return;
+        }
+
+        // Notify dependencies only if the stat was successfully published.
+        if (mStats.Publish(Handle, Instance.GetEffective(* this)))
+        {
+            NotifyDependencies(Handle);
+        }
+
+        // Replace the modifier on the stat instance, or in the ledger of an aggregated attribute.
+        if (Archetype.IsAggregated())
+        {
+            mStats.Aggregate(* this, Instance, [&](Ref<StatLedger> Ledger)
+            {
+                Ledger.Exchange(Source, Operation, Previous, Current);
+            });
+        }
+        else
+        {
+            Instance.Exchange(* this, Operation, Previous, Current);
+        }
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void Arsenal::ApplyModifier(ConstSpan<Ptr<Arsenal>> Targets, Stat Handle, StatOp Operation, Real32 Magnitude)
+    {
+        // Targets of a batch live in the same world, so its repositories are resolved once for all of them.
+        const GameplayContext::Scope Guard(Targets.empty() ? nullptr : Targets[0]->mContext);
+
+        for (const Ptr<Arsenal> Target : Targets)
+        {
+            Target->ApplyModifier(Handle, Operation, Magnitude);
+        }
+
+        // An overridden attribute keeps its value until the next poll, so there is nothing to resolve.
+        if (Operation != StatOp::Set)
+        {
+            Resolve(Targets, StatRepository::View().Get(Handle));
+        }
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void Arsenal::RevertModifier(ConstSpan<Ptr<Arsenal>> Targets, Stat Handle, StatOp Operation, Real32 Magnitude)
+    {
+        // Targets of a batch live in the same world, so its repositories are resolved once for all of them.
+        const GameplayContext::Scope Guard(Targets.empty() ? nullptr : Targets[0]->mContext);
+
+        for (const Ptr<Arsenal> Target : Targets)
+        {
+            Target->RevertModifier(Handle, Operation, Magnitude);
+        }
+        Resolve(Targets, StatRepository::View().Get(Handle));
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Bool Arsenal::Load(Ref<BakeReader> Reader, ConstRef<EffectInstance::OnRemap> Remap)
+    {
+        const GameplayContext::Scope Guard(mContext);
+
+        if (!Reader.Open(BakeKind::Arsenal))
+        {
+            return false;
+        }
+
+        mStats.Load(Reader);
+        mTokens.Load(Reader);
+
+        if (Reader.Read<Bool>())
+        {
+            GetEffects().Load(Reader, Remap);
+        }
+        else if (mEffects)
+        {
+            mEffects->Clear();
+        }
+
+        if (Reader.Read<Bool>())
+        {
+            GetAbilities().Load(Reader);
+        }
+        else if (mAbilities)
+        {
+            mAbilities->Clear();
+        }
+
+        if (!Reader.IsValid())
+        {
+            mStats.Clear();
+            mTokens.Clear();
+
+            if (mEffects)
+            {
+                mEffects->Clear();
+            }
+
+            if (mAbilities)
+            {
+                mAbilities->Clear();
+            }
+            return false;
+        }
+        return true;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void Arsenal::Save(Ref<BakeWriter> Writer) const
+    {
+        const GameplayContext::Scope Guard(mContext);
+
+        BakeHeader Header;
+        Header.Kind = BakeKind::Arsenal;
+
+        Writer.Write(Header);
+
+        mStats.Save(Writer);
+        mTokens.Save(Writer);
+
+        Writer.Write(mEffects != nullptr);
+
+        if (mEffects)
+        {
+            mEffects->Save(Writer);
+        }
+
+        Writer.Write(mAbilities != nullptr);
+
+        if (mAbilities)
+        {
+            mAbilities->Save(Writer);
+        }
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void Arsenal::Reload(ConstSpan<Ptr<Arsenal>> Targets, Ref<Content::Service> Content, ConstStr8 StatFilename, ConstStr8 EffectFilename)
+    {
+        const GameplayContext::Scope Guard(Targets.empty() ? nullptr : Targets[0]->mContext);
+
+        Ref<StatRepository>   Stats   = StatRepository::Instance();
+        Ref<EffectRepository> Effects = EffectRepository::Instance();
+
+        const Vector<Stat>   ChangedStats   = Stats.Stage(Content, StatFilename);
+        const Vector<Effect> ChangedEffects = Effects.Stage(Content, EffectFilename);
+
+        if (ChangedStats.empty() && ChangedEffects.empty())
+        {
+            return;
+        }
+
+        Array<UInt64, EffectRepository::kMaxArchetypes / 64> Changes { };
+
+        for (const Effect Handle : ChangedEffects)
+        {
+            Changes[Handle.GetID() / 64] |= (1ull << (Handle.GetID() % 64));
+        }
+
+        const auto IsChanged = [&](ConstRef<EffectInstance> Instance)
+        {
+            const UInt32 ID = Instance.GetArchetype()->GetHandle().GetID();
+            return ((Changes[ID / 64] >> (ID % 64)) & 1) != 0;
+        };
+
+        // Revert while the previous definitions are still live, since reverting reads their bonuses.
+        for (const Ptr<Arsenal> Target : Targets)
+        {
+            Target->ForEachEffect([&](Ref<EffectInstance> Instance)
+            {
+                if (IsChanged(Instance))
+                {
+                    Target->RevertEffectModifiers(Instance);
+                }
+            });
+
+            for (const Stat Handle : ChangedStats)
+            {
+                if (Target->mStats.Contains(Handle))
+                {
+                    Target->mStats.Publish(Handle, Target->GetStat(Handle));
+                }
+            }
+        }
+
+        Stats.Commit();
+        Effects.Commit();
+
+        // Recalculate the changed stats first, so the modifiers applied next resolve against the new definitions.
+        for (const Ptr<Arsenal> Target : Targets)
+        {
+            for (const Stat Handle : ChangedStats)
+            {
+                if (Target->mStats.Invalidate(Handle))
+                {
+                    Target->NotifyDependencies(Handle);
+                }
+            }
+
+            Target->ForEachEffect([&](Ref<EffectInstance> Instance)
+            {
+                if (IsChanged(Instance))
+                {
+                    Target->ApplyEffectModifiers(Instance);
+                }
+            });
+        }
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Effect Arsenal::ApplyEffect(Scene::Entity Instigator, ConstRef<EffectSpec> Specification, Real64 Timestamp)
+    {
+        return ApplyEffect(Instigator, Specification, EffectCache(), Timestamp);
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void Arsenal::ApplyEffectBatch(Scene::Entity Instigator, ConstRef<EffectSpec> Specification, ConstSpan<Scene::Entity> Targets, Real64 Timestamp)
+    {
+        // Targets of a batch live in the same world, so its repositories are resolved once for all of them.
+        const GameplayContext::Scope Guard(Targets.empty() ? nullptr : Targets[0].Get<Arsenal>().mContext);
+
+        ConstRef<EffectArchetype> Archetype = EffectRepository::View().Get(Specification.GetTarget());
+
+        EffectCache Cache;
+        Bool        Prepared = false;
+
+        for (const Scene::Entity Target : Targets)
+        {
+            Ref<Arsenal> Receiver = Target.Get<Arsenal>();
+            Receiver.mTokens.Resolve();
+
+            // Without an instigator every target is its own source, so nothing can be shared. The cache is only
+            // prepared once a target that is not immune is found, a batch of immune targets resolves nothing.
+            if (!Prepared && Instigator.IsValid() && Archetype.Admits(Receiver.mTokens))
+            {
+                Cache.Prepare(Archetype, Instigator.Get<Arsenal>());
+                Prepared = true;
+            }
+            Receiver.ApplyEffect(Instigator, Specification, Cache, Timestamp);
+        }
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Effect Arsenal::ApplyEffect(Scene::Entity Instigator, ConstRef<EffectSpec> Specification, ConstRef<EffectCache> Cache, Real64 Timestamp)
+    {
+        GAMEPLAY_TRACE_ZONE("Arsenal::ApplyEffect");
+        Trace::Increment(TraceCounter::Applications);
+
+        const GameplayContext::Scope Guard(mContext);
+
+        const ArsenalRecorder::Scope Nesting;
+
+        if (mRecorder && Nesting.IsOutermost())
+        {
+            mRecorder->RecordApplyEffect(mActor, Instigator, Specification, Timestamp);
+        }
+
+        ConstRef<EffectArchetype> Archetype = EffectRepository::View().Get(Specification.GetTarget());
+
+        // Reject immune targets before resolving any input or creating an instance, against resolved ancestors.
+        mTokens.Resolve();
+
+        if (!Archetype.Admits(mTokens))
+        {
+            Trace::Increment(TraceCounter::Immunities);
+            return Effect();
+        }
+
+        // Remember the stats read while applying, the same few are usually shared by most inputs.
+        const Memo Source(GetSource(Instigator));
+        const Memo Target(* this);
+
+        Effect Result;
+
+        switch (Archetype.GetApplication())
+        {
+        case EffectApplication::Instant:
+        {
+            const Real32 Intensity = Specification.GetIntensity().Resolve(Target);
+
+            // Apply each modifier defined in the effect archetype.
+            for (UInt32 Index = 0; ConstRef<EffectModifier> Bonus : Archetype.GetBonuses())
+            {
+                const Real32 Magnitude = Cache.Resolve(EffectCache::kBonuses + Index++, Bonus.GetMagnitude(), Source, Target);
+                ApplyModifier(Bonus.GetTarget(), Bonus.GetOperation(), Magnitude * Intensity);
+            }
+
+            if (mCombatLog)
+            {
+                mCombatLog->Emit(CombatRecord::Kind::Apply, Timestamp, mActor.GetID(), Instigator.GetID(), Archetype.GetHandle().GetID(), 1, 0.0f, Intensity);
+            }
+
+            // Trigger cues associated with the effect application.
+            RunCues(Archetype.GetCues(), CueData::Event::OnApply, Timestamp, Instigator.GetID(), Intensity);
+            break;
+        }
+        case EffectApplication::Temporary:
+        case EffectApplication::Permanent:
+        {
+            Ref<EffectSet> Effects = GetEffects();
+
+            // Resolve what a refresh needs first, so merging into an active stack never creates an instance.
+            const UInt16 Stack      = Specification.GetStack().Resolve(Target);
+            const Real32 Intensity  = Specification.GetIntensity().Resolve(Target);
+            Real32       Duration   = 0.0f;
+            Real64       Expiration = kInfinity<Real32>;
+
+            if (Archetype.GetApplication() == EffectApplication::Temporary)
+            {
+                Duration   = Cache.Resolve(EffectCache::kDuration, Archetype.GetDuration(), Source, Target);
+                Expiration = EffectClock::Advance(Timestamp, Duration);
+            }
+
+            // Handle effect stacking behavior.
+            if (const Ptr<EffectInstance> Inplace = Effects.FindStack(Archetype))
+            {
+                Effects.Refresh(* Inplace, [&](Ref<EffectInstance> Instance, EffectSet::Event)
+                {
+                    // Merge the new application into the existing instance.
+                    Instance.Merge(Expiration, Stack, Intensity);
+
+                    // Swap the applied values for the merged ones, the cache only holds the batch instigator's.
+                    if (Instance.GetInstigator() == Instigator.GetID())
+                    {
+                        ApplyEffectModifiers(Instance, Cache, true);
+                    }
+                    else
+                    {
+                        ApplyEffectModifiers(Instance, EffectCache(), true);
+                    }
+                    SubscribeDependents(Instance);
+
+                    // Trigger cues associated with the effect refresh, with the magnitude of the new application.
+                    const Real32 Magnitude = EffectInstance::GetEffectiveIntensity(Archetype, Intensity, Stack);
+
+                    if (mCombatLog)
+                    {
+                        mCombatLog->Emit(CombatRecord::Kind::Refresh, Timestamp, mActor.GetID(), Instigator.GetID(), Archetype.GetHandle().GetID(), Instance.GetStack(), 0.0f, Magnitude);
+                    }
+                    RunCues(Archetype.GetCues(), CueData::Event::OnRefresh, Timestamp, Instigator.GetID(), Magnitude);
+                });
+
+                Result = Inplace->GetHandle();
+                break;
+            }
+
+            // Drop the application once the set is full, rather than overrunning its storage.
+            if (Effects.IsFull())
+            {
+                LOG_WARNING("Effect set is full, dropping the application of effect {}.", Archetype.GetHandle().GetID());
+                break;
+            }
+
+            // Create a new effect instance.
+            Ref<EffectInstance> Instance = Effects.Create(Archetype);
+            Instance.SetStack(Stack);
+            Instance.SetIntensity(Intensity);
+            Instance.SetInstigator(Instigator.GetID());
+            Instance.SetDuration(Duration);
+            Instance.SetExpiration(Expiration);
+
+            // Set the period and interval for the effect.
+            Instance.SetPeriod(Cache.Resolve(EffectCache::kPeriod, Archetype.GetPeriod(), Source, Target));
+
+            if (const Real32 Period = Instance.GetPeriod(); Period > 0.0f)
+            {
+                Instance.SetInterval(EffectClock::Schedule(Timestamp, Period, Archetype.GetAlignment()));
+            }
+            else
+            {
+                Instance.SetInterval(Instance.GetExpiration());
+            }
+
+            Effects.Activate(Instance, [&](Ref<EffectInstance> Inplace, EffectSet::Event)
+            {
+                Result = Inplace.GetHandle();
+
+                ApplyEffectModifiers(Inplace, Cache, Source, Target, false);
+                SubscribeDependents(Inplace);
+
+                LogEffect(CombatRecord::Kind::Apply, Inplace, Timestamp, Inplace.GetIntensity());
+
+                // Trigger cues associated with the effect application.
+                RunCues(Inplace, CueData::Event::OnApply, Timestamp);
+            });
+            break;
+        }
+        }
+        return Result;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void Arsenal::RevertEffect(Effect Handle, Real64 Timestamp)
+    {
+        const GameplayContext::Scope Guard(mContext);
+
+        LOG_ASSERT(mEffects, "Attempting to revert an effect on an arsenal without effects.");
+
+        const ArsenalRecorder::Scope Nesting;
+
+        if (mRecorder && Nesting.IsOutermost())
+        {
+            mRecorder->RecordRevertEffect(mActor, Handle, Timestamp);
+        }
+
+        ConstRef<EffectInstance> Instance = mEffects->GetByHandle(Handle);
+
+        // Revert all modifiers applied by the effect.
+        RevertEffectModifiers(Instance);
+
+        // Deactivate the effect if it is currently active.
+        if (Instance.CanExpire())
+        {
+            mEffects->Deactivate(Instance);
+        }
+
+        // Trigger cues associated with the effect removal.
+        RunCues(Instance, CueData::Event::OnRemove, Timestamp);
+
+        // Free the effect instance from the registry.
+        mEffects->Delete(Instance);
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    UInt32 Arsenal::Dispel(Token Category, Real64 Timestamp)
+    {
+        const GameplayContext::Scope Guard(mContext);
+
+        const ArsenalRecorder::Scope Nesting;
+
+        if (mRecorder && Nesting.IsOutermost())
+        {
+            mRecorder->RecordDispel(mActor, Category, Timestamp);
+        }
+
+        const UInt32 Count = mEffects ? mEffects->Count(Category) : 0;
+
+        if (Count == 0)
+        {
+            return 0;
+        }
+
+        /// \brief Represents the modifiers of a single stat and operation summed across the dispelled effects.
+        struct Fold final
+        {
+            /// \brief The stat the modifiers apply to.
+            Stat   Target;
+
+            /// \brief The operation of the modifiers.
+            StatOp Operation;
+
+            /// \brief The summed magnitude of the modifiers.
+            Real32 Magnitude;
+        };
+
+        Ref<FrameArena>          Arena  = FrameArena::Current();
+        const FrameArena::Marker Marker = Arena.GetMarker();
+        const Span<Fold>         Folds  = Arena.Allocate<Fold>(Count * EffectArchetype::kMaxBonuses);
+        UInt32                   Size   = 0;
 
-        // Poll all stats and notify the coordinator of any changes.
-        mStats.Poll(* this, [this](Stat Handle, Real32 Previous, Real32 Current)
+        mEffects->Dispel(Category, [&](ConstRef<EffectInstance> Instance)
         {
-            Coordinator::Instance().Publish(Handle, mActor, Previous, Current);
-        });
-    }
+            for (const auto [Index, Modifier] : std::views::enumerate(Instance.GetArchetype()->GetBonuses()))
+            {
+                const Stat   Target    = Modifier.GetTarget();
+                const StatOp Operation = Modifier.GetOperation();
+                const Bool   Summable  = (Operation == StatOp::Add || Operation == StatOp::Percent);
 
-    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
-    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+                // Ledgers track each source separately and scale or set modifiers do not sum, revert them as usual.
+                if (!Summable || StatRepository::View().Get(Target).IsAggregated())
+                {
+                    RevertModifier(Target, Operation, Instance.GetSnapshot(Index), GetBonusSource(Instance, Index));
+                    continue;
+                }
 
-    void Arsenal::ApplyModifier(Stat Handle, StatOp Operation, Real32 Magnitude)
-    {
-        Ref<StatInstance> Instance = mStats.GetOrInsert(* this, StatRepository::Instance().Get(Handle));
+                const auto Matches = [&](ConstRef<Fold> Entry)
+                {
+                    return Entry.Target == Target && Entry.Operation == Operation;
+                };
 
-        // Notify dependencies only if the stat was successfully published.
-        if (mStats.Publish(Handle, Instance.GetEffective()))
+                if (const auto Iterator = std::ranges::find_if(Folds.first(Size), Matches); Iterator != Folds.first(Size).end())
+                {
+                    Iterator->Magnitude += Instance.GetSnapshot(Index);
+                }
+                else
+                {
+                    Folds[Size++] = Fold { Target, Operation, Instance.GetSnapshot(Index) };
+                }
+            }
+
+            // Trigger cues associated with the effect removal.
+            RunCues(Instance, CueData::Event::OnRemove, Timestamp);
+        });
+
+        for (ConstRef<Fold> Entry : Folds.first(Size))
         {
-            NotifyDependencies(Handle);
+            RevertModifier(Entry.Target, Entry.Operation, Entry.Magnitude);
         }
 
-        // Apply the modifier to the stat instance.
-        Instance.Apply(* this, Operation, Magnitude);
+        Arena.Rewind(Marker);
+        return Count;
     }
 
     // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
     // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 
-    void Arsenal::RevertModifier(Stat Handle, StatOp Operation, Real32 Magnitude)
+    void Arsenal::ApplyEffectModifiers(Ref<EffectInstance> Instance, ConstRef<EffectCache> Cache, ConstRef<Memo> Source, ConstRef<Memo> Target, Bool Exchange)
     {
-        Ref<StatInstance> Instance = mStats.GetOrInsert(* this, StatRepository::Instance().Get(Handle));
+        // Calculate the effective intensity of the effect.
+        const Real32 Intensity = Instance.GetEffectiveIntensity();
 
-        // Notify dependencies only if the stat was successfully published.
-        if (mStats.Publish(Handle, Instance.GetEffective()))
+        // Iterate over each modifier in the effect and apply it.
+        for (const auto [Index, Modifier] : std::views::enumerate(Instance.GetArchetype()->GetBonuses()))
         {
-            NotifyDependencies(Handle);
-        }
+            // Capture the magnitude, snapshot modifiers reuse it on every subsequent tick.
+            const Real32 Magnitude = Cache.Resolve(EffectCache::kBonuses + Index, Modifier.GetMagnitude(), Source, Target);
+            Instance.SetCapture(Index, Magnitude);
+
+            // Resolve the modifier's value based on its magnitude and the effect's intensity.
+            const Real32 Value    = Magnitude * Intensity;
+            const Real32 Previous = Instance.GetSnapshot(Index);
+            Instance.SetSnapshot(Index, Value);
 
-        // Revert the modifier from the stat instance.
-        Instance.Revert(* this, Operation, Magnitude);
+            // Apply the modifier to the arsenal, or replace the value currently applied.
+            if (Exchange)
+            {
+                ExchangeModifier(Modifier.GetTarget(), Modifier.GetOperation(), Previous, Value, GetBonusSource(Instance, Index));
+            }
+            else
+            {
+                ApplyModifier(Modifier.GetTarget(), Modifier.GetOperation(), Value, GetBonusSource(Instance, Index));
+            }
+        }
     }
 
     // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
     // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 
-    Effect Arsenal::ApplyEffect(Scene::Entity Instigator, ConstRef<EffectSpec> Specification, Real64 Timestamp)
+    void Arsenal::ReapplyEffectModifiers(Ref<EffectInstance> Instance, Bool Exchange)
     {
-        ConstRef<EffectArchetype> Archetype = EffectRepository::Instance().Get(Specification.GetTarget());
-        Ref<Arsenal>              Source    = GetSource(Instigator);
+        const Memo Source(GetSource(Instance));
+        const Memo Target(* this);
 
-        Effect Result;
+        // Calculate the effective intensity of the effect.
+        const Real32 Intensity = Instance.GetEffectiveIntensity();
 
-        switch (Archetype.GetApplication())
-        {
-        case EffectApplication::Instant:
+        // Iterate over each modifier in the effect and apply it.
+        for (const auto [Index, Modifier] : std::views::enumerate(Instance.GetArchetype()->GetBonuses()))
         {
-            const Real32 Intensity = Specification.GetIntensity().Resolve(* this);
+            Real32 Magnitude;
 
-            // Apply each modifier defined in the effect archetype.
-            for (ConstRef<EffectModifier> Bonus : Archetype.GetBonuses())
+            if (Modifier.GetMode() == StatMode::Snapshot)
+            {
+                Magnitude = Instance.GetCapture(Index);
+            }
+            else
             {
-                ApplyModifier(Bonus.GetTarget(), Bonus.GetOperation(), Bonus.GetMagnitude().Resolve(Source, * this) * Intensity);
+                Magnitude = Modifier.GetMagnitude().Resolve(Source, Target);
             }
 
-            // Trigger cues associated with the effect application.
-            RunCues(Archetype.GetCues(), CueData::Event::OnApply, Timestamp, Instigator.GetID(), Intensity);
-            break;
-        }
-        case EffectApplication::Temporary:
-        case EffectApplication::Permanent:
-        {
-            // Create a new effect instance.
-            Ref<EffectInstance> Instance = mEffects.Create(Archetype);
-            Instance.SetStack(Specification.GetStack().Resolve(* this));
-            Instance.SetIntensity(Specification.GetIntensity().Resolve(* this));
-            Instance.SetInstigator(Instigator.GetID());
+            // Resolve the modifier's value based on its magnitude and the effect's intensity.
+            const Real32 Value    = Magnitude * Intensity;
+            const Real32 Previous = Instance.GetSnapshot(Index);
+            Instance.SetSnapshot(Index, Value);
 
-            // Set the expiration based on the effect application type.
-            if (Archetype.GetApplication() == EffectApplication::Temporary)
+            // Apply the modifier to the arsenal, or replace the value currently applied.
+            if (Exchange)
             {
-                Instance.SetDuration(Instance.GetArchetype()->GetDuration().Resolve(Source, * this));
-                Instance.SetExpiration(Instance.GetDuration() + Timestamp);
+                ExchangeModifier(Modifier.GetTarget(), Modifier.GetOperation(), Previous, Value, GetBonusSource(Instance, Index));
             }
             else
             {
-                Instance.SetExpiration(kInfinity<Real32>);
+                ApplyModifier(Modifier.GetTarget(), Modifier.GetOperation(), Value, GetBonusSource(Instance, Index));
             }
+        }
+    }
 
-            // Set the period and interval for the effect.
-            Instance.SetPeriod(Instance.GetArchetype()->GetPeriod().Resolve(Source, * this));
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 
-            if (const Real32 Period = Instance.GetPeriod(); Period > 0.0f)
-            {
-                Instance.SetInterval(Period + Timestamp);
-            }
-            else
+    void Arsenal::RefreshEffectModifiers(Ref<EffectInstance> Instance)
+    {
+        const Memo Source(GetSource(Instance));
+        const Memo Target(* this);
+
+        // Calculate the effective intensity of the effect.
+        const Real32 Intensity = Instance.GetEffectiveIntensity();
+
+        for (const auto [Index, Modifier] : std::views::enumerate(Instance.GetArchetype()->GetBonuses()))
+        {
+            if (Modifier.GetMode() != StatMode::Dynamic)
             {
-                Instance.SetInterval(Instance.GetExpiration());
+                continue;
             }
 
-            // Handle effect stacking behavior.
-            const auto OnHandleEffectStack = [&](Ref<EffectInstance> Inplace, EffectSet::Event Event)
+            // Swap only the delta, a modifier whose inputs changed back is left untouched.
+            const Real32 Value    = Modifier.GetMagnitude().Resolve(Source, Target) * Intensity;
+            const Real32 Previous = Instance.GetSnapshot(Index);
+
+            if (Value != Previous)
             {
-                Result = Inplace.GetHandle();
+                Instance.SetSnapshot(Index, Value);
+                ExchangeModifier(Modifier.GetTarget(), Modifier.GetOperation(), Previous, Value, GetBonusSource(Instance, Index));
+            }
+        }
+    }
 
-                switch (Event)
-                {
-                case EffectSet::Event::Insert:
-                    ApplyEffectModifiers(Inplace);
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 
-                    // Trigger cues associated with the effect application.
-                    RunCues(Instance, CueData::Event::OnApply, Timestamp);
-                    break;
-                case EffectSet::Event::Update:
-                    RevertEffectModifiers(Inplace);
+    void Arsenal::RefreshDependents()
+    {
+        if (!mEffects || !mEffects->HasDependents())
+        {
+            mForwarded.clear();
+            return;
+        }
 
-                    // Merge the new instance into the existing one.
-                    Inplace.Merge(Instance);
+        GAMEPLAY_TRACE_ZONE("Arsenal::RefreshDependents");
 
-                    ApplyEffectModifiers(Inplace);
+        const auto IsSelf = [this](ConstRef<EffectInstance> Instance)
+        {
+            return Instance.GetInstigator() == 0 || Instance.GetInstigator() == mActor.GetID();
+        };
 
-                    // Trigger cues associated with the effect refresh.
-                    RunCues(Instance, CueData::Event::OnRefresh, Timestamp);
-                    break;
+        // Refresh the effects reading the stats of other instigators first, so the stats they change are visited below.
+        for (ConstRef<Coordinator::ForwardEvent> Event : mForwarded)
+        {
+            mEffects->ForEachDependent(Event.Handle, StatScope::Source, [&](Ref<EffectInstance> Instance)
+            {
+                if (Instance.GetInstigator() == Event.Instigator.GetID())
+                {
+                    RefreshEffectModifiers(Instance);
                 }
+            });
+        }
+        mForwarded.clear();
 
-            };
-            mEffects.Activate(Instance, OnHandleEffectStack);
-            break;
+        // Refreshing may publish further stats, which are appended to the changes and visited by this same loop.
+        for (UInt32 Index = 0; Index < mStats.GetChanges().size(); ++Index)
+        {
+            const Stat Handle = mStats.GetChanges()[Index];
+
+            mEffects->ForEachDependent(Handle, StatScope::Target, [this](Ref<EffectInstance> Instance)
+            {
+                RefreshEffectModifiers(Instance);
+            });
+
+            mEffects->ForEachDependent(Handle, StatScope::Source, [&](Ref<EffectInstance> Instance)
+            {
+                if (IsSelf(Instance))
+                {
+                    RefreshEffectModifiers(Instance);
+                }
+            });
         }
+
+        // Refresh the effects reading a token changed since the last tick, before the poll consumes the changes.
+        if (mEffects->HasTokenDependents())
+        {
+            mTokens.ForEachChange([&](Token Handle)
+            {
+                mEffects->ForEachDependent(Handle, StatScope::Target, [this](Ref<EffectInstance> Instance)
+                {
+                    RefreshEffectModifiers(Instance);
+                });
+
+                mEffects->ForEachDependent(Handle, StatScope::Source, [&](Ref<EffectInstance> Instance)
+                {
+                    if (IsSelf(Instance))
+                    {
+                        RefreshEffectModifiers(Instance);
+                    }
+                });
+            });
         }
-        return Result;
     }
 
     // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
     // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 
-    void Arsenal::RevertEffect(Effect Handle)
+    void Arsenal::SubscribeDependents(ConstRef<EffectInstance> Instance)
     {
-        ConstRef<EffectInstance> Instance = mEffects.GetByHandle(Handle);
-
-        // Revert all modifiers applied by the effect.
-        RevertEffectModifiers(Instance);
-
-        // Deactivate the effect if it is currently active.
-        if (Instance.CanExpire())
+        // Periodic effects resolve their dynamic modifiers on every tick, and this arsenal refreshes its own.
+        if (Instance.CanTick() || Instance.GetInstigator() == 0 || Instance.GetInstigator() == mActor.GetID())
         {
-            mEffects.Deactivate(Instance);
+            return;
         }
 
-        // Trigger cues associated with the effect removal.
-        RunCues(Instance, CueData::Event::OnRemove, Time::Elapsed());
+        Ref<Arsenal> Source = GetSource(Instance);
 
-        // Free the effect instance from the registry.
-        mEffects.Delete(Instance);
+        for (ConstRef<EffectModifier> Modifier : Instance.GetArchetype()->GetBonuses())
+        {
+            if (Modifier.GetMode() != StatMode::Dynamic)
+            {
+                continue;
+            }
+
+            Modifier.Traverse([&]<typename Type>(Type Dependency)
+            {
+                if constexpr (std::is_same_v<Type, Stat>)
+                {
+                    Source.Subscribe(Dependency, mActor);
+                }
+            }, StatScope::Source);
+        }
     }
 
     // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
     // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 
-    void Arsenal::ApplyEffectModifiers(Ref<EffectInstance> Instance)
+    void Arsenal::UnsubscribeDependents(ConstRef<EffectInstance> Instance)
     {
-        ConstRef<Arsenal> Instigator = GetSource(Instance.GetInstigator());
+        if (Instance.CanTick() || Instance.GetInstigator() == 0 || Instance.GetInstigator() == mActor.GetID())
+        {
+            return;
+        }
 
-        // Calculate the effective intensity of the effect.
-        const Real32 Intensity = Instance.GetEffectiveIntensity();
+        // The instigator may have been despawned first, in which case it holds no subscription anymore.
+        const Scene::Entity Instigator(Instance.GetInstigator());
 
-        // Iterate over each modifier in the effect and apply it.
-        for (const auto [Index, Modifier] : std::views::enumerate(Instance.GetArchetype()->GetBonuses()))
+        if (!Instigator.IsValid() || !Instigator.Has<Arsenal>())
         {
-            // Resolve the modifier's value based on its magnitude and the effect's intensity.
-            const Real32 Value = Modifier.GetMagnitude().Resolve(Instigator, * this) * Intensity;
-            Instance.SetSnapshot(Index, Value);
+            return;
+        }
+
+        Ref<Arsenal> Source = Instigator.Get<Arsenal>();
 
-            // Apply the modifier to the arsenal.
-            ApplyModifier(Modifier.GetTarget(), Modifier.GetOperation(), Value);
+        for (ConstRef<EffectModifier> Modifier : Instance.GetArchetype()->GetBonuses())
+        {
+            if (Modifier.GetMode() != StatMode::Dynamic)
+            {
+                continue;
+            }
+
+            Modifier.Traverse([&]<typename Type>(Type Dependency)
+            {
+                if constexpr (std::is_same_v<Type, Stat>)
+                {
+                    Source.Unsubscribe(Dependency, mActor);
+                }
+            }, StatScope::Source);
         }
     }
 
@@ -221,7 +1141,7 @@ namespace Gameplay
     {
         for (const auto [Index, Modifier] : std::views::enumerate(Instance.GetArchetype()->GetBonuses()))
         {
-            RevertModifier(Modifier.GetTarget(), Modifier.GetOperation(), Instance.GetSnapshot(Index));
+            RevertModifier(Modifier.GetTarget(), Modifier.GetOperation(), Instance.GetSnapshot(Index), GetBonusSource(Instance, Index));
         }
     }
 
@@ -230,15 +1150,31 @@ namespace Gameplay
 
     Bool Arsenal::UpdateEffect(Ref<EffectInstance> Instance, Real64 Timestamp)
     {
-        const ConstPtr<EffectArchetype> Archetype = Instance.GetArchetype();
+        GAMEPLAY_TRACE_ZONE("Arsenal::UpdateEffect");
+        Trace::Increment(TraceCounter::Updates);
 
-        if (Instance.GetInterval() >= Instance.GetExpiration())
+        using Handler = Bool (Arsenal::*)(Ref<EffectInstance>, Real64);
+
+        // One instantiation per expiration policy, so due ticks take a single indirect call instead of branching.
+        static constexpr Array<Handler, EffectPolicy::kExpirations> kHandlers
         {
-            // Revert the effect's modifiers before any changes.
-            RevertEffectModifiers(Instance);
+            & Arsenal::UpdateEffect<EffectExpiration::All>,
+            & Arsenal::UpdateEffect<EffectExpiration::Single>,
+            & Arsenal::UpdateEffect<EffectExpiration::Tick>,
+        };
+        return (this->*kHandlers[Enum::Cast(Instance.GetArchetype()->GetExpiration())])(Instance, Timestamp);
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 
+    template<EffectExpiration Expiration>
+    Bool Arsenal::UpdateEffect(Ref<EffectInstance> Instance, Real64 Timestamp)
+    {
+        if (Instance.GetInterval() >= Instance.GetExpiration())
+        {
             // Handle expiration based on the archetype's policy.
-            switch (Archetype->GetExpiration())
+            switch (Expiration)
             {
             case EffectExpiration::Single:
                 Instance.SetStack(Instance.GetStack() - 1);
@@ -250,29 +1186,36 @@ namespace Gameplay
                 break;
             }
 
-            // Re-apply the effect's modifiers to ensure correct intensity.
+            // Swap the effect's modifiers for the ones at the remaining stack count in a single step.
             if (Instance.GetStack() > 0)
             {
-                ApplyEffectModifiers(Instance);
+                ReapplyEffectModifiers(Instance, true);
 
                 // Refresh duration.
-                Instance.SetExpiration(Instance.GetDuration() + Timestamp);
+                Instance.SetExpiration(EffectClock::Advance(Timestamp, Instance.GetDuration()));
 
                 // Schedule next tick if applicable.
                 if (Instance.CanTick())
                 {
-                    Instance.SetInterval(Instance.GetPeriod());
+                    Instance.SetInterval(EffectClock::Schedule(Timestamp, Instance.GetPeriod(), Instance.GetArchetype()->GetAlignment()));
                 }
                 else
                 {
                     Instance.SetInterval(Instance.GetExpiration());
                 }
 
+                LogEffect(CombatRecord::Kind::Decay, Instance, Timestamp, Instance.GetEffectiveIntensity());
+
                 // Trigger cues associated with the effect refresh.
                 RunCues(Instance, CueData::Event::OnRefresh, Timestamp);
             }
             else
             {
+                // Revert the effect's modifiers, nothing is left to apply.
+                RevertEffectModifiers(Instance);
+
+                LogEffect(CombatRecord::Kind::Expire, Instance, Timestamp, 0.0f);
+
                 // Trigger cues associated with the effect removal.
                 RunCues(Instance, CueData::Event::OnRemove, Timestamp);
                 return true; // Effect has expired.
@@ -281,17 +1224,204 @@ namespace Gameplay
         else
         {
             // Re-apply the effect's modifiers on tick.
-            ApplyEffectModifiers(Instance);
+            ReapplyEffectModifiers(Instance, false);
+
+            LogEffect(CombatRecord::Kind::Tick, Instance, Timestamp, Instance.GetEffectiveIntensity());
 
             // Schedule the next tick.
-            Instance.SetInterval(Instance.GetPeriod() + Timestamp);
+            Instance.SetInterval(EffectClock::Schedule(Timestamp, Instance.GetPeriod(), Instance.GetArchetype()->GetAlignment()));
 
             // Decrease stack for tick-based expiration.
-            if (Archetype->GetExpiration() == EffectExpiration::Tick)
+            if constexpr (Expiration == EffectExpiration::Tick)
             {
                 Instance.SetStack(Instance.GetStack() - 1);
             }
         }
         return false;
     }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void Arsenal::RebuildContributions()
+    {
+        Table<Stat, AbilitySet::Contribution> Contributions;
+
+        mAbilities->Traverse([&](ConstRef<AbilityInstance> Instance)
+        {
+            if (!Instance.IsSustained())
+            {
+                return;
+            }
+
+            for (ConstRef<EffectSpec> Specification : Instance.GetArchetype()->GetEffects())
+            {
+                ConstRef<EffectArchetype> Archetype = EffectRepository::View().Get(Specification.GetTarget());
+                const Real32              Intensity = Specification.GetIntensity().Resolve(* this);
+
+                for (ConstRef<EffectModifier> Bonus : Archetype.GetBonuses())
+                {
+                    Contributions[Bonus.GetTarget()].Accumulate(Bonus.GetOperation(), Bonus.GetMagnitude().Resolve(* this) * Intensity);
+                }
+            }
+        });
+
+        const Table<Stat, AbilitySet::Contribution> Previous = mAbilities->Exchange(Move(Contributions));
+        ConstRef<Table<Stat, AbilitySet::Contribution>> Current  = mAbilities->GetContributions();
+
+        const auto Swap = [this](Stat Handle, ConstRef<AbilitySet::Contribution> Before, ConstRef<AbilitySet::Contribution> After)
+        {
+            ExchangeModifier(Handle, StatOp::Add, Before.Flat, After.Flat);
+            ExchangeModifier(Handle, StatOp::Percent, Before.Additive, After.Additive);
+            ExchangeModifier(Handle, StatOp::Scale, Before.Multiplier, After.Multiplier);
+        };
+
+        // Apply the difference per stat, stats whose contribution did not change are left untouched.
+        for (const auto & [Handle, Before] : Previous)
+        {
+            if (!Current.contains(Handle))
+            {
+                Swap(Handle, Before, AbilitySet::Contribution());
+            }
+        }
+
+        for (const auto & [Handle, After] : Current)
+        {
+            const auto Iterator = Previous.find(Handle);
+            Swap(Handle, Iterator != Previous.end() ? Iterator->second : AbilitySet::Contribution(), After);
+        }
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void Arsenal::Resolve(ConstSpan<Ptr<Arsenal>> Targets, ConstRef<StatArchetype> Archetype)
+    {
+        // Resources and custom formulas are already up to date or resolve on their own path.
+        if (Archetype.GetKind() != StatKind::Attribute || Archetype.GetFormula())
+        {
+            return;
+        }
+
+        StatSet::Block Lanes;
+
+        for (UInt32 First = 0; First < Targets.size(); First += StatSet::kLanes)
+        {
+            const UInt32 Count = Min(StatSet::kLanes, static_cast<UInt32>(Targets.size()) - First);
+
+            for (UInt32 Lane = 0; Lane < StatSet::kLanes; ++Lane)
+            {
+                if (Lane < Count)
+                {
+                    Ref<Arsenal>       Target   = * Targets[First + Lane];
+                    const StatInstance Instance = Target.mStats.GetOrInsert(Target, Archetype);
+
+                    Lanes.Base[Lane]       = Archetype.GetBase().Resolve(Target);
+                    Lanes.Flat[Lane]       = Instance.GetFlat();
+                    Lanes.Additive[Lane]   = Instance.GetAdditive();
+                    Lanes.Multiplier[Lane] = Instance.GetMultiplier();
+                    Lanes.Minimum[Lane]    = Archetype.GetMinimum().Resolve(Target);
+                    Lanes.Maximum[Lane]    = Archetype.GetMaximum().Resolve(Target);
+                }
+                else
+                {
+                    Lanes.Base[Lane]       = 0.0f;
+                    Lanes.Flat[Lane]       = 0.0f;
+                    Lanes.Additive[Lane]   = 0.0f;
+                    Lanes.Multiplier[Lane] = 1.0f;
+                    Lanes.Minimum[Lane]    = 0.0f;
+                    Lanes.Maximum[Lane]    = 0.0f;
+                }
+            }
+
+            StatSet::Calculate(Lanes);
+
+            for (UInt32 Lane = 0; Lane < Count; ++Lane)
+            {
+                Ref<Arsenal> Target = * Targets[First + Lane];
+                Target.mStats.GetOrInsert(Target, Archetype).SetEffective(Lanes.Effective[Lane]);
+            }
+        }
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void Arsenal::Capture(Ref<Snapshot> Target) const
+    {
+        const GameplayContext::Scope Guard(mContext);
+
+        mStats.Capture(Target.Stats);
+        mTokens.Capture(Target.Tokens);
+
+        Target.HasEffects = (mEffects != nullptr);
+
+        if (Target.HasEffects)
+        {
+            mEffects->Capture(Target.Effects);
+        }
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void Arsenal::Restore(ConstRef<Snapshot> Source)
+    {
+        const GameplayContext::Scope Guard(mContext);
+
+        // Channels are not captured, their scripts would resume against the abandoned timeline.
+        if (mAbilities)
+        {
+            mAbilities->Cancel();
+        }
+
+        mStats.Restore(Source.Stats);
+        mTokens.Restore(Source.Tokens);
+
+        if (Source.HasEffects)
+        {
+            GetEffects().Restore(Source.Effects);
+        }
+        else if (mEffects)
+        {
+            mEffects->Clear();
+        }
+
+        // Forwarded changes belong to the abandoned timeline.
+        mForwarded.clear();
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    MemoryUsage Arsenal::GetMemoryUsage() const
+    {
+        const GameplayContext::Scope Guard(mContext);
+
+        constexpr ConstStr8 kOwner = "Arsenal";
+
+        MemoryUsage Usage;
+        mStats.Measure(Usage);
+        mTokens.Measure(Usage);
+
+        if (mEffects)
+        {
+            mEffects->Measure(Usage);
+        }
+
+        if (mAbilities)
+        {
+            mAbilities->Measure(Usage);
+        }
+
+        Usage.RecordTable(kOwner, "Followers", mFollowers);
+
+        for (const auto & [Handle, Followers] : mFollowers)
+        {
+            Usage.RecordVector(kOwner, "Followers", Followers);
+        }
+
+        Usage.RecordVector(kOwner, "Forwarded", mForwarded);
+        return Usage;
+    }
 }
\ No newline at end of file
@@ -14,12 +14,21 @@
 
 #include "Gameplay/Ability/AbilityRepository.hpp"
 #include "Gameplay/Ability/AbilitySet.hpp"
+#include "Gameplay/Arsenal/ArsenalRecorder.hpp"
+#include "Gameplay/Arsenal/ArsenalSlot.hpp"
+#include "Gameplay/Arsenal/CombatLog.hpp"
+#include "Gameplay/Arsenal/Coordinator.hpp"
+#include "Gameplay/Arsenal/GameplayContext.hpp"
+#include "Gameplay/Arsenal/Trace.hpp"
 #include "Gameplay/Cue/CueRepository.hpp"
+#include "Gameplay/Effect/EffectClock.hpp"
 #include "Gameplay/Effect/EffectRepository.hpp"
 #include "Gameplay/Effect/EffectSet.hpp"
+#include "Gameplay/Stat/StatMemo.hpp"
 #include "Gameplay/Stat/StatRepository.hpp"
 #include "Gameplay/Stat/StatSet.hpp"
 #include "Gameplay/Token/TokenRepository.hpp"
+#include "Gameplay/Token/TokenQuery.hpp"
 #include "Gameplay/Token/TokenSet.hpp"
 #include <Zyphryon.Scene/Entity.hpp>
 
@@ -30,9 +39,32 @@
 namespace Gameplay
 {
     /// \brief Encapsulates a collection of tokens, stats, effects, and abilities for an entity.
-    class Arsenal final
+    ///
+    /// The effect and ability sets are created on first use, so ambient actors that only carry stats and tokens
+    /// do not pay for them.
+    class Arsenal final : private ArsenalSlot
     {
-        // TODO: Concurrency and Dynamic Modifiers.
+        // TODO: Concurrency.
+
+    public:
+
+        /// \brief Structure holding the runtime state of an arsenal captured for rollback.
+        ///
+        /// \note Snapshots are meant to be kept in a ring and captured into again, reusing their storage.
+        struct Snapshot final
+        {
+            /// \brief The state of the stats.
+            StatSet::Snapshot   Stats;
+
+            /// \brief The state of the tokens.
+            TokenSet::Snapshot  Tokens;
+
+            /// \brief The state of the effects, only meaningful when the arsenal had an effect set.
+            EffectSet::Snapshot Effects;
+
+            /// \brief Whether the arsenal had an effect set when captured.
+            Bool                HasEffects = false;
+        };
 
     public:
 
@@ -41,32 +73,363 @@ namespace Gameplay
 
         /// \brief Constructs an arsenal for the specified actor entity.
         ///
-        /// \param Actor The entity that owns this arsenal.
-        ZYPHRYON_INLINE Arsenal(Scene::Entity Actor)
-            : mActor { Actor }
+        /// \param Actor   The entity that owns this arsenal.
+        /// \param Context The context of the world the actor lives in, or `nullptr` to use the calling thread's.
+        ZYPHRYON_INLINE Arsenal(Scene::Entity Actor, Ptr<GameplayContext> Context = nullptr)
+            : mActor   { Actor },
+              mContext { Context }
+        {
+        }
+
+        /// \brief Retrieves the context of the world the arsenal belongs to.
+        ///
+        /// \note Every public entry point makes it current while it runs, so repositories resolve against it even
+        ///       when called outside a tick or from a thread bound to another world.
+        ///
+        /// \return A reference to the context of the arsenal, or to the calling thread's if it has none.
+        ZYPHRYON_INLINE Ref<GameplayContext> GetContext() const
+        {
+            return mContext ? * mContext : GameplayContext::Current();
+        }
+
+        /// \brief Sets the recorder that logs the commands issued to the arsenal.
+        ///
+        /// \note The recorder must outlive the arsenal, or be detached before it is destroyed.
+        ///
+        /// \param Recorder The recorder to log into, or `nullptr` to stop recording.
+        ZYPHRYON_INLINE void SetRecorder(Ptr<ArsenalRecorder> Recorder)
+        {
+            mRecorder = Recorder;
+        }
+
+        /// \brief Retrieves the recorder that logs the commands issued to the arsenal.
+        ///
+        /// \return A pointer to the recorder, or `nullptr` if the arsenal is not being recorded.
+        ZYPHRYON_INLINE Ptr<ArsenalRecorder> GetRecorder() const
         {
+            return mRecorder;
+        }
+
+        /// \brief Sets the combat log that receives the effect and stat events of the arsenal.
+        ///
+        /// \note The combat log must outlive the arsenal, or be detached before it is destroyed.
+        ///
+        /// \param Log The combat log to emit into, or `nullptr` to stop logging.
+        ZYPHRYON_INLINE void SetCombatLog(Ptr<CombatLog> Log)
+        {
+            mCombatLog = Log;
+        }
+
+        /// \brief Retrieves the combat log that receives the effect and stat events of the arsenal.
+        ///
+        /// \return A pointer to the combat log, or `nullptr` if the arsenal is not being logged.
+        ZYPHRYON_INLINE Ptr<CombatLog> GetCombatLog() const
+        {
+            return mCombatLog;
         }
 
         /// \brief Advances the state of the arsenal based on the elapsed time.
         ///
         /// \param Time The current time reference.
-        void Tick(ConstRef<Time> Time);
+        ZYPHRYON_INLINE void Tick(ConstRef<Time> Time)
+        {
+            const GameplayContext::Scope Guard(mContext);
+
+            Tick(Time, Coordinator::Instance());
+        }
+
+        /// \brief Advances the state of the arsenal based on the elapsed time.
+        ///
+        /// \param Time     The current time reference.
+        /// \param Listener The listener to notify of any stat or token changes.
+        template<typename Type>
+        ZYPHRYON_INLINE void Tick(ConstRef<Time> Time, Ref<Type> Listener)
+        {
+            Tick(Time.GetAbsolute(), Listener);
+        }
+
+        /// \brief Advances the state of the arsenal to the given timestamp.
+        ///
+        /// \param Timestamp The absolute time to advance to.
+        /// \param Listener  The listener to notify of any stat or token changes.
+        template<typename Type>
+        ZYPHRYON_INLINE void Tick(Real64 Timestamp, Ref<Type> Listener)
+        {
+            const GameplayContext::Scope Guard(mContext);
+
+            ConstRef<Coordinator> Subscribers = Coordinator::Instance();
+
+            Tick(Timestamp, Listener, Subscribers.GetStatSubscribers(mActor), Subscribers.GetTokenSubscribers(mActor));
+        }
+
+        /// \brief Advances the state of the arsenal to the given timestamp, reporting only the changes of interest.
+        ///
+        /// \note Repositories are resolved against the context of the arsenal, if it has one, for the whole tick.
+        ///       Stat and token changes outside the filters are discarded. Effect changes are only reported to
+        ///       listeners accepting them through `Publish(Effect, Scene::Entity, EffectSet::Event, ConstPtr<EffectInstance>)`,
+        ///       with a null instance on removal, and discarded otherwise.
+        ///
+        /// \param Timestamp The absolute time to advance to.
+        /// \param Listener  The listener to notify of any stat, token or effect changes.
+        /// \param Stats     The bitset of stats, indexed by identifier, whose changes should be reported.
+        /// \param Tokens    The bitset of tokens, indexed by dense index, whose changes should be reported.
+        template<typename Type>
+        ZYPHRYON_INLINE void Tick(Real64 Timestamp, Ref<Type> Listener, ConstRef<Array<UInt64, StatRepository::kWords>> Stats, ConstRef<Array<UInt64, TokenRepository::kWords>> Tokens)
+        {
+            GAMEPLAY_TRACE_ZONE("Arsenal::Tick");
+            Trace::Increment(TraceCounter::Ticks);
+
+            const GameplayContext::Scope Guard(mContext);
+
+            if (const ArsenalRecorder::Scope Nesting; mRecorder && Nesting.IsOutermost())
+            {
+                mRecorder->RecordTick(mActor, Timestamp);
+            }
+
+            // Snap to the simulation step, so effects due on this tick are not deferred by rounding errors.
+            Timestamp = EffectClock::Quantize(Timestamp);
+
+            // Poll all effects and update their state based on the current time.
+            if (mEffects)
+            {
+                const ArsenalRecorder::Scope Nesting;
+
+                mEffects->Poll(Timestamp, [&](Ref<EffectInstance> Instance)
+                {
+                    return UpdateEffect(Instance, Timestamp);
+                });
+            }
+
+            // Resume the channeled scripts whose condition is met or deadline has passed.
+            if (mAbilities && mAbilities->HasChannels())
+            {
+                mAbilities->Resume(* this, Timestamp);
+            }
+
+            // Re-resolve the dynamic bonuses that read a stat or token changed since the last tick.
+            RefreshDependents();
+
+            // Forward the stats changed since the last tick to the actors whose effects read them from this one.
+            if constexpr (requires { Listener.Forward(Stat(), mActor, mActor); })
+            {
+                for (const Stat Handle : mFollowers.empty() ? ConstSpan<Stat>() : mStats.GetChanges())
+                {
+                    if (const auto Iterator = mFollowers.find(Handle); Iterator != mFollowers.end())
+                    {
+                        for (const Scene::Entity Follower : Iterator->second)
+                        {
+                            Listener.Forward(Handle, mActor, Follower);
+                        }
+                    }
+                }
+            }
+
+            // Poll all subscribed tokens and notify the listener of any changes.
+            mTokens.Poll(Tokens, [&](Token Handle, UInt32 Previous, UInt32 Current)
+            {
+                Listener.Publish(Handle, mActor, Previous, Current);
+            });
+
+            // Poll all subscribed stats and notify the listener of any changes.
+            if (mCombatLog)
+            {
+                // The combat log receives every stat change, the listener only the ones it subscribed to.
+                Array<UInt64, StatRepository::kWords> Everything;
+                Everything.fill(~0ull);
+
+                mStats.Poll(* this, Everything, [&](Stat Handle, Real32 Previous, Real32 Current)
+                {
+                    mCombatLog->Emit(CombatRecord::Kind::Stat, Timestamp, mActor.GetID(), 0, Handle.GetID(), 0, Previous, Current);
+
+                    if ((Stats[Handle.GetID() / 64] >> (Handle.GetID() % 64)) & 1)
+                    {
+                        Listener.Publish(Handle, mActor, Previous, Current);
+                    }
+                });
+            }
+            else
+            {
+                mStats.Poll(* this, Stats, [&](Stat Handle, Real32 Previous, Real32 Current)
+                {
+                    Listener.Publish(Handle, mActor, Previous, Current);
+                });
+            }
+
+            // Store the attributes still stale, so reads from other actors never have to calculate them.
+            mStats.Resolve(* this);
+
+            // Poll the effects inserted, updated or removed since the last tick.
+            if (mEffects && mEffects->HasChanges())
+            {
+                mEffects->PollChanges([&](Effect Handle, EffectSet::Event Event, ConstPtr<EffectInstance> Instance)
+                {
+                    if constexpr (requires { Listener.Publish(Handle, mActor, Event, Instance); })
+                    {
+                        Listener.Publish(Handle, mActor, Event, Instance);
+                    }
+                });
+            }
+        }
+
+        /// \brief Checks if the arsenal has no work due at the given time.
+        ///
+        /// \note Ability cooldowns and charges are derived when queried, they never keep an arsenal awake. Channels
+        ///       waiting on a token or stat are woken by the change itself, which leaves a pending notification.
+        ///
+        /// \param Time The current time reference.
+        /// \return `true` if no effect or channel is due, no effect changed and no stat or token change is pending, `false` otherwise.
+        ZYPHRYON_INLINE Bool IsIdle(ConstRef<Time> Time) const
+        {
+            const Real64 Timestamp = EffectClock::Quantize(Time.GetAbsolute());
+            const Bool   Due       = (mEffects && (mEffects->GetDeadline() <= Timestamp || mEffects->HasChanges()))
+                                  || (mAbilities && mAbilities->GetDeadline() <= Timestamp);
+            return !Due && !mTokens.HasNotifications() && !mStats.HasNotifications() && mForwarded.empty();
+        }
+
+        /// \brief Checks if the effects due at the given time only read state owned by this arsenal.
+        ///
+        /// \param Time The current time reference.
+        /// \return `true` if no due effect resolves stats from another actor, `false` otherwise.
+        ZYPHRYON_INLINE Bool IsIsolated(ConstRef<Time> Time) const
+        {
+            // Forwarded changes are refreshed against the stats of their instigators, and scripts may reach anything.
+            if (!mForwarded.empty() || (mAbilities && mAbilities->HasChannels()))
+            {
+                return false;
+            }
+
+            const auto Filter = [this](ConstRef<EffectInstance> Instance)
+            {
+                if (const UInt64 Instigator = Instance.GetInstigator(); Instigator == 0 || Instigator == mActor.GetID())
+                {
+                    return false;
+                }
+
+                // Ticks only re-resolve dynamic modifiers, snapshot ones reuse their captured magnitude.
+                const auto IsForeign = [](ConstRef<EffectModifier> Modifier)
+                {
+                    return Modifier.GetMode() == StatMode::Dynamic && Modifier.GetMagnitude().IsScoped(StatScope::Source);
+                };
+                return std::ranges::any_of(Instance.GetArchetype()->GetBonuses(), IsForeign);
+            };
+            return !mEffects || !mEffects->HasDue(Time.GetAbsolute(), Filter);
+        }
+
+        /// \brief Warms the stats that the effects due at the given time will read from other actors.
+        ///
+        /// \note Meant to run over a batch of arsenals right before ticking them, so the instigator lookups and
+        ///       their memory fetches overlap instead of stalling each tick in turn.
+        ///
+        /// \param Time The current time reference.
+        void Prefetch(ConstRef<Time> Time);
 
         /// \brief Grants an ability to the arsenal.
         ///
+        /// \note Passive abilities contribute their bonuses right away, without creating effect instances.
+        ///
         /// \param Handle The handle of the ability to grant.
         ZYPHRYON_INLINE void Grant(Ability Handle)
         {
-            ConstRef<AbilityArchetype> Archetype = AbilityRepository::Instance().Get(Handle);
-            mAbilities.Insert(Archetype);
+            const GameplayContext::Scope Guard(mContext);
+
+            ConstRef<AbilityArchetype> Archetype = AbilityRepository::View().Get(Handle);
+            GetAbilities().Insert(Archetype);
+
+            if (Archetype.GetKind() == AbilityKind::Passive)
+            {
+                RebuildContributions();
+            }
+        }
+
+        /// \brief Checks if an ability is off cooldown, including any cooldown shared by its category.
+        ///
+        /// \param Handle    The handle of the ability to check.
+        /// \param Timestamp The current timestamp (default is current elapsed time).
+        /// \return `true` if the ability is granted and ready to be activated, `false` otherwise.
+        Bool IsReady(Ability Handle, Real64 Timestamp = Time::Elapsed()) const;
+
+        /// \brief Retrieves the time at which an ability regains its next use.
+        ///
+        /// \note Charges are recovered lazily when queried, so a recharging ability never wakes an idle actor.
+        ///
+        /// \param Handle    The handle of the ability to check.
+        /// \param Timestamp The current timestamp (default is current elapsed time).
+        /// \return The timestamp of the end of the cooldown or of the next charge, or infinity if nothing is pending.
+        ZYPHRYON_INLINE Real64 GetNextReady(Ability Handle, Real64 Timestamp = Time::Elapsed()) const
+        {
+            const GameplayContext::Scope Guard(mContext);
+
+            const ConstPtr<AbilityInstance> Instance = mAbilities ? mAbilities->TryGet(Handle) : nullptr;
+            return Instance ? Instance->GetNextReady(* this, Timestamp) : kInfinity<Real64>;
         }
 
+        /// \brief Attempts to activate an ability, validating and committing it in a single pass.
+        ///
+        /// \note Costs are resolved once, so the amounts checked are the amounts spent.
+        ///
+        /// \param Handle    The handle of the ability to activate.
+        /// \param Targets   The entities that receive the effects, required unless the ability targets itself.
+        /// \param Timestamp The current timestamp for the activation (default is current elapsed time).
+        /// \return `AbilityResult::Success` if the ability was activated, or the reason it was rejected.
+        AbilityResult TryActivate(Ability Handle, ConstSpan<Scene::Entity> Targets, Real64 Timestamp = Time::Elapsed());
+
         /// \brief Revokes an ability from the arsenal.
         ///
         /// \param Handle The handle of the ability to revoke.
         ZYPHRYON_INLINE void Revoke(Ability Handle)
         {
-            mAbilities.Remove(Handle);
+            const GameplayContext::Scope Guard(mContext);
+
+            if (const Ptr<AbilityInstance> Instance = mAbilities ? mAbilities->TryGet(Handle) : nullptr)
+            {
+                const Bool Sustained = Instance->IsSustained();
+
+                mAbilities->Interrupt(Handle);
+                mAbilities->Remove(Handle);
+
+                if (Sustained)
+                {
+                    RebuildContributions();
+                }
+            }
+        }
+
+        /// \brief Starts the channeled script of an ability, interrupting any script the ability is running.
+        ///
+        /// \note The script runs up to its first suspension right away, and afterwards whenever the arsenal ticks
+        ///       with its condition met or its deadline passed. Channels are not part of baked or captured state,
+        ///       loading or restoring the arsenal cancels them.
+        ///
+        /// \param Handle    The handle of the ability being channeled.
+        /// \param Script    The script to run.
+        /// \param Timestamp The current timestamp (default is current elapsed time).
+        ZYPHRYON_INLINE void Channel(Ability Handle, AnyRef<AbilityChannel> Script, Real64 Timestamp = Time::Elapsed())
+        {
+            const GameplayContext::Scope Guard(mContext);
+
+            GetAbilities().Channel(Handle, Move(Script), * this, EffectClock::Quantize(Timestamp));
+        }
+
+        /// \brief Interrupts the channeled script of an ability.
+        ///
+        /// \param Handle The handle of the ability.
+        /// \return `true` if the ability was channeling, `false` otherwise.
+        ZYPHRYON_INLINE Bool Interrupt(Ability Handle)
+        {
+            const GameplayContext::Scope Guard(mContext);
+
+            return mAbilities && mAbilities->Interrupt(Handle);
+        }
+
+        /// \brief Checks if an ability is running a channeled script.
+        ///
+        /// \param Handle The handle of the ability.
+        /// \return `true` if the ability is channeling, `false` otherwise.
+        ZYPHRYON_INLINE Bool IsChanneling(Ability Handle) const
+        {
+            const GameplayContext::Scope Guard(mContext);
+
+            return mAbilities && mAbilities->IsChanneling(Handle);
         }
 
         /// \brief Inserts a token into the arsenal.
@@ -75,7 +438,9 @@ namespace Gameplay
         /// \param Count The number of tokens to insert (default is 1).
         ZYPHRYON_INLINE void InsertToken(ConstStr8 Name, UInt32 Count = 1)
         {
-            const Token Token = TokenRepository::Instance().GetByName(Name);
+            const GameplayContext::Scope Guard(mContext);
+
+            const Token Token = TokenRepository::View().GetByName(Name);
             LOG_ASSERT(!Token.IsEmpty(), "Attempted to insert unknown token '{}' into arsenal.", Name);
 
             InsertToken(Token, Count);
@@ -87,6 +452,15 @@ namespace Gameplay
         /// \param Count  The number of tokens to insert (default is 1).
         ZYPHRYON_INLINE void InsertToken(Token Handle, UInt32 Count = 1)
         {
+            const GameplayContext::Scope Guard(mContext);
+
+            const ArsenalRecorder::Scope Nesting;
+
+            if (mRecorder && Nesting.IsOutermost())
+            {
+                mRecorder->RecordToken(ArsenalRecorder::Command::InsertToken, mActor, Handle, Count);
+            }
+
             NotifyDependencies(Handle);
 
             mTokens.Insert(Handle, Count);
@@ -98,7 +472,9 @@ namespace Gameplay
         /// \param Count The number of tokens to remove (default is 1).
         ZYPHRYON_INLINE void RemoveToken(ConstStr8 Name, UInt32 Count = 1)
         {
-            const Token Token = TokenRepository::Instance().GetByName(Name);
+            const GameplayContext::Scope Guard(mContext);
+
+            const Token Token = TokenRepository::View().GetByName(Name);
             LOG_ASSERT(!Token.IsEmpty(), "Attempted to remove an unknown token '{}' from arsenal.", Name);
 
             RemoveToken(Token, Count);
@@ -110,11 +486,71 @@ namespace Gameplay
         /// \param Count  The number of tokens to remove (default is 1).
         ZYPHRYON_INLINE void RemoveToken(Token Handle, UInt32 Count = 1)
         {
+            const GameplayContext::Scope Guard(mContext);
+
+            const ArsenalRecorder::Scope Nesting;
+
+            if (mRecorder && Nesting.IsOutermost())
+            {
+                mRecorder->RecordToken(ArsenalRecorder::Command::RemoveToken, mActor, Handle, Count);
+            }
+
             NotifyDependencies(Handle);
 
             mTokens.Remove(Handle, Count);
         }
 
+        /// \brief Subscribes an actor to the changes of a stat of this arsenal, read by the effects it holds.
+        ///
+        /// \note Subscriptions are dropped once the follower no longer holds an effect reading the stat from here.
+        ///
+        /// \param Handle   The handle of the stat whose changes to forward.
+        /// \param Follower The entity holding the effects that read the stat.
+        ZYPHRYON_INLINE void Subscribe(Stat Handle, Scene::Entity Follower)
+        {
+            Ref<Vector<Scene::Entity>> Followers = mFollowers[Handle];
+
+            if (std::ranges::find(Followers, Follower) == Followers.end())
+            {
+                Followers.emplace_back(Follower);
+            }
+        }
+
+        /// \brief Unsubscribes an actor from the changes of a stat of this arsenal.
+        ///
+        /// \param Handle   The handle of the stat whose changes were forwarded.
+        /// \param Follower The entity to stop forwarding them to.
+        ZYPHRYON_INLINE void Unsubscribe(Stat Handle, Scene::Entity Follower)
+        {
+            if (const auto Iterator = mFollowers.find(Handle); Iterator != mFollowers.end())
+            {
+                Ref<Vector<Scene::Entity>> Followers = Iterator->second;
+
+                if (const auto Element = std::ranges::find(Followers, Follower); Element != Followers.end())
+                {
+                    (* Element) = Followers.back();
+                    Followers.pop_back();
+                }
+
+                if (Followers.empty())
+                {
+                    mFollowers.erase(Iterator);
+                }
+            }
+        }
+
+        /// \brief Queues a change of an instigator's stat, so the effects reading it are refreshed on the next tick.
+        ///
+        /// \param Event The forwarded stat change.
+        /// \return `true` if an active effect still reads the stat from the instigator, `false` otherwise.
+        Bool Follow(ConstRef<Coordinator::ForwardEvent> Event);
+
+        /// \brief Drops the subscriptions of the arsenal, meant to be called before its actor is despawned.
+        ///
+        /// \note Instigators stop forwarding their stat changes to this arsenal and this arsenal stops forwarding its
+        ///       own, so no other arsenal keeps a follower entry for the despawned actor.
+        void Detach();
+
         /// \brief Applies an effect modifier to the arsenal.
         ///
         /// \note Bypasses effect stacking rules and directly modifies stats.
@@ -122,7 +558,8 @@ namespace Gameplay
         /// \param Handle    The handle of the stat to modify.
         /// \param Operation The operation to perform on the stat.
         /// \param Magnitude The magnitude of the modification.
-        void ApplyModifier(Stat Handle, StatOp Operation, Real32 Magnitude);
+        /// \param Source    The source recorded by aggregated attributes, or `0` if the modifier is not tracked.
+        void ApplyModifier(Stat Handle, StatOp Operation, Real32 Magnitude, UInt32 Source = 0);
 
         /// \brief Reverts an effect modifier from the arsenal.
         ///
@@ -131,7 +568,52 @@ namespace Gameplay
         /// \param Handle    The handle of the stat to modify.
         /// \param Operation The operation to perform on the stat.
         /// \param Magnitude The magnitude of the modification.
-        void RevertModifier(Stat Handle, StatOp Operation, Real32 Magnitude);
+        /// \param Source    The source recorded by aggregated attributes, or `0` if the modifier is not tracked.
+        void RevertModifier(Stat Handle, StatOp Operation, Real32 Magnitude, UInt32 Source = 0);
+
+        /// \brief Replaces an effect modifier previously applied to the arsenal with a new magnitude.
+        ///
+        /// \note Publishes and notifies dependencies once, and does nothing when the change is neutral.
+        ///
+        /// \param Handle    The handle of the stat to modify.
+        /// \param Operation The operation to perform on the stat.
+        /// \param Previous  The magnitude previously applied.
+        /// \param Current   The magnitude to apply instead.
+        /// \param Source    The source recorded by aggregated attributes, or `0` if the modifier is not tracked.
+        void ExchangeModifier(Stat Handle, StatOp Operation, Real32 Previous, Real32 Current, UInt32 Source = 0);
+
+        /// \brief Applies the same effect modifier to several arsenals at once.
+        ///
+        /// \note Attributes using the default formula are resolved across all targets in lanes.
+        ///
+        /// \param Targets   The arsenals to modify.
+        /// \param Handle    The handle of the stat to modify.
+        /// \param Operation The operation to perform on the stat.
+        /// \param Magnitude The magnitude of the modification.
+        static void ApplyModifier(ConstSpan<Ptr<Arsenal>> Targets, Stat Handle, StatOp Operation, Real32 Magnitude);
+
+        /// \brief Reverts the same effect modifier from several arsenals at once.
+        ///
+        /// \note Attributes using the default formula are resolved across all targets in lanes.
+        ///
+        /// \param Targets   The arsenals to modify.
+        /// \param Handle    The handle of the stat to modify.
+        /// \param Operation The operation to revert on the stat.
+        /// \param Magnitude The magnitude of the modification.
+        static void RevertModifier(ConstSpan<Ptr<Arsenal>> Targets, Stat Handle, StatOp Operation, Real32 Magnitude);
+
+        /// \brief Reloads stat and effect archetypes in place, patching only the arsenals that hold changed ones.
+        ///
+        /// Modifiers of effects whose archetype changed are reverted against the previous definition and applied
+        /// again against the new one, stats whose archetype changed are recalculated along with their dependents.
+        ///
+        /// \note Running effects keep their current duration and period until they are refreshed.
+        ///
+        /// \param Targets        The arsenals to patch, usually every live arsenal.
+        /// \param Content        The content service to load from.
+        /// \param StatFilename   The filename of the stat resource.
+        /// \param EffectFilename The filename of the effect resource.
+        static void Reload(ConstSpan<Ptr<Arsenal>> Targets, Ref<Content::Service> Content, ConstStr8 StatFilename, ConstStr8 EffectFilename);
 
         /// \brief Applies an effect to the arsenal.
         ///
@@ -151,22 +633,58 @@ namespace Gameplay
         /// \return The handle of the applied effect.
         Effect ApplyEffect(Scene::Entity Instigator, ConstRef<EffectSpec> Specification, Real64 Timestamp = Time::Elapsed());
 
+        /// \brief Applies an effect to several targets at once, such as an area of effect cast.
+        ///
+        /// \note Inputs that only read from the instigator are resolved once and shared by every target.
+        ///
+        /// \param Instigator    The entity that is instigating the effect.
+        /// \param Specification The specification of the effect to apply.
+        /// \param Targets       The entities that receive the effect.
+        /// \param Timestamp     The current timestamp for effect application (default is current elapsed time).
+        static void ApplyEffectBatch(Scene::Entity Instigator, ConstRef<EffectSpec> Specification, ConstSpan<Scene::Entity> Targets, Real64 Timestamp = Time::Elapsed());
+
         /// \brief Reverts an effect from the arsenal.
         ///
-        /// \param Handle The handle of the effect to revert.
-        void RevertEffect(Effect Handle);
+        /// \param Handle    The handle of the effect to revert.
+        /// \param Timestamp The current timestamp for effect removal (default is current elapsed time).
+        void RevertEffect(Effect Handle, Real64 Timestamp = Time::Elapsed());
+
+        /// \brief Reverts every effect whose category holds the given token or one of its descendants.
+        ///
+        /// \note Flat and percent modifiers on plain attributes are summed per stat across the dispelled effects and
+        ///       reverted once, the remaining modifiers are reverted one by one.
+        ///
+        /// \param Category  The category token to dispel.
+        /// \param Timestamp The current timestamp for effect removal (default is current elapsed time).
+        /// \return The number of effects reverted.
+        UInt32 Dispel(Token Category, Real64 Timestamp = Time::Elapsed());
 
         /// \brief Retrieves the effective value of a stat from the arsenal.
         ///
+        /// Dirty attributes are calculated on demand without being stored, the arsenal stores them once per change to
+        /// their modifiers or dependencies when it publishes them, polls them or ends its tick.
+        ///
         /// \param Handle The handle of the stat to retrieve.
         /// \return The effective value of the stat.
         ZYPHRYON_INLINE Real32 GetStat(Stat Handle) const
         {
-            if (const ConstPtr<StatInstance> Instance = mStats.TryGet(Handle); Instance != nullptr)
+            const GameplayContext::Scope Guard(mContext);
+
+            if (mStats.Contains(Handle))
             {
-                return Instance->GetEffective();
+                return mStats.GetEffective(* this, Handle);
             }
-            return StatRepository::Instance().Get(Handle).Calculate(* this, 0.0f, 0.0f, 1.0f);
+            return mStats.GetDefault(* this, Handle);
+        }
+
+        /// \brief Sets the shared baseline used for the default values of untouched stats.
+        ///
+        /// \note The baseline must outlive the arsenal and be built against the same actor template.
+        ///
+        /// \param Baseline The baseline to read from, or `nullptr` to resolve every default.
+        ZYPHRYON_INLINE void SetBaseline(ConstPtr<StatBaseline> Baseline)
+        {
+            mStats.SetBaseline(Baseline);
         }
 
         /// \brief Retrieves the count of a token in the arsenal.
@@ -175,7 +693,9 @@ namespace Gameplay
         /// \return The count of the specified token.
         ZYPHRYON_INLINE UInt32 GetToken(ConstStr8 Name) const
         {
-            const Token Handle = TokenRepository::Instance().GetByName(Name);
+            const GameplayContext::Scope Guard(mContext);
+
+            const Token Handle = TokenRepository::View().GetByName(Name);
             LOG_ASSERT(!Handle.IsEmpty(), "Attempted to query unknown token '{}' in arsenal.", Name);
 
             return mTokens.Count(Handle);
@@ -187,15 +707,30 @@ namespace Gameplay
         /// \return The count of the specified token.
         ZYPHRYON_INLINE UInt32 GetToken(Token Handle) const
         {
+            const GameplayContext::Scope Guard(mContext);
+
             return mTokens.Count(Handle);
         }
 
+        /// \brief Checks if the tokens of the arsenal satisfy a compiled token query.
+        ///
+        /// \param Query The query to evaluate.
+        /// \return `true` if the query is satisfied, `false` otherwise.
+        ZYPHRYON_INLINE Bool Matches(ConstRef<TokenQuery> Query) const
+        {
+            const GameplayContext::Scope Guard(mContext);
+
+            return Query.Evaluate(mTokens);
+        }
+
         /// \brief Iterates over all stats in the arsenal.
         ///
         /// \param Action The action to apply to each stat.
         template<typename Function>
         ZYPHRYON_INLINE void ForEachStat(AnyRef<Function> Action)
         {
+            const GameplayContext::Scope Guard(mContext);
+
             mStats.Traverse(Action);
         }
 
@@ -205,7 +740,12 @@ namespace Gameplay
         template<typename Function>
         ZYPHRYON_INLINE void ForEachAbility(AnyRef<Function> Action)
         {
-            mAbilities.Traverse(Action);
+            const GameplayContext::Scope Guard(mContext);
+
+            if (mAbilities)
+            {
+                mAbilities->Traverse(Action);
+            }
         }
 
         /// \brief Iterates over all tokens in the arsenal.
@@ -214,6 +754,9 @@ namespace Gameplay
         template<typename Function>
         ZYPHRYON_INLINE void ForEachToken(AnyRef<Function> Action)
         {
+            const GameplayContext::Scope Guard(mContext);
+
+            mTokens.Resolve();
             mTokens.Traverse(Action);
         }
 
@@ -223,23 +766,189 @@ namespace Gameplay
         template<typename Function>
         ZYPHRYON_INLINE void ForEachEffect(AnyRef<Function> Action)
         {
-            mEffects.Traverse(Action);
+            const GameplayContext::Scope Guard(mContext);
+
+            if (mEffects)
+            {
+                mEffects->Traverse(Action);
+            }
         }
 
+        /// \brief Restores the runtime state of the arsenal from a baked snapshot, replacing its current state.
+        ///
+        /// Stats, tokens, effects and abilities are restored exactly as saved, so no stat is recalculated and no
+        /// effect is applied again. Running effects resume their schedule from the saved timestamps.
+        ///
+        /// \note The actor and the stat baseline of the arsenal are kept. Snapshots should only be restored by a
+        ///       process that registered the same archetypes, elements of unknown archetypes are discarded. Effect
+        ///       instigators are saved as entity identifiers, which only the saving process can resolve, so they are
+        ///       mapped through the given delegate and dropped without one.
+        ///
+        /// \param Reader The baked snapshot to load from.
+        /// \param Remap  The delegate mapping saved instigators to their actors, or an empty delegate to drop them.
+        /// \return `true` if the snapshot was restored, `false` if it is invalid and the arsenal was left empty.
+        Bool Load(Ref<BakeReader> Reader, ConstRef<EffectInstance::OnRemap> Remap = EffectInstance::OnRemap());
+
+        /// \brief Saves the runtime state of the arsenal to a baked snapshot, including its header.
+        ///
+        /// \note Pending stat and token notifications are not part of the snapshot, tick the arsenal beforehand.
+        ///
+        /// \param Writer The writer to save to, constructed without a header.
+        void Save(Ref<BakeWriter> Writer) const;
+
+        /// \brief Captures the runtime state of the arsenal for rollback.
+        ///
+        /// Storage that did not change since the previous capture or restore is shared with it instead of being
+        /// copied, so capturing every frame only pays for what the frame modified.
+        ///
+        /// \note Pending stat notifications are not captured and abilities are left out, tick the arsenal beforehand.
+        ///
+        /// \param Target The snapshot receiving the state, whose previous content is replaced.
+        void Capture(Ref<Snapshot> Target) const;
+
+        /// \brief Restores the runtime state of the arsenal from a rollback snapshot, replacing its current state.
+        ///
+        /// \note Like `Load`, nothing is recalculated or applied again and the restored values are not reported.
+        ///
+        /// \param Source The snapshot previously filled by `Capture` on this arsenal.
+        void Restore(ConstRef<Snapshot> Source);
+
+        /// \brief Samples the memory held by the arsenal and its sets.
+        ///
+        /// \note Reports of several arsenals can be merged to check the budget of a whole shard.
+        ///
+        /// \return The memory usage of the arsenal, broken down by subsystem and container.
+        MemoryUsage GetMemoryUsage() const;
+
+    private:
+
+        /// \brief Caches the effect inputs that do not read from the target, so they can be shared across targets.
+        class EffectCache final
+        {
+        public:
+
+            /// \brief Maximum number of inputs that can be cached.
+            static constexpr UInt32 kCapacity = 64;
+
+            /// \brief Slot of the duration input.
+            static constexpr UInt32 kDuration = 0;
+
+            /// \brief Slot of the period input.
+            static constexpr UInt32 kPeriod   = 1;
+
+            /// \brief Slot of the first bonus magnitude, followed by the rest in archetype order.
+            static constexpr UInt32 kBonuses  = 2;
+
+        public:
+
+            /// \brief Resolves every input of the archetype that does not read from the target.
+            ///
+            /// \param Archetype The archetype of the effect to cache.
+            /// \param Source    The arsenal of the instigator.
+            ZYPHRYON_INLINE void Prepare(ConstRef<EffectArchetype> Archetype, ConstRef<Arsenal> Source)
+            {
+                const Memo Instigator(Source);
+
+                Store(kDuration, Archetype.GetDuration(), Instigator);
+                Store(kPeriod, Archetype.GetPeriod(), Instigator);
+
+                for (UInt32 Index = 0; ConstRef<EffectModifier> Bonus : Archetype.GetBonuses())
+                {
+                    Store(kBonuses + Index++, Bonus.GetMagnitude(), Instigator);
+                }
+            }
+
+            /// \brief Resolves an input, using the cached value when available.
+            ///
+            /// \param Slot   The slot of the input.
+            /// \param Input  The input to resolve.
+            /// \param Source The context of the instigator.
+            /// \param Target The context receiving the effect.
+            /// \return The resolved value.
+            template<typename Context>
+            ZYPHRYON_INLINE Real32 Resolve(UInt32 Slot, ConstRef<StatInput> Input, ConstRef<Context> Source, ConstRef<Context> Target) const
+            {
+                if (Slot < kCapacity && ((mMask >> Slot) & 1))
+                {
+                    return mValues[Slot];
+                }
+                return Input.Resolve(Source, Target);
+            }
+
+        private:
+
+            /// \brief Resolves and stores an input if it does not read from the target.
+            ///
+            /// \param Slot   The slot of the input.
+            /// \param Input  The input to resolve.
+            /// \param Source The context of the instigator.
+            template<typename Context>
+            ZYPHRYON_INLINE void Store(UInt32 Slot, ConstRef<StatInput> Input, ConstRef<Context> Source)
+            {
+                if (Slot < kCapacity && !Input.IsScoped(StatScope::Target))
+                {
+                    mValues[Slot] = Input.Resolve(Source, Source);
+                    mMask        |= (1ull << Slot);
+                }
+            }
+
+        private:
+
+            // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+            // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+            UInt64                   mMask = 0;
+            Array<Real32, kCapacity> mValues;
+        };
+
+        /// \brief Type alias for a memo remembering the stats read from an arsenal during one application.
+        using Memo = StatMemo<Arsenal>;
+
     private:
 
+        /// \brief Applies an effect to the arsenal, resolving its inputs through the given cache.
+        ///
+        /// \param Instigator    The entity that is instigating the effect.
+        /// \param Specification The specification of the effect to apply.
+        /// \param Cache         The cache of inputs already resolved for the instigator.
+        /// \param Timestamp     The current timestamp for effect application.
+        /// \return The handle of the applied effect.
+        Effect ApplyEffect(Scene::Entity Instigator, ConstRef<EffectSpec> Specification, ConstRef<EffectCache> Cache, Real64 Timestamp);
+
+        /// \brief Deducts the resolved costs of an ability as one batched write to the stats of the arsenal.
+        ///
+        /// \note Every target is published before any is modified, so dependents are notified in a single pass.
+        ///
+        /// \param Inputs The inputs of the ability cost.
+        /// \param Costs  The resolved cost of each input, in input order.
+        void PayCost(ConstSpan<AbilityCost::Input> Inputs, ConstRef<Array<Real32, AbilityCost::kMaxInput>> Costs);
+
+        /// \brief Aggregates the bonuses of every sustained ability into one contribution per stat and applies the change.
+        ///
+        /// \note Magnitudes are resolved against the arsenal when the contributions are rebuilt.
+        void RebuildContributions();
+
         /// \brief Notifies dependent stats of a change in the specified stat or token.
         ///
         /// \param Dependant The stat or token that has changed.
         template<typename Type>
         ZYPHRYON_INLINE void NotifyDependencies(Type Dependant)
         {
-            StatRepository::Instance().NotifyDependency(Dependant, [this](Stat Dependency)
+            StatRepository::View().NotifyDependency(Dependant, [this](Stat Dependency)
             {
-                return mStats.Publish(Dependency, GetStat(Dependency));
+                const Bool Published = mStats.Publish(Dependency, GetStat(Dependency));
+
+                // Keep propagating while a dependent was clean, since its own dependents may have been read since.
+                return mStats.Invalidate(Dependency) || Published;
             });
         }
 
+        /// \brief Resolves a stat across several arsenals, evaluating the default formula in lanes.
+        ///
+        /// \param Targets   The arsenals whose stat to resolve.
+        /// \param Archetype The archetype of the stat to resolve.
+        static void Resolve(ConstSpan<Ptr<Arsenal>> Targets, ConstRef<StatArchetype> Archetype);
+
         /// \brief Retrieves the source arsenal for a given actor entity.
         ///
         /// \param Actor The actor entity to retrieve the arsenal for.
@@ -249,16 +958,103 @@ namespace Gameplay
             return Actor.IsValid() ? Actor.Get<Arsenal>() : (* this);
         }
 
+        /// \brief Retrieves the source arsenal of an effect instance, reusing the one cached on the instance.
+        ///
+        /// \note The cache is keyed by the slot of the instigator, which follows it when the scene relocates it and
+        ///       stops resolving once it is destroyed, so other arsenals coming and going leave it untouched.
+        ///
+        /// \param Instance The effect instance whose instigator to retrieve.
+        /// \return A reference to the arsenal of the instigator, or this arsenal if the effect has no instigator.
+        ZYPHRYON_INLINE Ref<Arsenal> GetSource(ConstRef<EffectInstance> Instance)
+        {
+            if (Instance.GetInstigator() == 0)
+            {
+                return (* this);
+            }
+
+            if (const Ptr<ArsenalSlot> Cached = ArsenalSlot::Find(Instance.GetCachedSource()))
+            {
+                return (* static_cast<Ptr<Arsenal>>(Cached));
+            }
+
+            Ref<Arsenal> Source = GetSource(Scene::Entity(Instance.GetInstigator()));
+            Instance.SetCachedSource(Source.GetKey());
+            return Source;
+        }
+
         /// \brief Applies effect modifiers from an effect instance to the arsenal.
         ///
         /// \param Instance The effect instance containing the modifiers to apply.
-        void ApplyEffectModifiers(Ref<EffectInstance> Instance);
+        ZYPHRYON_INLINE void ApplyEffectModifiers(Ref<EffectInstance> Instance)
+        {
+            ApplyEffectModifiers(Instance, EffectCache());
+        }
+
+        /// \brief Applies effect modifiers from an effect instance to the arsenal, resolving them through a cache.
+        ///
+        /// \param Instance The effect instance containing the modifiers to apply.
+        /// \param Cache    The cache of inputs already resolved for the instigator.
+        /// \param Exchange Whether to replace the values currently applied instead of applying on top of them.
+        ZYPHRYON_INLINE void ApplyEffectModifiers(Ref<EffectInstance> Instance, ConstRef<EffectCache> Cache, Bool Exchange = false)
+        {
+            ApplyEffectModifiers(Instance, Cache, Memo(GetSource(Instance)), Memo(* this), Exchange);
+        }
+
+        /// \brief Applies effect modifiers from an effect instance to the arsenal, reading stats through memos.
+        ///
+        /// \param Instance The effect instance containing the modifiers to apply.
+        /// \param Cache    The cache of inputs already resolved for the instigator.
+        /// \param Source   The memo over the arsenal of the instance's instigator.
+        /// \param Target   The memo over this arsenal.
+        /// \param Exchange Whether to replace the values currently applied instead of applying on top of them.
+        void ApplyEffectModifiers(Ref<EffectInstance> Instance, ConstRef<EffectCache> Cache, ConstRef<Memo> Source, ConstRef<Memo> Target, Bool Exchange);
+
+        /// \brief Re-applies effect modifiers from an effect instance on a periodic tick or stack expiration.
+        ///
+        /// \note Snapshot modifiers reuse the magnitude captured at application time, so only dynamic modifiers read
+        ///       from the instigator.
+        ///
+        /// \param Instance The effect instance containing the modifiers to re-apply.
+        /// \param Exchange Whether to replace the values currently applied instead of applying on top of them.
+        void ReapplyEffectModifiers(Ref<EffectInstance> Instance, Bool Exchange);
+
+        /// \brief Re-resolves the dynamic modifiers of an effect instance, exchanging only those whose value changed.
+        ///
+        /// \param Instance The effect instance containing the modifiers to refresh.
+        void RefreshEffectModifiers(Ref<EffectInstance> Instance);
+
+        /// \brief Refreshes the effect instances whose dynamic modifiers read a stat or token changed since the last poll.
+        ///
+        /// \note Source scoped stats of other instigators are refreshed from the changes forwarded to this arsenal.
+        ///       Stats changed by a refresh are visited in the same pass, each stat at most once per tick.
+        ///       Tokens are only refreshed for this arsenal, as token changes are not forwarded to followers.
+        void RefreshDependents();
+
+        /// \brief Subscribes this arsenal to the instigator stats read by the dynamic modifiers of an effect instance.
+        ///
+        /// \param Instance The effect instance whose dependencies to subscribe to.
+        void SubscribeDependents(ConstRef<EffectInstance> Instance);
+
+        /// \brief Unsubscribes this arsenal from the instigator stats read by the dynamic modifiers of an effect instance.
+        ///
+        /// \param Instance The effect instance whose dependencies to unsubscribe from.
+        void UnsubscribeDependents(ConstRef<EffectInstance> Instance);
 
         /// \brief Reverts effect modifiers from an effect instance in the arsenal.
         ///
         /// \param Instance The effect instance containing the modifiers to revert.
         void RevertEffectModifiers(ConstRef<EffectInstance> Instance);
 
+        /// \brief Retrieves the source under which a bonus of an effect instance is recorded by aggregated attributes.
+        ///
+        /// \param Instance The effect instance owning the bonus.
+        /// \param Index    The index of the bonus within the effect archetype.
+        /// \return The source of the bonus, never `0` as effect handles start at one.
+        ZYPHRYON_INLINE static UInt32 GetBonusSource(ConstRef<EffectInstance> Instance, UInt32 Index)
+        {
+            return (static_cast<UInt32>(Instance.GetHandle().GetID()) << 8) | Index;
+        }
+
         /// \brief Updates an active effect instance based on the current timestamp.
         ///
         /// \param Instance  The effect instance to update.
@@ -266,8 +1062,33 @@ namespace Gameplay
         /// \return `true` if the effect is still active, `false` if it has expired.
         Bool UpdateEffect(Ref<EffectInstance> Instance, Real64 Timestamp);
 
+        /// \brief Updates an active effect instance under a fixed expiration policy.
+        ///
+        /// \param Instance  The effect instance to update.
+        /// \param Timestamp The current timestamp for effect updating.
+        /// \return `true` if the effect is still active, `false` if it has expired.
+        template<EffectExpiration Expiration>
+        Bool UpdateEffect(Ref<EffectInstance> Instance, Real64 Timestamp);
+
+        /// \brief Emits an event of an effect instance into the combat log, if the arsenal has one.
+        ///
+        /// \param Type      The kind of event.
+        /// \param Instance  The effect instance the event happened to.
+        /// \param Timestamp The time at which the event happened.
+        /// \param Value     The value logged with the event.
+        ZYPHRYON_INLINE void LogEffect(CombatRecord::Kind Type, ConstRef<EffectInstance> Instance, Real64 Timestamp, Real32 Value) const
+        {
+            if (mCombatLog)
+            {
+                const UInt16 Subject = Instance.GetArchetype()->GetHandle().GetID();
+                mCombatLog->Emit(Type, Timestamp, mActor.GetID(), Instance.GetInstigator(), Subject, Instance.GetStack(), 0.0f, Value);
+            }
+        }
+
         /// \brief Runs cues from a cue sheet for a specific event.
         ///
+        /// \note Cues are enqueued and only reach their delegates on the next `CueRepository::Flush`.
+        ///
         /// \param Sheet     The cue sheet containing cues to run.
         /// \param Event     The cue event type to trigger.
         /// \param Timestamp The current timestamp for cue triggering.
@@ -279,7 +1100,7 @@ namespace Gameplay
 
             for (const Token Cue : Sheet.GetChildren())
             {
-                Repository.Publish(CueData(Cue, Event, Timestamp, Source, mActor.GetID(), Magnitude));
+                Repository.Enqueue(CueData(Cue, Event, Timestamp, Source, mActor.GetID(), Magnitude));
             }
         }
 
@@ -293,15 +1114,44 @@ namespace Gameplay
             RunCues(Instance.GetArchetype()->GetCues(), Event, Timestamp, Instance.GetInstigator(), Instance.GetEffectiveIntensity());
         }
 
+        /// \brief Retrieves the effect set of the arsenal, creating it on first use.
+        ///
+        /// \return A reference to the effect set.
+        ZYPHRYON_INLINE Ref<EffectSet> GetEffects()
+        {
+            if (!mEffects)
+            {
+                mEffects = std::make_unique<EffectSet>();
+            }
+            return * mEffects;
+        }
+
+        /// \brief Retrieves the ability set of the arsenal, creating it on first use.
+        ///
+        /// \return A reference to the ability set.
+        ZYPHRYON_INLINE Ref<AbilitySet> GetAbilities()
+        {
+            if (!mAbilities)
+            {
+                mAbilities = std::make_unique<AbilitySet>();
+            }
+            return * mAbilities;
+        }
+
     private:
 
         // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
         // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 
-        Scene::Entity mActor;       // TODO: Investigate to remove from here?
-        StatSet       mStats;
-        TokenSet      mTokens;
-        EffectSet     mEffects;
-        AbilitySet    mAbilities;
+        Scene::Entity                      mActor;       // TODO: Investigate to remove from here?
+        Ptr<GameplayContext>               mContext = nullptr;
+        Ptr<ArsenalRecorder>               mRecorder = nullptr;
+        Ptr<CombatLog>                     mCombatLog = nullptr;
+        StatSet                            mStats;
+        TokenSet                           mTokens;
+        std::unique_ptr<EffectSet>         mEffects;
+        std::unique_ptr<AbilitySet>        mAbilities;
+        Table<Stat, Vector<Scene::Entity>> mFollowers;
+        Vector<Coordinator::ForwardEvent>  mForwarded;
     };
 }
\ No newline at end of file
@@ -0,0 +1,165 @@
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// Copyright (C) 2025 by Agustin L. Alvarez. All rights reserved.
+//
+// This work is licensed under the terms of the MIT license.
+//
+// For a copy, see <https://opensource.org/licenses/MIT>.
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [  HEADER  ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#include "Gameplay/Arsenal/ArsenalDelta.hpp"
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [   CODE   ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+namespace Gameplay
+{
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    ArsenalDelta::ArsenalDelta()
+        : mEffects   { true },
+          mBits      { 0 },
+          mActor     { 0 },
+          mTimestamp { 0.0 },
+          mOpen      { false }
+    {
+        mStats.fill(~0ull);
+        mTokens.fill(~0ull);
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void ArsenalDelta::Begin(Scene::Entity Actor, Real64 Timestamp)
+    {
+        LOG_ASSERT(!mOpen, "The delta of the previous actor was not completed.");
+
+        mActor     = Actor.GetID();
+        mTimestamp = Timestamp;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void ArsenalDelta::End()
+    {
+        if (mOpen)
+        {
+            Write(static_cast<UInt64>(Tag::End), 2);
+            mOpen = false;
+        }
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void ArsenalDelta::Publish(Stat Target, Scene::Entity Entity, Real32 /*Previous*/, Real32 Current)
+    {
+        LOG_ASSERT(Entity.GetID() == mActor, "Publishing a change of an actor outside its delta.");
+
+        WriteTag(Tag::Stat);
+        Write(Target.GetID(), kStatBits);
+        Write(std::bit_cast<UInt32>(Current), 32);
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void ArsenalDelta::Publish(Token Target, Scene::Entity Entity, UInt32 /*Previous*/, UInt32 Current)
+    {
+        LOG_ASSERT(Entity.GetID() == mActor, "Publishing a change of an actor outside its delta.");
+
+        WriteTag(Tag::Token);
+        Write(TokenRepository::View().GetIndex(Target), kTokenBits);
+        WriteVarying(Current, 3);
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void ArsenalDelta::Publish(Effect Target, Scene::Entity Entity, EffectSet::Event Event, ConstPtr<EffectInstance> Instance)
+    {
+        LOG_ASSERT(Entity.GetID() == mActor, "Publishing a change of an actor outside its delta.");
+
+        if (!mEffects)
+        {
+            return;
+        }
+
+        WriteTag(Tag::Effect);
+        Write(Target.GetID(), kEffectBits);
+        Write(static_cast<UInt64>(Event), 2);
+
+        if (Event == EffectSet::Event::Insert)
+        {
+            Write(Instance->GetArchetype()->GetHandle().GetID(), kArchetypeBits);
+        }
+
+        if (Event != EffectSet::Event::Remove)
+        {
+            // Expirations are sent relative to the tick, permanent effects keep an infinite remaining time.
+            const Real32 Remaining = static_cast<Real32>(Instance->GetExpiration() - mTimestamp);
+
+            WriteVarying(Instance->GetStack(), 3);
+            Write(std::bit_cast<UInt32>(Instance->GetIntensity()), 32);
+            Write(std::bit_cast<UInt32>(Remaining), 32);
+        }
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void ArsenalDelta::Write(UInt64 Value, UInt32 Count)
+    {
+        while (Count > 0)
+        {
+            if (mBits % 8 == 0)
+            {
+                mData.emplace_back(static_cast<Byte>(0));
+            }
+
+            const UInt32 Bit  = mBits % 8;
+            const UInt32 Take = Min(8 - Bit, Count);
+
+            mData.back() |= static_cast<Byte>((Value & ((1u << Take) - 1)) << Bit);
+
+            Value >>= Take;
+            Count  -= Take;
+            mBits  += Take;
+        }
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void ArsenalDelta::WriteVarying(UInt64 Value, UInt32 Group)
+    {
+        do
+        {
+            Write(Value, Group);
+            Value >>= Group;
+            Write(Value != 0, 1);
+        }
+        while (Value != 0);
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void ArsenalDelta::WriteTag(Tag Entry)
+    {
+        // The actor is only written along with its first change, so idle actors leave no trace in the stream.
+        if (!mOpen)
+        {
+            Write(1, 1);
+            WriteVarying(mActor, 7);
+            mOpen = true;
+        }
+        Write(static_cast<UInt64>(Entry), 2);
+    }
+}
\ No newline at end of file
@@ -0,0 +1,346 @@
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// Copyright (C) 2025 by Agustin L. Alvarez. All rights reserved.
+//
+// This work is licensed under the terms of the MIT license.
+//
+// For a copy, see <https://opensource.org/licenses/MIT>.
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#pragma once
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [  HEADER  ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+
+#include "Gameplay/Effect/EffectRepository.hpp"
+#include "Gameplay/Effect/EffectSet.hpp"
+#include "Gameplay/Stat/StatRepository.hpp"
+#include "Gameplay/Token/TokenRepository.hpp"
+#include <Zyphryon.Scene/Entity.hpp>
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [   CODE   ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+namespace Gameplay
+{
+    /// \brief Encodes the changes of arsenals into a compact bit-packed stream, one delta per actor and tick.
+    ///
+    /// The encoder is passed as the listener of `Arsenal::Tick` along with its interest filters, so stat, token
+    /// and effect changes are packed as they are polled instead of going through delegates. Handles are written
+    /// with the fewest bits their capacity allows and counts with variable length, actors without any change of
+    /// interest cost nothing.
+    ///
+    /// Each actor starts with a set bit and its identifier, followed by tagged changes and an end tag. Tokens are
+    /// written by dense index, so both ends must have loaded the same token hierarchy.
+    class ArsenalDelta final
+    {
+    public:
+
+        /// \brief Number of bits used to write a stat identifier.
+        static constexpr UInt32 kStatBits      = std::bit_width(StatRepository::kMaxArchetypes - 1);
+
+        /// \brief Number of bits used to write the dense index of a token.
+        static constexpr UInt32 kTokenBits     = std::bit_width(TokenRepository::kMaxTokens - 1);
+
+        /// \brief Number of bits used to write the handle of an effect instance.
+        static constexpr UInt32 kEffectBits    = std::bit_width(EffectSet::kMaxInstances - 1);
+
+        /// \brief Number of bits used to write the handle of an effect archetype.
+        static constexpr UInt32 kArchetypeBits = std::bit_width(EffectRepository::kMaxArchetypes - 1);
+
+        /// \brief Tags identifying each entry of an actor delta.
+        enum class Tag : UInt8
+        {
+            End,        ///< The delta of the actor is complete.
+            Stat,       ///< A stat changed its effective value.
+            Token,      ///< A token changed its count.
+            Effect,     ///< An effect instance was inserted, updated or removed.
+        };
+
+        /// \brief Represents a decoded change of an effect instance.
+        struct EffectChange final
+        {
+            /// \brief The handle of the effect instance within the arsenal.
+            Effect           Handle;
+
+            /// \brief The kind of change.
+            EffectSet::Event Event     = EffectSet::Event::Insert;
+
+            /// \brief The archetype of the effect, only written on insertion.
+            Effect           Archetype;
+
+            /// \brief The current stack count of the effect.
+            UInt16           Stack     = 0;
+
+            /// \brief The current intensity of the effect.
+            Real32           Intensity = 0.0f;
+
+            /// \brief The time left before the effect expires, relative to the encoded timestamp.
+            Real32           Remaining = 0.0f;
+        };
+
+    public:
+
+        /// \brief Constructs an encoder interested in every stat, token and effect.
+        ArsenalDelta();
+
+        /// \brief Adds a stat to the interest of the encoder.
+        ///
+        /// \param Handle The handle of the stat to replicate.
+        ZYPHRYON_INLINE void Include(Stat Handle)
+        {
+            mStats[Handle.GetID() / 64] |= (1ull << (Handle.GetID() % 64));
+        }
+
+        /// \brief Removes a stat from the interest of the encoder.
+        ///
+        /// \param Handle The handle of the stat to stop replicating.
+        ZYPHRYON_INLINE void Exclude(Stat Handle)
+        {
+            mStats[Handle.GetID() / 64] &= ~(1ull << (Handle.GetID() % 64));
+        }
+
+        /// \brief Adds a token to the interest of the encoder.
+        ///
+        /// \note The token hierarchy must be loaded, since the interest is indexed by dense token index.
+        ///
+        /// \param Handle The handle of the token to replicate.
+        ZYPHRYON_INLINE void Include(Token Handle)
+        {
+            const UInt32 Index = TokenRepository::View().GetIndex(Handle);
+            mTokens[Index / 64] |= (1ull << (Index % 64));
+        }
+
+        /// \brief Removes a token from the interest of the encoder.
+        ///
+        /// \param Handle The handle of the token to stop replicating.
+        ZYPHRYON_INLINE void Exclude(Token Handle)
+        {
+            const UInt32 Index = TokenRepository::View().GetIndex(Handle);
+            mTokens[Index / 64] &= ~(1ull << (Index % 64));
+        }
+
+        /// \brief Sets whether effect changes are part of the interest of the encoder.
+        ///
+        /// \param Enabled `true` to replicate effect changes, `false` to discard them.
+        ZYPHRYON_INLINE void SetEffectInterest(Bool Enabled)
+        {
+            mEffects = Enabled;
+        }
+
+        /// \brief Retrieves the bitset of stats, indexed by identifier, the encoder is interested in.
+        ///
+        /// \return The stat interest bitset, to be passed to `Arsenal::Tick`.
+        ZYPHRYON_INLINE ConstRef<Array<UInt64, StatRepository::kWords>> GetStatInterest() const
+        {
+            return mStats;
+        }
+
+        /// \brief Retrieves the bitset of tokens, indexed by dense index, the encoder is interested in.
+        ///
+        /// \return The token interest bitset, to be passed to `Arsenal::Tick`.
+        ZYPHRYON_INLINE ConstRef<Array<UInt64, TokenRepository::kWords>> GetTokenInterest() const
+        {
+            return mTokens;
+        }
+
+        /// \brief Starts the delta of an actor, every change published until `End` belongs to it.
+        ///
+        /// \param Actor     The entity whose changes are about to be published.
+        /// \param Timestamp The current timestamp, effect expirations are written relative to it.
+        void Begin(Scene::Entity Actor, Real64 Timestamp);
+
+        /// \brief Completes the delta of the current actor, discarding it if no change was published.
+        void End();
+
+        /// \brief Encodes a stat change of the current actor.
+        ///
+        /// \param Target   The handle of the modified stat.
+        /// \param Entity   The entity whose stat was modified.
+        /// \param Previous The previous value of the stat.
+        /// \param Current  The current value of the stat.
+        void Publish(Stat Target, Scene::Entity Entity, Real32 Previous, Real32 Current);
+
+        /// \brief Encodes a token change of the current actor.
+        ///
+        /// \param Target   The handle of the modified token.
+        /// \param Entity   The entity whose token was modified.
+        /// \param Previous The previous count of the token.
+        /// \param Current  The current count of the token.
+        void Publish(Token Target, Scene::Entity Entity, UInt32 Previous, UInt32 Current);
+
+        /// \brief Encodes an effect change of the current actor.
+        ///
+        /// \param Target   The handle of the effect instance that changed.
+        /// \param Entity   The entity whose effect changed.
+        /// \param Event    The kind of change.
+        /// \param Instance The effect instance, or `nullptr` if it was removed.
+        void Publish(Effect Target, Scene::Entity Entity, EffectSet::Event Event, ConstPtr<EffectInstance> Instance);
+
+        /// \brief Retrieves the stream encoded since the last reset.
+        ///
+        /// \return A span over the encoded stream, padded with zero bits to a whole byte.
+        ZYPHRYON_INLINE ConstSpan<Byte> GetData() const
+        {
+            return mData;
+        }
+
+        /// \brief Discards the encoded stream, keeping its memory and the interest of the encoder.
+        ZYPHRYON_INLINE void Reset()
+        {
+            mData.clear();
+            mBits = 0;
+        }
+
+    public:
+
+        /// \brief Decodes a stream produced by the encoder.
+        ///
+        /// \note The action is invoked as `Action(UInt64, Stat, Real32)` for stats, `Action(UInt64, Token, UInt32)`
+        ///       for tokens and `Action(UInt64, ConstRef<EffectChange>)` for effects, the first argument being
+        ///       the identifier of the actor.
+        ///
+        /// \param Data   The encoded stream.
+        /// \param Action The action to invoke for each decoded change.
+        template<typename Function>
+        ZYPHRYON_INLINE static void Decode(ConstSpan<Byte> Data, AnyRef<Function> Action)
+        {
+            ConstRef<TokenRepository> Repository = TokenRepository::View();
+
+            Cursor Input { Data };
+
+            // Padding bits are zero, so the stream ends as soon as no further actor is flagged.
+            while (Input.Read(1) != 0)
+            {
+                const UInt64 Actor = Input.ReadVarying(7);
+
+                for (Tag Entry = static_cast<Tag>(Input.Read(2)); Entry != Tag::End; Entry = static_cast<Tag>(Input.Read(2)))
+                {
+                    switch (Entry)
+                    {
+                    case Tag::Stat:
+                    {
+                        const Stat Handle = Input.Read(kStatBits);
+                        Action(Actor, Handle, std::bit_cast<Real32>(static_cast<UInt32>(Input.Read(32))));
+                        break;
+                    }
+                    case Tag::Token:
+                    {
+                        const Token Handle = Repository.GetByIndex(Input.Read(kTokenBits));
+                        Action(Actor, Handle, static_cast<UInt32>(Input.ReadVarying(3)));
+                        break;
+                    }
+                    case Tag::Effect:
+                    {
+                        EffectChange Change;
+                        Change.Handle = Input.Read(kEffectBits);
+                        Change.Event  = static_cast<EffectSet::Event>(Input.Read(2));
+
+                        if (Change.Event == EffectSet::Event::Insert)
+                        {
+                            Change.Archetype = Input.Read(kArchetypeBits);
+                        }
+
+                        if (Change.Event != EffectSet::Event::Remove)
+                        {
+                            Change.Stack     = Input.ReadVarying(3);
+                            Change.Intensity = std::bit_cast<Real32>(static_cast<UInt32>(Input.Read(32)));
+                            Change.Remaining = std::bit_cast<Real32>(static_cast<UInt32>(Input.Read(32)));
+                        }
+                        Action(Actor, Change);
+                        break;
+                    }
+                    case Tag::End:
+                        break;
+                    }
+                }
+            }
+        }
+
+    private:
+
+        /// \brief Reads bits from an encoded stream, yielding zero bits once it is exhausted.
+        struct Cursor final
+        {
+            /// \brief The encoded stream.
+            ConstSpan<Byte> Data;
+
+            /// \brief The offset of the next bit to read.
+            UInt64          Offset = 0;
+
+            /// \brief Reads a value of the given width, least significant bit first.
+            ///
+            /// \param Count The number of bits to read, at most 64.
+            /// \return The value read.
+            ZYPHRYON_INLINE UInt64 Read(UInt32 Count)
+            {
+                UInt64 Value = 0;
+
+                for (UInt32 Shift = 0; Shift < Count && Offset / 8 < Data.size();)
+                {
+                    const UInt32 Bit  = Offset % 8;
+                    const UInt32 Take = Min(8 - Bit, Count - Shift);
+                    const UInt32 Part = (static_cast<UInt32>(Data[Offset / 8]) >> Bit) & ((1u << Take) - 1);
+
+                    Value  |= static_cast<UInt64>(Part) << Shift;
+                    Shift  += Take;
+                    Offset += Take;
+                }
+                return Value;
+            }
+
+            /// \brief Reads a variable length value written in groups of the given width.
+            ///
+            /// \param Group The number of value bits in each group.
+            /// \return The value read.
+            ZYPHRYON_INLINE UInt64 ReadVarying(UInt32 Group)
+            {
+                UInt64 Value = 0;
+
+                for (UInt32 Shift = 0; Shift < 64; Shift += Group)
+                {
+                    Value |= Read(Group) << Shift;
+
+                    if (Read(1) == 0)
+                    {
+                        break;
+                    }
+                }
+                return Value;
+            }
+        };
+
+        /// \brief Writes a value of the given width, least significant bit first.
+        ///
+        /// \param Value The value to write.
+        /// \param Count The number of bits to write, at most 64.
+        void Write(UInt64 Value, UInt32 Count);
+
+        /// \brief Writes a value in groups of the given width, each followed by a continuation bit.
+        ///
+        /// \param Value The value to write.
+        /// \param Group The number of value bits in each group.
+        void WriteVarying(UInt64 Value, UInt32 Group);
+
+        /// \brief Writes the tag of an entry, opening the delta of the current actor on its first entry.
+        ///
+        /// \param Entry The tag of the entry.
+        void WriteTag(Tag Entry);
+
+    private:
+
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+        Array<UInt64, StatRepository::kWords>  mStats;
+        Array<UInt64, TokenRepository::kWords> mTokens;
+        Bool                                   mEffects;
+        Vector<Byte>                           mData;
+        UInt64                                 mBits;
+        UInt64                                 mActor;
+        Real64                                 mTimestamp;
+        Bool                                   mOpen;
+    };
+}
\ No newline at end of file
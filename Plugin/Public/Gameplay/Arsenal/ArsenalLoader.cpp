@@ -0,0 +1,220 @@
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// Copyright (C) 2025 by Agustin L. Alvarez. All rights reserved.
+//
+// This work is licensed under the terms of the MIT license.
+//
+// For a copy, see <https://opensource.org/licenses/MIT>.
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [  HEADER  ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#include "Gameplay/Arsenal/ArsenalLoader.hpp"
+#include <latch>
+#include <thread>
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [   CODE   ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+namespace Gameplay
+{
+    namespace
+    {
+        /// \brief Retrieves a resource from the content service, or an empty blob when no filename is given.
+        ///
+        /// \param Content  The content service to load from.
+        /// \param Filename The filename of the resource to load.
+        /// \return The resource data.
+        ZYPHRYON_INLINE Blob Fetch(Ref<Content::Service> Content, ConstStr8 Filename)
+        {
+            return (Filename.empty() ? Blob() : Content.Find(Filename));
+        }
+
+        /// \brief Checks whether a resource holds TOML text that the pipeline has to parse.
+        ///
+        /// \param Data The resource data.
+        /// \return `true` if the resource is a non-empty TOML resource, `false` otherwise.
+        ZYPHRYON_INLINE Bool IsText(ConstRef<Blob> Data)
+        {
+            return Data && !BakeReader::IsBaked(Data.GetSpan());
+        }
+
+        /// \brief Parses the archetypes of a TOML resource, building them once the token hierarchy is available.
+        ///
+        /// \param Data       The resource data.
+        /// \param Key        The name of the array holding the archetypes.
+        /// \param Tokens     The latch released once all tokens are registered.
+        /// \param Archetypes The vector receiving the parsed archetypes.
+        template<typename Type>
+        void Parse(ConstRef<Blob> Data, ConstStr8 Key, Ref<std::latch> Tokens, Ref<Vector<Type>> Archetypes)
+        {
+            if (!IsText(Data))
+            {
+                return;
+            }
+
+            TOMLParser      Parser(Data.GetText());
+            const TOMLArray Root = Parser.GetArray(Key);
+
+            // Formulas may name tokens, so archetypes are only built once the hierarchy is in place.
+            Tokens.wait();
+
+            Archetypes.reserve(Root.GetSize());
+
+            for (UInt32 Element = 0; Element < Root.GetSize(); ++Element)
+            {
+                Archetypes.emplace_back(Root.GetSection(Element));
+            }
+        }
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void ArsenalLoader::Load(Ref<Content::Service> Content, ConstRef<Manifest> Manifest)
+    {
+        // Fetch the resources up front, so the worker threads never touch the content service.
+        const Blob StatData    = Fetch(Content, Manifest.Stats);
+        Blob       EffectData  = Fetch(Content, Manifest.Effects);
+        Blob       AbilityData = Fetch(Content, Manifest.Abilities);
+
+        Vector<StatArchetype>          ParsedStats;
+        Vector<EffectArchetype>        ParsedEffects;
+        Vector<AbilityArchetype>       ParsedAbilities;
+        Vector<std::pair<Stat, Stat>>  ValueDependencies;
+        Vector<std::pair<Stat, Token>> TokenDependencies;
+
+        std::latch Tokens(1);
+
+        std::thread StatWorker([&]
+        {
+            Parse(StatData, "Stat", Tokens, ParsedStats);
+
+            // Collect the dependencies on the worker as well, the calling thread only merges them.
+            for (ConstRef<StatArchetype> Archetype : ParsedStats)
+            {
+                Archetype.Traverse([&]<typename T0>(T0 Dependency)
+                {
+                    if constexpr (std::is_same_v<T0, Stat>)
+                    {
+                        ValueDependencies.emplace_back(Archetype.GetHandle(), Dependency);
+                    }
+                    else
+                    {
+                        TokenDependencies.emplace_back(Archetype.GetHandle(), Dependency);
+                    }
+                });
+            }
+        });
+
+        std::thread EffectWorker([&]
+        {
+            Parse(EffectData, "Effect", Tokens, ParsedEffects);
+        });
+
+        std::thread AbilityWorker([&]
+        {
+            Parse(AbilityData, "Ability", Tokens, ParsedAbilities);
+        });
+
+        // Load the tokens on the calling thread while the other resources parse their text.
+        if (!Manifest.Tokens.empty())
+        {
+            TokenRepository::Instance().Load(Content, Manifest.Tokens);
+        }
+        Tokens.count_down();
+
+        StatWorker.join();
+        EffectWorker.join();
+        AbilityWorker.join();
+
+        // Insert in dependency order: stats, then the effects modifying them, then the abilities applying those.
+        Ref<StatRepository> Stats = StatRepository::Instance();
+
+        if (IsText(StatData))
+        {
+            for (Ref<StatArchetype> Archetype : ParsedStats)
+            {
+                Stats.Insert(Move(Archetype));
+            }
+
+            for (const auto & [Dependant, Dependency] : ValueDependencies)
+            {
+                Stats.InsertDependency(Dependant, Dependency);
+            }
+
+            for (const auto & [Dependant, Dependency] : TokenDependencies)
+            {
+                Stats.InsertDependency(Dependant, Dependency);
+            }
+            Stats.Rebuild();
+        }
+        else if (StatData)
+        {
+            Stats.Load(Content, Manifest.Stats);
+        }
+
+        Ref<EffectRepository> Effects = EffectRepository::Instance();
+
+        if (IsText(EffectData))
+        {
+            for (Ref<EffectArchetype> Archetype : ParsedEffects)
+            {
+                Effects.Insert(Move(Archetype));
+            }
+        }
+        else if (EffectData && Manifest.Streaming)
+        {
+            Effects.Stream(Move(EffectData));
+        }
+        else if (EffectData)
+        {
+            Effects.Load(Content, Manifest.Effects);
+        }
+
+        Ref<AbilityRepository> Abilities = AbilityRepository::Instance();
+
+        if (IsText(AbilityData))
+        {
+            for (Ref<AbilityArchetype> Archetype : ParsedAbilities)
+            {
+                Abilities.Insert(Move(Archetype));
+            }
+        }
+        else if (AbilityData && Manifest.Streaming)
+        {
+            Abilities.Stream(Move(AbilityData));
+        }
+        else if (AbilityData)
+        {
+            BakeReader Reader(AbilityData.GetSpan());
+            Abilities.Load(Reader);
+        }
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void ArsenalLoader::Freeze()
+    {
+        TokenRepository::Instance().Freeze();
+        StatRepository::Instance().Freeze();
+        EffectRepository::Instance().Freeze();
+        AbilityRepository::Instance().Freeze();
+        CueRepository::Instance().Freeze();
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void ArsenalLoader::Thaw()
+    {
+        TokenRepository::Instance().Thaw();
+        StatRepository::Instance().Thaw();
+        EffectRepository::Instance().Thaw();
+        AbilityRepository::Instance().Thaw();
+        CueRepository::Instance().Thaw();
+    }
+}
\ No newline at end of file
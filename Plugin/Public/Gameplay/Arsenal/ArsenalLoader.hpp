@@ -0,0 +1,73 @@
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// Copyright (C) 2025 by Agustin L. Alvarez. All rights reserved.
+//
+// This work is licensed under the terms of the MIT license.
+//
+// For a copy, see <https://opensource.org/licenses/MIT>.
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#pragma once
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [  HEADER  ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#include "Gameplay/Ability/AbilityRepository.hpp"
+#include "Gameplay/Cue/CueRepository.hpp"
+#include "Gameplay/Effect/EffectRepository.hpp"
+#include "Gameplay/Stat/StatRepository.hpp"
+#include "Gameplay/Token/TokenRepository.hpp"
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [   CODE   ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+namespace Gameplay
+{
+    /// \brief Loads the token, stat, effect and ability repositories together, parsing their resources in parallel.
+    ///
+    /// Each TOML resource is parsed and turned into archetypes on its own thread, while tokens load on the calling
+    /// thread. Archetypes wait for the token hierarchy before they are built, since formulas may name tokens, and
+    /// are then inserted serially in dependency order: stats, effects and finally abilities.
+    class ArsenalLoader final
+    {
+    public:
+
+        /// \brief Filenames of the resources to load, any of them may be left empty to skip it.
+        struct Manifest final
+        {
+            /// \brief The filename of the token resource.
+            ConstStr8 Tokens;
+
+            /// \brief The filename of the stat resource.
+            ConstStr8 Stats;
+
+            /// \brief The filename of the effect resource.
+            ConstStr8 Effects;
+
+            /// \brief The filename of the ability resource.
+            ConstStr8 Abilities;
+
+            /// \brief Whether baked effect and ability resources are streamed instead of loaded up front.
+            Bool      Streaming = false;
+        };
+
+    public:
+
+        /// \brief Loads every resource of the manifest into its repository.
+        ///
+        /// \note Baked resources need no parsing and are handed to their repository as is.
+        ///
+        /// \param Content  The content service to load from.
+        /// \param Manifest The filenames of the resources to load.
+        static void Load(Ref<Content::Service> Content, ConstRef<Manifest> Manifest);
+
+        /// \brief Freezes every repository once loading is done, so arsenals can be ticked from several threads.
+        ///
+        /// \note Stats and effects can still be hot-reloaded through `Arsenal::Reload` between ticks.
+        static void Freeze();
+
+        /// \brief Thaws every repository, so they can be loaded or edited again.
+        static void Thaw();
+    };
+}
\ No newline at end of file
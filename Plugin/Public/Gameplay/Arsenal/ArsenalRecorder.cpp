@@ -0,0 +1,186 @@
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// Copyright (C) 2025 by Agustin L. Alvarez. All rights reserved.
+//
+// This work is licensed under the terms of the MIT license.
+//
+// For a copy, see <https://opensource.org/licenses/MIT>.
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [  HEADER  ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#include "Gameplay/Arsenal/ArsenalRecorder.hpp"
+#include "Gameplay/Arsenal/Arsenal.hpp"
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [   CODE   ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+namespace Gameplay
+{
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void ArsenalRecorder::Clear()
+    {
+        std::lock_guard Guard(mMutex);
+
+        // Keep the streams registered, their threads hold a cached pointer to them.
+        for (ConstRef<std::unique_ptr<Stream>> Current : mStreams)
+        {
+            Current->Writer = BakeWriter();
+            Current->Entries.clear();
+        }
+        mSequence.store(0, std::memory_order_relaxed);
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void ArsenalRecorder::Save(Ref<BakeWriter> Writer) const
+    {
+        // Gather the commands of every thread, and interleave them back in the order they were issued.
+        Vector<std::pair<UInt64, ConstSpan<Byte>>> Commands;
+
+        for (ConstRef<std::unique_ptr<Stream>> Current : mStreams)
+        {
+            const ConstSpan<Byte> Data = Current->Writer.GetData();
+
+            for (ConstRef<Stream::Entry> Entry : Current->Entries)
+            {
+                Commands.emplace_back(Entry.Sequence, Data.subspan(Entry.Offset, Entry.Size));
+            }
+        }
+        std::ranges::sort(Commands, {}, &std::pair<UInt64, ConstSpan<Byte>>::first);
+
+        Writer.Write(static_cast<UInt32>(Commands.size()));
+
+        for (ConstRef<std::pair<UInt64, ConstSpan<Byte>>> Command : Commands)
+        {
+            Writer.WriteBytes(Command.second);
+        }
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    UInt32 ArsenalRecorder::Replay(ConstSpan<Byte> Data, ConstRef<OnResolve> Resolve)
+    {
+        BakeReader Reader(Data);
+
+        if (!Reader.Open(BakeKind::Recording))
+        {
+            return 0;
+        }
+
+        const UInt32 Count    = Reader.Read<UInt32>();
+        UInt32       Replayed = 0;
+
+        for (UInt32 Index = 0; Index < Count && Reader.IsValid(); ++Index)
+        {
+            const Command       Type  = Reader.Read<Command>();
+            const Scene::Entity Actor = Resolve(Reader.Read<UInt64>());
+
+            // The arguments are always read, so an unresolved actor only skips its own command.
+            switch (Type)
+            {
+            case Command::Tick:
+            {
+                const Real64 Timestamp = Reader.Read<Real64>();
+
+                if (Actor.IsValid())
+                {
+                    Actor.Get<Arsenal>().Tick(Timestamp, Coordinator::Instance());
+                }
+                break;
+            }
+            case Command::ApplyEffect:
+            {
+                const Scene::Entity Instigator = Resolve(Reader.Read<UInt64>());
+                const Real64        Timestamp  = Reader.Read<Real64>();
+
+                EffectSpec Specification;
+                Specification.Load(Reader);
+
+                if (Actor.IsValid())
+                {
+                    Actor.Get<Arsenal>().ApplyEffect(Instigator, Specification, Timestamp);
+                }
+                break;
+            }
+            case Command::RevertEffect:
+            {
+                const Effect Handle    = Reader.Read<UInt16>();
+                const Real64 Timestamp = Reader.Read<Real64>();
+
+                if (Actor.IsValid())
+                {
+                    Actor.Get<Arsenal>().RevertEffect(Handle, Timestamp);
+                }
+                break;
+            }
+            case Command::Dispel:
+            {
+                const Token  Category  = Reader.Read<UInt32>();
+                const Real64 Timestamp = Reader.Read<Real64>();
+
+                if (Actor.IsValid())
+                {
+                    Actor.Get<Arsenal>().Dispel(Category, Timestamp);
+                }
+                break;
+            }
+            case Command::ApplyModifier:
+            case Command::RevertModifier:
+            {
+                const Stat   Handle    = Reader.Read<UInt16>();
+                const StatOp Operation = Reader.Read<StatOp>();
+                const Real32 Magnitude = Reader.Read<Real32>();
+                const UInt32 Source    = Reader.Read<UInt32>();
+
+                if (Actor.IsValid())
+                {
+                    if (Type == Command::ApplyModifier)
+                    {
+                        Actor.Get<Arsenal>().ApplyModifier(Handle, Operation, Magnitude, Source);
+                    }
+                    else
+                    {
+                        Actor.Get<Arsenal>().RevertModifier(Handle, Operation, Magnitude, Source);
+                    }
+                }
+                break;
+            }
+            case Command::InsertToken:
+            case Command::RemoveToken:
+            {
+                const Token  Handle = Reader.Read<UInt32>();
+                const UInt32 Amount = Reader.Read<UInt32>();
+
+                if (Actor.IsValid())
+                {
+                    if (Type == Command::InsertToken)
+                    {
+                        Actor.Get<Arsenal>().InsertToken(Handle, Amount);
+                    }
+                    else
+                    {
+                        Actor.Get<Arsenal>().RemoveToken(Handle, Amount);
+                    }
+                }
+                break;
+            }
+            default:
+                LOG_WARNING("Unknown command {} in arsenal recording, aborting replay.", static_cast<UInt32>(Type));
+                return Replayed;
+            }
+
+            if (Actor.IsValid() && Reader.IsValid())
+            {
+                ++Replayed;
+            }
+        }
+        return Replayed;
+    }
+}
\ No newline at end of file
@@ -0,0 +1,296 @@
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// Copyright (C) 2025 by Agustin L. Alvarez. All rights reserved.
+//
+// This work is licensed under the terms of the MIT license.
+//
+// For a copy, see <https://opensource.org/licenses/MIT>.
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#pragma once
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [  HEADER  ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#include "Gameplay/Arsenal/GameplayContext.hpp"
+#include "Gameplay/Bake/BakeReader.hpp"
+#include "Gameplay/Bake/BakeWriter.hpp"
+#include "Gameplay/Effect/EffectSpec.hpp"
+#include "Gameplay/Stat/StatTypes.hpp"
+#include "Gameplay/Token/Token.hpp"
+#include <Zyphryon.Scene/Entity.hpp>
+#include <atomic>
+#include <memory>
+#include <thread>
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [   CODE   ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+namespace Gameplay
+{
+    /// \brief Records the commands issued to arsenals into a compact binary log, which can be replayed offline
+    ///        against fresh arsenals to reproduce a session deterministically.
+    ///
+    /// \note Only the outermost command is recorded, the modifiers and effects an arsenal applies on its own while
+    ///       executing another command are reproduced by replaying that command. Ability activations are recorded
+    ///       through the effects and modifiers they issue, so the log replays without the ability repository.
+    class ArsenalRecorder final
+    {
+    public:
+
+        /// \brief Enumerates the commands that can be recorded.
+        enum class Command : UInt8
+        {
+            Tick,               ///< The arsenal advanced to a timestamp.
+            ApplyEffect,        ///< An effect was applied to the arsenal.
+            RevertEffect,       ///< An effect was reverted from the arsenal.
+            Dispel,             ///< The effects of a category were dispelled from the arsenal.
+            ApplyModifier,      ///< A modifier was applied to a stat of the arsenal.
+            RevertModifier,     ///< A modifier was reverted from a stat of the arsenal.
+            InsertToken,        ///< A token was inserted into the arsenal.
+            RemoveToken,        ///< A token was removed from the arsenal.
+        };
+
+        /// \brief Represents a delegate that resolves the actor a recorded actor identifier maps to on replay.
+        using OnResolve = Delegate<Scene::Entity(UInt64), DelegateInlineSize::Small>;
+
+        /// \brief Tracks the nesting of commands on the calling thread, so only the outermost one is recorded.
+        class Scope final
+        {
+        public:
+
+            /// \brief Enters a command on the calling thread.
+            ZYPHRYON_INLINE Scope()
+            {
+                ++GetDepth();
+            }
+
+            /// \brief Leaves the command on the calling thread.
+            ZYPHRYON_INLINE ~Scope()
+            {
+                --GetDepth();
+            }
+
+            /// \brief Checks whether the command was issued from outside of any other command.
+            ///
+            /// \return `true` if the command is the outermost one, `false` otherwise.
+            ZYPHRYON_INLINE Bool IsOutermost() const
+            {
+                return GetDepth() == 1;
+            }
+
+        private:
+
+            /// \brief Retrieves the nesting depth of the calling thread.
+            ///
+            /// \return A reference to the nesting depth.
+            ZYPHRYON_INLINE static Ref<UInt32> GetDepth()
+            {
+                static thread_local UInt32 Depth = 0;
+                return Depth;
+            }
+        };
+
+    public:
+
+        /// \brief Records an arsenal advancing to a timestamp.
+        ///
+        /// \param Actor     The actor that owns the arsenal.
+        /// \param Timestamp The absolute time the arsenal advanced to.
+        ZYPHRYON_INLINE void RecordTick(Scene::Entity Actor, Real64 Timestamp)
+        {
+            Record(Command::Tick, Actor, [&](Ref<BakeWriter> Writer)
+            {
+                Writer.Write(Timestamp);
+            });
+        }
+
+        /// \brief Records an effect being applied to an arsenal.
+        ///
+        /// \param Actor         The actor that owns the arsenal.
+        /// \param Instigator    The entity that instigated the effect.
+        /// \param Specification The specification of the applied effect.
+        /// \param Timestamp     The timestamp of the application.
+        ZYPHRYON_INLINE void RecordApplyEffect(Scene::Entity Actor, Scene::Entity Instigator, ConstRef<EffectSpec> Specification, Real64 Timestamp)
+        {
+            Record(Command::ApplyEffect, Actor, [&](Ref<BakeWriter> Writer)
+            {
+                Writer.Write(Instigator.GetID());
+                Writer.Write(Timestamp);
+                Specification.Save(Writer);
+            });
+        }
+
+        /// \brief Records an effect being reverted from an arsenal.
+        ///
+        /// \param Actor     The actor that owns the arsenal.
+        /// \param Handle    The handle of the reverted effect.
+        /// \param Timestamp The timestamp of the removal.
+        ZYPHRYON_INLINE void RecordRevertEffect(Scene::Entity Actor, Effect Handle, Real64 Timestamp)
+        {
+            Record(Command::RevertEffect, Actor, [&](Ref<BakeWriter> Writer)
+            {
+                Writer.Write(Handle.GetID());
+                Writer.Write(Timestamp);
+            });
+        }
+
+        /// \brief Records the effects of a category being dispelled from an arsenal.
+        ///
+        /// \param Actor     The actor that owns the arsenal.
+        /// \param Category  The category token dispelled.
+        /// \param Timestamp The timestamp of the removal.
+        ZYPHRYON_INLINE void RecordDispel(Scene::Entity Actor, Token Category, Real64 Timestamp)
+        {
+            Record(Command::Dispel, Actor, [&](Ref<BakeWriter> Writer)
+            {
+                Writer.Write(Category.GetID());
+                Writer.Write(Timestamp);
+            });
+        }
+
+        /// \brief Records a modifier being applied to or reverted from a stat of an arsenal.
+        ///
+        /// \param Type      The command, either \ref Command::ApplyModifier or \ref Command::RevertModifier.
+        /// \param Actor     The actor that owns the arsenal.
+        /// \param Handle    The handle of the modified stat.
+        /// \param Operation The operation of the modifier.
+        /// \param Magnitude The magnitude of the modifier.
+        /// \param Source    The source of the modifier.
+        ZYPHRYON_INLINE void RecordModifier(Command Type, Scene::Entity Actor, Stat Handle, StatOp Operation, Real32 Magnitude, UInt32 Source)
+        {
+            Record(Type, Actor, [&](Ref<BakeWriter> Writer)
+            {
+                Writer.Write(Handle.GetID());
+                Writer.Write(Operation);
+                Writer.Write(Magnitude);
+                Writer.Write(Source);
+            });
+        }
+
+        /// \brief Records a token being inserted into or removed from an arsenal.
+        ///
+        /// \param Type   The command, either \ref Command::InsertToken or \ref Command::RemoveToken.
+        /// \param Actor  The actor that owns the arsenal.
+        /// \param Handle The handle of the token.
+        /// \param Count  The number of tokens inserted or removed.
+        ZYPHRYON_INLINE void RecordToken(Command Type, Scene::Entity Actor, Token Handle, UInt32 Count)
+        {
+            Record(Type, Actor, [&](Ref<BakeWriter> Writer)
+            {
+                Writer.Write(Handle.GetID());
+                Writer.Write(Count);
+            });
+        }
+
+        /// \brief Retrieves the number of commands recorded since the last clear.
+        ///
+        /// \return The number of recorded commands.
+        ZYPHRYON_INLINE UInt64 GetCount() const
+        {
+            return mSequence.load(std::memory_order_relaxed);
+        }
+
+        /// \brief Discards every recorded command.
+        ///
+        /// \note Must be called at a sync point, where no other thread is recording.
+        void Clear();
+
+        /// \brief Saves every recorded command, in the order they were issued, to a baked resource.
+        ///
+        /// \note Must be called at a sync point, where no other thread is recording.
+        ///
+        /// \param Writer The writer to save to.
+        void Save(Ref<BakeWriter> Writer) const;
+
+    public:
+
+        /// \brief Replays a recorded log against the arsenals of the resolved actors.
+        ///
+        /// \note Ticks are forwarded through the global coordinator, and commands whose actor does not resolve to a
+        ///       valid entity are skipped.
+        ///
+        /// \param Data    The binary data of the log, as written by \ref Save.
+        /// \param Resolve The delegate mapping every recorded actor identifier to the actor to replay it on.
+        /// \return The number of commands replayed, or `0` if the data is not a valid log.
+        static UInt32 Replay(ConstSpan<Byte> Data, ConstRef<OnResolve> Resolve);
+
+    private:
+
+        /// \brief Holds the commands recorded by a single thread.
+        struct Stream final
+        {
+            /// \brief Locates a recorded command within the stream.
+            struct Entry final
+            {
+                UInt64 Sequence;
+                UInt32 Offset;
+                UInt32 Size;
+            };
+
+            BakeWriter    Writer;
+            Vector<Entry> Entries;
+        };
+
+        /// \brief Records a command into the calling thread's stream.
+        ///
+        /// \param Type   The command to record.
+        /// \param Actor  The actor that owns the arsenal.
+        /// \param Action The callback writing the arguments of the command.
+        template<typename Function>
+        ZYPHRYON_INLINE void Record(Command Type, Scene::Entity Actor, AnyRef<Function> Action)
+        {
+            Ref<Stream> Current = GetStream();
+
+            const UInt Offset = Current.Writer.GetSize();
+            Current.Writer.Write(Type);
+            Current.Writer.Write(Actor.GetID());
+            Action(Current.Writer);
+
+            const UInt64 Sequence = mSequence.fetch_add(1, std::memory_order_relaxed);
+            Current.Entries.push_back({ Sequence, static_cast<UInt32>(Offset), static_cast<UInt32>(Current.Writer.GetSize() - Offset) });
+        }
+
+        /// \brief Retrieves the stream owned by the calling thread, registering it on first use.
+        ///
+        /// \return A reference to the calling thread's stream.
+        ZYPHRYON_INLINE Ref<Stream> GetStream()
+        {
+            // Cache the stream of the last recorder used on this thread, keyed by serial so recorders never share one.
+            static thread_local UInt64      Owner   = 0;
+            static thread_local Ptr<Stream> Current = nullptr;
+
+            if (Owner != mSerial)
+            {
+                std::lock_guard Guard(mMutex);
+
+                const std::thread::id Thread   = std::this_thread::get_id();
+                const auto            Iterator = std::ranges::find(mThreads, Thread);
+
+                if (Iterator != mThreads.end())
+                {
+                    Current = mStreams[std::distance(mThreads.begin(), Iterator)].get();
+                }
+                else
+                {
+                    Current = mStreams.emplace_back(std::make_unique<Stream>()).get();
+                    mThreads.push_back(Thread);
+                }
+                Owner = mSerial;
+            }
+            return * Current;
+        }
+
+    private:
+
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+        Vector<std::unique_ptr<Stream>> mStreams;
+        Vector<std::thread::id>         mThreads;
+        std::mutex                      mMutex;
+        std::atomic<UInt64>             mSequence = 0;
+        UInt64                          mSerial = GameplayContext::Serial();
+    };
+}
\ No newline at end of file
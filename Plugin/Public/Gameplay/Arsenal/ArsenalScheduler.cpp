@@ -0,0 +1,316 @@
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// Copyright (C) 2025 by Agustin L. Alvarez. All rights reserved.
+//
+// This work is licensed under the terms of the MIT license.
+//
+// For a copy, see <https://opensource.org/licenses/MIT>.
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [  HEADER  ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#include "Gameplay/Arsenal/ArsenalScheduler.hpp"
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [   CODE   ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+namespace Gameplay
+{
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    ArsenalScheduler::ArsenalScheduler(UInt32 Workers, UInt32 Nodes, OnStartWorker Affinity)
+        : mTime       { nullptr },
+          mContext    { nullptr },
+          mGeneration { 0 },
+          mPending    { 0 },
+          mExit       { false }
+    {
+        mWorkers.resize(Max(Workers, 1u));
+
+        const UInt32 Count   = mWorkers.size();
+        const UInt32 Domains = Clamp(Nodes, 1u, Count);
+
+        // Assign contiguous worker ranges to each node, so each node owns a contiguous range of actors.
+        for (UInt32 Index = 0; Index < Count; ++Index)
+        {
+            mWorkers[Index].Node = static_cast<UInt64>(Index) * Domains / Count;
+        }
+
+        // Order the victims of each worker, preferring workers on the same node to keep stealing local.
+        for (UInt32 Index = 0; Index < Count; ++Index)
+        {
+            Ref<Worker> Owner = mWorkers[Index];
+            Owner.Victims.reserve(Count);
+
+            for (UInt32 Offset = 0; Offset < Count; ++Offset)
+            {
+                if (const UInt32 Other = (Index + Offset) % Count; mWorkers[Other].Node == Owner.Node)
+                {
+                    Owner.Victims.emplace_back(Other);
+                }
+            }
+
+            for (UInt32 Offset = 0; Offset < Count; ++Offset)
+            {
+                if (const UInt32 Other = (Index + Offset) % Count; mWorkers[Other].Node != Owner.Node)
+                {
+                    Owner.Victims.emplace_back(Other);
+                }
+            }
+        }
+
+        // The calling thread acts as the first worker, spawn threads for the rest.
+        for (UInt32 Index = 1; Index < Count; ++Index)
+        {
+            mThreads.emplace_back(&ArsenalScheduler::Loop, this, Index, Affinity);
+        }
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    ArsenalScheduler::~ArsenalScheduler()
+    {
+        {
+            std::lock_guard Guard(mMutex);
+            mExit = true;
+        }
+        mWake.notify_all();
+
+        for (Ref<std::thread> Thread : mThreads)
+        {
+            Thread.join();
+        }
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void ArsenalScheduler::Tick(ConstRef<Time> Time)
+    {
+        // Resolve the coordinator once for the whole batch.
+        Ref<Coordinator> Coordinator = Coordinator::Instance();
+
+        if (mThreads.empty())
+        {
+            for (const Scene::Entity Actor : mActors)
+            {
+                Ref<Arsenal> Arsenal = Actor.Get<Gameplay::Arsenal>();
+
+                // Skip actors with no effect due and no pending notifications.
+                if (!Arsenal.IsIdle(Time))
+                {
+                    Arsenal.Tick(Time, Coordinator.GetQueue());
+                }
+            }
+            Coordinator.Dispatch();
+
+            // Cues are client-facing, they are drained once the whole batch is done.
+            CueRepository::Instance().Flush();
+
+            // Release the scratch memory of the frame at once.
+            FrameArena::Current().Reset();
+            return;
+        }
+
+        // Split the actors into one contiguous partition per worker.
+        const UInt32 Count = mActors.size();
+
+        for (UInt32 Index = 0; Index < mWorkers.size(); ++Index)
+        {
+            Ref<Worker> Worker = mWorkers[Index];
+            Worker.Cursor = static_cast<UInt64>(Count) * Index / mWorkers.size();
+            Worker.End    = static_cast<UInt64>(Count) * (Index + 1) / mWorkers.size();
+        }
+
+        // Wake the pooled workers and join them from the calling thread.
+        {
+            std::lock_guard Guard(mMutex);
+            mTime    = & Time;
+            mContext = & GameplayContext::Current();
+            mPending = mThreads.size();
+            ++mGeneration;
+        }
+        mWake.notify_all();
+
+        Run(0, Time);
+
+        {
+            std::unique_lock Guard(mMutex);
+            mDone.wait(Guard, [this]
+            {
+                return mPending == 0;
+            });
+        }
+
+        // Sync point, everything recorded by the workers is applied serially.
+        Merge(Time, Coordinator);
+
+        // Cues are client-facing, they are drained once the whole batch is done.
+        CueRepository::Instance().Flush();
+
+        // Release the scratch memory of the frame at once, pooled workers release their own.
+        FrameArena::Current().Reset();
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void ArsenalScheduler::ApplyEffect(Scene::Entity Target, Scene::Entity Instigator, ConstRef<EffectSpec> Specification, Real64 Timestamp)
+    {
+        if (const Ptr<Worker> Worker = GetCurrentWorker(); Worker)
+        {
+            Worker->Effects.emplace_back(Target, Instigator, Specification, Timestamp);
+        }
+        else
+        {
+            Target.Get<Arsenal>().ApplyEffect(Instigator, Specification, Timestamp);
+        }
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void ArsenalScheduler::Run(UInt32 Index, ConstRef<Time> Time)
+    {
+        Ref<Worker>             Owner = mWorkers[Index];
+        Ref<Coordinator::Queue> Queue = Coordinator::Instance().GetQueue();
+
+        GetCurrentWorker() = & Owner;
+
+        for (const UInt32 Target : Owner.Victims)
+        {
+            Ref<Worker> Victim = mWorkers[Target];
+
+            // Claim batches until the partition is drained, starting with our own.
+            while (true)
+            {
+                const UInt32 First = std::atomic_ref(Victim.Cursor).fetch_add(kBatchSize, std::memory_order_relaxed);
+
+                if (First >= Victim.End)
+                {
+                    break;
+                }
+
+                for (UInt32 Element = First, Last = Min(First + kBatchSize, Victim.End); Element < Last; ++Element)
+                {
+                    const Scene::Entity Actor = mActors[Element];
+
+                    Ref<Arsenal> Arsenal = Actor.Get<Gameplay::Arsenal>();
+
+                    // Skip actors with no effect due and no pending notifications.
+                    if (Arsenal.IsIdle(Time))
+                    {
+                        continue;
+                    }
+
+                    // Actors whose due effects read other actors are ticked at the sync point instead.
+                    if (Arsenal.IsIsolated(Time))
+                    {
+                        Arsenal.Tick(Time, Queue);
+                    }
+                    else
+                    {
+                        Owner.Deferred.emplace_back(Actor);
+                    }
+                }
+            }
+        }
+
+        GetCurrentWorker() = nullptr;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void ArsenalScheduler::Loop(UInt32 Index, OnStartWorker Affinity)
+    {
+        // Bind the thread to its node before it first touches any memory.
+        if (Affinity)
+        {
+            Affinity(Index, mWorkers[Index].Node);
+        }
+
+        UInt64 Generation = 0;
+
+        while (true)
+        {
+            ConstPtr<Time>       Time;
+            Ptr<GameplayContext> Context;
+            {
+                std::unique_lock Guard(mMutex);
+                mWake.wait(Guard, [&]
+                {
+                    return mExit || mGeneration != Generation;
+                });
+
+                if (mExit)
+                {
+                    return;
+                }
+
+                Generation = mGeneration;
+                Time       = mTime;
+                Context    = mContext;
+            }
+
+            {
+                const GameplayContext::Scope Guard(Context);
+                Run(Index, * Time);
+            }
+
+            FrameArena::Current().Reset();
+
+            {
+                std::lock_guard Guard(mMutex);
+
+                if (--mPending == 0)
+                {
+                    mDone.notify_one();
+                }
+            }
+        }
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void ArsenalScheduler::Merge(ConstRef<Time> Time, Ref<Coordinator> Coordinator)
+    {
+        // Publish the changes recorded during the parallel phase, grouped by handle.
+        Coordinator.Dispatch();
+
+        // Tick the actors that could not run in isolation, warming the instigators of each batch ahead of it.
+        for (Ref<Worker> Worker : mWorkers)
+        {
+            for (UInt32 First = 0; First < Worker.Deferred.size(); First += kBatchSize)
+            {
+                const UInt32 Last = Min(First + kBatchSize, static_cast<UInt32>(Worker.Deferred.size()));
+
+                for (UInt32 Element = First; Element < Last; ++Element)
+                {
+                    Worker.Deferred[Element].Get<Arsenal>().Prefetch(Time);
+                }
+
+                for (UInt32 Element = First; Element < Last; ++Element)
+                {
+                    Worker.Deferred[Element].Get<Arsenal>().Tick(Time, Coordinator);
+                }
+            }
+            Worker.Deferred.clear();
+        }
+
+        // Apply the cross-actor effects recorded during the parallel phase, each against the context of its target.
+        for (Ref<Worker> Worker : mWorkers)
+        {
+            for (ConstRef<EffectRecord> Record : Worker.Effects)
+            {
+                Record.Target.Get<Arsenal>().ApplyEffect(Record.Instigator, Record.Specification, Record.Timestamp);
+            }
+            Worker.Effects.clear();
+        }
+    }
+}
\ No newline at end of file
@@ -0,0 +1,232 @@
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// Copyright (C) 2025 by Agustin L. Alvarez. All rights reserved.
+//
+// This work is licensed under the terms of the MIT license.
+//
+// For a copy, see <https://opensource.org/licenses/MIT>.
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#pragma once
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [  HEADER  ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#include "Gameplay/Arsenal/Arsenal.hpp"
+#include "Gameplay/Arsenal/FrameArena.hpp"
+#include <condition_variable>
+#include <thread>
+
+#ifndef GAMEPLAY_SCHEDULER_BATCH_SIZE
+    #define GAMEPLAY_SCHEDULER_BATCH_SIZE 64
+#endif
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [   CODE   ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+namespace Gameplay
+{
+    /// \brief Ticks the arsenals of a whole world in a single batch, skipping actors with nothing due.
+    ///
+    /// With more than one worker, actors are partitioned across a work-stealing pool. Stat and token changes are
+    /// recorded into the coordinator's per-thread queues, and any work that reaches into another actor is recorded
+    /// into per-worker command buffers. Both are merged serially once all workers are done.
+    ///
+    /// Workers are grouped into contiguous per-node ranges, which own contiguous actor partitions, and steal from
+    /// workers of their own node before crossing to another. Partitions are stable while the actor list is, so the
+    /// catalogs and queues an actor grows during its tick are first touched, and placed, on the node that owns it.
+    ///
+    /// Each thread owns a `FrameArena` for scratch memory, which is reset wholesale at the end of every tick. Pooled
+    /// workers run under the context that was current on the thread calling `Tick`.
+    class ArsenalScheduler final
+    {
+    public:
+
+        /// \brief Number of actors a worker claims from a partition at a time.
+        static constexpr UInt32 kBatchSize = GAMEPLAY_SCHEDULER_BATCH_SIZE;
+
+        /// \brief Delegate invoked on each pooled worker thread before it runs, used to pin it to its node.
+        using OnStartWorker = Delegate<void(UInt32, UInt32), DelegateInlineSize::Small>;
+
+    public:
+
+        /// \brief Constructs a scheduler that ticks every actor on the calling thread.
+        ZYPHRYON_INLINE ArsenalScheduler()
+            : ArsenalScheduler(1)
+        {
+        }
+
+        /// \brief Constructs a scheduler that ticks actors over the given number of workers.
+        ///
+        /// \note The thread that calls `Tick` acts as the first worker and is assumed to live on the first node. The
+        ///       delegate receives the worker and node index, and must not touch the scheduler.
+        ///
+        /// \param Workers  The number of workers, including the thread that calls `Tick`.
+        /// \param Nodes    The number of memory domains the workers are spread across.
+        /// \param Affinity The delegate that binds a pooled worker thread to its node, if any.
+        explicit ArsenalScheduler(UInt32 Workers, UInt32 Nodes = 1, OnStartWorker Affinity = OnStartWorker());
+
+        /// \brief Stops and joins all worker threads.
+        ~ArsenalScheduler();
+
+        /// \brief Copying a scheduler is not allowed.
+        ArsenalScheduler(ConstRef<ArsenalScheduler>) = delete;
+
+        /// \brief Copying a scheduler is not allowed.
+        Ref<ArsenalScheduler> operator=(ConstRef<ArsenalScheduler>) = delete;
+
+        /// \brief Registers an actor whose arsenal should be ticked by the scheduler.
+        ///
+        /// \param Actor The entity that owns the arsenal.
+        ZYPHRYON_INLINE void Insert(Scene::Entity Actor)
+        {
+            LOG_ASSERT(Actor.IsValid(), "Attempted to schedule an invalid actor.");
+
+            mActors.emplace_back(Actor);
+        }
+
+        /// \brief Unregisters an actor from the scheduler.
+        ///
+        /// \note The order of the remaining actors is not preserved.
+        ///
+        /// \param Actor The entity that owns the arsenal.
+        ZYPHRYON_INLINE void Remove(Scene::Entity Actor)
+        {
+            const auto Filter = [Actor](Scene::Entity Other)
+            {
+                return Other.GetID() == Actor.GetID();
+            };
+
+            if (const auto Iterator = std::ranges::find_if(mActors, Filter); Iterator != mActors.end())
+            {
+                (* Iterator) = mActors.back();
+                mActors.pop_back();
+            }
+        }
+
+        /// \brief Clears all actors from the scheduler.
+        ZYPHRYON_INLINE void Clear()
+        {
+            mActors.clear();
+        }
+
+        /// \brief Retrieves the number of actors registered in the scheduler.
+        ///
+        /// \return The number of scheduled actors.
+        ZYPHRYON_INLINE UInt32 GetSize() const
+        {
+            return mActors.size();
+        }
+
+        /// \brief Retrieves the node a worker is bound to.
+        ///
+        /// \param Index The index of the worker.
+        /// \return The index of the node of the worker.
+        ZYPHRYON_INLINE UInt32 GetNode(UInt32 Index) const
+        {
+            return mWorkers[Index].Node;
+        }
+
+        /// \brief Advances the state of every scheduled arsenal that has work due.
+        ///
+        /// \param Time The current time reference.
+        void Tick(ConstRef<Time> Time);
+
+        /// \brief Applies an effect to an actor, deferring it to the sync point when called from a worker.
+        ///
+        /// \note Use this instead of `Arsenal::ApplyEffect` for cross-actor work issued from cue delegates.
+        ///
+        /// \param Target        The entity that receives the effect.
+        /// \param Instigator    The entity that is instigating the effect.
+        /// \param Specification The specification of the effect to apply.
+        /// \param Timestamp     The current timestamp for effect application (default is current elapsed time).
+        void ApplyEffect(Scene::Entity Target, Scene::Entity Instigator, ConstRef<EffectSpec> Specification, Real64 Timestamp = Time::Elapsed());
+
+    private:
+
+        /// \brief Represents an effect application recorded by a worker.
+        struct EffectRecord final
+        {
+            /// \brief The entity that receives the effect.
+            Scene::Entity Target;
+
+            /// \brief The entity that is instigating the effect.
+            Scene::Entity Instigator;
+
+            /// \brief The specification of the effect to apply.
+            EffectSpec    Specification;
+
+            /// \brief The timestamp of the effect application.
+            Real64        Timestamp;
+        };
+
+        /// \brief Holds the partition and command buffers owned by a single worker.
+        struct alignas(64) Worker final
+        {
+            /// \brief The next actor index to claim from this worker's partition.
+            UInt32               Cursor = 0;
+
+            /// \brief One past the last actor index of this worker's partition.
+            UInt32               End    = 0;
+
+            /// \brief The memory domain the worker is bound to.
+            UInt32               Node   = 0;
+
+            /// \brief The workers to claim batches from, own first, then the same node, then the rest.
+            Vector<UInt32>       Victims;
+
+            /// \brief The effect applications recorded during the parallel phase.
+            Vector<EffectRecord> Effects;
+
+            /// \brief The actors that read other actors and must be ticked at the sync point.
+            Vector<Scene::Entity> Deferred;
+        };
+
+    private:
+
+        /// \brief Processes actors from the worker's own partition, then steals from the others.
+        ///
+        /// \param Index The index of the worker.
+        /// \param Time  The current time reference.
+        void Run(UInt32 Index, ConstRef<Time> Time);
+
+        /// \brief Entry point of a pooled worker thread.
+        ///
+        /// \param Index    The index of the worker.
+        /// \param Affinity The delegate that binds the thread to its node, if any.
+        void Loop(UInt32 Index, OnStartWorker Affinity);
+
+        /// \brief Dispatches the queued changes and applies everything recorded by the workers, in worker order.
+        ///
+        /// \param Time        The current time reference.
+        /// \param Coordinator The coordinator to notify of any stat or token changes.
+        void Merge(ConstRef<Time> Time, Ref<Coordinator> Coordinator);
+
+        /// \brief Retrieves the worker bound to the calling thread.
+        ///
+        /// \return A reference to the worker pointer, which is `nullptr` outside of the parallel phase.
+        ZYPHRYON_INLINE static Ref<Ptr<Worker>> GetCurrentWorker()
+        {
+            static thread_local Ptr<Worker> Current = nullptr;
+            return Current;
+        }
+
+    private:
+
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+        Vector<Scene::Entity>   mActors;
+        Vector<Worker>          mWorkers;
+        Vector<std::thread>     mThreads;
+        std::mutex              mMutex;
+        std::condition_variable mWake;
+        std::condition_variable mDone;
+        ConstPtr<Time>          mTime;
+        Ptr<GameplayContext>    mContext;
+        UInt64                  mGeneration;
+        UInt32                  mPending;
+        Bool                    mExit;
+    };
+}
\ No newline at end of file
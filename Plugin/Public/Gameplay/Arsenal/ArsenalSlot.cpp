@@ -0,0 +1,77 @@
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// Copyright (C) 2025 by Agustin L. Alvarez. All rights reserved.
+//
+// This work is licensed under the terms of the MIT license.
+//
+// For a copy, see <https://opensource.org/licenses/MIT>.
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [  HEADER  ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#include "Gameplay/Arsenal/ArsenalSlot.hpp"
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [   CODE   ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+namespace Gameplay
+{
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    UInt32 ArsenalSlot::Acquire(Ptr<ArsenalSlot> Owner)
+    {
+        Ref<Registry> Registry = GetRegistry();
+
+        UInt32 Slot;
+        {
+            std::lock_guard Guard(Registry.Mutex);
+
+            if (!Registry.Free.empty())
+            {
+                Slot = Registry.Free.back();
+                Registry.Free.pop_back();
+            }
+            else if (Registry.Count < kChunkSize * kMaxChunks)
+            {
+                Slot = Registry.Count++;
+
+                if (Slot % kChunkSize == 0)
+                {
+                    Registry.Chunks[Slot / kChunkSize] = std::make_unique<Array<Entry, kChunkSize>>();
+                }
+            }
+            else
+            {
+                LOG_WARNING("Exceeded the maximum number of arsenal slots, instigator lookups will not be cached.");
+                return kNone;
+            }
+        }
+
+        Ref<Entry> Entry = GetEntry(Slot);
+        Entry.Owner = Owner;
+        ++Entry.Generation;
+        return Slot;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void ArsenalSlot::Release(UInt32 Slot)
+    {
+        if (Slot == kNone)
+        {
+            return;
+        }
+
+        Ref<Entry> Entry = GetEntry(Slot);
+        Entry.Owner = nullptr;
+        ++Entry.Generation;
+
+        Ref<Registry> Registry = GetRegistry();
+        std::lock_guard Guard(Registry.Mutex);
+        Registry.Free.push_back(Slot);
+    }
+}
\ No newline at end of file
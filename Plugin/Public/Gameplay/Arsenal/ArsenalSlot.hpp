@@ -0,0 +1,219 @@
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// Copyright (C) 2025 by Agustin L. Alvarez. All rights reserved.
+//
+// This work is licensed under the terms of the MIT license.
+//
+// For a copy, see <https://opensource.org/licenses/MIT>.
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#pragma once
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [  HEADER  ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#include <Zyphryon.Base/Base.hpp>
+#include <memory>
+#include <mutex>
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [   CODE   ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+namespace Gameplay
+{
+    /// \brief Gives the object deriving from it a stable slot that follows it across relocations by the scene.
+    ///
+    /// Each slot records the current address of its owner and a generation, bumped when the owner is destroyed or
+    /// overwritten by another one. A key taken from a slot therefore resolves to the same owner after it is moved,
+    /// and to nothing once it is gone, without invalidating the keys of any other owner.
+    class ArsenalSlot
+    {
+    public:
+
+        /// \brief Number of slots allocated together, whose addresses never change.
+        static constexpr UInt32 kChunkSize = 4096;
+
+        /// \brief Maximum number of chunks, bounding the number of owners alive at once.
+        static constexpr UInt32 kMaxChunks = 1024;
+
+        /// \brief Identifies an owner by its slot and the generation of the slot when the key was taken.
+        struct Key final
+        {
+            /// \brief The index of the slot.
+            UInt32 Slot       = 0;
+
+            /// \brief The generation of the slot, `0` for a key that never resolves.
+            UInt32 Generation = 0;
+        };
+
+    public:
+
+        /// \brief Acquires a slot for a new owner.
+        ZYPHRYON_INLINE ArsenalSlot()
+            : mSlot { Acquire(this) }
+        {
+        }
+
+        /// \brief Acquires a slot for a copy, which is a distinct owner.
+        ZYPHRYON_INLINE ArsenalSlot(ConstRef<ArsenalSlot>)
+            : mSlot { Acquire(this) }
+        {
+        }
+
+        /// \brief Takes over the slot of the moved owner, so its keys resolve to the new address.
+        ///
+        /// \param Other The owner being moved.
+        ZYPHRYON_INLINE ArsenalSlot(AnyRef<ArsenalSlot> Other)
+            : mSlot { Other.mSlot }
+        {
+            Other.mSlot = kNone;
+            Bind(mSlot, this);
+        }
+
+        /// \brief Releases the slot of the owner, so its keys stop resolving.
+        ZYPHRYON_INLINE ~ArsenalSlot()
+        {
+            Release(mSlot);
+        }
+
+        /// \brief Keeps the slot of the owner but bumps its generation, since it now holds another owner's state.
+        ///
+        /// \return A reference to this slot.
+        ZYPHRYON_INLINE Ref<ArsenalSlot> operator=(ConstRef<ArsenalSlot>)
+        {
+            Retire(mSlot);
+            return (* this);
+        }
+
+        /// \brief Releases the slot of the owner and takes over the slot of the moved one.
+        ///
+        /// \param Other The owner being moved.
+        /// \return A reference to this slot.
+        ZYPHRYON_INLINE Ref<ArsenalSlot> operator=(AnyRef<ArsenalSlot> Other)
+        {
+            if (this != & Other)
+            {
+                Release(mSlot);
+
+                mSlot       = Other.mSlot;
+                Other.mSlot = kNone;
+                Bind(mSlot, this);
+            }
+            return (* this);
+        }
+
+        /// \brief Retrieves the key resolving to this owner until it is destroyed or overwritten.
+        ///
+        /// \return The key of the owner.
+        ZYPHRYON_INLINE Key GetKey() const
+        {
+            return Key { mSlot, mSlot == kNone ? 0 : GetEntry(mSlot).Generation };
+        }
+
+        /// \brief Resolves a key to the current address of its owner.
+        ///
+        /// \param Value The key to resolve.
+        /// \return A pointer to the owner, or `nullptr` if it was destroyed or overwritten since the key was taken.
+        ZYPHRYON_INLINE static Ptr<ArsenalSlot> Find(Key Value)
+        {
+            if (Value.Generation == 0)
+            {
+                return nullptr;
+            }
+
+            ConstRef<Entry> Slot = GetEntry(Value.Slot);
+            return (Slot.Generation == Value.Generation ? Slot.Owner : nullptr);
+        }
+
+    private:
+
+        /// \brief Index standing for an owner that holds no slot, such as a moved-from one.
+        static constexpr UInt32 kNone = ~0u;
+
+        /// \brief Represents a slot of the registry.
+        struct Entry final
+        {
+            /// \brief The current address of the owner, or `nullptr` if the slot is free.
+            Ptr<ArsenalSlot> Owner      = nullptr;
+
+            /// \brief The generation of the slot, bumped every time its owner is released or overwritten.
+            UInt32           Generation = 0;
+        };
+
+        /// \brief Represents the registry of every slot, shared by all owners.
+        struct Registry final
+        {
+            /// \brief The chunks of slots, allocated on demand and never freed.
+            Array<std::unique_ptr<Array<Entry, kChunkSize>>, kMaxChunks> Chunks;
+
+            /// \brief The slots released and available for reuse.
+            Vector<UInt32>                                               Free;
+
+            /// \brief The number of slots handed out so far.
+            UInt32                                                       Count = 0;
+
+            /// \brief The mutex guarding acquisition and release.
+            std::mutex                                                   Mutex;
+        };
+
+        /// \brief Retrieves the registry of slots.
+        ///
+        /// \return A reference to the registry.
+        ZYPHRYON_INLINE static Ref<Registry> GetRegistry()
+        {
+            static Registry Instance;
+            return Instance;
+        }
+
+        /// \brief Retrieves the entry of a slot.
+        ///
+        /// \param Slot The index of the slot.
+        /// \return A reference to the entry.
+        ZYPHRYON_INLINE static Ref<Entry> GetEntry(UInt32 Slot)
+        {
+            return (* GetRegistry().Chunks[Slot / kChunkSize])[Slot % kChunkSize];
+        }
+
+        /// \brief Records the current address of the owner of a slot.
+        ///
+        /// \param Slot  The index of the slot, or `kNone` to do nothing.
+        /// \param Owner The current address of the owner.
+        ZYPHRYON_INLINE static void Bind(UInt32 Slot, Ptr<ArsenalSlot> Owner)
+        {
+            if (Slot != kNone)
+            {
+                GetEntry(Slot).Owner = Owner;
+            }
+        }
+
+        /// \brief Bumps the generation of a slot, so the keys taken from it stop resolving.
+        ///
+        /// \param Slot The index of the slot, or `kNone` to do nothing.
+        ZYPHRYON_INLINE static void Retire(UInt32 Slot)
+        {
+            if (Slot != kNone)
+            {
+                ++GetEntry(Slot).Generation;
+            }
+        }
+
+        /// \brief Acquires a free slot for an owner.
+        ///
+        /// \param Owner The address of the owner.
+        /// \return The index of the slot, or `kNone` if every slot is in use.
+        static UInt32 Acquire(Ptr<ArsenalSlot> Owner);
+
+        /// \brief Releases a slot, bumping its generation and making it available for reuse.
+        ///
+        /// \param Slot The index of the slot, or `kNone` to do nothing.
+        static void Release(UInt32 Slot);
+
+    private:
+
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+        UInt32 mSlot;
+    };
+}
\ No newline at end of file
@@ -0,0 +1,139 @@
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// Copyright (C) 2025 by Agustin L. Alvarez. All rights reserved.
+//
+// This work is licensed under the terms of the MIT license.
+//
+// For a copy, see <https://opensource.org/licenses/MIT>.
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [  HEADER  ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#include "Gameplay/Arsenal/CombatLog.hpp"
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [   CODE   ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+namespace Gameplay
+{
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    CombatLog::~CombatLog()
+    {
+        Stop();
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void CombatLog::Start(AnyRef<OnWrite> Sink, UInt32 Interval)
+    {
+        LOG_ASSERT(!mWriter.joinable(), "Combat log writer is already running.");
+
+        mSink = Move(Sink);
+        mExit = false;
+
+        mWriter = std::thread([this, Interval]
+        {
+            std::unique_lock Guard(mMutex);
+
+            while (!mExit)
+            {
+                mWake.wait_for(Guard, std::chrono::milliseconds(Interval), [this]
+                {
+                    return mExit;
+                });
+
+                // Drain without the lock, so threads emitting for the first time can register their ring meanwhile.
+                Guard.unlock();
+                Drain();
+                Guard.lock();
+            }
+        });
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void CombatLog::Stop()
+    {
+        if (!mWriter.joinable())
+        {
+            return;
+        }
+
+        {
+            std::lock_guard Guard(mMutex);
+            mExit = true;
+        }
+        mWake.notify_all();
+        mWriter.join();
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    UInt32 CombatLog::Drain()
+    {
+        // Snapshot the registered rings, the ones registered afterwards are drained on the next pass.
+        Vector<Ptr<Ring>> Rings;
+        {
+            std::lock_guard Guard(mMutex);
+
+            for (ConstRef<std::unique_ptr<Ring>> Buffer : mRings)
+            {
+                Rings.push_back(Buffer.get());
+            }
+        }
+
+        // Gather the pending records of every ring as views into it, a ring that wrapped around yields two views.
+        Vector<UInt32> Heads;
+        UInt32         Count = 0;
+
+        const auto View = [](ConstPtr<CombatRecord> Records, UInt32 Size)
+        {
+            return ConstSpan<Byte>(reinterpret_cast<ConstPtr<Byte>>(Records), Size * sizeof(CombatRecord));
+        };
+
+        mGather.clear();
+
+        for (const Ptr<Ring> Buffer : Rings)
+        {
+            const UInt32 Tail    = Buffer->Tail.load(std::memory_order_relaxed);
+            const UInt32 Head    = Buffer->Head.load(std::memory_order_acquire);
+            const UInt32 Pending = Head - Tail;
+            const UInt32 Start   = Tail & (kCapacity - 1);
+            const UInt32 First   = Min(Pending, kCapacity - Start);
+
+            Heads.push_back(Head);
+
+            if (Pending == 0)
+            {
+                continue;
+            }
+
+            mGather.push_back(View(Buffer->Records.data() + Start, First));
+
+            if (Pending > First)
+            {
+                mGather.push_back(View(Buffer->Records.data(), Pending - First));
+            }
+            Count += Pending;
+        }
+
+        if (Count > 0 && mSink)
+        {
+            mSink(mGather);
+        }
+
+        // Release the drained records back to their producers only once the sink is done reading them.
+        for (UInt32 Index = 0; Index < Rings.size(); ++Index)
+        {
+            Rings[Index]->Tail.store(Heads[Index], std::memory_order_release);
+        }
+        return Count;
+    }
+}
\ No newline at end of file
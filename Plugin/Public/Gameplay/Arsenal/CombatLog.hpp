@@ -0,0 +1,216 @@
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// Copyright (C) 2025 by Agustin L. Alvarez. All rights reserved.
+//
+// This work is licensed under the terms of the MIT license.
+//
+// For a copy, see <https://opensource.org/licenses/MIT>.
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#pragma once
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [  HEADER  ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#include "Gameplay/Arsenal/GameplayContext.hpp"
+#include <atomic>
+#include <bit>
+#include <condition_variable>
+#include <memory>
+#include <thread>
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [   CODE   ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+namespace Gameplay
+{
+    /// \brief A fixed-size binary record of a combat event, written as is to the combat log.
+    struct CombatRecord final
+    {
+        /// \brief Enumerates the events that can be logged.
+        enum class Kind : UInt8
+        {
+            Apply,      ///< An effect was applied, `Current` holds its intensity.
+            Refresh,    ///< An effect was merged into an active stack, `Current` holds the magnitude applied.
+            Tick,       ///< A periodic effect ticked, `Current` holds its effective intensity.
+            Decay,      ///< An effect lost stacks on expiration, `Current` holds its effective intensity.
+            Expire,     ///< An effect expired and was removed.
+            Stat,       ///< A stat changed from `Previous` to `Current`, as reported after its notification policy.
+        };
+
+        /// \brief The time at which the event happened.
+        Real64 Timestamp;
+
+        /// \brief The identifier of the actor the event happened to.
+        UInt64 Target;
+
+        /// \brief The identifier of the actor that caused the event, or `0` if none.
+        UInt64 Source;
+
+        /// \brief The value before the event, only set by stat changes.
+        Real32 Previous;
+
+        /// \brief The value after the event, as described by its kind.
+        Real32 Current;
+
+        /// \brief The identifier of the effect archetype or stat.
+        UInt16 Subject;
+
+        /// \brief The stack count of the effect, or `0` for stats.
+        UInt16 Stack;
+
+        /// \brief The kind of event.
+        Kind   Type;
+
+        /// \brief Padding up to the record size, always zero.
+        UInt8  Reserved[3];
+    };
+
+    static_assert(sizeof(CombatRecord) == 40, "Combat records must keep a fixed binary layout.");
+
+    /// \brief Collects combat events into per-thread lock-free ring buffers of binary records, drained by a writer
+    ///        thread straight from the rings, so the game thread never formats or copies an event twice.
+    ///
+    /// \note Each ring has a single producer, the thread that owns it, and a single consumer, the drain. An event
+    ///       emitted while its ring is full is dropped and counted, instead of stalling the game thread.
+    class CombatLog final
+    {
+    public:
+
+        /// \brief Number of records each thread's ring can hold, must be a power of two.
+        static constexpr UInt32 kCapacity = 4096;
+
+        /// \brief Represents a delegate receiving the drained records as a gather list of views into the rings,
+        ///        suited to be handed as is to a vectored write.
+        ///
+        /// \note The views are only valid for the duration of the call.
+        using OnWrite = Delegate<void(ConstSpan<ConstSpan<Byte>>), DelegateInlineSize::Small>;
+
+    public:
+
+        /// \brief Default constructor, creates a log without a writer thread.
+        ZYPHRYON_INLINE CombatLog() = default;
+
+        /// \brief Stops the writer thread, if any, after draining the pending records.
+        ~CombatLog();
+
+        /// \brief Starts a writer thread draining the rings periodically.
+        ///
+        /// \param Sink     The delegate receiving the drained records.
+        /// \param Interval The time to wait between drains, in milliseconds.
+        void Start(AnyRef<OnWrite> Sink, UInt32 Interval = 10);
+
+        /// \brief Stops the writer thread after draining the pending records.
+        void Stop();
+
+        /// \brief Drains every record emitted so far into the sink.
+        ///
+        /// \note Called by the writer thread, may also be called manually when no writer thread was started. Records
+        ///       drained without a sink are discarded.
+        ///
+        /// \return The number of records drained.
+        UInt32 Drain();
+
+        /// \brief Emits an event into the calling thread's ring.
+        ///
+        /// \param Type      The kind of event.
+        /// \param Timestamp The time at which the event happened.
+        /// \param Target    The identifier of the actor the event happened to.
+        /// \param Source    The identifier of the actor that caused the event, or `0` if none.
+        /// \param Subject   The identifier of the effect or stat.
+        /// \param Stack     The stack count of the effect, or `0` for stats.
+        /// \param Previous  The value before the event.
+        /// \param Current   The value after the event.
+        ZYPHRYON_INLINE void Emit(CombatRecord::Kind Type, Real64 Timestamp, UInt64 Target, UInt64 Source, UInt16 Subject, UInt16 Stack, Real32 Previous, Real32 Current)
+        {
+            Ref<Ring>    Buffer = GetRing();
+            const UInt32 Head   = Buffer.Head.load(std::memory_order_relaxed);
+
+            if (Head - Buffer.Tail.load(std::memory_order_acquire) == kCapacity)
+            {
+                mDropped.fetch_add(1, std::memory_order_relaxed);
+                return;
+            }
+
+            Ref<CombatRecord> Record = Buffer.Records[Head & (kCapacity - 1)];
+            Record.Timestamp = Timestamp;
+            Record.Target    = Target;
+            Record.Source    = Source;
+            Record.Previous  = Previous;
+            Record.Current   = Current;
+            Record.Subject   = Subject;
+            Record.Stack     = Stack;
+            Record.Type      = Type;
+            std::ranges::fill(Record.Reserved, 0);
+
+            Buffer.Head.store(Head + 1, std::memory_order_release);
+        }
+
+        /// \brief Retrieves the number of events dropped because their ring was full.
+        ///
+        /// \return The number of dropped events.
+        ZYPHRYON_INLINE UInt64 GetDropped() const
+        {
+            return mDropped.load(std::memory_order_relaxed);
+        }
+
+    private:
+
+        /// \brief Holds the records emitted by a single thread, with the indices of both ends on their own line.
+        struct Ring final
+        {
+            Array<CombatRecord, kCapacity> Records;
+            alignas(64) std::atomic<UInt32> Head = 0;
+            alignas(64) std::atomic<UInt32> Tail = 0;
+        };
+
+        static_assert(std::has_single_bit(kCapacity), "Ring capacity must be a power of two.");
+
+        /// \brief Retrieves the ring owned by the calling thread, registering it on first use.
+        ///
+        /// \return A reference to the calling thread's ring.
+        ZYPHRYON_INLINE Ref<Ring> GetRing()
+        {
+            // Cache the ring of the last log used on this thread, keyed by serial so logs never share rings.
+            static thread_local UInt64    Owner   = 0;
+            static thread_local Ptr<Ring> Current = nullptr;
+
+            if (Owner != mSerial)
+            {
+                std::lock_guard Guard(mMutex);
+
+                const std::thread::id Thread   = std::this_thread::get_id();
+                const auto            Iterator = std::ranges::find(mThreads, Thread);
+
+                if (Iterator != mThreads.end())
+                {
+                    Current = mRings[std::distance(mThreads.begin(), Iterator)].get();
+                }
+                else
+                {
+                    Current = mRings.emplace_back(std::make_unique<Ring>()).get();
+                    mThreads.push_back(Thread);
+                }
+                Owner = mSerial;
+            }
+            return * Current;
+        }
+
+    private:
+
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+        Vector<std::unique_ptr<Ring>> mRings;
+        Vector<std::thread::id>       mThreads;
+        Vector<ConstSpan<Byte>>       mGather;
+        OnWrite                       mSink;
+        std::thread                   mWriter;
+        std::mutex                    mMutex;
+        std::condition_variable       mWake;
+        std::atomic<UInt64>           mDropped = 0;
+        Bool                          mExit = false;
+        UInt64                        mSerial = GameplayContext::Serial();
+    };
+}
\ No newline at end of file
@@ -10,4 +10,142 @@
 // [  HEADER  ]
 // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 
-#include "Gameplay/Arsenal/Coordinator.hpp"
\ No newline at end of file
+#include "Gameplay/Arsenal/Coordinator.hpp"
+#include "Gameplay/Arsenal/Arsenal.hpp"
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [   CODE   ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+namespace Gameplay
+{
+    namespace
+    {
+        /// \brief Broadcasts a batch of events, resolving the global delegates once per distinct handle.
+        ///
+        /// \note Delegates scoped to an entity or group are only resolved if the snapshot holds any.
+        ///
+        /// \param Events   The events to broadcast, cleared once done.
+        /// \param Snapshot The subscriber snapshot to resolve the delegates from.
+        template<typename Event, typename Type>
+        ZYPHRYON_INLINE void Broadcast(Ref<Vector<Event>> Events, ConstRef<Type> Snapshot)
+        {
+            ConstRef<decltype(Snapshot.Delegates)> Delegates = Snapshot.Delegates;
+
+            std::ranges::stable_sort(Events, std::less(), [](ConstRef<Event> Record)
+            {
+                return Record.Handle.GetID();
+            });
+
+            for (UInt32 First = 0, Last; First < Events.size(); First = Last)
+            {
+                const auto Handle = Events[First].Handle;
+
+                for (Last = First + 1; Last < Events.size() && Events[Last].Handle == Handle; ++Last)
+                {
+                }
+
+                if (const auto Iterator = Delegates.find(Handle); Iterator != Delegates.end())
+                {
+                    for (UInt32 Element = First; Element < Last; ++Element)
+                    {
+                        ConstRef<Event> Record = Events[Element];
+                        Iterator->second.Broadcast(Record.Actor, Record.Previous, Record.Current);
+                    }
+                }
+            }
+
+            if (!Snapshot.Filters.empty())
+            {
+                for (ConstRef<Event> Record : Events)
+                {
+                    Snapshot.Notify(Record.Handle, Record.Actor, Record.Previous, Record.Current);
+                }
+            }
+            Events.clear();
+        }
+
+        /// \brief Releases every retired snapshot of a subscriber table.
+        ///
+        /// \param Retired The snapshots awaiting reclamation.
+        template<typename Type>
+        ZYPHRYON_INLINE void Reclaim(Ref<Vector<Ptr<Type>>> Retired)
+        {
+            for (const Ptr<Type> Snapshot : Retired)
+            {
+                delete Snapshot;
+            }
+            Retired.clear();
+        }
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Coordinator::Coordinator()
+        : mStatDelegates  { new StatSnapshot() },
+          mTokenDelegates { new TokenSnapshot() },
+          mSerial         { GameplayContext::Serial() }
+    {
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Coordinator::~Coordinator()
+    {
+        Reclaim(mRetiredStatDelegates);
+        Reclaim(mRetiredTokenDelegates);
+
+        delete mStatDelegates.load(std::memory_order_relaxed);
+        delete mTokenDelegates.load(std::memory_order_relaxed);
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void Coordinator::Dispatch()
+    {
+        {
+            std::lock_guard Guard(mMutex);
+
+            // Gather the events of every thread, in registration order.
+            for (ConstRef<std::unique_ptr<Queue>> Queue : mQueues)
+            {
+                mTokenEvents.insert(mTokenEvents.end(), Queue->mTokens.begin(), Queue->mTokens.end());
+                mStatEvents.insert(mStatEvents.end(), Queue->mStats.begin(), Queue->mStats.end());
+                mForwardEvents.insert(mForwardEvents.end(), Queue->mForwards.begin(), Queue->mForwards.end());
+
+                Queue->mTokens.clear();
+                Queue->mStats.clear();
+                Queue->mForwards.clear();
+            }
+
+            // No reader can hold a retired snapshot past the sync point.
+            Reclaim(mRetiredStatDelegates);
+            Reclaim(mRetiredTokenDelegates);
+        }
+
+        // Broadcast outside the lock, delegates are free to subscribe or unsubscribe.
+        Broadcast(mTokenEvents, * mTokenDelegates.load(std::memory_order_acquire));
+        Broadcast(mStatEvents, * mStatDelegates.load(std::memory_order_acquire));
+
+        // Hand the forwarded changes to their followers, dropping the followers that were despawned or that no
+        // effect reads them for anymore.
+        for (ConstRef<ForwardEvent> Event : mForwardEvents)
+        {
+            const Bool Alive = Event.Follower.IsValid() && Event.Follower.Has<Arsenal>();
+
+            if (Alive && Event.Follower.Get<Arsenal>().Follow(Event))
+            {
+                continue;
+            }
+
+            if (Event.Instigator.IsValid() && Event.Instigator.Has<Arsenal>())
+            {
+                Event.Instigator.Get<Arsenal>().Unsubscribe(Event.Handle, Event.Follower);
+            }
+        }
+        mForwardEvents.clear();
+    }
+}
\ No newline at end of file
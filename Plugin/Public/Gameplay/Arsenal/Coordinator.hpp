@@ -12,9 +12,13 @@
 // [  HEADER  ]
 // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 
-#include "Gameplay/Stat/Stat.hpp"
-#include "Gameplay/Token/Token.hpp"
+#include "Gameplay/Arsenal/GameplayContext.hpp"
+#include "Gameplay/Stat/StatRepository.hpp"
+#include "Gameplay/Token/TokenRepository.hpp"
 #include <Zyphryon.Scene/Entity.hpp>
+#include <atomic>
+#include <memory>
+#include <thread>
 
 // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 // [   CODE   ]
@@ -23,8 +27,16 @@
 namespace Gameplay
 {
     /// \brief Coordinates stat and marker modification events within the gameplay system.
-    /// TODO: Investigate Batch / ECS way
-    /// TODO: Consider using Event Bus pattern?
+    ///
+    /// Subscriber tables are published as immutable snapshots, readers never take a lock. Writers copy the current
+    /// snapshot, modify the copy and swap it in, retiring the old one until the next `Dispatch` (the grace period).
+    ///
+    /// Events can either be published immediately, or recorded into the calling thread's queue and dispatched in
+    /// a single pass grouped by handle.
+    ///
+    /// Besides global subscriptions, delegates can be scoped to a single entity or to a group of entities (a party
+    /// or any interest set). Scoped delegates are only invoked for changes of their entities, and an entity only
+    /// records the changes that some delegate, global or scoped, is interested in.
     class Coordinator final
     {
     public:
@@ -41,16 +53,155 @@ namespace Gameplay
         /// \brief Multicast delegate type for token modification events.
         using OnModifyToken          = OnModifyTokenMulticast::Type;
 
+        /// \brief Represents a recorded stat change.
+        struct StatEvent final
+        {
+            /// \brief The handle of the stat that changed.
+            Stat          Handle;
+
+            /// \brief The entity whose stat changed.
+            Scene::Entity Actor;
+
+            /// \brief The previous value of the stat.
+            Real32        Previous;
+
+            /// \brief The current value of the stat.
+            Real32        Current;
+        };
+
+        /// \brief Represents a recorded token change.
+        struct TokenEvent final
+        {
+            /// \brief The handle of the token that changed.
+            Token         Handle;
+
+            /// \brief The entity whose token changed.
+            Scene::Entity Actor;
+
+            /// \brief The previous count of the token.
+            UInt32        Previous;
+
+            /// \brief The current count of the token.
+            UInt32        Current;
+        };
+
+        /// \brief Represents a change of an instigator's stat, forwarded to an actor whose effects read it.
+        struct ForwardEvent final
+        {
+            /// \brief The handle of the stat that changed.
+            Stat          Handle;
+
+            /// \brief The entity whose stat changed.
+            Scene::Entity Instigator;
+
+            /// \brief The entity holding the effects that read the stat.
+            Scene::Entity Follower;
+        };
+
+        /// \brief Buffers the stat and token changes published by a single thread until the next dispatch.
+        class Queue final
+        {
+            friend class Coordinator;
+
+        public:
+
+            /// \brief Records a stat change to be published on the next dispatch.
+            ///
+            /// \param Target   The handle of the modified stat.
+            /// \param Entity   The entity whose stat was modified.
+            /// \param Previous The previous value of the stat.
+            /// \param Current  The current value of the stat.
+            ZYPHRYON_INLINE void Publish(Stat Target, Scene::Entity Entity, Real32 Previous, Real32 Current)
+            {
+                mStats.emplace_back(Target, Entity, Previous, Current);
+            }
+
+            /// \brief Records a token change to be published on the next dispatch.
+            ///
+            /// \param Target   The handle of the modified token.
+            /// \param Entity   The entity whose token was modified.
+            /// \param Previous The previous count of the token.
+            /// \param Current  The current count of the token.
+            ZYPHRYON_INLINE void Publish(Token Target, Scene::Entity Entity, UInt32 Previous, UInt32 Current)
+            {
+                mTokens.emplace_back(Target, Entity, Previous, Current);
+            }
+
+            /// \brief Records a stat change to be forwarded to a follower on the next dispatch.
+            ///
+            /// \param Target     The handle of the modified stat.
+            /// \param Instigator The entity whose stat was modified.
+            /// \param Follower   The entity holding the effects that read the stat.
+            ZYPHRYON_INLINE void Forward(Stat Target, Scene::Entity Instigator, Scene::Entity Follower)
+            {
+                mForwards.emplace_back(Target, Instigator, Follower);
+            }
+
+        private:
+
+            // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+            // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+            Vector<StatEvent>    mStats;
+            Vector<TokenEvent>   mTokens;
+            Vector<ForwardEvent> mForwards;
+        };
+
     public:
 
+        /// \brief Constructs a coordinator with empty subscriber tables.
+        Coordinator();
+
+        /// \brief Releases the subscriber tables and every thread queue.
+        ~Coordinator();
+
+        /// \brief Copying a coordinator is not allowed.
+        Coordinator(ConstRef<Coordinator>) = delete;
+
+        /// \brief Copying a coordinator is not allowed.
+        Ref<Coordinator> operator=(ConstRef<Coordinator>) = delete;
+
         /// \brief Subscribes a delegate to stat modification events for a specific stat.
         ///
         /// \param Target   The handle of the stat to subscribe to.
         /// \param Delegate The delegate to invoke on stat modification.
         ZYPHRYON_INLINE void Subscribe(Stat Target, AnyRef<OnModifyStat> Delegate)
         {
-            std::unique_lock Guard(mStatDelegatesMutex);
-            mStatDelegates[Target].Add(Move(Delegate));
+            Update(mStatDelegates, mRetiredStatDelegates, [&](Ref<StatSnapshot> Snapshot)
+            {
+                Snapshot.Insert(Target, Target.GetID(), Move(Delegate));
+                Snapshot.Refilter();
+            });
+        }
+
+        /// \brief Subscribes a delegate to stat modification events of a single entity.
+        ///
+        /// \note The subscription is not dropped when the entity is destroyed, it must be unsubscribed explicitly.
+        ///
+        /// \param Actor    The entity whose stat changes to subscribe to.
+        /// \param Target   The handle of the stat to subscribe to.
+        /// \param Delegate The delegate to invoke on stat modification.
+        ZYPHRYON_INLINE void Subscribe(Scene::Entity Actor, Stat Target, AnyRef<OnModifyStat> Delegate)
+        {
+            Update(mStatDelegates, mRetiredStatDelegates, [&](Ref<StatSnapshot> Snapshot)
+            {
+                Snapshot.Entities[Actor.GetID()].Insert(Target, Target.GetID(), Move(Delegate));
+                Snapshot.Refilter(Actor.GetID());
+            });
+        }
+
+        /// \brief Subscribes a delegate to stat modification events of every entity in a group.
+        ///
+        /// \param Group    The identifier of the group whose stat changes to subscribe to.
+        /// \param Target   The handle of the stat to subscribe to.
+        /// \param Delegate The delegate to invoke on stat modification.
+        ZYPHRYON_INLINE void SubscribeGroup(UInt64 Group, Stat Target, AnyRef<OnModifyStat> Delegate)
+        {
+            Update(mStatDelegates, mRetiredStatDelegates, [&](Ref<StatSnapshot> Snapshot)
+            {
+                Snapshot.Groups[Group].Insert(Target, Target.GetID(), Move(Delegate));
+                Snapshot.RefilterGroup(Group);
+            });
         }
 
         /// \brief Publishes a stat modification event to all subscribed delegates.
@@ -61,12 +212,17 @@ namespace Gameplay
         /// \param Current  The current value of the stat.
         ZYPHRYON_INLINE void Publish(Stat Target, Scene::Entity Entity, Real32 Previous, Real32 Current)
         {
-            std::shared_lock Guard(mStatDelegatesMutex);
+            ConstRef<StatSnapshot> Snapshot = * mStatDelegates.load(std::memory_order_acquire);
 
-            if (const auto Iterator = mStatDelegates.find(Target); Iterator != mStatDelegates.end())
+            if (const auto Iterator = Snapshot.Delegates.find(Target); Iterator != Snapshot.Delegates.end())
             {
                 Iterator->second.Broadcast(Entity, Previous, Current);
             }
+
+            if (!Snapshot.Filters.empty())
+            {
+                Snapshot.Notify(Target, Entity, Previous, Current);
+            }
         }
 
         /// \brief Unsubscribes a delegate from stat modification events for a specific stat.
@@ -75,18 +231,39 @@ namespace Gameplay
         /// \param Delegate The delegate to remove from the subscription list.
         ZYPHRYON_INLINE void Unsubscribe(Stat Target, ConstRef<OnModifyStat> Delegate)
         {
-            std::unique_lock Guard(mStatDelegatesMutex);
+            Update(mStatDelegates, mRetiredStatDelegates, [&](Ref<StatSnapshot> Snapshot)
+            {
+                Snapshot.Remove(Target, Target.GetID(), Delegate);
+                Snapshot.Refilter();
+            });
+        }
 
-            if (const auto Iterator = mStatDelegates.find(Target); Iterator != mStatDelegates.end())
+        /// \brief Unsubscribes a delegate from stat modification events of a single entity.
+        ///
+        /// \param Actor    The entity whose stat changes to unsubscribe from.
+        /// \param Target   The handle of the stat to unsubscribe from.
+        /// \param Delegate The delegate to remove from the subscription list.
+        ZYPHRYON_INLINE void Unsubscribe(Scene::Entity Actor, Stat Target, ConstRef<OnModifyStat> Delegate)
+        {
+            Update(mStatDelegates, mRetiredStatDelegates, [&](Ref<StatSnapshot> Snapshot)
             {
-                Ref<OnModifyStatMulticast> Delegates = Iterator->second;
-                Delegates.Remove(Delegate);
+                Snapshot.Withdraw(Snapshot.Entities, Actor.GetID(), Target, Target.GetID(), Delegate);
+                Snapshot.Refilter(Actor.GetID());
+            });
+        }
 
-                if (Delegates.IsEmpty())
-                {
-                    mStatDelegates.erase(Iterator);
-                }
-            }
+        /// \brief Unsubscribes a delegate from stat modification events of the entities in a group.
+        ///
+        /// \param Group    The identifier of the group whose stat changes to unsubscribe from.
+        /// \param Target   The handle of the stat to unsubscribe from.
+        /// \param Delegate The delegate to remove from the subscription list.
+        ZYPHRYON_INLINE void UnsubscribeGroup(UInt64 Group, Stat Target, ConstRef<OnModifyStat> Delegate)
+        {
+            Update(mStatDelegates, mRetiredStatDelegates, [&](Ref<StatSnapshot> Snapshot)
+            {
+                Snapshot.Withdraw(Snapshot.Groups, Group, Target, Target.GetID(), Delegate);
+                Snapshot.RefilterGroup(Group);
+            });
         }
 
         /// \brief Subscribes a delegate to token modification events for a specific token.
@@ -95,8 +272,41 @@ namespace Gameplay
         /// \param Delegate The delegate to invoke on token modification.
         ZYPHRYON_INLINE void Subscribe(Token Target, AnyRef<OnModifyToken> Delegate)
         {
-            std::unique_lock Guard(mTokenDelegatesMutex);
-            mTokenDelegates[Target].Add(Move(Delegate));
+            Update(mTokenDelegates, mRetiredTokenDelegates, [&](Ref<TokenSnapshot> Snapshot)
+            {
+                Snapshot.Insert(Target, TokenRepository::View().GetIndex(Target), Move(Delegate));
+                Snapshot.Refilter();
+            });
+        }
+
+        /// \brief Subscribes a delegate to token modification events of a single entity.
+        ///
+        /// \note The subscription is not dropped when the entity is destroyed, it must be unsubscribed explicitly.
+        ///
+        /// \param Actor    The entity whose token changes to subscribe to.
+        /// \param Target   The handle of the token to subscribe to.
+        /// \param Delegate The delegate to invoke on token modification.
+        ZYPHRYON_INLINE void Subscribe(Scene::Entity Actor, Token Target, AnyRef<OnModifyToken> Delegate)
+        {
+            Update(mTokenDelegates, mRetiredTokenDelegates, [&](Ref<TokenSnapshot> Snapshot)
+            {
+                Snapshot.Entities[Actor.GetID()].Insert(Target, TokenRepository::View().GetIndex(Target), Move(Delegate));
+                Snapshot.Refilter(Actor.GetID());
+            });
+        }
+
+        /// \brief Subscribes a delegate to token modification events of every entity in a group.
+        ///
+        /// \param Group    The identifier of the group whose token changes to subscribe to.
+        /// \param Target   The handle of the token to subscribe to.
+        /// \param Delegate The delegate to invoke on token modification.
+        ZYPHRYON_INLINE void SubscribeGroup(UInt64 Group, Token Target, AnyRef<OnModifyToken> Delegate)
+        {
+            Update(mTokenDelegates, mRetiredTokenDelegates, [&](Ref<TokenSnapshot> Snapshot)
+            {
+                Snapshot.Groups[Group].Insert(Target, TokenRepository::View().GetIndex(Target), Move(Delegate));
+                Snapshot.RefilterGroup(Group);
+            });
         }
 
         /// \brief Publishes a token modification event to all subscribed delegates.
@@ -107,12 +317,17 @@ namespace Gameplay
         /// \param Current  The current count of the token.
         ZYPHRYON_INLINE void Publish(Token Target, Scene::Entity Entity, UInt32 Previous, UInt32 Current)
         {
-            std::shared_lock Guard(mTokenDelegatesMutex);
+            ConstRef<TokenSnapshot> Snapshot = * mTokenDelegates.load(std::memory_order_acquire);
 
-            if (const auto Iterator = mTokenDelegates.find(Target); Iterator != mTokenDelegates.end())
+            if (const auto Iterator = Snapshot.Delegates.find(Target); Iterator != Snapshot.Delegates.end())
             {
                 Iterator->second.Broadcast(Entity, Previous, Current);
             }
+
+            if (!Snapshot.Filters.empty())
+            {
+                Snapshot.Notify(Target, Entity, Previous, Current);
+            }
         }
 
         /// \brief Unsubscribes a delegate from token modification events for a specific token.
@@ -121,29 +336,488 @@ namespace Gameplay
         /// \param Delegate The delegate to remove from the subscription list.
         ZYPHRYON_INLINE void Unsubscribe(Token Target, ConstRef<OnModifyToken> Delegate)
         {
-            std::unique_lock Guard(mTokenDelegatesMutex);
+            Update(mTokenDelegates, mRetiredTokenDelegates, [&](Ref<TokenSnapshot> Snapshot)
+            {
+                Snapshot.Remove(Target, TokenRepository::View().GetIndex(Target), Delegate);
+                Snapshot.Refilter();
+            });
+        }
+
+        /// \brief Unsubscribes a delegate from token modification events of a single entity.
+        ///
+        /// \param Actor    The entity whose token changes to unsubscribe from.
+        /// \param Target   The handle of the token to unsubscribe from.
+        /// \param Delegate The delegate to remove from the subscription list.
+        ZYPHRYON_INLINE void Unsubscribe(Scene::Entity Actor, Token Target, ConstRef<OnModifyToken> Delegate)
+        {
+            Update(mTokenDelegates, mRetiredTokenDelegates, [&](Ref<TokenSnapshot> Snapshot)
+            {
+                Snapshot.Withdraw(Snapshot.Entities, Actor.GetID(), Target, TokenRepository::View().GetIndex(Target), Delegate);
+                Snapshot.Refilter(Actor.GetID());
+            });
+        }
+
+        /// \brief Unsubscribes a delegate from token modification events of the entities in a group.
+        ///
+        /// \param Group    The identifier of the group whose token changes to unsubscribe from.
+        /// \param Target   The handle of the token to unsubscribe from.
+        /// \param Delegate The delegate to remove from the subscription list.
+        ZYPHRYON_INLINE void UnsubscribeGroup(UInt64 Group, Token Target, ConstRef<OnModifyToken> Delegate)
+        {
+            Update(mTokenDelegates, mRetiredTokenDelegates, [&](Ref<TokenSnapshot> Snapshot)
+            {
+                Snapshot.Withdraw(Snapshot.Groups, Group, Target, TokenRepository::View().GetIndex(Target), Delegate);
+                Snapshot.RefilterGroup(Group);
+            });
+        }
+
+        /// \brief Adds an entity to a group, so the delegates subscribed to the group observe its changes.
+        ///
+        /// \param Group The identifier of the group to join.
+        /// \param Actor The entity joining the group.
+        ZYPHRYON_INLINE void Join(UInt64 Group, Scene::Entity Actor)
+        {
+            const auto Action = [&]<typename Type>(Ref<Type> Snapshot)
+            {
+                Snapshot.Join(Group, Actor.GetID());
+            };
+            Update(mStatDelegates, mRetiredStatDelegates, Action);
+            Update(mTokenDelegates, mRetiredTokenDelegates, Action);
+        }
+
+        /// \brief Removes an entity from a group.
+        ///
+        /// \param Group The identifier of the group to leave.
+        /// \param Actor The entity leaving the group.
+        ZYPHRYON_INLINE void Leave(UInt64 Group, Scene::Entity Actor)
+        {
+            const auto Action = [&]<typename Type>(Ref<Type> Snapshot)
+            {
+                Snapshot.Leave(Group, Actor.GetID());
+            };
+            Update(mStatDelegates, mRetiredStatDelegates, Action);
+            Update(mTokenDelegates, mRetiredTokenDelegates, Action);
+        }
+
+        /// \brief Forwards a stat change to an actor whose effects read it from the instigator.
+        ///
+        /// \note Forwarded changes are always recorded into the calling thread's queue, and reach the follower on
+        ///       the next `Dispatch`, so its effects are refreshed on the tick after.
+        ///
+        /// \param Target     The handle of the modified stat.
+        /// \param Instigator The entity whose stat was modified.
+        /// \param Follower   The entity holding the effects that read the stat.
+        ZYPHRYON_INLINE void Forward(Stat Target, Scene::Entity Instigator, Scene::Entity Follower)
+        {
+            GetQueue().Forward(Target, Instigator, Follower);
+        }
+
+        /// \brief Checks whether any delegate is subscribed to a specific stat.
+        ///
+        /// \param Target The handle of the stat to check.
+        /// \return `true` if the stat has at least one subscriber, `false` otherwise.
+        ZYPHRYON_INLINE Bool HasSubscribers(Stat Target) const
+        {
+            return mStatDelegates.load(std::memory_order_acquire)->Contains(Target.GetID());
+        }
+
+        /// \brief Checks whether any delegate is subscribed to a specific token.
+        ///
+        /// \param Target The handle of the token to check.
+        /// \return `true` if the token has at least one subscriber, `false` otherwise.
+        ZYPHRYON_INLINE Bool HasSubscribers(Token Target) const
+        {
+            return mTokenDelegates.load(std::memory_order_acquire)->Contains(TokenRepository::View().GetIndex(Target));
+        }
+
+        /// \brief Retrieves a bitset indexed by stat identifier of the stats that have at least one subscriber.
+        ///
+        /// \note The reference stays valid until the next `Dispatch`.
+        ///
+        /// \return The stat subscriber bitset.
+        ZYPHRYON_INLINE ConstRef<Array<UInt64, StatRepository::kWords>> GetStatSubscribers() const
+        {
+            return mStatDelegates.load(std::memory_order_acquire)->Subscribers;
+        }
+
+        /// \brief Retrieves a bitset indexed by stat identifier of the stats that any delegate observes on an entity.
+        ///
+        /// \note The reference stays valid until the next `Dispatch`.
+        ///
+        /// \param Actor The entity whose stat changes are to be recorded.
+        /// \return The stat subscriber bitset of the entity, including the global subscribers.
+        ZYPHRYON_INLINE ConstRef<Array<UInt64, StatRepository::kWords>> GetStatSubscribers(Scene::Entity Actor) const
+        {
+            return mStatDelegates.load(std::memory_order_acquire)->GetFilter(Actor.GetID());
+        }
+
+        /// \brief Retrieves a bitset indexed by dense token index of the tokens that have at least one subscriber.
+        ///
+        /// \note The reference stays valid until the next `Dispatch`. Token subscriptions must be made once the
+        ///       token hierarchy is loaded, since they are indexed by the token's dense index.
+        ///
+        /// \return The token subscriber bitset.
+        ZYPHRYON_INLINE ConstRef<Array<UInt64, TokenRepository::kWords>> GetTokenSubscribers() const
+        {
+            return mTokenDelegates.load(std::memory_order_acquire)->Subscribers;
+        }
+
+        /// \brief Retrieves a bitset indexed by dense token index of the tokens that any delegate observes on an entity.
+        ///
+        /// \note The reference stays valid until the next `Dispatch`.
+        ///
+        /// \param Actor The entity whose token changes are to be recorded.
+        /// \return The token subscriber bitset of the entity, including the global subscribers.
+        ZYPHRYON_INLINE ConstRef<Array<UInt64, TokenRepository::kWords>> GetTokenSubscribers(Scene::Entity Actor) const
+        {
+            return mTokenDelegates.load(std::memory_order_acquire)->GetFilter(Actor.GetID());
+        }
+
+        /// \brief Retrieves the queue owned by the calling thread, registering it on first use.
+        ///
+        /// \return A reference to the calling thread's queue.
+        ZYPHRYON_INLINE Ref<Queue> GetQueue()
+        {
+            // Cache the queue of the last owner used on this thread, keyed by serial so contexts never share queues.
+            static thread_local UInt64     Owner   = 0;
+            static thread_local Ptr<Queue> Current = nullptr;
 
-            if (const auto Iterator = mTokenDelegates.find(Target); Iterator != mTokenDelegates.end())
+            if (Owner != mSerial)
             {
-                Ref<OnModifyTokenMulticast> Delegates = Iterator->second;
-                Delegates.Remove(Delegate);
+                std::lock_guard Guard(mMutex);
+
+                const std::thread::id Thread   = std::this_thread::get_id();
+                const auto            Iterator = std::ranges::find(mThreads, Thread);
 
-                if (Delegates.IsEmpty())
+                if (Iterator != mThreads.end())
+                {
+                    Current = mQueues[std::distance(mThreads.begin(), Iterator)].get();
+                }
+                else
                 {
-                    mTokenDelegates.erase(Iterator);
+                    Current = mQueues.emplace_back(std::make_unique<Queue>()).get();
+                    mThreads.push_back(Thread);
                 }
+                Owner = mSerial;
             }
+            return * Current;
         }
 
+        /// \brief Publishes every queued event in one pass grouped by handle, then reclaims retired tables.
+        ///
+        /// \note Must be called at a sync point where no other thread is publishing or enqueuing. Events of
+        ///       the same handle are delivered in queue order, while the order across handles is not preserved.
+        void Dispatch();
+
     public:
 
-        /// \brief Retrieves the singleton instance of the Coordinator.
+        /// \brief Retrieves the coordinator of the context current on the calling thread.
         ///
-        /// \return A reference to the singleton Coordinator instance.
+        /// \return A reference to the coordinator of the current context.
         ZYPHRYON_INLINE static Ref<Coordinator> Instance()
         {
-            static Coordinator Singleton;
-            return Singleton;
+            return GameplayContext::Current().GetCoordinator();
+        }
+
+    private:
+
+        /// \brief Represents the delegates subscribed to one kind of handle, globally or within a single scope.
+        template<typename Handle, typename Multicast, UInt32 Words>
+        struct Interest
+        {
+            /// \brief The delegates subscribed to each handle.
+            Table<Handle, Multicast> Delegates;
+
+            /// \brief One bit per handle index that has at least one subscribed delegate.
+            Array<UInt64, Words>     Subscribers { };
+
+            /// \brief Subscribes a delegate to a handle.
+            ///
+            /// \param Target   The handle to subscribe to.
+            /// \param Index    The index of the handle.
+            /// \param Delegate The delegate to subscribe.
+            ZYPHRYON_INLINE void Insert(Handle Target, UInt32 Index, AnyRef<typename Multicast::Type> Delegate)
+            {
+                Delegates[Target].Add(Move(Delegate));
+                Mark(Index, true);
+            }
+
+            /// \brief Unsubscribes a delegate from a handle.
+            ///
+            /// \param Target   The handle to unsubscribe from.
+            /// \param Index    The index of the handle.
+            /// \param Delegate The delegate to unsubscribe.
+            ZYPHRYON_INLINE void Remove(Handle Target, UInt32 Index, ConstRef<typename Multicast::Type> Delegate)
+            {
+                if (const auto Iterator = Delegates.find(Target); Iterator != Delegates.end())
+                {
+                    Ref<Multicast> Listeners = Iterator->second;
+                    Listeners.Remove(Delegate);
+
+                    if (Listeners.IsEmpty())
+                    {
+                        Delegates.erase(Iterator);
+                        Mark(Index, false);
+                    }
+                }
+            }
+
+            /// \brief Checks whether the handle at the given index has any subscriber.
+            ///
+            /// \param Index The index of the handle.
+            /// \return `true` if the handle has at least one subscriber, `false` otherwise.
+            ZYPHRYON_INLINE Bool Contains(UInt32 Index) const
+            {
+                return (Subscribers[Index / 64] >> (Index % 64)) & 1;
+            }
+
+            /// \brief Sets or clears the subscriber bit of the handle at the given index.
+            ///
+            /// \param Index      The index of the handle.
+            /// \param Subscribed Whether the handle has any subscriber.
+            ZYPHRYON_INLINE void Mark(UInt32 Index, Bool Subscribed)
+            {
+                if (Subscribed)
+                {
+                    Subscribers[Index / 64] |= (1ull << (Index % 64));
+                }
+                else
+                {
+                    Subscribers[Index / 64] &= ~(1ull << (Index % 64));
+                }
+            }
+        };
+
+        /// \brief Represents an immutable snapshot of the delegates subscribed to one kind of handle.
+        ///
+        /// The inherited interest holds the global delegates, invoked for every entity. Entities and groups hold their
+        /// own, and each scoped entity keeps a precomputed filter combining every interest that observes it.
+        template<typename Handle, typename Multicast, UInt32 Words>
+        struct Snapshot final : public Interest<Handle, Multicast, Words>
+        {
+            /// \brief Interest type of a single entity or group.
+            using Scope = Interest<Handle, Multicast, Words>;
+
+            /// \brief The delegates scoped to a single entity, keyed by entity identifier.
+            Table<UInt64, Scope>                Entities;
+
+            /// \brief The delegates scoped to a group, keyed by group identifier.
+            Table<UInt64, Scope>                Groups;
+
+            /// \brief The entities of each group, keyed by group identifier.
+            Table<UInt64, Vector<UInt64>>       Members;
+
+            /// \brief The groups of each entity, keyed by entity identifier.
+            Table<UInt64, Vector<UInt64>>       Memberships;
+
+            /// \brief The handles observed on each scoped entity, global subscribers included.
+            Table<UInt64, Array<UInt64, Words>> Filters;
+
+            /// \brief Retrieves the handles observed on an entity.
+            ///
+            /// \param Entity The identifier of the entity.
+            /// \return The bitset of the handles with at least one delegate interested in the entity.
+            ZYPHRYON_INLINE ConstRef<Array<UInt64, Words>> GetFilter(UInt64 Entity) const
+            {
+                if (!Filters.empty())
+                {
+                    if (const auto Iterator = Filters.find(Entity); Iterator != Filters.end())
+                    {
+                        return Iterator->second;
+                    }
+                }
+                return this->Subscribers;
+            }
+
+            /// \brief Invokes the delegates scoped to an entity, or to any of its groups, for a change of a handle.
+            ///
+            /// \param Target   The handle that changed.
+            /// \param Entity   The entity whose handle changed.
+            /// \param Previous The previous value of the handle.
+            /// \param Current  The current value of the handle.
+            template<typename Value>
+            ZYPHRYON_INLINE void Notify(Handle Target, Scene::Entity Entity, Value Previous, Value Current) const
+            {
+                const auto Broadcast = [&](ConstRef<Scope> Entry)
+                {
+                    if (const auto Iterator = Entry.Delegates.find(Target); Iterator != Entry.Delegates.end())
+                    {
+                        Iterator->second.Broadcast(Entity, Previous, Current);
+                    }
+                };
+
+                if (const auto Iterator = Entities.find(Entity.GetID()); Iterator != Entities.end())
+                {
+                    Broadcast(Iterator->second);
+                }
+
+                if (const auto Iterator = Memberships.find(Entity.GetID()); Iterator != Memberships.end())
+                {
+                    for (const UInt64 Group : Iterator->second)
+                    {
+                        if (const auto Found = Groups.find(Group); Found != Groups.end())
+                        {
+                            Broadcast(Found->second);
+                        }
+                    }
+                }
+            }
+
+            /// \brief Unsubscribes a delegate from a scope, dropping the scope once it has no delegates left.
+            ///
+            /// \param Scopes   The scopes to unsubscribe from.
+            /// \param Key      The identifier of the entity or group.
+            /// \param Target   The handle to unsubscribe from.
+            /// \param Index    The index of the handle.
+            /// \param Delegate The delegate to unsubscribe.
+            ZYPHRYON_INLINE void Withdraw(Ref<Table<UInt64, Scope>> Scopes, UInt64 Key, Handle Target, UInt32 Index, ConstRef<typename Multicast::Type> Delegate)
+            {
+                if (const auto Iterator = Scopes.find(Key); Iterator != Scopes.end())
+                {
+                    Iterator->second.Remove(Target, Index, Delegate);
+
+                    if (Iterator->second.Delegates.empty())
+                    {
+                        Scopes.erase(Iterator);
+                    }
+                }
+            }
+
+            /// \brief Adds an entity to a group.
+            ///
+            /// \param Group  The identifier of the group.
+            /// \param Entity The identifier of the entity.
+            ZYPHRYON_INLINE void Join(UInt64 Group, UInt64 Entity)
+            {
+                if (Ref<Vector<UInt64>> Entries = Members[Group]; std::ranges::find(Entries, Entity) == Entries.end())
+                {
+                    Entries.push_back(Entity);
+                    Memberships[Entity].push_back(Group);
+                }
+                Refilter(Entity);
+            }
+
+            /// \brief Removes an entity from a group.
+            ///
+            /// \param Group  The identifier of the group.
+            /// \param Entity The identifier of the entity.
+            ZYPHRYON_INLINE void Leave(UInt64 Group, UInt64 Entity)
+            {
+                const auto Erase = [](Ref<Table<UInt64, Vector<UInt64>>> Lists, UInt64 Key, UInt64 Value)
+                {
+                    if (const auto Iterator = Lists.find(Key); Iterator != Lists.end())
+                    {
+                        std::erase(Iterator->second, Value);
+
+                        if (Iterator->second.empty())
+                        {
+                            Lists.erase(Iterator);
+                        }
+                    }
+                };
+                Erase(Members, Group, Entity);
+                Erase(Memberships, Entity, Group);
+                Refilter(Entity);
+            }
+
+            /// \brief Recomputes the filter of a single entity from every interest that observes it.
+            ///
+            /// \param Entity The identifier of the entity.
+            ZYPHRYON_INLINE void Refilter(UInt64 Entity)
+            {
+                Array<UInt64, Words> Filter = this->Subscribers;
+                Bool                 Scoped = false;
+
+                const auto Merge = [&](ConstRef<Scope> Entry)
+                {
+                    for (UInt32 Word = 0; Word < Words; ++Word)
+                    {
+                        Filter[Word] |= Entry.Subscribers[Word];
+                    }
+                };
+
+                if (const auto Iterator = Entities.find(Entity); Iterator != Entities.end())
+                {
+                    Merge(Iterator->second);
+                    Scoped = true;
+                }
+
+                if (const auto Iterator = Memberships.find(Entity); Iterator != Memberships.end())
+                {
+                    for (const UInt64 Group : Iterator->second)
+                    {
+                        if (const auto Found = Groups.find(Group); Found != Groups.end())
+                        {
+                            Merge(Found->second);
+                        }
+                    }
+                    Scoped = true;
+                }
+
+                if (Scoped)
+                {
+                    Filters[Entity] = Filter;
+                }
+                else
+                {
+                    Filters.erase(Entity);
+                }
+            }
+
+            /// \brief Recomputes the filters of every entity in a group.
+            ///
+            /// \param Group The identifier of the group.
+            ZYPHRYON_INLINE void RefilterGroup(UInt64 Group)
+            {
+                if (const auto Iterator = Members.find(Group); Iterator != Members.end())
+                {
+                    for (const UInt64 Entity : Iterator->second)
+                    {
+                        Refilter(Entity);
+                    }
+                }
+            }
+
+            /// \brief Recomputes the filters of every scoped entity, once the global subscribers have changed.
+            ZYPHRYON_INLINE void Refilter()
+            {
+                Vector<UInt64> Scoped;
+                Scoped.reserve(Filters.size());
+
+                for (const auto & [Entity, Filter] : Filters)
+                {
+                    Scoped.push_back(Entity);
+                }
+
+                for (const UInt64 Entity : Scoped)
+                {
+                    Refilter(Entity);
+                }
+            }
+        };
+
+        /// \brief Snapshot type of the stat subscribers, indexed by stat identifier.
+        using StatSnapshot  = Snapshot<Stat, OnModifyStatMulticast, StatRepository::kWords>;
+
+        /// \brief Snapshot type of the token subscribers, indexed by dense token index.
+        using TokenSnapshot = Snapshot<Token, OnModifyTokenMulticast, TokenRepository::kWords>;
+
+        /// \brief Replaces a subscriber snapshot with a modified copy, retiring the previous one.
+        ///
+        /// \param Snapshot The current subscriber snapshot.
+        /// \param Retired  The snapshots awaiting reclamation.
+        /// \param Action   The modification to apply to the copy.
+        template<typename Type, typename Function>
+        ZYPHRYON_INLINE void Update(Ref<std::atomic<Ptr<Type>>> Snapshot, Ref<Vector<Ptr<Type>>> Retired, AnyRef<Function> Action)
+        {
+            std::lock_guard Guard(mMutex);
+
+            const Ptr<Type> Previous = Snapshot.load(std::memory_order_relaxed);
+            const Ptr<Type> Current  = new Type(* Previous);
+            Action(* Current);
+
+            Snapshot.store(Current, std::memory_order_release);
+            Retired.emplace_back(Previous);
         }
 
     private:
@@ -151,9 +825,16 @@ namespace Gameplay
         // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
         // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 
-        Table<Stat, OnModifyStatMulticast>   mStatDelegates;
-        mutable std::shared_mutex            mStatDelegatesMutex;
-        Table<Token, OnModifyTokenMulticast> mTokenDelegates;
-        mutable std::shared_mutex            mTokenDelegatesMutex;
+        std::atomic<Ptr<StatSnapshot>>   mStatDelegates;
+        Vector<Ptr<StatSnapshot>>        mRetiredStatDelegates;
+        std::atomic<Ptr<TokenSnapshot>>  mTokenDelegates;
+        Vector<Ptr<TokenSnapshot>>       mRetiredTokenDelegates;
+        Vector<std::unique_ptr<Queue>>   mQueues;
+        Vector<std::thread::id>          mThreads;
+        Vector<StatEvent>                mStatEvents;
+        Vector<TokenEvent>               mTokenEvents;
+        Vector<ForwardEvent>             mForwardEvents;
+        std::mutex                       mMutex;
+        UInt64                           mSerial;
     };
 }
\ No newline at end of file
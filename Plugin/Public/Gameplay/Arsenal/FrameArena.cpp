@@ -0,0 +1,72 @@
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// Copyright (C) 2025 by Agustin L. Alvarez. All rights reserved.
+//
+// This work is licensed under the terms of the MIT license.
+//
+// For a copy, see <https://opensource.org/licenses/MIT>.
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [  HEADER  ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#include "Gameplay/Arsenal/FrameArena.hpp"
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [   CODE   ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+namespace Gameplay
+{
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void FrameArena::Reset()
+    {
+        // Fold the overflow blocks into a single one, so a frame of the same size fits in one block next time.
+        if (mBlocks.size() > 1)
+        {
+            UInt32 Capacity = 0;
+
+            for (ConstRef<Block> Block : mBlocks)
+            {
+                Capacity += Block.Capacity;
+            }
+
+            mBlocks.clear();
+            mBlocks.emplace_back(std::make_unique<Byte[]>(Capacity), Capacity);
+        }
+
+        mBlock  = 0;
+        mOffset = 0;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Ptr<Byte> FrameArena::Reserve(UInt32 Size, UInt32 Alignment)
+    {
+        while (mBlock < mBlocks.size())
+        {
+            Ref<Block>   Current = mBlocks[mBlock];
+            const UInt32 Offset  = (mOffset + Alignment - 1) & ~(Alignment - 1);
+
+            if (Offset + Size <= Current.Capacity)
+            {
+                mOffset = Offset + Size;
+                return Current.Data.get() + Offset;
+            }
+
+            // Move to the next block, which may have been kept from an earlier rewind.
+            ++mBlock;
+            mOffset = 0;
+        }
+
+        const UInt32 Capacity = Max(kBlockSize, Size);
+        mBlocks.emplace_back(std::make_unique<Byte[]>(Capacity), Capacity);
+
+        mBlock  = mBlocks.size() - 1;
+        mOffset = Size;
+        return mBlocks.back().Data.get();
+    }
+}
\ No newline at end of file
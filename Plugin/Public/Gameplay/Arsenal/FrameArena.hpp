@@ -0,0 +1,132 @@
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// Copyright (C) 2025 by Agustin L. Alvarez. All rights reserved.
+//
+// This work is licensed under the terms of the MIT license.
+//
+// For a copy, see <https://opensource.org/licenses/MIT>.
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#pragma once
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [  HEADER  ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#include <Zyphryon.Base/Base.hpp>
+#include <memory>
+
+#ifndef GAMEPLAY_FRAME_ARENA_BLOCK
+    #define GAMEPLAY_FRAME_ARENA_BLOCK (64 * 1024)
+#endif
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [   CODE   ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+namespace Gameplay
+{
+    /// \brief Provides per-thread linear scratch memory for data that only lives during a single frame.
+    ///
+    /// Allocations bump an offset into the current block and are never freed individually. The scheduler resets
+    /// the arena of each worker once per tick, folding any overflow blocks into a single larger one so the next
+    /// frame fits without allocating.
+    class FrameArena final
+    {
+    public:
+
+        /// \brief Minimum size in bytes of a block allocated by the arena.
+        static constexpr UInt32 kBlockSize = GAMEPLAY_FRAME_ARENA_BLOCK;
+
+        /// \brief Represents a position in the arena that can be rewound to.
+        struct Marker final
+        {
+            /// \brief The index of the block in use.
+            UInt32 Block;
+
+            /// \brief The offset within the block in use.
+            UInt32 Offset;
+        };
+
+    public:
+
+        /// \brief Default constructor, initializes an empty arena.
+        ZYPHRYON_INLINE FrameArena()
+            : mBlock  { 0 },
+              mOffset { 0 }
+        {
+        }
+
+        /// \brief Allocates scratch storage for the given number of elements, value-initialized.
+        ///
+        /// \note The memory is reclaimed without running destructors, so only trivially destructible types are allowed.
+        ///
+        /// \param Count The number of elements to allocate.
+        /// \return A span over the allocated elements, valid until the arena is rewound or reset.
+        template<typename Type>
+        ZYPHRYON_INLINE Span<Type> Allocate(UInt32 Count)
+        {
+            static_assert(std::is_trivially_destructible_v<Type>, "Arena memory is reclaimed without destructors.");
+
+            const Ptr<Type> Data = reinterpret_cast<Ptr<Type>>(Reserve(sizeof(Type) * Count, alignof(Type)));
+            std::uninitialized_value_construct_n(Data, Count);
+            return Span<Type>(Data, Count);
+        }
+
+        /// \brief Retrieves the current position of the arena.
+        ///
+        /// \return A marker that can be passed to `Rewind` to release everything allocated after it.
+        ZYPHRYON_INLINE Marker GetMarker() const
+        {
+            return Marker { mBlock, mOffset };
+        }
+
+        /// \brief Releases everything allocated after the given marker.
+        ///
+        /// \param Position The marker previously returned by `GetMarker`.
+        ZYPHRYON_INLINE void Rewind(Marker Position)
+        {
+            mBlock  = Position.Block;
+            mOffset = Position.Offset;
+        }
+
+        /// \brief Releases every allocation at once, keeping the memory for the next frame.
+        void Reset();
+
+        /// \brief Retrieves the arena bound to the calling thread.
+        ///
+        /// \return A reference to the arena of the calling thread.
+        ZYPHRYON_INLINE static Ref<FrameArena> Current()
+        {
+            static thread_local FrameArena Arena;
+            return Arena;
+        }
+
+    private:
+
+        /// \brief Represents a contiguous region of memory owned by the arena.
+        struct Block final
+        {
+            /// \brief The memory of the block.
+            std::unique_ptr<Byte[]> Data;
+
+            /// \brief The size of the block in bytes.
+            UInt32                  Capacity;
+        };
+
+        /// \brief Reserves raw memory from the arena, moving to a new block if the current one is exhausted.
+        ///
+        /// \param Size      The number of bytes to reserve.
+        /// \param Alignment The required alignment of the memory.
+        /// \return A pointer to the reserved memory.
+        Ptr<Byte> Reserve(UInt32 Size, UInt32 Alignment);
+
+    private:
+
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+        Vector<Block> mBlocks;
+        UInt32        mBlock;
+        UInt32        mOffset;
+    };
+}
\ No newline at end of file
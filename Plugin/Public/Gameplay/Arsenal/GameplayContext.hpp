@@ -0,0 +1,200 @@
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// Copyright (C) 2025 by Agustin L. Alvarez. All rights reserved.
+//
+// This work is licensed under the terms of the MIT license.
+//
+// For a copy, see <https://opensource.org/licenses/MIT>.
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#pragma once
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [  HEADER  ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#include "Gameplay/Arsenal/MemoryUsage.hpp"
+#include <memory>
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [   CODE   ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+namespace Gameplay
+{
+    class AbilityRepository;
+    class Coordinator;
+    class CueRepository;
+    class EffectRepository;
+    class StatRepository;
+    class TokenRepository;
+
+    /// \brief Owns the repositories and the coordinator of one game world, so several worlds with different rule
+    ///        sets can run in the same process.
+    ///
+    /// Every `Instance()` accessor resolves against the context current on the calling thread, which is the default
+    /// context unless a `Scope` is active. Contexts built from another one share its archetype tables, which should
+    /// be frozen, and own their cues and coordinator.
+    ///
+    /// \note Token literals are cached process-wide, so contexts with different token hierarchies should resolve
+    ///       tokens by name or share their token repository.
+    class GameplayContext final
+    {
+    public:
+
+        /// \brief Makes a context current on the calling thread for the lifetime of the scope.
+        class Scope final
+        {
+        public:
+
+            /// \brief Makes a context current, remembering the one it replaces.
+            ///
+            /// \param Context The context to make current, or `nullptr` to keep the current one.
+            ZYPHRYON_INLINE explicit Scope(Ptr<GameplayContext> Context)
+                : mPrevious { GetCurrent() }
+            {
+                if (Context)
+                {
+                    GetCurrent() = Context;
+                }
+            }
+
+            /// \brief Restores the context that was current before the scope.
+            ZYPHRYON_INLINE ~Scope()
+            {
+                GetCurrent() = mPrevious;
+            }
+
+            /// \brief Copying a scope is not allowed.
+            Scope(ConstRef<Scope>) = delete;
+
+            /// \brief Copying a scope is not allowed.
+            Ref<Scope> operator=(ConstRef<Scope>) = delete;
+
+        private:
+
+            // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+            // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+            Ptr<GameplayContext> mPrevious;
+        };
+
+    public:
+
+        /// \brief Constructs a context owning empty repositories and its own coordinator.
+        GameplayContext();
+
+        /// \brief Constructs a context sharing the archetype tables of another one.
+        ///
+        /// \note The token, stat, effect and ability repositories are shared, the cue repository and the coordinator
+        ///       are owned by the new context, since delegates and subscriptions belong to each world.
+        ///
+        /// \param Source The context whose archetype tables are shared.
+        explicit GameplayContext(ConstRef<GameplayContext> Source);
+
+        /// \brief Destroys the context, releasing the tables no other context shares.
+        ~GameplayContext();
+
+        /// \brief Retrieves the token repository of the context.
+        ///
+        /// \return A reference to the token repository.
+        ZYPHRYON_INLINE Ref<TokenRepository> GetTokens() const
+        {
+            return * mTokens;
+        }
+
+        /// \brief Retrieves the stat repository of the context.
+        ///
+        /// \return A reference to the stat repository.
+        ZYPHRYON_INLINE Ref<StatRepository> GetStats() const
+        {
+            return * mStats;
+        }
+
+        /// \brief Retrieves the effect repository of the context.
+        ///
+        /// \return A reference to the effect repository.
+        ZYPHRYON_INLINE Ref<EffectRepository> GetEffects() const
+        {
+            return * mEffects;
+        }
+
+        /// \brief Retrieves the ability repository of the context.
+        ///
+        /// \return A reference to the ability repository.
+        ZYPHRYON_INLINE Ref<AbilityRepository> GetAbilities() const
+        {
+            return * mAbilities;
+        }
+
+        /// \brief Retrieves the cue repository of the context.
+        ///
+        /// \return A reference to the cue repository.
+        ZYPHRYON_INLINE Ref<CueRepository> GetCues() const
+        {
+            return * mCues;
+        }
+
+        /// \brief Retrieves the coordinator of the context.
+        ///
+        /// \return A reference to the coordinator.
+        ZYPHRYON_INLINE Ref<Coordinator> GetCoordinator() const
+        {
+            return * mCoordinator;
+        }
+
+        /// \brief Samples the memory held by the repositories of the context.
+        ///
+        /// \note Must be called at a sync point. Tables shared with other contexts are reported by each of them.
+        ///
+        /// \return The memory usage of every repository, broken down by container.
+        MemoryUsage GetMemoryUsage() const;
+
+    public:
+
+        /// \brief Retrieves the context current on the calling thread.
+        ///
+        /// \return A reference to the current context, or to the default context if no scope is active.
+        ZYPHRYON_INLINE static Ref<GameplayContext> Current()
+        {
+            const Ptr<GameplayContext> Context = GetCurrent();
+            return Context ? * Context : Default();
+        }
+
+        /// \brief Retrieves the process-wide context used when no scope is active.
+        ///
+        /// \return A reference to the default context.
+        ZYPHRYON_INLINE static Ref<GameplayContext> Default()
+        {
+            static GameplayContext Singleton;
+            return Singleton;
+        }
+
+        /// \brief Allocates a process-wide unique serial, used to key per-thread caches by owner.
+        ///
+        /// \return A serial never returned before, never `0`.
+        static UInt64 Serial();
+
+    private:
+
+        /// \brief Retrieves the slot holding the context current on the calling thread.
+        ///
+        /// \return A reference to the thread's current context slot.
+        ZYPHRYON_INLINE static Ref<Ptr<GameplayContext>> GetCurrent()
+        {
+            static thread_local Ptr<GameplayContext> Current = nullptr;
+            return Current;
+        }
+
+    private:
+
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+        std::shared_ptr<TokenRepository>   mTokens;
+        std::shared_ptr<StatRepository>    mStats;
+        std::shared_ptr<EffectRepository>  mEffects;
+        std::shared_ptr<AbilityRepository> mAbilities;
+        std::unique_ptr<CueRepository>     mCues;
+        std::unique_ptr<Coordinator>       mCoordinator;
+    };
+}
\ No newline at end of file
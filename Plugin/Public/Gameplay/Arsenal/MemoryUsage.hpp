@@ -0,0 +1,140 @@
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// Copyright (C) 2025 by Agustin L. Alvarez. All rights reserved.
+//
+// This work is licensed under the terms of the MIT license.
+//
+// For a copy, see <https://opensource.org/licenses/MIT>.
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#pragma once
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [  HEADER  ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#include <Zyphryon.Base/Base.hpp>
+#include <ranges>
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [   CODE   ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+namespace Gameplay
+{
+    /// \brief Accumulates the memory held by gameplay containers, split into reserved and used bytes.
+    ///
+    /// Entries are keyed by owner and container, and recording the same pair again adds to it, so the usage of every
+    /// arsenal of a shard can be merged into a single report. Sampling only reads sizes and capacities and never
+    /// allocates, so it is cheap enough to run in production.
+    ///
+    /// \note Hash tables do not expose their buckets, they are estimated from the elements they hold.
+    class MemoryUsage final
+    {
+    public:
+
+        /// \brief Maximum number of distinct containers a report can hold.
+        static constexpr UInt32 kMaxEntries = 64;
+
+        /// \brief Represents the memory held by a single container.
+        struct Entry final
+        {
+            /// \brief The name of the subsystem owning the container.
+            ConstStr8 Owner;
+
+            /// \brief The name of the container within its owner.
+            ConstStr8 Container;
+
+            /// \brief The bytes reserved by the container, including unused capacity.
+            UInt64    Reserved = 0;
+
+            /// \brief The bytes holding live elements.
+            UInt64    Used     = 0;
+        };
+
+    public:
+
+        /// \brief Records the memory held by a container, adding to any previous record of the same container.
+        ///
+        /// \param Owner     The name of the subsystem owning the container, which must outlive the report.
+        /// \param Container The name of the container, which must outlive the report.
+        /// \param Reserved  The bytes reserved by the container.
+        /// \param Used      The bytes holding live elements.
+        void Record(ConstStr8 Owner, ConstStr8 Container, UInt64 Reserved, UInt64 Used);
+
+        /// \brief Records the memory held by a contiguous container from its size and capacity.
+        ///
+        /// \param Owner     The name of the subsystem owning the container.
+        /// \param Container The name of the container.
+        /// \param Values    The container to measure.
+        template<typename Type>
+        ZYPHRYON_INLINE void RecordVector(ConstStr8 Owner, ConstStr8 Container, ConstRef<Type> Values)
+        {
+            constexpr UInt64 kElement = sizeof(typename Type::value_type);
+
+            Record(Owner, Container, Values.capacity() * kElement, Values.size() * kElement);
+        }
+
+        /// \brief Records the memory held by a hash table, estimated from its element count.
+        ///
+        /// \param Owner     The name of the subsystem owning the container.
+        /// \param Container The name of the container.
+        /// \param Values    The table to measure.
+        template<typename Type>
+        ZYPHRYON_INLINE void RecordTable(ConstStr8 Owner, ConstStr8 Container, ConstRef<Type> Values)
+        {
+            const UInt64 Bytes = Values.size() * sizeof(std::ranges::range_value_t<Type>);
+
+            Record(Owner, Container, Bytes, Bytes);
+        }
+
+        /// \brief Records the memory held by a fixed block, whose whole size is always reserved.
+        ///
+        /// \param Owner     The name of the subsystem owning the container.
+        /// \param Container The name of the container.
+        /// \param Block     The block to measure.
+        /// \param Used      The bytes of the block holding live elements.
+        template<typename Type>
+        ZYPHRYON_INLINE void RecordBlock(ConstStr8 Owner, ConstStr8 Container, ConstRef<Type> Block, UInt64 Used)
+        {
+            Record(Owner, Container, sizeof(Block), Min<UInt64>(Used, sizeof(Block)));
+        }
+
+        /// \brief Adds every entry of another report to this one.
+        ///
+        /// \param Other The report to merge.
+        void Merge(ConstRef<MemoryUsage> Other);
+
+        /// \brief Removes every entry of the report.
+        ZYPHRYON_INLINE void Clear()
+        {
+            mEntries.clear();
+        }
+
+        /// \brief Retrieves every entry of the report, in recording order.
+        ///
+        /// \return A span over the recorded entries.
+        ZYPHRYON_INLINE ConstSpan<Entry> GetEntries() const
+        {
+            return mEntries;
+        }
+
+        /// \brief Retrieves the bytes reserved by the containers of an owner, or by every container.
+        ///
+        /// \param Owner The name of the owner to sum, or empty to sum every entry.
+        /// \return The total reserved bytes.
+        UInt64 GetReserved(ConstStr8 Owner = ConstStr8()) const;
+
+        /// \brief Retrieves the bytes holding live elements in the containers of an owner, or in every container.
+        ///
+        /// \param Owner The name of the owner to sum, or empty to sum every entry.
+        /// \return The total used bytes.
+        UInt64 GetUsed(ConstStr8 Owner = ConstStr8()) const;
+
+    private:
+
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+        Vector<Entry, kMaxEntries> mEntries;
+    };
+}
\ No newline at end of file
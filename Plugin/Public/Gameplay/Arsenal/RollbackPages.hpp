@@ -0,0 +1,150 @@
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// Copyright (C) 2025 by Agustin L. Alvarez. All rights reserved.
+//
+// This work is licensed under the terms of the MIT license.
+//
+// For a copy, see <https://opensource.org/licenses/MIT>.
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#pragma once
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [  HEADER  ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#include <Zyphryon.Base/Base.hpp>
+#include <cstring>
+#include <memory>
+
+#ifndef GAMEPLAY_ROLLBACK_PAGE_SIZE
+    #define GAMEPLAY_ROLLBACK_PAGE_SIZE 512
+#endif
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [   CODE   ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+namespace Gameplay
+{
+    /// \brief Captures and restores a trivially copyable block of state as immutable pages shared between snapshots.
+    ///
+    /// The most recent page captured or restored is remembered for every range of the block. A capture only copies
+    /// the pages whose bytes differ from it and shares the rest, so a ring of snapshots taken a few frames apart
+    /// holds one copy of the state plus the pages that changed in between. A restore only writes back the pages
+    /// that differ from the live state.
+    ///
+    /// The block is a span of elements whose length may change between captures, so sets can size their storage
+    /// to what they hold. The caller resizes the block to the length of a capture before restoring it.
+    ///
+    /// \tparam Type The type of the elements of the block, which must be trivially copyable.
+    template<typename Type>
+    class RollbackPages final
+    {
+        static_assert(std::is_trivially_copyable_v<Type>, "Rollback pages are compared and copied bytewise.");
+
+    public:
+
+        /// \brief Size in bytes of a page.
+        static constexpr UInt32 kPageSize = GAMEPLAY_ROLLBACK_PAGE_SIZE;
+
+        /// \brief Represents a copy of a range of the block, never modified once captured.
+        using Page  = Array<Byte, kPageSize>;
+
+        /// \brief Represents the pages covering a captured block.
+        using Pages = Vector<std::shared_ptr<const Page>>;
+
+    public:
+
+        /// \brief Captures the block into the given pages, sharing the pages that did not change.
+        ///
+        /// \param Block  The live block to capture.
+        /// \param Target The pages receiving the capture.
+        ZYPHRYON_INLINE void Capture(ConstSpan<Type> Block, Ref<Pages> Target)
+        {
+            const UInt32 Count = GetCount(Block.size_bytes());
+
+            mRecent.resize(Count);
+            Target.resize(Count);
+
+            for (UInt32 Index = 0; Index < Count; ++Index)
+            {
+                const ConstPtr<Byte> Range = reinterpret_cast<ConstPtr<Byte>>(Block.data()) + Index * kPageSize;
+                const UInt32         Size  = GetSize(Block.size_bytes(), Index);
+
+                if (!mRecent[Index] || std::memcmp(Range, mRecent[Index]->data(), Size) != 0)
+                {
+                    const std::shared_ptr<Page> Copy = std::make_shared<Page>();
+                    std::memcpy(Copy->data(), Range, Size);
+                    mRecent[Index] = Copy;
+                }
+                Target[Index] = mRecent[Index];
+            }
+        }
+
+        /// \brief Restores the block from the given pages, writing back only the pages that differ.
+        ///
+        /// \param Block  The live block to restore, already sized to the length it had when captured.
+        /// \param Source The pages of a previous capture.
+        ZYPHRYON_INLINE void Restore(Span<Type> Block, ConstRef<Pages> Source)
+        {
+            const UInt32 Count = GetCount(Block.size_bytes());
+
+            LOG_ASSERT(Source.size() == Count, "Restoring a block whose length differs from the capture.");
+
+            mRecent.resize(Count);
+
+            for (UInt32 Index = 0; Index < Count; ++Index)
+            {
+                LOG_ASSERT(Source[Index], "Restoring from pages that were never captured.");
+
+                const Ptr<Byte> Range = reinterpret_cast<Ptr<Byte>>(Block.data()) + Index * kPageSize;
+                const UInt32    Size  = GetSize(Block.size_bytes(), Index);
+
+                if (std::memcmp(Range, Source[Index]->data(), Size) != 0)
+                {
+                    std::memcpy(Range, Source[Index]->data(), Size);
+                }
+                mRecent[Index] = Source[Index];
+            }
+        }
+
+        /// \brief Retrieves the bytes of the pages most recently captured or restored, which snapshots may share.
+        ///
+        /// \return The bytes retained by the recent pages.
+        ZYPHRYON_INLINE UInt64 GetRetained() const
+        {
+            return std::ranges::count_if(mRecent, [](ConstRef<std::shared_ptr<const Page>> Recent)
+            {
+                return Recent != nullptr;
+            }) * sizeof(Page);
+        }
+
+    private:
+
+        /// \brief Retrieves the number of pages needed to cover a block.
+        ///
+        /// \param Bytes The size of the block in bytes.
+        /// \return The number of pages covering the block.
+        ZYPHRYON_INLINE static UInt32 GetCount(UInt64 Bytes)
+        {
+            return static_cast<UInt32>((Bytes + kPageSize - 1) / kPageSize);
+        }
+
+        /// \brief Retrieves the number of bytes of the block covered by a page, smaller for the last one.
+        ///
+        /// \param Bytes The size of the block in bytes.
+        /// \param Index The index of the page.
+        /// \return The number of bytes covered by the page.
+        ZYPHRYON_INLINE static UInt32 GetSize(UInt64 Bytes, UInt32 Index)
+        {
+            return static_cast<UInt32>(Min<UInt64>(kPageSize, Bytes - Index * kPageSize));
+        }
+
+    private:
+
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+        Pages mRecent;
+    };
+}
\ No newline at end of file
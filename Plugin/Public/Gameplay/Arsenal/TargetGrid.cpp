@@ -0,0 +1,162 @@
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// Copyright (C) 2025 by Agustin L. Alvarez. All rights reserved.
+//
+// This work is licensed under the terms of the MIT license.
+//
+// For a copy, see <https://opensource.org/licenses/MIT>.
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [  HEADER  ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#include "Gameplay/Arsenal/TargetGrid.hpp"
+#include <numeric>
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [   CODE   ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+namespace Gameplay
+{
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void TargetGrid::Build()
+    {
+        mOffsets.fill(0);
+
+        for (ConstRef<Entry> Candidate : mEntries)
+        {
+            ++mOffsets[Candidate.Bucket + 1];
+        }
+        std::inclusive_scan(mOffsets.begin(), mOffsets.end(), mOffsets.begin());
+
+        Ref<FrameArena>          Arena   = FrameArena::Current();
+        const FrameArena::Marker Marker  = Arena.GetMarker();
+        const Span<UInt32>       Cursors = Arena.Allocate<UInt32>(kBuckets);
+
+        std::copy_n(mOffsets.begin(), kBuckets, Cursors.begin());
+
+        // Scatter the entries by bucket, each bucket keeps the insertion order of its entities.
+        mScratch.resize(mEntries.size());
+
+        for (ConstRef<Entry> Candidate : mEntries)
+        {
+            mScratch[Cursors[Candidate.Bucket]++] = Candidate;
+        }
+        std::swap(mEntries, mScratch);
+
+        Arena.Rewind(Marker);
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Span<Scene::Entity> TargetGrid::Query(Real32 X, Real32 Y, Real32 Radius, ConstRef<TokenQuery> Filter) const
+    {
+        LOG_ASSERT(Radius >= 0.0f, "The radius of an area cannot be negative.");
+
+        const UInt32 Left   = GetCell(X - Radius);
+        const UInt32 Right  = GetCell(X + Radius);
+        const UInt32 Bottom = GetCell(Y - Radius);
+        const UInt32 Top    = GetCell(Y + Radius);
+        const UInt64 Cells  = (static_cast<UInt64>(Right - Left) + 1) * (static_cast<UInt64>(Top - Bottom) + 1);
+
+        const auto IsInside = [&](ConstRef<Entry> Candidate)
+        {
+            const Real32 DeltaX = Candidate.X - X;
+            const Real32 DeltaY = Candidate.Y - Y;
+            return DeltaX * DeltaX + DeltaY * DeltaY <= Radius * Radius;
+        };
+
+        Ref<FrameArena> Arena = FrameArena::Current();
+        UInt32          Count = 0;
+
+        // An area spanning more cells than buckets would visit every bucket anyway, scan the entries instead.
+        if (Cells >= kBuckets)
+        {
+            const Span<Scene::Entity> Targets = Arena.Allocate<Scene::Entity>(mEntries.size());
+
+            for (ConstRef<Entry> Candidate : mEntries)
+            {
+                if (IsInside(Candidate) && Accepts(Candidate, Filter))
+                {
+                    Targets[Count++] = Candidate.Entity;
+                }
+            }
+            return Targets.first(Count);
+        }
+
+        const auto ForEachCell = [&](auto Action)
+        {
+            for (UInt32 Column = Left; Column <= Right; ++Column)
+            {
+                for (UInt32 Row = Bottom; Row <= Top; ++Row)
+                {
+                    Action(Column, Row, GetBucket(Column, Row));
+                }
+            }
+        };
+
+        // Bound the result by the size of the buckets covered, so the span is allocated once.
+        UInt32 Bound = 0;
+
+        ForEachCell([&](UInt32, UInt32, UInt32 Bucket)
+        {
+            Bound += mOffsets[Bucket + 1] - mOffsets[Bucket];
+        });
+
+        const Span<Scene::Entity> Targets = Arena.Allocate<Scene::Entity>(Bound);
+
+        ForEachCell([&](UInt32 Column, UInt32 Row, UInt32 Bucket)
+        {
+            for (UInt32 Index = mOffsets[Bucket]; Index < mOffsets[Bucket + 1]; ++Index)
+            {
+                // Buckets are shared by colliding cells, only take the entities of the cell being visited.
+                if (ConstRef<Entry> Candidate = mEntries[Index]; Candidate.Column == Column && Candidate.Row == Row)
+                {
+                    if (IsInside(Candidate) && Accepts(Candidate, Filter))
+                    {
+                        Targets[Count++] = Candidate.Entity;
+                    }
+                }
+            }
+        });
+        return Targets.first(Count);
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Span<Scene::Entity> TargetGrid::Query(ConstRef<TokenQuery> Filter) const
+    {
+        const Span<Scene::Entity> Targets = FrameArena::Current().Allocate<Scene::Entity>(mEntries.size());
+        UInt32                    Count   = 0;
+
+        for (ConstRef<Entry> Candidate : mEntries)
+        {
+            if (Accepts(Candidate, Filter))
+            {
+                Targets[Count++] = Candidate.Entity;
+            }
+        }
+        return Targets.first(Count);
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Span<Scene::Entity> TargetGrid::Resolve(ConstRef<AbilityTarget> Target, Real32 X, Real32 Y, Real32 Radius) const
+    {
+        switch (Target.GetKind())
+        {
+        case AbilityTarget::Kind::Area:
+            return Query(X, Y, Radius, Target.GetQuery());
+        case AbilityTarget::Kind::Category:
+            return Query(Target.GetQuery());
+        default:
+            return Span<Scene::Entity>();
+        }
+    }
+}
\ No newline at end of file
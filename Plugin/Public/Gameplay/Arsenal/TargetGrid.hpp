@@ -0,0 +1,190 @@
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// Copyright (C) 2025 by Agustin L. Alvarez. All rights reserved.
+//
+// This work is licensed under the terms of the MIT license.
+//
+// For a copy, see <https://opensource.org/licenses/MIT>.
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#pragma once
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [  HEADER  ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#include "Gameplay/Arsenal/Arsenal.hpp"
+
+#ifndef GAMEPLAY_TARGET_GRID_BUCKETS
+    #define GAMEPLAY_TARGET_GRID_BUCKETS 4096
+#endif
+
+#ifndef GAMEPLAY_TARGET_GRID_CELL_SIZE
+    #define GAMEPLAY_TARGET_GRID_CELL_SIZE 8.0f
+#endif
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [   CODE   ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+namespace Gameplay
+{
+    /// \brief Resolves the targets of abilities from a uniform grid over the positions of entities on a plane.
+    ///
+    /// The grid is meant to be rebuilt once per frame: entities are inserted with their position and arsenal,
+    /// then `Build` sorts them by cell so every cell is a contiguous run. Cells are hashed into a fixed number
+    /// of buckets, so the grid covers an unbounded plane without allocating per cell.
+    ///
+    /// Candidates are filtered against the requirement of the target with a query compiled once per call, and
+    /// read the tokens through the arsenal captured at insertion instead of looking up each entity.
+    class TargetGrid final
+    {
+    public:
+
+        /// \brief Number of buckets the cells are hashed into.
+        static constexpr UInt32 kBuckets  = GAMEPLAY_TARGET_GRID_BUCKETS;
+
+        /// \brief Default length of the side of a cell.
+        static constexpr Real32 kCellSize = GAMEPLAY_TARGET_GRID_CELL_SIZE;
+
+        static_assert(std::has_single_bit(kBuckets), "The number of buckets must be a power of two.");
+
+    public:
+
+        /// \brief Constructs an empty grid.
+        ///
+        /// \param CellSize The length of the side of a cell, ideally close to the radius of common areas.
+        ZYPHRYON_INLINE explicit TargetGrid(Real32 CellSize = kCellSize)
+            : mCellSize { CellSize },
+              mOffsets  { }
+        {
+            LOG_ASSERT(CellSize > 0.0f, "The cells of the grid must have a positive size.");
+        }
+
+        /// \brief Removes every entity from the grid, keeping the memory for the next frame.
+        ZYPHRYON_INLINE void Clear()
+        {
+            mEntries.clear();
+            mOffsets.fill(0);
+        }
+
+        /// \brief Inserts an entity into the grid.
+        ///
+        /// \note The entity cannot be queried until the grid is built, and the arsenal must outlive the grid content.
+        ///
+        /// \param Entity The entity to insert.
+        /// \param Owner  The arsenal of the entity, used to filter it against requirements.
+        /// \param X      The position of the entity along the first axis of the plane.
+        /// \param Y      The position of the entity along the second axis of the plane.
+        ZYPHRYON_INLINE void Insert(Scene::Entity Entity, ConstRef<Arsenal> Owner, Real32 X, Real32 Y)
+        {
+            const UInt32 Column = GetCell(X);
+            const UInt32 Row    = GetCell(Y);
+
+            mEntries.emplace_back(Entry { X, Y, Column, Row, GetBucket(Column, Row), Entity, & Owner });
+        }
+
+        /// \brief Sorts the inserted entities by cell, so they can be queried.
+        void Build();
+
+        /// \brief Collects the entities within a circle that satisfy a compiled token query.
+        ///
+        /// \param X      The center of the circle along the first axis of the plane.
+        /// \param Y      The center of the circle along the second axis of the plane.
+        /// \param Radius The radius of the circle.
+        /// \param Filter The query the tokens of each candidate must satisfy, ignored when empty.
+        /// \return A span over the matching entities, allocated from the frame arena of the calling thread.
+        Span<Scene::Entity> Query(Real32 X, Real32 Y, Real32 Radius, ConstRef<TokenQuery> Filter) const;
+
+        /// \brief Collects every entity in the grid that satisfies a compiled token query.
+        ///
+        /// \param Filter The query the tokens of each candidate must satisfy, ignored when empty.
+        /// \return A span over the matching entities, allocated from the frame arena of the calling thread.
+        Span<Scene::Entity> Query(ConstRef<TokenQuery> Filter) const;
+
+        /// \brief Resolves the targets of an ability, ready to be passed to `Arsenal::TryActivate`.
+        ///
+        /// \note Area targets are collected within the circle and category targets across the whole grid, both
+        ///       filtered by the requirement. Any other kind is chosen by the caller and resolves to no target.
+        ///
+        /// \param Target The target definition of the ability.
+        /// \param X      The center of the area along the first axis of the plane.
+        /// \param Y      The center of the area along the second axis of the plane.
+        /// \param Radius The radius of the area.
+        /// \return A span over the resolved entities, allocated from the frame arena of the calling thread.
+        Span<Scene::Entity> Resolve(ConstRef<AbilityTarget> Target, Real32 X, Real32 Y, Real32 Radius) const;
+
+        /// \brief Retrieves the number of entities inserted into the grid.
+        ///
+        /// \return The number of entities.
+        ZYPHRYON_INLINE UInt32 GetSize() const
+        {
+            return mEntries.size();
+        }
+
+    private:
+
+        /// \brief Represents an entity inserted into the grid.
+        struct Entry final
+        {
+            /// \brief The position of the entity along the first axis.
+            Real32            X;
+
+            /// \brief The position of the entity along the second axis.
+            Real32            Y;
+
+            /// \brief The column of the cell holding the entity.
+            UInt32            Column;
+
+            /// \brief The row of the cell holding the entity.
+            UInt32            Row;
+
+            /// \brief The bucket the cell is hashed into.
+            UInt32            Bucket;
+
+            /// \brief The entity itself.
+            Scene::Entity     Entity;
+
+            /// \brief The arsenal of the entity.
+            ConstPtr<Arsenal> Owner;
+        };
+
+        /// \brief Retrieves the cell coordinate of a position, biased so negative positions map to unsigned cells.
+        ///
+        /// \param Coordinate The position along one axis.
+        /// \return The cell coordinate along that axis.
+        ZYPHRYON_INLINE UInt32 GetCell(Real32 Coordinate) const
+        {
+            return static_cast<UInt32>(std::floor(static_cast<Real64>(Coordinate) / mCellSize) + 2'147'483'648.0);
+        }
+
+        /// \brief Hashes the coordinates of a cell into a bucket.
+        ///
+        /// \param Column The column of the cell.
+        /// \param Row    The row of the cell.
+        /// \return The bucket of the cell.
+        ZYPHRYON_INLINE static UInt32 GetBucket(UInt32 Column, UInt32 Row)
+        {
+            return ((Column * 0x9E3779B1u) ^ (Row * 0x85EBCA77u)) & (kBuckets - 1);
+        }
+
+        /// \brief Checks if an entry satisfies a compiled token query.
+        ///
+        /// \param Candidate The entry to check.
+        /// \param Filter    The query to evaluate, ignored when empty.
+        /// \return `true` if the entry satisfies the query, `false` otherwise.
+        ZYPHRYON_INLINE static Bool Accepts(ConstRef<Entry> Candidate, ConstRef<TokenQuery> Filter)
+        {
+            return Filter.IsEmpty() || Candidate.Owner->Matches(Filter);
+        }
+
+    private:
+
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+        Real32                      mCellSize;
+        Vector<Entry>               mEntries;
+        Vector<Entry>               mScratch;
+        Array<UInt32, kBuckets + 1> mOffsets;
+    };
+}
\ No newline at end of file
@@ -0,0 +1,235 @@
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// Copyright (C) 2025 by Agustin L. Alvarez. All rights reserved.
+//
+// This work is licensed under the terms of the MIT license.
+//
+// For a copy, see <https://opensource.org/licenses/MIT>.
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#pragma once
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [  HEADER  ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#include <Zyphryon.Base/Base.hpp>
+#include <atomic>
+#include <memory>
+#include <mutex>
+
+#ifndef GAMEPLAY_TRACE
+    #define GAMEPLAY_TRACE 0
+#endif
+
+#ifndef GAMEPLAY_TRACE_ZONE
+    #if GAMEPLAY_TRACE && defined(TRACY_ENABLE)
+        #include <tracy/Tracy.hpp>
+        #define GAMEPLAY_TRACE_ZONE(Name) ZoneScopedN(Name)
+    #else
+        #define GAMEPLAY_TRACE_ZONE(Name)
+    #endif
+#endif
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [   CODE   ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+namespace Gameplay
+{
+    /// \brief Enumerates the counters recorded by the gameplay instrumentation.
+    enum class TraceCounter : UInt8
+    {
+        Ticks,          ///< Arsenal ticks processed.
+        Applications,   ///< Effects applied to an arsenal.
+        Updates,        ///< Effect periods and expirations processed.
+        Recomputes,     ///< Stat effective values recalculated.
+        Propagations,   ///< Dependency notifications started.
+        Reach,          ///< Largest number of dependents visited by a single notification.
+        Notifications,  ///< Stat and token changes published to a listener.
+        Cues,           ///< Cue events published to a delegate.
+        Immunities,     ///< Effect applications rejected by the markers of their archetype.
+        Culled,         ///< Cue events dropped for being irrelevant to every observer.
+    };
+
+    /// \brief Compile-time toggleable instrumentation of the gameplay hot paths.
+    ///
+    /// Counters are kept per thread and only written by their owner, so recording never contends. Scoped zones go
+    /// through `GAMEPLAY_TRACE_ZONE`, which maps to Tracy when `TRACY_ENABLE` is defined and can be predefined to any
+    /// other profiler (such as `TRACE_EVENT("gameplay", Name)` for Perfetto). With `GAMEPLAY_TRACE` left at `0` every
+    /// hook compiles to nothing.
+    class Trace final
+    {
+    public:
+
+        /// \brief Whether the instrumentation is compiled in.
+        static constexpr Bool   kEnabled  = GAMEPLAY_TRACE;
+
+        /// \brief Number of counters recorded per thread.
+        static constexpr UInt32 kCounters = 10;
+
+        /// \brief Holds the counters recorded by a single thread.
+        class Counters final
+        {
+        public:
+
+            /// \brief Retrieves the value of a counter.
+            ///
+            /// \param Counter The counter to retrieve.
+            /// \return The current value of the counter.
+            ZYPHRYON_INLINE UInt64 Get(TraceCounter Counter) const
+            {
+                return mValues[Enum::Cast(Counter)].load(std::memory_order_relaxed);
+            }
+
+            /// \brief Adds an amount to a counter.
+            ///
+            /// \param Counter The counter to increase.
+            /// \param Amount  The amount to add.
+            ZYPHRYON_INLINE void Add(TraceCounter Counter, UInt64 Amount)
+            {
+                Ref<std::atomic<UInt64>> Value = mValues[Enum::Cast(Counter)];
+                Value.store(Value.load(std::memory_order_relaxed) + Amount, std::memory_order_relaxed);
+            }
+
+            /// \brief Raises a counter to the given value if it is larger.
+            ///
+            /// \param Counter The counter to raise.
+            /// \param Amount  The candidate value.
+            ZYPHRYON_INLINE void Raise(TraceCounter Counter, UInt64 Amount)
+            {
+                if (Ref<std::atomic<UInt64>> Value = mValues[Enum::Cast(Counter)]; Value.load(std::memory_order_relaxed) < Amount)
+                {
+                    Value.store(Amount, std::memory_order_relaxed);
+                }
+            }
+
+            /// \brief Resets every counter to zero.
+            ZYPHRYON_INLINE void Reset()
+            {
+                for (Ref<std::atomic<UInt64>> Value : mValues)
+                {
+                    Value.store(0, std::memory_order_relaxed);
+                }
+            }
+
+        private:
+
+            // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+            // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+            Array<std::atomic<UInt64>, kCounters> mValues { };
+        };
+
+    public:
+
+        /// \brief Adds an amount to a counter of the calling thread.
+        ///
+        /// \param Counter The counter to increase.
+        /// \param Amount  The amount to add (default is one).
+        ZYPHRYON_INLINE static void Increment(TraceCounter Counter, UInt64 Amount = 1)
+        {
+            if constexpr (kEnabled)
+            {
+                GetLocal().Add(Counter, Amount);
+            }
+        }
+
+        /// \brief Raises a peak counter of the calling thread to the given value if it is larger.
+        ///
+        /// \param Counter The counter to raise.
+        /// \param Amount  The candidate value.
+        ZYPHRYON_INLINE static void Raise(TraceCounter Counter, UInt64 Amount)
+        {
+            if constexpr (kEnabled)
+            {
+                GetLocal().Raise(Counter, Amount);
+            }
+        }
+
+        /// \brief Retrieves the counters of the calling thread, registering them on first use.
+        ///
+        /// \return A reference to the counters of the calling thread.
+        ZYPHRYON_INLINE static Ref<Counters> GetLocal()
+        {
+            static thread_local Ptr<Counters> Current = nullptr;
+
+            if (!Current)
+            {
+                Current = Register();
+            }
+            return * Current;
+        }
+
+        /// \brief Sums the counters of every thread, keeping the largest value of peak counters.
+        ///
+        /// \note Meant to run at a sync point, values being written concurrently may be missed until the next call.
+        ///
+        /// \param Action The action receiving each counter and its combined value.
+        template<typename Function>
+        ZYPHRYON_INLINE static void Collect(AnyRef<Function> Action)
+        {
+            Array<UInt64, kCounters> Totals { };
+
+            Visit([&](ConstRef<Counters> Thread)
+            {
+                for (UInt32 Index = 0; Index < kCounters; ++Index)
+                {
+                    const TraceCounter Counter = static_cast<TraceCounter>(Index);
+                    const UInt64       Value   = Thread.Get(Counter);
+
+                    Totals[Index] = (Counter == TraceCounter::Reach ? std::max(Totals[Index], Value) : Totals[Index] + Value);
+                }
+            });
+
+            for (UInt32 Index = 0; Index < kCounters; ++Index)
+            {
+                Action(static_cast<TraceCounter>(Index), Totals[Index]);
+            }
+        }
+
+        /// \brief Resets the counters of every thread, typically once per frame after collecting them.
+        static void Reset();
+
+    private:
+
+        /// \brief Holds the counters of every thread that recorded an event.
+        struct Registry final
+        {
+            /// \brief Guards the thread list.
+            std::mutex                        Mutex;
+
+            /// \brief The counters of each registered thread.
+            Vector<std::unique_ptr<Counters>> Threads;
+        };
+
+        /// \brief Allocates and registers the counters of a new thread.
+        ///
+        /// \return A pointer to the counters, owned by the registry for the lifetime of the program.
+        static Ptr<Counters> Register();
+
+        /// \brief Invokes the action for the counters of every registered thread.
+        ///
+        /// \param Action The action receiving each counter set.
+        template<typename Function>
+        ZYPHRYON_INLINE static void Visit(AnyRef<Function> Action)
+        {
+            Ref<Registry> Registry = GetRegistry();
+
+            std::lock_guard Guard(Registry.Mutex);
+
+            for (ConstRef<std::unique_ptr<Counters>> Thread : Registry.Threads)
+            {
+                Action(* Thread);
+            }
+        }
+
+        /// \brief Retrieves the process-wide registry of thread counters.
+        ///
+        /// \return A reference to the registry.
+        ZYPHRYON_INLINE static Ref<Registry> GetRegistry()
+        {
+            static Registry Singleton;
+            return Singleton;
+        }
+    };
+}
\ No newline at end of file
@@ -0,0 +1,147 @@
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// Copyright (C) 2025 by Agustin L. Alvarez. All rights reserved.
+//
+// This work is licensed under the terms of the MIT license.
+//
+// For a copy, see <https://opensource.org/licenses/MIT>.
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#pragma once
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [  HEADER  ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#include "Gameplay/Bake/BakeTypes.hpp"
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [   CODE   ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+namespace Gameplay
+{
+    /// \brief Reads values from a baked binary resource, usually a view over a memory-mapped blob.
+    ///
+    /// \note Strings returned by the reader are views into the underlying data, which must outlive them.
+    class BakeReader final
+    {
+    public:
+
+        /// \brief Constructs a reader over the given binary data.
+        ///
+        /// \param Data The binary data to read from.
+        ZYPHRYON_INLINE BakeReader(ConstSpan<Byte> Data)
+            : mData   { Data },
+              mOffset { 0 },
+              mValid  { true }
+        {
+        }
+
+        /// \brief Reads and validates the header of the resource.
+        ///
+        /// \param Kind The kind of repository the resource is expected to hold.
+        /// \return `true` if the header matches the expected kind and version, `false` otherwise.
+        Bool Open(BakeKind Kind);
+
+        /// \brief Checks whether every read so far stayed within the bounds of the data.
+        ///
+        /// \return `true` if the reader is valid, `false` otherwise.
+        ZYPHRYON_INLINE Bool IsValid() const
+        {
+            return mValid;
+        }
+
+        /// \brief Reads a trivially copyable value and advances the reader.
+        ///
+        /// \return The value read, or a default constructed value if the data is exhausted.
+        template<typename Type>
+        ZYPHRYON_INLINE Type Read()
+        {
+            Type Value = Peek<Type>();
+
+            if (mValid)
+            {
+                mOffset += sizeof(Type);
+            }
+            return Value;
+        }
+
+        /// \brief Reads a trivially copyable value without advancing the reader.
+        ///
+        /// \return The value read, or a default constructed value if the data is exhausted.
+        template<typename Type>
+        ZYPHRYON_INLINE Type Peek()
+        {
+            static_assert(std::is_trivially_copyable_v<Type>, "Baked values must be trivially copyable.");
+
+            Type Value { };
+
+            if (Reserve(sizeof(Type)))
+            {
+                std::memcpy(&Value, mData.data() + mOffset, sizeof(Type));
+            }
+            return Value;
+        }
+
+        /// \brief Reads a length-prefixed string and advances the reader.
+        ///
+        /// \return A view over the string stored in the data, or an empty view if the data is exhausted.
+        ZYPHRYON_INLINE ConstStr8 ReadString()
+        {
+            const UInt32 Length = Read<UInt32>();
+
+            if (!Reserve(Length))
+            {
+                return ConstStr8();
+            }
+
+            const ConstStr8 Value(reinterpret_cast<ConstPtr<Char>>(mData.data() + mOffset), Length);
+            mOffset += Length;
+            return Value;
+        }
+
+        /// \brief Skips over bytes without reading them.
+        ///
+        /// \param Size The number of bytes to skip.
+        ZYPHRYON_INLINE void Skip(UInt Size)
+        {
+            if (Reserve(Size))
+            {
+                mOffset += Size;
+            }
+        }
+
+    public:
+
+        /// \brief Checks whether the given data starts with the magic number of a baked resource.
+        ///
+        /// \param Data The data to inspect.
+        /// \return `true` if the data holds a baked resource, `false` otherwise (e.g. TOML text).
+        static Bool IsBaked(ConstSpan<Byte> Data);
+
+    private:
+
+        /// \brief Ensures that the given number of bytes can be read, invalidating the reader otherwise.
+        ///
+        /// \param Size The number of bytes to read.
+        /// \return `true` if the bytes are available, `false` otherwise.
+        ZYPHRYON_INLINE Bool Reserve(UInt Size)
+        {
+            if (mValid && Size > mData.size() - mOffset)
+            {
+                LOG_WARNING("Baked resource is truncated at offset {}.", mOffset);
+                mValid = false;
+            }
+            return mValid;
+        }
+
+    private:
+
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+        ConstSpan<Byte> mData;
+        UInt            mOffset;
+        Bool            mValid;
+    };
+}
\ No newline at end of file
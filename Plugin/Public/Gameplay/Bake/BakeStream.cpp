@@ -0,0 +1,123 @@
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// Copyright (C) 2025 by Agustin L. Alvarez. All rights reserved.
+//
+// This work is licensed under the terms of the MIT license.
+//
+// For a copy, see <https://opensource.org/licenses/MIT>.
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [  HEADER  ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#include "Gameplay/Bake/BakeStream.hpp"
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [   CODE   ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+namespace Gameplay
+{
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Bool BakeStream::Open(AnyRef<Blob> Data, BakeKind Kind, UInt32 Limit)
+    {
+        Close();
+
+        const ConstSpan<Byte> Bytes = Data.GetSpan();
+        BakeReader            Reader(Bytes);
+
+        if (!Reader.Open(Kind))
+        {
+            return false;
+        }
+
+        std::unique_ptr<Slot[]> Slots = std::make_unique<Slot[]>(Limit);
+
+        for (UInt32 Element = 0, Count = Reader.Read<UInt32>(); Element < Count && Reader.IsValid(); ++Element)
+        {
+            const BakeEntry Entry = Reader.Read<BakeEntry>();
+
+            if (Entry.ID >= Limit || Entry.Offset > Bytes.size() || Entry.Size > Bytes.size() - Entry.Offset)
+            {
+                LOG_WARNING("Ignoring streamed archetype {} that lies outside of the resource.", Entry.ID);
+                continue;
+            }
+
+            Slots[Entry.ID].Offset = Entry.Offset;
+            Slots[Entry.ID].Size   = Entry.Size;
+        }
+
+        if (!Reader.IsValid())
+        {
+            return false;
+        }
+
+        mData     = Move(Data);
+        mSlots    = Move(Slots);
+        mCapacity = Limit;
+        return true;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void BakeStream::Close()
+    {
+        mData     = Blob();
+        mSlots    = nullptr;
+        mCapacity = 0;
+        mResident = 0;
+        mZones.clear();
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void BakeStream::Release(UInt32 Zone)
+    {
+        if (const auto Iterator = mZones.find(Zone); Iterator != mZones.end())
+        {
+            for (const UInt32 ID : Iterator->second)
+            {
+                --mSlots[ID].References;
+            }
+            mZones.erase(Iterator);
+        }
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void BakeStream::Pin(UInt32 ID)
+    {
+        if (ID >= mCapacity)
+        {
+            return;
+        }
+
+        Ref<Slot> Entry = mSlots[ID];
+        ++Entry.References;
+
+        if (!Entry.Resident.exchange(true, std::memory_order_acq_rel))
+        {
+            ++mResident;
+        }
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void BakeStream::Measure(Ref<MemoryUsage> Usage, ConstStr8 Owner) const
+    {
+        const UInt64 Index = mCapacity * sizeof(Slot);
+        Usage.Record(Owner, "StreamIndex", Index, Index);
+        Usage.RecordTable(Owner, "StreamZones", mZones);
+
+        for (const auto & [Zone, Pins] : mZones)
+        {
+            Usage.RecordVector(Owner, "StreamZones", Pins);
+        }
+    }
+}
\ No newline at end of file
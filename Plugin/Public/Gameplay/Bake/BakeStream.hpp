@@ -0,0 +1,243 @@
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// Copyright (C) 2025 by Agustin L. Alvarez. All rights reserved.
+//
+// This work is licensed under the terms of the MIT license.
+//
+// For a copy, see <https://opensource.org/licenses/MIT>.
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#pragma once
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [  HEADER  ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#include "Gameplay/Arsenal/MemoryUsage.hpp"
+#include "Gameplay/Bake/BakeReader.hpp"
+#include "Gameplay/Bake/BakeWriter.hpp"
+#include <Zyphryon.Content/Service.hpp>
+#include <atomic>
+#include <memory>
+#include <mutex>
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [   CODE   ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+namespace Gameplay
+{
+    /// \brief Indexes a baked archetype resource, so each archetype is read the first time it is requested.
+    ///
+    /// Baked archetype resources start with a table locating the body of every archetype. Opening a stream only reads
+    /// that table, and the owning repository faults bodies in on demand. Zones pin the archetypes they use, and the
+    /// archetypes left unpinned are evicted on request, so the resident set follows the zones that are loaded instead
+    /// of the size of the content.
+    ///
+    /// \note Faulting is safe from any thread. Pinning, releasing and evicting must happen at a sync point, and an
+    ///       archetype still referenced by live instances must stay pinned by some zone.
+    class BakeStream final
+    {
+    public:
+
+        /// \brief Opens a stream over a baked archetype resource, reading only its index.
+        ///
+        /// \param Data  The resource to stream from, kept alive while the stream is open.
+        /// \param Kind  The kind of repository the resource is expected to hold.
+        /// \param Limit The number of identifiers the owning repository can hold.
+        /// \return `true` if the index was read, `false` if the resource is invalid and the stream was left closed.
+        Bool Open(AnyRef<Blob> Data, BakeKind Kind, UInt32 Limit);
+
+        /// \brief Closes the stream, forgetting its index and every zone.
+        ///
+        /// \note Archetypes already faulted in are left to the owning repository.
+        void Close();
+
+        /// \brief Checks if the stream is open.
+        ///
+        /// \return `true` if an index is loaded, `false` otherwise.
+        ZYPHRYON_INLINE Bool IsOpen() const
+        {
+            return mSlots != nullptr;
+        }
+
+        /// \brief Checks if an archetype is in the index but has not been faulted in yet.
+        ///
+        /// \param ID The identifier of the archetype.
+        /// \return `true` if the archetype must be faulted in before use, `false` otherwise.
+        ZYPHRYON_INLINE Bool IsPending(UInt32 ID) const
+        {
+            return ID < mCapacity && mSlots[ID].Size > 0 && !mSlots[ID].Resident.load(std::memory_order_acquire);
+        }
+
+        /// \brief Reads the body of an archetype unless another thread already did.
+        ///
+        /// \param ID     The identifier of the archetype, which must be in the index.
+        /// \param Loader The callable constructing the archetype from a reader over its body.
+        template<typename Function>
+        ZYPHRYON_INLINE void Fault(UInt32 ID, AnyRef<Function> Loader)
+        {
+            std::lock_guard Guard(mMutex);
+
+            Ref<Slot> Entry = mSlots[ID];
+
+            if (!Entry.Resident.load(std::memory_order_relaxed))
+            {
+                BakeReader Reader(mData.GetSpan().subspan(Entry.Offset, Entry.Size));
+                Loader(Reader);
+
+                Entry.Resident.store(true, std::memory_order_release);
+                ++mResident;
+            }
+        }
+
+        /// \brief Pins an archetype for a zone, faulting it in if needed.
+        ///
+        /// \param Zone   The zone pinning the archetype.
+        /// \param ID     The identifier of the archetype, ignored if it is not in the index.
+        /// \param Loader The callable constructing the archetype from a reader over its body.
+        template<typename Function>
+        ZYPHRYON_INLINE void Acquire(UInt32 Zone, UInt32 ID, AnyRef<Function> Loader)
+        {
+            if (ID >= mCapacity || mSlots[ID].Size == 0)
+            {
+                return;
+            }
+
+            if (IsPending(ID))
+            {
+                Fault(ID, Loader);
+            }
+
+            ++mSlots[ID].References;
+            mZones[Zone].push_back(ID);
+        }
+
+        /// \brief Drops every pin held by a zone, leaving its archetypes resident until the next eviction.
+        ///
+        /// \param Zone The zone to release.
+        void Release(UInt32 Zone);
+
+        /// \brief Keeps an archetype resident for as long as the stream is open, such as one patched by a commit.
+        ///
+        /// \param ID The identifier of the archetype.
+        void Pin(UInt32 ID);
+
+        /// \brief Unloads every resident archetype that no zone pins.
+        ///
+        /// \param Unloader The callable destroying the archetype with the given identifier.
+        /// \return The number of archetypes unloaded.
+        template<typename Function>
+        ZYPHRYON_INLINE UInt32 Evict(AnyRef<Function> Unloader)
+        {
+            UInt32 Evicted = 0;
+
+            for (UInt32 ID = 0; ID < mCapacity; ++ID)
+            {
+                Ref<Slot> Entry = mSlots[ID];
+
+                if (Entry.References == 0 && Entry.Resident.load(std::memory_order_relaxed))
+                {
+                    Unloader(ID);
+
+                    Entry.Resident.store(false, std::memory_order_release);
+                    --mResident;
+                    ++Evicted;
+                }
+            }
+            return Evicted;
+        }
+
+        /// \brief Retrieves the number of archetypes currently faulted in.
+        ///
+        /// \return The number of resident archetypes.
+        ZYPHRYON_INLINE UInt32 GetResident() const
+        {
+            return mResident;
+        }
+
+        /// \brief Records the memory held by the index and the zones of the stream.
+        ///
+        /// \param Usage The report receiving the usage.
+        /// \param Owner The name of the repository owning the stream.
+        void Measure(Ref<MemoryUsage> Usage, ConstStr8 Owner) const;
+
+    public:
+
+        /// \brief Writes archetypes preceded by the index that lets a stream locate each of them.
+        ///
+        /// \param Writer     The writer to save to, positioned right after the header.
+        /// \param Archetypes The archetypes to write, invalid ones are skipped.
+        template<typename Type>
+        ZYPHRYON_INLINE static void Write(Ref<BakeWriter> Writer, ConstSpan<Type> Archetypes)
+        {
+            const UInt32 Count = std::ranges::count_if(Archetypes, &Type::IsValid);
+            Writer.Write(Count);
+
+            // Reserve the index, it is patched once the offset of every body is known.
+            const UInt Index = Writer.GetSize();
+
+            for (UInt32 Element = 0; Element < Count; ++Element)
+            {
+                Writer.Write(BakeEntry());
+            }
+
+            UInt32 Element = 0;
+
+            for (ConstRef<Type> Archetype : Archetypes)
+            {
+                if (Archetype.IsValid())
+                {
+                    BakeEntry Entry;
+                    Entry.ID     = Archetype.GetHandle().GetID();
+                    Entry.Offset = Writer.GetSize();
+
+                    Archetype.Save(Writer);
+
+                    Entry.Size   = Writer.GetSize() - Entry.Offset;
+                    Writer.Patch(Index + (Element++) * sizeof(BakeEntry), Entry);
+                }
+            }
+        }
+
+        /// \brief Reads the number of archetypes of a resource and skips over its index.
+        ///
+        /// \param Reader The reader to read from, positioned right after the header.
+        /// \return The number of archetype bodies that follow.
+        ZYPHRYON_INLINE static UInt32 Skip(Ref<BakeReader> Reader)
+        {
+            const UInt32 Count = Reader.Read<UInt32>();
+            Reader.Skip(Count * sizeof(BakeEntry));
+            return Count;
+        }
+
+    private:
+
+        /// \brief Represents the location and residency of a single archetype.
+        struct Slot final
+        {
+            /// \brief The offset of the body from the beginning of the resource.
+            UInt32            Offset     = 0;
+
+            /// \brief The size of the body in bytes, `0` if the archetype is not in the index.
+            UInt32            Size       = 0;
+
+            /// \brief The number of pins held on the archetype.
+            UInt32            References = 0;
+
+            /// \brief Whether the archetype has been faulted in.
+            std::atomic<Bool> Resident   = false;
+        };
+
+    private:
+
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+        Blob                          mData;
+        std::unique_ptr<Slot[]>       mSlots;
+        UInt32                        mCapacity = 0;
+        UInt32                        mResident = 0;
+        Table<UInt32, Vector<UInt32>> mZones;
+        std::mutex                    mMutex;
+    };
+}
\ No newline at end of file
@@ -0,0 +1,71 @@
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// Copyright (C) 2025 by Agustin L. Alvarez. All rights reserved.
+//
+// This work is licensed under the terms of the MIT license.
+//
+// For a copy, see <https://opensource.org/licenses/MIT>.
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#pragma once
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [  HEADER  ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#include <Zyphryon.Base/Base.hpp>
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [   CODE   ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+namespace Gameplay
+{
+    /// \brief Defines the kind of repository stored in a baked resource.
+    enum class BakeKind : UInt8
+    {
+        Stat,       ///< A resource holding stat archetypes.
+        Effect,     ///< A resource holding effect archetypes.
+        Ability,    ///< A resource holding ability archetypes.
+        Token,      ///< A resource holding the token hierarchy.
+        Arsenal,    ///< A resource holding a snapshot of the runtime state of an arsenal.
+        Recording,  ///< A resource holding a log of recorded arsenal commands.
+    };
+
+    /// \brief Fixed header written at the beginning of every baked resource.
+    struct BakeHeader final
+    {
+        /// \brief Magic number identifying a baked resource ("GPBK").
+        static constexpr UInt32 kMagic   = 0x4B425047;
+
+        /// \brief Version of the baked format, bumped whenever the layout of any archetype changes.
+        static constexpr UInt16 kVersion = 7;
+
+        /// \brief The magic number of the resource.
+        UInt32   Magic    = kMagic;
+
+        /// \brief The format version of the resource.
+        UInt16   Version  = kVersion;
+
+        /// \brief The kind of repository stored in the resource.
+        BakeKind Kind     = BakeKind::Stat;
+
+        /// \brief Reserved for future use, keeps the header 8 bytes long.
+        UInt8    Reserved = 0;
+    };
+
+    /// \brief Locates the body of an archetype within a baked resource, so it can be read without the others.
+    struct BakeEntry final
+    {
+        /// \brief The identifier of the archetype.
+        UInt16 ID       = 0;
+
+        /// \brief Reserved for future use, keeps the entry aligned.
+        UInt16 Reserved = 0;
+
+        /// \brief The offset of the body from the beginning of the resource.
+        UInt32 Offset   = 0;
+
+        /// \brief The size of the body in bytes.
+        UInt32 Size     = 0;
+    };
+}
\ No newline at end of file
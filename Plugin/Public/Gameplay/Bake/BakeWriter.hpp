@@ -0,0 +1,133 @@
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// Copyright (C) 2025 by Agustin L. Alvarez. All rights reserved.
+//
+// This work is licensed under the terms of the MIT license.
+//
+// For a copy, see <https://opensource.org/licenses/MIT>.
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#pragma once
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [  HEADER  ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#include "Gameplay/Bake/BakeTypes.hpp"
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [   CODE   ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+namespace Gameplay
+{
+    /// \brief Writes values into a baked binary resource.
+    class BakeWriter final
+    {
+    public:
+
+        /// \brief Constructs a writer without a header, used for standalone values.
+        ZYPHRYON_INLINE BakeWriter() = default;
+
+        /// \brief Constructs a writer and emits the header for the given kind of repository.
+        ///
+        /// \param Kind The kind of repository the resource holds.
+        ZYPHRYON_INLINE BakeWriter(BakeKind Kind)
+        {
+            BakeHeader Header;
+            Header.Kind = Kind;
+
+            Write(Header);
+        }
+
+        /// \brief Writes a trivially copyable value.
+        ///
+        /// \param Value The value to write.
+        template<typename Type>
+        ZYPHRYON_INLINE void Write(ConstRef<Type> Value)
+        {
+            static_assert(std::is_trivially_copyable_v<Type>, "Baked values must be trivially copyable.");
+
+            const UInt Offset = mData.size();
+            mData.resize(Offset + sizeof(Type));
+            std::memcpy(mData.data() + Offset, &Value, sizeof(Type));
+        }
+
+        /// \brief Writes a length-prefixed string.
+        ///
+        /// \param Value The string to write.
+        ZYPHRYON_INLINE void WriteString(ConstStr8 Value)
+        {
+            Write(static_cast<UInt32>(Value.size()));
+
+            const UInt Offset = mData.size();
+            mData.resize(Offset + Value.size());
+            std::memcpy(mData.data() + Offset, Value.data(), Value.size());
+        }
+
+        /// \brief Writes raw bytes without a length prefix, such as data baked by another writer.
+        ///
+        /// \param Data The bytes to write.
+        ZYPHRYON_INLINE void WriteBytes(ConstSpan<Byte> Data)
+        {
+            const UInt Offset = mData.size();
+            mData.resize(Offset + Data.size());
+            std::memcpy(mData.data() + Offset, Data.data(), Data.size());
+        }
+
+        /// \brief Overwrites a trivially copyable value written earlier, such as a placeholder.
+        ///
+        /// \param Offset The offset of the value within the written data.
+        /// \param Value  The value to write.
+        template<typename Type>
+        ZYPHRYON_INLINE void Patch(UInt Offset, ConstRef<Type> Value)
+        {
+            static_assert(std::is_trivially_copyable_v<Type>, "Baked values must be trivially copyable.");
+
+            LOG_ASSERT(Offset + sizeof(Type) <= mData.size(), "Cannot patch past the written data.");
+
+            std::memcpy(mData.data() + Offset, &Value, sizeof(Type));
+        }
+
+        /// \brief Retrieves the number of bytes written so far.
+        ///
+        /// \return The size of the written data.
+        ZYPHRYON_INLINE UInt GetSize() const
+        {
+            return mData.size();
+        }
+
+        /// \brief Retrieves the binary data written so far.
+        ///
+        /// \return A span over the written data.
+        ZYPHRYON_INLINE ConstSpan<Byte> GetData() const
+        {
+            return mData;
+        }
+
+    public:
+
+        /// \brief Compares two values by their baked representation.
+        ///
+        /// \param First  The first value to compare.
+        /// \param Second The second value to compare.
+        /// \return `true` if both values bake to the same bytes, `false` otherwise.
+        template<typename Type>
+        ZYPHRYON_INLINE static Bool IsEqual(ConstRef<Type> First, ConstRef<Type> Second)
+        {
+            BakeWriter Left;
+            First.Save(Left);
+
+            BakeWriter Right;
+            Second.Save(Right);
+
+            return std::ranges::equal(Left.GetData(), Right.GetData());
+        }
+
+    private:
+
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+        Vector<Byte> mData;
+    };
+}
\ No newline at end of file
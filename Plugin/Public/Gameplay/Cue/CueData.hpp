@@ -23,8 +23,6 @@ namespace Gameplay
     /// \brief Represents data associated with a gameplay cue event.
     class CueData final
     {
-        // TODO: Extra payload info with payload pool = Awesome!
-
     public:
 
         /// \brief Defines the types of cue events.
@@ -55,6 +53,24 @@ namespace Gameplay
         {
         }
 
+        /// \brief Sets the extra payload of the cue event.
+        ///
+        /// \param Payload The payload bytes, owned by the cue repository's payload pool.
+        ZYPHRYON_INLINE void SetPayload(ConstSpan<Byte> Payload)
+        {
+            mPayload = Payload;
+        }
+
+        /// \brief Retrieves the extra payload of the cue event.
+        ///
+        /// \note The payload is only valid for the duration of the delegate call.
+        ///
+        /// \return The payload bytes, empty if the cue carries no payload.
+        ZYPHRYON_INLINE ConstSpan<Byte> GetPayload() const
+        {
+            return mPayload;
+        }
+
         /// \brief Retrieves the token handle associated with this cue data.
         ///
         /// \return The token handle.
@@ -108,11 +124,12 @@ namespace Gameplay
         // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
         // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 
-        Token  mHandle;
-        Event  mEvent;
-        Real64 mTimestamp;
-        UInt64 mSource;
-        UInt64 mTarget;
-        Real32 mMagnitude;
+        Token           mHandle;
+        Event           mEvent;
+        Real64          mTimestamp;
+        UInt64          mSource;
+        UInt64          mTarget;
+        Real32          mMagnitude;
+        ConstSpan<Byte> mPayload;
     };
 }
\ No newline at end of file
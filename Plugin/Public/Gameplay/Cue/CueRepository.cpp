@@ -10,4 +10,132 @@
 // [  HEADER  ]
 // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 
-#include "Gameplay/Cue/CueRepository.hpp"
\ No newline at end of file
+#include "Gameplay/Cue/CueRepository.hpp"
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [   CODE   ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+namespace Gameplay
+{
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void CueRepository::Flush()
+    {
+        {
+            std::lock_guard Guard(mMutex);
+
+            for (ConstRef<std::unique_ptr<Queue>> Queue : mQueues)
+            {
+                // Hold on to the pool until the next flush, so cues enqueued by delegates can't move it.
+                Queue->mFlushing.swap(Queue->mPayloads);
+                Queue->mPayloads.clear();
+
+                for (Ref<Queue::Entry> Entry : Queue->mEntries)
+                {
+                    Entry.Data.SetPayload(ConstSpan<Byte>(Queue->mFlushing.data() + Entry.Offset, Entry.Size));
+                    mPending.emplace_back(Entry.Data);
+                }
+                Queue->mEntries.clear();
+            }
+        }
+
+        std::ranges::stable_sort(mPending, std::less(), [](ConstRef<CueData> Data)
+        {
+            return Data.GetHandle().GetID();
+        });
+
+        for (UInt32 First = 0, Last; First < mPending.size(); First = Last)
+        {
+            const Token Handle = mPending[First].GetHandle();
+
+            for (Last = First + 1; Last < mPending.size() && mPending[Last].GetHandle() == Handle; ++Last)
+            {
+            }
+
+            // Resolve the delegate once for every cue sharing the same token.
+            const auto Iterator = mDelegates.find(Handle);
+
+            if (Iterator == mDelegates.end())
+            {
+                continue;
+            }
+
+            if (!GetRelevance(Handle).Aggregate)
+            {
+                for (UInt32 Element = First; Element < Last; ++Element)
+                {
+                    Iterator->second(mPending[Element]);
+                }
+                continue;
+            }
+
+            // Collapse the cues sharing event, source and target, keeping the payload of the first one.
+            mMerged.assign(mPending.begin() + First, mPending.begin() + Last);
+
+            std::ranges::stable_sort(mMerged, [](ConstRef<CueData> Left, ConstRef<CueData> Right)
+            {
+                if (Left.GetTarget() != Right.GetTarget())
+                {
+                    return Left.GetTarget() < Right.GetTarget();
+                }
+                if (Left.GetSource() != Right.GetSource())
+                {
+                    return Left.GetSource() < Right.GetSource();
+                }
+                return Left.GetEvent() < Right.GetEvent();
+            });
+
+            for (UInt32 Element = 0, End; Element < mMerged.size(); Element = End)
+            {
+                ConstRef<CueData> Head      = mMerged[Element];
+                Real64            Timestamp = Head.GetTimestamp();
+                Real32            Magnitude = Head.GetMagnitude();
+
+                for (End = Element + 1; End < mMerged.size(); ++End)
+                {
+                    ConstRef<CueData> Next = mMerged[End];
+
+                    if (Next.GetTarget() != Head.GetTarget() || Next.GetSource() != Head.GetSource() || Next.GetEvent() != Head.GetEvent())
+                    {
+                        break;
+                    }
+                    Timestamp  = Max(Timestamp, Next.GetTimestamp());
+                    Magnitude += Next.GetMagnitude();
+                }
+
+                CueData Merged(Handle, Head.GetEvent(), Timestamp, Head.GetSource(), Head.GetTarget(), Magnitude);
+                Merged.SetPayload(Head.GetPayload());
+                Iterator->second(Merged);
+            }
+            mMerged.clear();
+        }
+        mPending.clear();
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void CueRepository::Measure(Ref<MemoryUsage> Usage) const
+    {
+        constexpr ConstStr8 kOwner = "CueRepository";
+
+        Usage.RecordTable(kOwner, "Delegates", mDelegates);
+        Usage.RecordTable(kOwner, "Relevance", mRelevance);
+        Usage.RecordVector(kOwner, "Interest", mInterest);
+        Usage.RecordVector(kOwner, "Queues", mQueues);
+        Usage.RecordVector(kOwner, "Threads", mThreads);
+
+        for (ConstRef<std::unique_ptr<Queue>> Pending : mQueues)
+        {
+            Usage.Record(kOwner, "QueueStorage", sizeof(Queue), sizeof(Queue));
+            Usage.RecordVector(kOwner, "QueueEntries", Pending->mEntries);
+            Usage.RecordVector(kOwner, "QueuePayloads", Pending->mPayloads);
+            Usage.RecordVector(kOwner, "QueuePayloads", Pending->mFlushing);
+        }
+
+        Usage.RecordVector(kOwner, "Pending", mPending);
+        Usage.RecordVector(kOwner, "Merged", mMerged);
+    }
+}
\ No newline at end of file
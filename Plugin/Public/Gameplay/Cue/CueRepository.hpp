@@ -12,7 +12,11 @@
 // [  HEADER  ]
 // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 
+#include "Gameplay/Arsenal/GameplayContext.hpp"
+#include "Gameplay/Arsenal/Trace.hpp"
 #include "Gameplay/Cue/CueData.hpp"
+#include <memory>
+#include <thread>
 
 // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 // [   CODE   ]
@@ -21,6 +25,13 @@
 namespace Gameplay
 {
     /// \brief Manages the subscription and publication of gameplay cues.
+    ///
+    /// Cues are either published immediately, or enqueued into the calling thread's queue and flushed once per
+    /// frame in cue token order. Enqueued payloads are copied into a per-thread pool that is recycled every flush.
+    ///
+    /// Each cue can be given a relevance, and cues are culled before they are queued: those below the priority
+    /// threshold are dropped, and unless critical, so are those whose source and target are both outside the interest
+    /// set of the observers. Aggregated cues are collapsed into one per event, source and target on every flush.
     class CueRepository final
     {
     public:
@@ -28,6 +39,68 @@ namespace Gameplay
         /// \brief Delegate type for executing cue actions.
         using OnExecuteCue = Delegate<void(ConstRef<CueData>), DelegateInlineSize::Small>;
 
+        /// \brief Defines how important a cue is to the observers.
+        enum class Priority : UInt8
+        {
+            Low,        ///< Cosmetic cues, the first to be dropped under load.
+            Normal,     ///< Regular cues, delivered while relevant to an observer.
+            High,       ///< Important cues, kept under load while relevant to an observer.
+            Critical,   ///< Cues that are always delivered, regardless of the interest set.
+        };
+
+        /// \brief Describes how a cue is culled and merged before dispatch.
+        struct Relevance final
+        {
+            /// \brief The importance of the cue.
+            Priority Level     = Priority::Normal;
+
+            /// \brief Whether the cues of a flush sharing event, source and target are collapsed into one.
+            Bool     Aggregate = false;
+        };
+
+        /// \brief Buffers the cues enqueued by a single thread until the next flush.
+        class Queue final
+        {
+            friend class CueRepository;
+
+        public:
+
+            /// \brief Records a cue event to be published on the next flush.
+            ///
+            /// \param Data    The cue data to publish.
+            /// \param Payload The extra payload bytes to copy into the pool.
+            ZYPHRYON_INLINE void Enqueue(ConstRef<CueData> Data, ConstSpan<Byte> Payload)
+            {
+                const UInt32 Offset = mPayloads.size();
+                mPayloads.insert(mPayloads.end(), Payload.begin(), Payload.end());
+                mEntries.emplace_back(Data, Offset, static_cast<UInt32>(Payload.size()));
+            }
+
+        private:
+
+            /// \brief Represents a cue event along with the location of its payload in the pool.
+            struct Entry final
+            {
+                /// \brief The cue data to publish.
+                CueData Data;
+
+                /// \brief The offset of the payload within the pool.
+                UInt32  Offset;
+
+                /// \brief The size of the payload in bytes.
+                UInt32  Size;
+            };
+
+        private:
+
+            // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+            // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+            Vector<Entry> mEntries;
+            Vector<Byte>  mPayloads;
+            Vector<Byte>  mFlushing;
+        };
+
     public:
 
         /// \brief Subscribes a delegate to a specific cue token.
@@ -36,6 +109,8 @@ namespace Gameplay
         /// \param Delegate The delegate to invoke when the cue is published.
         ZYPHRYON_INLINE void Subscribe(Token Cue, AnyRef<OnExecuteCue> Delegate)
         {
+            LOG_ASSERT(!mFrozen, "Cannot modify the cue repository while it is frozen.");
+
             mDelegates[Cue] = Move(Delegate);
         }
 
@@ -44,32 +119,221 @@ namespace Gameplay
         /// \param Data The cue data to publish.
         ZYPHRYON_INLINE void Publish(ConstRef<CueData> Data)
         {
+            GAMEPLAY_TRACE_ZONE("CueRepository::Publish");
+
+            if (!IsRelevant(Data))
+            {
+                Trace::Increment(TraceCounter::Culled);
+                return;
+            }
+
             if (const auto Iterator = mDelegates.find(Data.GetHandle()); Iterator != mDelegates.end())
             {
+                Trace::Increment(TraceCounter::Cues);
                 Iterator->second(Data);
             }
         }
 
+        /// \brief Enqueues a cue event into the calling thread's queue, to be published on the next flush.
+        ///
+        /// \param Data    The cue data to publish.
+        /// \param Payload The extra payload bytes to copy into the pool (default is no payload).
+        ZYPHRYON_INLINE void Enqueue(ConstRef<CueData> Data, ConstSpan<Byte> Payload = ConstSpan<Byte>())
+        {
+            if (!IsRelevant(Data))
+            {
+                Trace::Increment(TraceCounter::Culled);
+                return;
+            }
+            GetQueue().Enqueue(Data, Payload);
+        }
+
+        /// \brief Publishes every enqueued cue event sorted by cue token, then recycles the payload pools.
+        ///
+        /// \note Must be called once per frame, at a sync point where no other thread is enqueuing. Cues with the
+        ///       same token are delivered in queue order. Aggregated cues are delivered once per event, source and
+        ///       target, with the sum of their magnitudes, the latest timestamp and the payload of the first.
+        void Flush();
+
+        /// \brief Sets the relevance of a cue token.
+        ///
+        /// \param Cue   The cue token to configure.
+        /// \param Value The relevance to assign.
+        ZYPHRYON_INLINE void SetRelevance(Token Cue, Relevance Value)
+        {
+            LOG_ASSERT(!mFrozen, "Cannot modify the cue repository while it is frozen.");
+
+            mRelevance[Cue] = Value;
+        }
+
+        /// \brief Retrieves the relevance of a cue token.
+        ///
+        /// \param Cue The cue token to retrieve the relevance of.
+        /// \return The relevance of the cue, or the default relevance if none was set.
+        ZYPHRYON_INLINE Relevance GetRelevance(Token Cue) const
+        {
+            if (!mRelevance.empty())
+            {
+                if (const auto Iterator = mRelevance.find(Cue); Iterator != mRelevance.end())
+                {
+                    return Iterator->second;
+                }
+            }
+            return Relevance();
+        }
+
+        /// \brief Sets the lowest priority a cue needs to be delivered, raised to shed cosmetic cues under load.
+        ///
+        /// \note Must be called at a sync point, where no other thread is enqueuing.
+        ///
+        /// \param Threshold The lowest priority to deliver.
+        ZYPHRYON_INLINE void SetThreshold(Priority Threshold)
+        {
+            mThreshold = Threshold;
+        }
+
+        /// \brief Retrieves the lowest priority a cue needs to be delivered.
+        ///
+        /// \return The priority threshold.
+        ZYPHRYON_INLINE Priority GetThreshold() const
+        {
+            return mThreshold;
+        }
+
+        /// \brief Sets the entities perceived by any observer, enabling interest culling.
+        ///
+        /// \note Must be called at a sync point, where no other thread is enqueuing. The interest set is a single list
+        ///       shared by every observer, the union of what each of them perceives, so cues reaching at least one
+        ///       observer are kept for all of them. Per-observer filtering is left to the delegates.
+        ///
+        /// \param Entities The identifiers of the entities any observer can perceive.
+        ZYPHRYON_INLINE void SetInterest(ConstSpan<UInt64> Entities)
+        {
+            mInterest.assign(Entities.begin(), Entities.end());
+            std::ranges::sort(mInterest);
+            mCulling = true;
+        }
+
+        /// \brief Clears the interest set, disabling interest culling.
+        ///
+        /// \note Must be called at a sync point, where no other thread is enqueuing.
+        ZYPHRYON_INLINE void ClearInterest()
+        {
+            mInterest.clear();
+            mCulling = false;
+        }
+
+        /// \brief Checks whether a cue is relevant enough to be delivered.
+        ///
+        /// \param Data The cue data to check.
+        /// \return `true` if the cue survives culling, `false` otherwise.
+        ZYPHRYON_INLINE Bool IsRelevant(ConstRef<CueData> Data) const
+        {
+            const Priority Level = GetRelevance(Data.GetHandle()).Level;
+
+            if (Level < mThreshold)
+            {
+                return false;
+            }
+
+            if (Level == Priority::Critical || !mCulling)
+            {
+                return true;
+            }
+            return std::ranges::binary_search(mInterest, Data.GetTarget()) || std::ranges::binary_search(mInterest, Data.GetSource());
+        }
+
         /// \brief Unsubscribes the delegate associated with a specific cue token.
         ///
         /// \param Cue The cue token to unsubscribe from.
         ZYPHRYON_INLINE void Unsubscribe(Token Cue)
         {
+            LOG_ASSERT(!mFrozen, "Cannot modify the cue repository while it is frozen.");
+
             if (const auto Iterator = mDelegates.find(Cue); Iterator != mDelegates.end())
             {
                 mDelegates.erase(Iterator);
             }
         }
 
+        /// \brief Freezes the repository, so it can be read from any thread without synchronization.
+        ///
+        /// \note While frozen, delegates cannot be subscribed or unsubscribed until thawed, which must happen between
+        ///       ticks, when no other thread is publishing.
+        ZYPHRYON_INLINE void Freeze()
+        {
+            mFrozen = true;
+        }
+
+        /// \brief Thaws the repository, allowing it to be modified again.
+        ZYPHRYON_INLINE void Thaw()
+        {
+            mFrozen = false;
+        }
+
+        /// \brief Checks if the repository is frozen.
+        ///
+        /// \return `true` if the repository is read-only, `false` otherwise.
+        ZYPHRYON_INLINE Bool IsFrozen() const
+        {
+            return mFrozen;
+        }
+
     public:
 
-        /// \brief Retrieves the singleton instance of the repository.
+        /// \brief Retrieves the repository of the context current on the calling thread.
         ///
-        /// \return The singleton instance of the repository.
+        /// \return A reference to the repository of the current context.
         ZYPHRYON_INLINE static Ref<CueRepository> Instance()
         {
-            static CueRepository Singleton;
-            return Singleton;
+            return GameplayContext::Current().GetCues();
+        }
+
+        /// \brief Retrieves the read-only view of the repository, safe to share between threads once frozen.
+        ///
+        /// \return A constant reference to the singleton repository instance.
+        ZYPHRYON_INLINE static ConstRef<CueRepository> View()
+        {
+            return Instance();
+        }
+
+        /// \brief Records the memory held by the repository.
+        ///
+        /// \note Must be called at a sync point, where no other thread is enqueuing.
+        ///
+        /// \param Usage The report receiving the usage.
+        void Measure(Ref<MemoryUsage> Usage) const;
+
+    private:
+
+        /// \brief Retrieves the queue owned by the calling thread, registering it on first use.
+        ///
+        /// \return A reference to the calling thread's queue.
+        ZYPHRYON_INLINE Ref<Queue> GetQueue()
+        {
+            // Cache the queue of the last owner used on this thread, keyed by serial so contexts never share queues.
+            static thread_local UInt64     Owner   = 0;
+            static thread_local Ptr<Queue> Current = nullptr;
+
+            if (Owner != mSerial)
+            {
+                std::lock_guard Guard(mMutex);
+
+                const std::thread::id Thread   = std::this_thread::get_id();
+                const auto            Iterator = std::ranges::find(mThreads, Thread);
+
+                if (Iterator != mThreads.end())
+                {
+                    Current = mQueues[std::distance(mThreads.begin(), Iterator)].get();
+                }
+                else
+                {
+                    Current = mQueues.emplace_back(std::make_unique<Queue>()).get();
+                    mThreads.push_back(Thread);
+                }
+                Owner = mSerial;
+            }
+            return * Current;
         }
 
     private:
@@ -77,6 +341,17 @@ namespace Gameplay
         // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
         // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 
-        Table<Token, OnExecuteCue> mDelegates;
+        Table<Token, OnExecuteCue>     mDelegates;
+        Table<Token, Relevance>        mRelevance;
+        Vector<UInt64>                 mInterest;
+        Vector<std::unique_ptr<Queue>> mQueues;
+        Vector<std::thread::id>        mThreads;
+        Vector<CueData>                mPending;
+        Vector<CueData>                mMerged;
+        std::mutex                     mMutex;
+        Priority                       mThreshold = Priority::Low;
+        Bool                           mCulling = false;
+        Bool                           mFrozen = false;
+        UInt64                         mSerial = GameplayContext::Serial();
     };
 }
\ No newline at end of file
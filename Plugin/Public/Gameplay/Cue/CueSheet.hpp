@@ -12,6 +12,8 @@
 // [  HEADER  ]
 // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 
+#include "Gameplay/Bake/BakeReader.hpp"
+#include "Gameplay/Bake/BakeWriter.hpp"
 #include "Gameplay/Token/Token.hpp"
 
 // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
@@ -99,6 +101,30 @@ namespace Gameplay
             }
         }
 
+        /// \brief Loads the cue sheet from a baked resource.
+        ///
+        /// \param Reader The baked resource to load from.
+        ZYPHRYON_INLINE void Load(Ref<BakeReader> Reader)
+        {
+            for (UInt8 Index = 0, Count = Reader.Read<UInt8>(); Index < Count; ++Index)
+            {
+                mCues.emplace_back(Token(Reader.Read<UInt32>()));
+            }
+        }
+
+        /// \brief Saves the cue sheet to a baked resource.
+        ///
+        /// \param Writer The baked resource to save to.
+        ZYPHRYON_INLINE void Save(Ref<BakeWriter> Writer) const
+        {
+            Writer.Write(static_cast<UInt8>(mCues.size()));
+
+            for (const Token Child : mCues)
+            {
+                Writer.Write(Child.GetID());
+            }
+        }
+
     private:
 
         // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
@@ -27,9 +27,13 @@ namespace Gameplay
         mHandle   = Section.GetInteger("ID");
         mPolicies.Load(Section.GetSection("Policies"));
         mCategory.Load(Section.GetArray("Category"));
+        mBlocked.Load(Section.GetArray("Blocked"));
+        mAllowed.Load(Section.GetArray("Allowed"));
+        mRequired.Load(Section.GetArray("Required"));
         mDuration.Load(Section.GetArray("Duration"));
         mPeriod.Load(Section.GetArray("Period"));
-        mLimit = Section.GetInteger("Limit");
+        mLimit     = Section.GetInteger("Limit");
+        mAlignment = Max(static_cast<Real32>(Section.GetReal("Alignment")), 0.0f);
 
         mCues.Load(Section.GetArray("Cues"));
 
@@ -42,6 +46,8 @@ namespace Gameplay
                 mBonuses[Element].Load(Bonuses.GetArray(Element));
             }
         }
+
+        Compile();
     }
 
     // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
@@ -53,10 +59,18 @@ namespace Gameplay
         Section.SetInteger("ID", mHandle.GetID());
         mPolicies.Save(Section.SetSection("Policies"));
         mCategory.Save(Section.SetArray("Category"));
+        mBlocked.Save(Section.SetArray("Blocked"));
+        mAllowed.Save(Section.SetArray("Allowed"));
+        mRequired.Save(Section.SetArray("Required"));
         mDuration.Save(Section.SetArray("Length"));
         mPeriod.Save(Section.SetArray("Period"));
         Section.SetInteger("Limit", mLimit);
 
+        if (mAlignment > 0.0f)
+        {
+            Section.SetReal("Alignment", mAlignment);
+        }
+
         mCues.Save(Section.SetArray("Cues"));
 
         for (TOMLArray Bonuses = Section.SetArray("Bonuses"); ConstRef<EffectModifier> Modifier: mBonuses)
@@ -64,4 +78,70 @@ namespace Gameplay
             Modifier.Save(Bonuses.AddArray());
         }
     }
-}
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void EffectArchetype::Load(Ref<BakeReader> Reader)
+    {
+        mHandle   = Reader.Read<UInt16>();
+        mName     = Reader.ReadString();
+        mPolicies.Load(Reader);
+        mCategory.Load(Reader);
+        mBlocked.Load(Reader);
+        mAllowed.Load(Reader);
+        mRequired.Load(Reader);
+        mDuration.Load(Reader);
+        mPeriod.Load(Reader);
+        mLimit     = Reader.Read<UInt16>();
+        mAlignment = Reader.Read<Real32>();
+
+        mCues.Load(Reader);
+
+        mBonuses.resize(Min<UInt32>(Reader.Read<UInt8>(), kMaxBonuses));
+
+        for (Ref<EffectModifier> Modifier : mBonuses)
+        {
+            Modifier.Load(Reader);
+        }
+
+        Compile();
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void EffectArchetype::Save(Ref<BakeWriter> Writer) const
+    {
+        Writer.Write(mHandle.GetID());
+        Writer.WriteString(mName);
+        mPolicies.Save(Writer);
+        mCategory.Save(Writer);
+        mBlocked.Save(Writer);
+        mAllowed.Save(Writer);
+        mRequired.Save(Writer);
+        mDuration.Save(Writer);
+        mPeriod.Save(Writer);
+        Writer.Write(mLimit);
+        Writer.Write(mAlignment);
+
+        mCues.Save(Writer);
+
+        Writer.Write(static_cast<UInt8>(mBonuses.size()));
+
+        for (ConstRef<EffectModifier> Modifier : mBonuses)
+        {
+            Modifier.Save(Writer);
+        }
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void EffectArchetype::Compile()
+    {
+        mBlockedQuery.Compile(mBlocked, TokenQuery::Match::None);
+        mAllowedQuery.Compile(mAllowed, TokenQuery::Match::Any);
+        mRequiredQuery.Compile(mRequired, TokenQuery::Match::All);
+    }
+}
\ No newline at end of file
@@ -17,6 +17,11 @@
 #include "Gameplay/Effect/EffectModifier.hpp"
 #include "Gameplay/Effect/EffectTypes.hpp"
 #include "Gameplay/Token/TokenFamily.hpp"
+#include "Gameplay/Token/TokenQuery.hpp"
+
+#ifndef GAMEPLAY_MAX_EFFECT_BONUSES
+    #define GAMEPLAY_MAX_EFFECT_BONUSES 6
+#endif
 
 // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 // [   CODE   ]
@@ -25,21 +30,28 @@
 namespace Gameplay
 {
     /// \brief Defines the archetype of an effect, including its properties and behavior policies.
+    ///
+    /// The markers restricting which targets can receive the effect are compiled into token queries when the
+    /// archetype is loaded or changed, so checking a target only reads a few words of its presence bitset.
+    ///
+    /// The fields read when effects are applied or ticked are packed at the front, so they share the leading cache
+    /// lines, while the name and the source markers only read when editing or saving are kept at the tail.
     class EffectArchetype final
     {
     public:
 
         /// \brief Maximum number of stat modifiers an effect can have.
-        static constexpr UInt32 kMaxBonuses = 6;    // TODO: Macro Configurable
+        static constexpr UInt32 kMaxBonuses = GAMEPLAY_MAX_EFFECT_BONUSES;
 
     public:
 
         /// \brief Default constructor, initializes members to default values.
         ZYPHRYON_INLINE EffectArchetype()
-            : mHandle   { 0 },
-              mDuration { 0.0f },
-              mPeriod   { 0.0f },
-              mLimit    { 0 }
+            : mHandle    { 0 },
+              mLimit     { 0 },
+              mAlignment { 0.0f },
+              mDuration  { 0.0f },
+              mPeriod    { 0.0f }
         {
         }
 
@@ -51,6 +63,14 @@ namespace Gameplay
             Load(Section);
         }
 
+        /// \brief Constructs an effect archetype by loading data from a baked resource.
+        ///
+        /// \param Reader The baked resource to load from.
+        ZYPHRYON_INLINE EffectArchetype(Ref<BakeReader> Reader)
+        {
+            Load(Reader);
+        }
+
         /// \brief Destruct an effect archetype.
         ZYPHRYON_INLINE ~EffectArchetype()
         {
@@ -97,6 +117,68 @@ namespace Gameplay
             return mCategory;
         }
 
+        /// \brief Sets the markers that make a target immune to the effect when any of them is present.
+        ///
+        /// \param Markers The blocked markers to assign.
+        ZYPHRYON_INLINE void SetBlocked(AnyRef<TokenFamily> Markers)
+        {
+            mBlocked = Markers;
+            mBlockedQuery.Compile(mBlocked, TokenQuery::Match::None);
+        }
+
+        /// \brief Retrieves the markers that make a target immune to the effect.
+        ///
+        /// \return The blocked markers.
+        ZYPHRYON_INLINE ConstRef<TokenFamily> GetBlocked() const
+        {
+            return mBlocked;
+        }
+
+        /// \brief Sets the markers of which a target needs at least one to receive the effect, if any is given.
+        ///
+        /// \param Markers The allowed markers to assign.
+        ZYPHRYON_INLINE void SetAllowed(AnyRef<TokenFamily> Markers)
+        {
+            mAllowed = Markers;
+            mAllowedQuery.Compile(mAllowed, TokenQuery::Match::Any);
+        }
+
+        /// \brief Retrieves the markers of which a target needs at least one to receive the effect.
+        ///
+        /// \return The allowed markers.
+        ZYPHRYON_INLINE ConstRef<TokenFamily> GetAllowed() const
+        {
+            return mAllowed;
+        }
+
+        /// \brief Sets the markers a target needs all of to receive the effect.
+        ///
+        /// \param Markers The required markers to assign.
+        ZYPHRYON_INLINE void SetRequired(AnyRef<TokenFamily> Markers)
+        {
+            mRequired = Markers;
+            mRequiredQuery.Compile(mRequired, TokenQuery::Match::All);
+        }
+
+        /// \brief Retrieves the markers a target needs all of to receive the effect.
+        ///
+        /// \return The required markers.
+        ZYPHRYON_INLINE ConstRef<TokenFamily> GetRequired() const
+        {
+            return mRequired;
+        }
+
+        /// \brief Checks if a target satisfies the blocked, allowed and required markers of the effect.
+        ///
+        /// \param Tokens The tokens of the target.
+        /// \return `true` if the target can receive the effect, `false` if it is immune.
+        ZYPHRYON_INLINE Bool Admits(ConstRef<TokenSet> Tokens) const
+        {
+            return mBlockedQuery.HasNone(Tokens)
+                && mRequiredQuery.HasAll(Tokens)
+                && (mAllowedQuery.IsEmpty() || mAllowedQuery.HasAny(Tokens));
+        }
+
         /// \brief Sets the name of the effect archetype.
         ///
         /// \param Name The name to assign.
@@ -145,6 +227,25 @@ namespace Gameplay
             return mPeriod;
         }
 
+        /// \brief Sets the phase grid that the ticks of the effect are aligned to.
+        ///
+        /// \note Aligned effects tick on the boundaries of a global grid instead of relative to their application, so
+        ///       the same effect applied to many targets a few milliseconds apart is processed in a single poll.
+        ///
+        /// \param Alignment The grid step in seconds, or `0` to tick relative to the application time.
+        ZYPHRYON_INLINE void SetAlignment(Real32 Alignment)
+        {
+            mAlignment = Max(Alignment, 0.0f);
+        }
+
+        /// \brief Retrieves the phase grid that the ticks of the effect are aligned to.
+        ///
+        /// \return The grid step in seconds, or `0` if ticks are not aligned.
+        ZYPHRYON_INLINE Real32 GetAlignment() const
+        {
+            return mAlignment;
+        }
+
         /// \brief Sets the maximum number of stacks for the effect.
         ///
         /// \param Limit The stack limit to assign.
@@ -320,6 +421,21 @@ namespace Gameplay
         /// \param Section The TOML section to save to.
         void Save(TOMLSection Section) const;
 
+        /// \brief Loads the effect archetype data from a baked resource.
+        ///
+        /// \param Reader The baked resource to load from.
+        void Load(Ref<BakeReader> Reader);
+
+        /// \brief Saves the effect archetype data to a baked resource.
+        ///
+        /// \param Writer The baked resource to save to.
+        void Save(Ref<BakeWriter> Writer) const;
+
+        /// \brief Compiles the markers into token queries against the current token hierarchy.
+        ///
+        /// \note Loading already compiles them, this is only needed after the token hierarchy is rebuilt.
+        void Compile();
+
         /// \brief Generates a hash value for the effect archetype based on its handle.
         ///
         /// \return A hash value uniquely representing the effect archetype.
@@ -335,14 +451,21 @@ namespace Gameplay
 
         Effect                              mHandle;
         EffectPolicy                        mPolicies;
-        TokenFamily                         mCategory;
-        Str8                                mName;
+        UInt16                              mLimit;
+        Real32                              mAlignment;
         StatInput                           mDuration;
         StatInput                           mPeriod;
-        UInt16                              mLimit;
-        CueSheet                            mCues;
         Vector<EffectModifier, kMaxBonuses> mBonuses;
+        TokenFamily                         mCategory;
+        CueSheet                            mCues;
+        TokenQuery                          mBlockedQuery;
+        TokenQuery                          mAllowedQuery;
+        TokenQuery                          mRequiredQuery;
+        TokenFamily                         mBlocked;
+        TokenFamily                         mAllowed;
+        TokenFamily                         mRequired;
+        Str8                                mName;
 
-        // TODO: Conditions (Has, Not, All, Any => Apply on Stat&Tags) BlockedMarkers, AllowedMarkers, RequiredMarkers
+        // TODO: Conditions (Has, Not, All, Any => Apply on Stat)
     };
 }
\ No newline at end of file
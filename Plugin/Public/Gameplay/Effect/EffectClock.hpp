@@ -0,0 +1,148 @@
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// Copyright (C) 2025 by Agustin L. Alvarez. All rights reserved.
+//
+// This work is licensed under the terms of the MIT license.
+//
+// For a copy, see <https://opensource.org/licenses/MIT>.
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#pragma once
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [  HEADER  ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#include <Zyphryon.Base/Base.hpp>
+#include <cmath>
+
+#ifndef GAMEPLAY_EFFECT_TICK_RATE
+    #define GAMEPLAY_EFFECT_TICK_RATE 0
+#endif
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [   CODE   ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+namespace Gameplay
+{
+    /// \brief Resolves the timestamps used by effect instances, optionally on a fixed simulation step.
+    ///
+    /// With a tick rate of zero timestamps are continuous and pass through untouched. Otherwise every expiration
+    /// and interval is computed from a whole number of ticks, so effects due on the same tick share the same key
+    /// and are processed in the same poll, and the same inputs always yield the same bits on every machine.
+    class EffectClock final
+    {
+    public:
+
+        /// \brief Number of simulation ticks per second, or `0` for continuous timestamps.
+        static constexpr UInt32 kRate       = GAMEPLAY_EFFECT_TICK_RATE;
+
+        /// \brief Whether timestamps are quantized to the simulation step.
+        static constexpr Bool   kFixed      = (kRate > 0);
+
+        /// \brief Number of ticks per second used by the conversions, whole seconds when timestamps are continuous.
+        static constexpr UInt32 kResolution = (kFixed ? kRate : 1);
+
+    public:
+
+        /// \brief Converts a timestamp into the nearest simulation tick.
+        ///
+        /// \param Timestamp The timestamp in seconds.
+        /// \return The tick closest to the timestamp.
+        ZYPHRYON_INLINE static UInt64 ToTick(Real64 Timestamp)
+        {
+            return static_cast<UInt64>(std::floor(Timestamp * kResolution + 0.5));
+        }
+
+        /// \brief Converts a simulation tick into its timestamp.
+        ///
+        /// \param Tick The simulation tick.
+        /// \return The timestamp in seconds at which the tick starts.
+        ZYPHRYON_INLINE static Real64 ToTimestamp(UInt64 Tick)
+        {
+            return static_cast<Real64>(Tick) / kResolution;
+        }
+
+        /// \brief Snaps a timestamp to the nearest simulation tick.
+        ///
+        /// \param Timestamp The timestamp in seconds.
+        /// \return The snapped timestamp, or the timestamp itself when timestamps are continuous.
+        ZYPHRYON_INLINE static Real64 Quantize(Real64 Timestamp)
+        {
+            if constexpr (kFixed)
+            {
+                return std::isfinite(Timestamp) ? ToTimestamp(ToTick(Timestamp)) : Timestamp;
+            }
+            else
+            {
+                return Timestamp;
+            }
+        }
+
+        /// \brief Computes the timestamp reached after a span of time, such as a duration or a period.
+        ///
+        /// \note On a fixed step the span is rounded to the nearest whole number of ticks, at least one for periods,
+        ///       so a periodic effect never becomes due twice on the same tick.
+        ///
+        /// \param Timestamp The timestamp to advance from.
+        /// \param Span      The span of time in seconds, infinite spans never elapse.
+        /// \param Periodic  Whether the span is a period, which must last at least one tick.
+        /// \return The timestamp at the end of the span.
+        ZYPHRYON_INLINE static Real64 Advance(Real64 Timestamp, Real32 Span, Bool Periodic = false)
+        {
+            if constexpr (kFixed)
+            {
+                if (!std::isfinite(Span))
+                {
+                    return Span;
+                }
+
+                const UInt64 Ticks = static_cast<UInt64>(std::floor(Max(static_cast<Real64>(Span), 0.0) * kResolution + 0.5));
+                return ToTimestamp(ToTick(Timestamp) + (Periodic ? Max<UInt64>(Ticks, 1) : Ticks));
+            }
+            else
+            {
+                return Timestamp + Span;
+            }
+        }
+
+        /// \brief Delays a timestamp to the next boundary of a global phase grid.
+        ///
+        /// \note Boundaries are multiples of the grid step counted from time zero, so periodic effects aligned to the
+        ///       same grid become due on the same poll no matter when each one was applied. On a fixed step the grid
+        ///       is rounded to a whole number of ticks, at least one.
+        ///
+        /// \param Timestamp The timestamp to align.
+        /// \param Grid      The grid step in seconds, or `0` to leave the timestamp untouched.
+        /// \return The first boundary at or after the timestamp.
+        ZYPHRYON_INLINE static Real64 Align(Real64 Timestamp, Real32 Grid)
+        {
+            if (Grid <= 0.0f || !std::isfinite(Timestamp))
+            {
+                return Timestamp;
+            }
+
+            if constexpr (kFixed)
+            {
+                const UInt64 Step = Max<UInt64>(static_cast<UInt64>(std::floor(static_cast<Real64>(Grid) * kResolution + 0.5)), 1);
+                const UInt64 Tick = ToTick(Timestamp);
+                return ToTimestamp((Tick + Step - 1) / Step * Step);
+            }
+            else
+            {
+                return std::ceil(Timestamp / Grid) * Grid;
+            }
+        }
+
+        /// \brief Computes the timestamp of the next tick of a periodic effect.
+        ///
+        /// \param Timestamp The timestamp to advance from.
+        /// \param Period    The period of the effect in seconds.
+        /// \param Grid      The phase grid the tick is aligned to, or `0` to tick relative to the timestamp.
+        /// \return The timestamp of the next tick.
+        ZYPHRYON_INLINE static Real64 Schedule(Real64 Timestamp, Real32 Period, Real32 Grid)
+        {
+            return Align(Advance(Timestamp, Period, true), Grid);
+        }
+    };
+}
\ No newline at end of file
@@ -0,0 +1,142 @@
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// Copyright (C) 2025 by Agustin L. Alvarez. All rights reserved.
+//
+// This work is licensed under the terms of the MIT license.
+//
+// For a copy, see <https://opensource.org/licenses/MIT>.
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#pragma once
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [  HEADER  ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#include "Gameplay/Effect/Effect.hpp"
+#include <bit>
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [   CODE   ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+namespace Gameplay
+{
+    /// \brief An open-addressed map from effect archetype handles to the active instance of that archetype.
+    ///
+    /// Uses linear probing with backward-shift deletion, so lookups never have to skip over tombstones.
+    ///
+    /// \tparam Capacity The maximum number of entries the index must hold.
+    template<UInt32 Capacity>
+    class EffectIndex final
+    {
+    public:
+
+        /// \brief Number of slots in the table, at least twice the capacity to keep probe sequences short.
+        static constexpr UInt32 kSlots = std::bit_ceil(Capacity * 2);
+
+    public:
+
+        /// \brief Inserts or replaces the instance associated with an archetype.
+        ///
+        /// \param Key   The handle of the effect archetype.
+        /// \param Value The handle of the effect instance.
+        ZYPHRYON_INLINE void Insert(Effect Key, Effect Value)
+        {
+            LOG_ASSERT(Key.IsValid(), "Attempted to index an invalid effect archetype.");
+
+            UInt32 Slot = GetHome(Key);
+
+            while (mSlots[Slot].Key.IsValid() && mSlots[Slot].Key != Key)
+            {
+                Slot = (Slot + 1) & (kSlots - 1);
+            }
+            mSlots[Slot] = { Key, Value };
+        }
+
+        /// \brief Finds the instance associated with an archetype.
+        ///
+        /// \param Key The handle of the effect archetype.
+        /// \return The handle of the effect instance, or an invalid handle if not found.
+        ZYPHRYON_INLINE Effect Find(Effect Key) const
+        {
+            for (UInt32 Slot = GetHome(Key); mSlots[Slot].Key.IsValid(); Slot = (Slot + 1) & (kSlots - 1))
+            {
+                if (mSlots[Slot].Key == Key)
+                {
+                    return mSlots[Slot].Value;
+                }
+            }
+            return Effect();
+        }
+
+        /// \brief Removes the entry of an archetype if it maps to the given instance.
+        ///
+        /// \param Key   The handle of the effect archetype.
+        /// \param Value The handle of the effect instance expected to be mapped.
+        ZYPHRYON_INLINE void Remove(Effect Key, Effect Value)
+        {
+            UInt32 Hole = GetHome(Key);
+
+            while (mSlots[Hole].Key != Key)
+            {
+                if (!mSlots[Hole].Key.IsValid())
+                {
+                    return;
+                }
+                Hole = (Hole + 1) & (kSlots - 1);
+            }
+
+            if (mSlots[Hole].Value != Value)
+            {
+                return;
+            }
+
+            // Shift back every following entry that would otherwise become unreachable.
+            for (UInt32 Slot = (Hole + 1) & (kSlots - 1); mSlots[Slot].Key.IsValid(); Slot = (Slot + 1) & (kSlots - 1))
+            {
+                const UInt32 Home = GetHome(mSlots[Slot].Key);
+
+                if (((Slot - Home) & (kSlots - 1)) >= ((Slot - Hole) & (kSlots - 1)))
+                {
+                    mSlots[Hole] = mSlots[Slot];
+                    Hole = Slot;
+                }
+            }
+            mSlots[Hole] = Entry();
+        }
+
+        /// \brief Removes all entries from the index.
+        ZYPHRYON_INLINE void Clear()
+        {
+            mSlots.fill(Entry());
+        }
+
+    private:
+
+        /// \brief Represents a single slot of the index.
+        struct Entry final
+        {
+            /// \brief The handle of the effect archetype, invalid if the slot is empty.
+            Effect Key;
+
+            /// \brief The handle of the active effect instance.
+            Effect Value;
+        };
+
+        /// \brief Computes the preferred slot of an archetype handle.
+        ///
+        /// \param Key The handle of the effect archetype.
+        /// \return The index of the preferred slot.
+        ZYPHRYON_INLINE static UInt32 GetHome(Effect Key)
+        {
+            return (static_cast<UInt32>(Key.GetID()) * 0x9E3779B1u) >> (32 - std::countr_zero(kSlots));
+        }
+
+    private:
+
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+        Array<Entry, kSlots> mSlots;
+    };
+}
\ No newline at end of file
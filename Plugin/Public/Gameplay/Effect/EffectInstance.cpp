@@ -11,6 +11,8 @@
 // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 
 #include "Gameplay/Effect/EffectInstance.hpp"
+#include "Gameplay/Effect/EffectClock.hpp"
+#include "Gameplay/Effect/EffectRepository.hpp"
 
 // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 // [   CODE   ]
@@ -21,62 +23,163 @@ namespace Gameplay
     // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
     // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 
-    void EffectInstance::Merge(ConstRef<EffectInstance> Other)
+    void EffectInstance::Merge(Real64 Expiration, UInt16 Stack, Real32 Intensity)
+    {
+        using Handler = void (EffectInstance::*)(Real64, UInt16, Real32);
+
+        // One instantiation per refresh and resolution pair, so merging takes a single indirect call instead of
+        // branching on both policies of the archetype.
+        static constexpr auto kHandlers = []<UInt32... Index>(std::integer_sequence<UInt32, Index...>)
+        {
+            return Array<Handler, sizeof...(Index)>
+            {
+                & EffectInstance::MergeWith<static_cast<EffectRefresh>(Index / EffectPolicy::kResolutions),
+                                            static_cast<EffectResolution>(Index % EffectPolicy::kResolutions)>...
+            };
+        }(std::make_integer_sequence<UInt32, EffectPolicy::kRefreshes * EffectPolicy::kResolutions>());
+
+        const UInt32 Index = Enum::Cast(mArchetype->GetRefresh()) * EffectPolicy::kResolutions + Enum::Cast(mArchetype->GetResolution());
+        (this->*kHandlers[Index])(Expiration, Stack, Intensity);
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    template<EffectRefresh Refresh, EffectResolution Resolution>
+    void EffectInstance::MergeWith(Real64 Expiration, UInt16 Stack, Real32 Intensity)
     {
         // Merge the expiration based on the refresh policy.
-        switch (mArchetype->GetRefresh())
+        switch (Refresh)
         {
         case EffectRefresh::Keep:
             break;
         case EffectRefresh::Replace:
-            mExpiration = Other.GetExpiration();
+            mExpiration = Expiration;
         case EffectRefresh::Longest:
-            mExpiration = Max(mExpiration, Other.GetExpiration());
+            mExpiration = Max(mExpiration, Expiration);
         case EffectRefresh::Extend:
-            mExpiration += Other.GetExpiration();
+            mExpiration += Expiration;
             break;
         }
 
+        // Keep the merged expiration on the simulation step, sums of snapped timestamps may drift off it.
+        mExpiration = EffectClock::Quantize(mExpiration);
+
         // Merge the stacks based on the stacking behavior.
         const Bool IsFull = (mArchetype->GetLimit() == mStack);
-        mStack = Min(mStack + Other.GetStack(), mArchetype->GetLimit());
+        mStack = Min(mStack + Stack, mArchetype->GetLimit());
 
         // Merge the intensity based on the intensity policy.
-        switch (mArchetype->GetResolution())
+        switch (Resolution)
         {
         case EffectResolution::Additive:
             if (!IsFull)
             {
-                mIntensity += Other.GetIntensity();
+                mIntensity += Intensity;
             }
             break;
         case EffectResolution::Replace:
-            if (!IsAlmostEqual(mIntensity, Other.GetIntensity()))
+            if (!IsAlmostEqual(mIntensity, Intensity))
             {
-                mIntensity = Other.GetIntensity();
+                mIntensity = Intensity;
                 mStack     = 1;
             }
             break;
         case EffectResolution::Highest:
-            if (!IsAlmostEqual(mIntensity, Other.GetIntensity()))
+            if (!IsAlmostEqual(mIntensity, Intensity))
             {
-                mIntensity = Max(mIntensity, Other.GetIntensity());
+                mIntensity = Max(mIntensity, Intensity);
                 mStack     = 1;
             }
             break;
         case EffectResolution::Lowest:
-            if (!IsAlmostEqual(mIntensity, Other.GetIntensity()))
+            if (!IsAlmostEqual(mIntensity, Intensity))
             {
-                mIntensity = Min(mIntensity, Other.GetIntensity());
+                mIntensity = Min(mIntensity, Intensity);
                 mStack     = 1;
             }
             break;
         case EffectResolution::Average:
             if (!IsFull)
             {
-                mIntensity = (mIntensity + Other.GetIntensity()) * 0.5f;
+                mIntensity = (mIntensity + Intensity) * 0.5f;
             }
             break;
         }
+
+        UpdateEffectiveIntensity();
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void EffectInstance::Load(Ref<BakeReader> Reader, ConstRef<OnRemap> Remap)
+    {
+        const UInt16 Handle    = Reader.Read<UInt16>();
+        const UInt16 Archetype = Reader.Read<UInt16>();
+
+        mExpiration = Reader.Read<Real64>();
+        mInterval   = Reader.Read<Real64>();
+        mInstigator = Reader.Read<UInt64>();
+        mInstigator = (mInstigator != 0 && Remap ? Remap(mInstigator) : 0);
+        mSource     = { };
+        mDuration   = Reader.Read<Real32>();
+        mPeriod     = Reader.Read<Real32>();
+        mIntensity  = Reader.Read<Real32>();
+        mStack      = Reader.Read<UInt16>();
+
+        mSnapshot.fill(0.0f);
+        mCapture.fill(0.0f);
+
+        for (UInt32 Index = 0, Count = Reader.Read<UInt8>(); Index < Count; ++Index)
+        {
+            const Real32 Snapshot = Reader.Read<Real32>();
+            const Real32 Capture  = Reader.Read<Real32>();
+
+            if (Index < kMaxBonuses)
+            {
+                mSnapshot[Index] = Snapshot;
+                mCapture[Index]  = Capture;
+            }
+        }
+
+        ConstRef<EffectRepository> Repository = EffectRepository::View();
+
+        if (Reader.IsValid() && Archetype < EffectRepository::kMaxArchetypes && Repository.Get(Archetype).IsValid())
+        {
+            mArchetype = & Repository.Get(Archetype);
+            mHandle    = Handle;
+            UpdateEffectiveIntensity();
+        }
+        else
+        {
+            mArchetype = nullptr;
+            mHandle.Reset();
+        }
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void EffectInstance::Save(Ref<BakeWriter> Writer) const
+    {
+        const UInt32 Bonuses = mArchetype->GetBonuses().size();
+
+        Writer.Write(mHandle.GetID());
+        Writer.Write(mArchetype->GetHandle().GetID());
+        Writer.Write(mExpiration);
+        Writer.Write(mInterval);
+        Writer.Write(mInstigator);
+        Writer.Write(mDuration);
+        Writer.Write(mPeriod);
+        Writer.Write(mIntensity);
+        Writer.Write(mStack);
+        Writer.Write(static_cast<UInt8>(Bonuses));
+
+        for (UInt32 Index = 0; Index < Bonuses; ++Index)
+        {
+            Writer.Write(mSnapshot[Index]);
+            Writer.Write(mCapture[Index]);
+        }
     }
 }
\ No newline at end of file
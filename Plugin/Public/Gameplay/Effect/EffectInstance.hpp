@@ -12,6 +12,7 @@
 // [  HEADER  ]
 // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 
+#include "Gameplay/Arsenal/ArsenalSlot.hpp"
 #include "Gameplay/Effect/EffectArchetype.hpp"
 
 // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
@@ -21,6 +22,9 @@
 namespace Gameplay
 {
     /// \brief Represents an instance of an effect applied to an entity.
+    ///
+    /// The fields read on every due tick are packed at the front, so they share a cache line, while the per-bonus
+    /// values only read when modifiers are applied or reverted are kept at the tail.
     class EffectInstance final
     {
     public:
@@ -28,6 +32,12 @@ namespace Gameplay
         /// \brief Defines the maximum number of bonuses an effect can have.
         static constexpr UInt32 kMaxBonuses = EffectArchetype::kMaxBonuses;
 
+        /// \brief Represents a delegate mapping a saved instigator identifier to the actor it stands for on load.
+        using OnRemap = Delegate<UInt64(UInt64), DelegateInlineSize::Small>;
+
+        /// \brief Defines the stack count past which a diminishing effect rounds to its full intensity.
+        static constexpr UInt32 kMaxDiminish = 25;
+
     public:
 
         /// \brief Constructs an effect instance with default values.
@@ -37,16 +47,19 @@ namespace Gameplay
         ///
         /// \param Archetype The archetype defining the effect's properties.
         ZYPHRYON_INLINE explicit EffectInstance(ConstRef<EffectArchetype> Archetype)
-            : mArchetype  { & Archetype },
-              mHandle     { 0 },
-              mStack      { 1 },
+            : mExpiration { 0 },
+              mInterval   { 0 },
+              mArchetype  { & Archetype },
+              mInstigator { 0 },
+              mSource     { },
               mDuration   { 0 },
               mPeriod     { 0 },
               mIntensity  { 1.0f },
-              mExpiration { 0 },
-              mInterval   { 0 },
-              mInstigator { 0 },
-              mSnapshot   { }
+              mEffective  { GetEffectiveIntensity(Archetype, 1.0f, 1) },
+              mHandle     { 0 },
+              mStack      { 1 },
+              mSnapshot   { },
+              mCapture    { }
         {
         }
 
@@ -59,7 +72,17 @@ namespace Gameplay
         /// \brief Merges another effect instance into this one, combining their properties.
         ///
         /// \param Other  The other effect instance to merge.
-        void Merge(ConstRef<EffectInstance> Other);
+        ZYPHRYON_INLINE void Merge(ConstRef<EffectInstance> Other)
+        {
+            Merge(Other.GetExpiration(), Other.GetStack(), Other.GetIntensity());
+        }
+
+        /// \brief Merges a new application into this instance, without materializing it as an instance.
+        ///
+        /// \param Expiration The expiration of the application.
+        /// \param Stack      The stack count of the application.
+        /// \param Intensity  The intensity of the application.
+        void Merge(Real64 Expiration, UInt16 Stack, Real32 Intensity);
 
         /// \brief Checks if the effect instance has a valid handle.
         ///
@@ -99,6 +122,7 @@ namespace Gameplay
         ZYPHRYON_INLINE void SetStack(UInt16 Stack)
         {
             mStack = Stack;
+            UpdateEffectiveIntensity();
         }
 
         /// \brief Retrieves the current stack count of the effect.
@@ -163,6 +187,7 @@ namespace Gameplay
         ZYPHRYON_INLINE void SetIntensity(Real32 Intensity)
         {
             mIntensity = Intensity;
+            UpdateEffectiveIntensity();
         }
 
         /// \brief Retrieves the intensity of the effect.
@@ -173,21 +198,34 @@ namespace Gameplay
             return mIntensity;
         }
 
-        /// \brief Calculates the effective intensity of the effect based on its stacking behavior.
+        /// \brief Retrieves the effective intensity of the effect based on its stacking behavior.
+        ///
+        /// \note The value is cached whenever the stack or the intensity changes, reading it is free.
         ///
         /// \return The effective intensity value.
         ZYPHRYON_INLINE Real32 GetEffectiveIntensity() const
         {
-            switch (mArchetype->GetStack())
+            return mEffective;
+        }
+
+        /// \brief Calculates the effective intensity of an application based on the stacking behavior of its archetype.
+        ///
+        /// \param Archetype The archetype of the application.
+        /// \param Intensity The intensity of the application.
+        /// \param Stack     The stack count of the application.
+        /// \return The effective intensity value.
+        ZYPHRYON_INLINE static Real32 GetEffectiveIntensity(ConstRef<EffectArchetype> Archetype, Real32 Intensity, UInt16 Stack)
+        {
+            switch (Archetype.GetStack())
             {
             case EffectStack::Linear:
-                return mIntensity * static_cast<Real32>(mStack);
+                return Intensity * static_cast<Real32>(Stack);
             case EffectStack::Diminish:
-                return 1.0f - Pow(0.5f, static_cast<Real32>(mStack));
+                return kDiminish[Min(static_cast<UInt32>(Stack), kMaxDiminish)];
             case EffectStack::Exponential:
-                return Pow(mIntensity, static_cast<Real32>(mStack));
+                return Pow(Intensity, static_cast<Real32>(Stack));
             default:
-                return mIntensity;
+                return Intensity;
             }
         }
 
@@ -229,6 +267,7 @@ namespace Gameplay
         ZYPHRYON_INLINE void SetInstigator(UInt64 Instigator)
         {
             mInstigator = Instigator;
+            mSource     = { };
         }
 
         /// \brief Retrieves the entity that instigated the effect.
@@ -239,6 +278,22 @@ namespace Gameplay
             return mInstigator;
         }
 
+        /// \brief Caches the arsenal of the instigator, so ticks do not look it up through the scene again.
+        ///
+        /// \param Source The slot key of the arsenal of the instigator.
+        ZYPHRYON_INLINE void SetCachedSource(ArsenalSlot::Key Source) const
+        {
+            mSource = Source;
+        }
+
+        /// \brief Retrieves the slot key of the cached arsenal of the instigator.
+        ///
+        /// \return The cached key, which resolves to nothing if none was cached or the instigator is gone.
+        ZYPHRYON_INLINE ArsenalSlot::Key GetCachedSource() const
+        {
+            return mSource;
+        }
+
         /// \brief Sets a snapshot value for the effect.
         ///
         /// \param Index The index of the snapshot to set.
@@ -257,6 +312,39 @@ namespace Gameplay
             return mSnapshot[Index];
         }
 
+        /// \brief Sets the captured magnitude of a bonus, before intensity is applied.
+        ///
+        /// \param Index The index of the bonus.
+        /// \param Value The magnitude resolved at application time.
+        ZYPHRYON_INLINE void SetCapture(UInt16 Index, Real32 Value)
+        {
+            mCapture[Index] = Value;
+        }
+
+        /// \brief Retrieves the captured magnitude of a bonus, before intensity is applied.
+        ///
+        /// \param Index The index of the bonus.
+        /// \return The magnitude resolved at application time.
+        ZYPHRYON_INLINE Real32 GetCapture(UInt16 Index) const
+        {
+            return mCapture[Index];
+        }
+
+        /// \brief Loads the effect instance from a baked snapshot, resolving its archetype by handle.
+        ///
+        /// \note The instance is left invalid if its archetype is no longer registered. Entity identifiers are only
+        ///       meaningful to the process that saved them, so the instigator is mapped through the given delegate
+        ///       and dropped without one. Its cached arsenal is looked up again on the next tick.
+        ///
+        /// \param Reader The baked snapshot to load from.
+        /// \param Remap  The delegate mapping the saved instigator to its actor, or an empty delegate to drop it.
+        void Load(Ref<BakeReader> Reader, ConstRef<OnRemap> Remap);
+
+        /// \brief Saves the effect instance to a baked snapshot.
+        ///
+        /// \param Writer The baked snapshot to save to.
+        void Save(Ref<BakeWriter> Writer) const;
+
         /// \brief Generates a hash value for the effect instance based on its archetype.
         ///
         /// \return A hash value uniquely representing the effect effect.
@@ -265,20 +353,53 @@ namespace Gameplay
             return mArchetype->Hash();
         }
 
+    private:
+
+        /// \brief Merges a new application into this instance under a fixed refresh and resolution policy.
+        ///
+        /// \param Expiration The expiration of the application.
+        /// \param Stack      The stack count of the application.
+        /// \param Intensity  The intensity of the application.
+        template<EffectRefresh Refresh, EffectResolution Resolution>
+        void MergeWith(Real64 Expiration, UInt16 Stack, Real32 Intensity);
+
+        /// \brief Caches the effective intensity after the stack or the intensity changes.
+        ZYPHRYON_INLINE void UpdateEffectiveIntensity()
+        {
+            mEffective = GetEffectiveIntensity(* mArchetype, mIntensity, mStack);
+        }
+
+        /// \brief Holds `1 - 0.5^n` for each stack count, the curve is the same for every diminishing archetype and
+        ///        reaches exactly `1` in single precision at `kMaxDiminish` stacks.
+        static constexpr Array<Real32, kMaxDiminish + 1> kDiminish = []
+        {
+            Array<Real32, kMaxDiminish + 1> Table { };
+
+            for (Real32 Remainder = 1.0f; Ref<Real32> Value : Table)
+            {
+                Value      = 1.0f - Remainder;
+                Remainder *= 0.5f;
+            }
+            return Table;
+        }();
+
     private:
 
         // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
         // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 
+        Real64                     mExpiration;
+        Real64                     mInterval;
         ConstPtr<EffectArchetype>  mArchetype;
-        Effect                     mHandle;
-        UInt16                     mStack;       // TODO: Move out of here.
-        Real32                     mDuration;    // TODO: Move out of here.
-        Real32                     mPeriod;      // TODO: Move out of here.
-        Real32                     mIntensity;   // TODO: Move out of here.
-        Real64                     mExpiration;  // TODO: Move out of here.
-        Real64                     mInterval;    // TODO: Move out of here.
         UInt64                     mInstigator;
+        mutable ArsenalSlot::Key   mSource;
+        Real32                     mDuration;
+        Real32                     mPeriod;
+        Real32                     mIntensity;
+        Real32                     mEffective;
+        Effect                     mHandle;
+        UInt16                     mStack;
         Array<Real32, kMaxBonuses> mSnapshot;
+        Array<Real32, kMaxBonuses> mCapture;
     };
 }
\ No newline at end of file
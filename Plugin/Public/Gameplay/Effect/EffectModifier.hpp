@@ -139,6 +139,28 @@ namespace Gameplay
             mMagnitude.Save(Array);
         }
 
+        /// \brief Loads the stat modifier data from a baked resource.
+        ///
+        /// \param Reader The baked resource to load from.
+        ZYPHRYON_INLINE void Load(Ref<BakeReader> Reader)
+        {
+            mTarget    = Reader.Read<UInt16>();
+            mMode      = Reader.Read<StatMode>();
+            mOperation = Reader.Read<StatOp>();
+            mMagnitude.Load(Reader);
+        }
+
+        /// \brief Saves the stat modifier data to a baked resource.
+        ///
+        /// \param Writer The baked resource to save to.
+        ZYPHRYON_INLINE void Save(Ref<BakeWriter> Writer) const
+        {
+            Writer.Write(mTarget.GetID());
+            Writer.Write(mMode);
+            Writer.Write(mOperation);
+            mMagnitude.Save(Writer);
+        }
+
     public:
 
         /// \brief Creates a dynamic effect modifier.
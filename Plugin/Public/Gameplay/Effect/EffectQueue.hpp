@@ -0,0 +1,322 @@
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// Copyright (C) 2025 by Agustin L. Alvarez. All rights reserved.
+//
+// This work is licensed under the terms of the MIT license.
+//
+// For a copy, see <https://opensource.org/licenses/MIT>.
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#pragma once
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [  HEADER  ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#include "Gameplay/Effect/Effect.hpp"
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [   CODE   ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+namespace Gameplay
+{
+    /// \brief An indexed d-ary min-heap of effect handles ordered by the time they are next due.
+    ///
+    /// Keys are stored inline with the handles so sifting never touches the effect instances, and the position of
+    /// every queued handle is tracked so rescheduling or removing an arbitrary effect is `O(log n)`.
+    ///
+    /// \tparam Capacity The maximum number of distinct effect handles, handle identifiers must be below it.
+    /// \tparam Arity    The number of children per heap node.
+    template<UInt32 Capacity, UInt32 Arity = 4>
+    class EffectQueue final
+    {
+        static_assert(Arity >= 2, "An effect queue requires at least two children per node.");
+        static_assert(Capacity < 0xFFFF, "An effect queue can index at most 65534 handles.");
+
+    public:
+
+        /// \brief Sentinel position for handles that are not queued.
+        static constexpr UInt16 kInvalid = 0xFFFF;
+
+        /// \brief Represents an effect handle together with the time it is due.
+        struct Node final
+        {
+            /// \brief The time at which the effect is next due.
+            Real64 Key;
+
+            /// \brief The handle of the queued effect.
+            Effect Handle;
+        };
+
+    public:
+
+        /// \brief Default constructor, initializes an empty queue.
+        ZYPHRYON_INLINE EffectQueue()
+        {
+            mPositions.fill(kInvalid);
+        }
+
+        /// \brief Inserts an effect handle into the queue.
+        ///
+        /// \param Handle The handle of the effect to insert.
+        /// \param Key    The time at which the effect is due.
+        ZYPHRYON_INLINE void Insert(Effect Handle, Real64 Key)
+        {
+            LOG_ASSERT(Handle.GetID() < Capacity, "Effect handle is out of the queue capacity.");
+            LOG_ASSERT(!Contains(Handle), "Effect handle is already queued.");
+
+            mNodes.emplace_back(Key, Handle);
+            mPositions[Handle.GetID()] = mNodes.size() - 1;
+            SiftUp(mNodes.size() - 1);
+        }
+
+        /// \brief Changes the time at which a queued effect is due.
+        ///
+        /// \param Handle The handle of the queued effect.
+        /// \param Key    The new time at which the effect is due.
+        ZYPHRYON_INLINE void Update(Effect Handle, Real64 Key)
+        {
+            LOG_ASSERT(Contains(Handle), "Effect handle is not queued.");
+
+            const UInt32 Position = mPositions[Handle.GetID()];
+            const Real64 Previous = Exchange(mNodes[Position].Key, Key);
+
+            if (Key < Previous)
+            {
+                SiftUp(Position);
+            }
+            else
+            {
+                SiftDown(Position);
+            }
+        }
+
+        /// \brief Removes an effect handle from the queue, if present.
+        ///
+        /// \param Handle The handle of the effect to remove.
+        /// \return `true` if the handle was queued, `false` otherwise.
+        ZYPHRYON_INLINE Bool Remove(Effect Handle)
+        {
+            if (!Contains(Handle))
+            {
+                return false;
+            }
+
+            const UInt32 Position = Exchange(mPositions[Handle.GetID()], kInvalid);
+            const UInt32 Last     = mNodes.size() - 1;
+
+            if (Position != Last)
+            {
+                // Fill the hole with the last node and restore the heap property around it.
+                const Real64 Previous = mNodes[Position].Key;
+
+                Place(Position, mNodes[Last]);
+                mNodes.pop_back();
+
+                if (mNodes[Position].Key < Previous)
+                {
+                    SiftUp(Position);
+                }
+                else
+                {
+                    SiftDown(Position);
+                }
+            }
+            else
+            {
+                mNodes.pop_back();
+            }
+            return true;
+        }
+
+        /// \brief Checks if an effect handle is queued.
+        ///
+        /// \param Handle The handle of the effect to check.
+        /// \return `true` if the handle is queued, `false` otherwise.
+        ZYPHRYON_INLINE Bool Contains(Effect Handle) const
+        {
+            return Handle.GetID() < Capacity && mPositions[Handle.GetID()] != kInvalid;
+        }
+
+        /// \brief Retrieves the node that is due the soonest.
+        ///
+        /// \return The node at the top of the queue, the queue must not be empty.
+        ZYPHRYON_INLINE ConstRef<Node> GetTop() const
+        {
+            LOG_ASSERT(!mNodes.empty(), "Attempted to peek an empty effect queue.");
+
+            return mNodes.front();
+        }
+
+        /// \brief Retrieves the time at which the top node is due.
+        ///
+        /// \return The key of the top node, or infinity if the queue is empty.
+        ZYPHRYON_INLINE Real64 GetDeadline() const
+        {
+            return mNodes.empty() ? kInfinity<Real64> : mNodes.front().Key;
+        }
+
+        /// \brief Retrieves the number of queued effects.
+        ///
+        /// \return The number of queued effects.
+        ZYPHRYON_INLINE UInt32 GetSize() const
+        {
+            return mNodes.size();
+        }
+
+        /// \brief Retrieves the number of effects the queue can hold before growing.
+        ///
+        /// \return The number of reserved nodes.
+        ZYPHRYON_INLINE UInt32 GetReserved() const
+        {
+            return mNodes.capacity();
+        }
+
+        /// \brief Checks if the queue is empty.
+        ///
+        /// \return `true` if no effect is queued, `false` otherwise.
+        ZYPHRYON_INLINE Bool IsEmpty() const
+        {
+            return mNodes.empty();
+        }
+
+        /// \brief Retrieves all queued nodes, in heap order.
+        ///
+        /// \return A span over the queued nodes.
+        ZYPHRYON_INLINE ConstSpan<Node> GetNodes() const
+        {
+            return mNodes;
+        }
+
+        /// \brief Checks if any node due at or before the given time matches the predicate.
+        ///
+        /// \param Limit     The time limit, nodes due later are not visited.
+        /// \param Predicate A function that returns `true` for the nodes to look for.
+        /// \return `true` if a due node matches the predicate, `false` otherwise.
+        template<typename Filter>
+        ZYPHRYON_INLINE Bool Any(Real64 Limit, AnyRef<Filter> Predicate) const
+        {
+            return !mNodes.empty() && Any(0, Limit, Predicate);
+        }
+
+        /// \brief Removes all effect handles from the queue.
+        ZYPHRYON_INLINE void Clear()
+        {
+            for (ConstRef<Node> Node : mNodes)
+            {
+                mPositions[Node.Handle.GetID()] = kInvalid;
+            }
+            mNodes.clear();
+        }
+
+    private:
+
+        /// \brief Writes a node at the given position and updates its tracked position.
+        ///
+        /// \param Position The position to write to.
+        /// \param Node     The node to write.
+        ZYPHRYON_INLINE void Place(UInt32 Position, ConstRef<Node> Node)
+        {
+            mNodes[Position] = Node;
+            mPositions[Node.Handle.GetID()] = Position;
+        }
+
+        /// \brief Moves a node towards the root until its parent is due before it.
+        ///
+        /// \param Position The position of the node to move.
+        ZYPHRYON_INLINE void SiftUp(UInt32 Position)
+        {
+            const Node Moving = mNodes[Position];
+
+            while (Position > 0)
+            {
+                const UInt32 Parent = (Position - 1) / Arity;
+
+                if (mNodes[Parent].Key <= Moving.Key)
+                {
+                    break;
+                }
+
+                Place(Position, mNodes[Parent]);
+                Position = Parent;
+            }
+            Place(Position, Moving);
+        }
+
+        /// \brief Moves a node towards the leaves until all of its children are due after it.
+        ///
+        /// \param Position The position of the node to move.
+        ZYPHRYON_INLINE void SiftDown(UInt32 Position)
+        {
+            const Node   Moving = mNodes[Position];
+            const UInt32 Size   = mNodes.size();
+
+            while (true)
+            {
+                const UInt32 First = Position * Arity + 1;
+
+                if (First >= Size)
+                {
+                    break;
+                }
+
+                // Find the child that is due the soonest.
+                UInt32 Best = First;
+
+                for (UInt32 Child = First + 1, Last = Min(First + Arity, Size); Child < Last; ++Child)
+                {
+                    if (mNodes[Child].Key < mNodes[Best].Key)
+                    {
+                        Best = Child;
+                    }
+                }
+
+                if (Moving.Key <= mNodes[Best].Key)
+                {
+                    break;
+                }
+
+                Place(Position, mNodes[Best]);
+                Position = Best;
+            }
+            Place(Position, Moving);
+        }
+
+        /// \brief Visits the subtree rooted at the given position, pruning branches due after the limit.
+        ///
+        /// \param Position  The root of the subtree to visit.
+        /// \param Limit     The time limit, nodes due later are not visited.
+        /// \param Predicate A function that returns `true` for the nodes to look for.
+        /// \return `true` if a due node matches the predicate, `false` otherwise.
+        template<typename Filter>
+        ZYPHRYON_INLINE Bool Any(UInt32 Position, Real64 Limit, Ref<Filter> Predicate) const
+        {
+            if (mNodes[Position].Key > Limit)
+            {
+                return false;
+            }
+
+            if (Predicate(mNodes[Position]))
+            {
+                return true;
+            }
+
+            for (UInt32 Child = Position * Arity + 1, Last = Min(Child + Arity, mNodes.size()); Child < Last; ++Child)
+            {
+                if (Any(Child, Limit, Predicate))
+                {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+    private:
+
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+        Vector<Node>            mNodes;
+        Array<UInt16, Capacity> mPositions;
+    };
+}
\ No newline at end of file
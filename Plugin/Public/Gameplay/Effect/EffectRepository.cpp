@@ -23,10 +23,20 @@ namespace Gameplay
 
     void EffectRepository::Load(Ref<Content::Service> Content, ConstStr8 Filename)
     {
+        LOG_ASSERT(!mFrozen, "Cannot modify the effect repository while it is frozen.");
+
         if (const Blob Data = Content.Find(Filename); Data)
         {
-            TOMLParser Parser(Data.GetText());
-            Load(Parser);
+            if (BakeReader::IsBaked(Data.GetSpan()))
+            {
+                BakeReader Reader(Data.GetSpan());
+                Load(Reader);
+            }
+            else
+            {
+                TOMLParser Parser(Data.GetText());
+                Load(Parser);
+            }
         }
         else
         {
@@ -48,6 +58,17 @@ namespace Gameplay
     // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
     // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 
+    void EffectRepository::Bake(Ref<Content::Service> Content, ConstStr8 Filename) const
+    {
+        BakeWriter Writer(BakeKind::Effect);
+        Save(Writer);
+
+        Content.Save(Filename, Writer.GetData());
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
     void EffectRepository::Load(Ref<TOMLParser> Parser)
     {
         const TOMLArray Root = Parser.GetArray("Effect");
@@ -75,4 +96,157 @@ namespace Gameplay
             }
         }
     }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void EffectRepository::Load(Ref<BakeReader> Reader)
+    {
+        if (!Reader.Open(BakeKind::Effect))
+        {
+            return;
+        }
+
+        for (UInt32 Element = 0, Count = BakeStream::Skip(Reader); Element < Count && Reader.IsValid(); ++Element)
+        {
+            mArchetypes.Acquire(Reader.Peek<UInt16>(), Reader);
+        }
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void EffectRepository::Save(Ref<BakeWriter> Writer) const
+    {
+        BakeStream::Write(Writer, GetAll());
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Vector<Effect> EffectRepository::Stage(Ref<Content::Service> Content, ConstStr8 Filename)
+    {
+        mStaging.clear();
+
+        if (const Blob Data = Content.Find(Filename); Data)
+        {
+            if (BakeReader::IsBaked(Data.GetSpan()))
+            {
+                BakeReader Reader(Data.GetSpan());
+
+                if (Reader.Open(BakeKind::Effect))
+                {
+                    for (UInt32 Element = 0, Count = BakeStream::Skip(Reader); Element < Count && Reader.IsValid(); ++Element)
+                    {
+                        mStaging.emplace_back(Reader);
+                    }
+                }
+            }
+            else
+            {
+                TOMLParser      Parser(Data.GetText());
+                const TOMLArray Root = Parser.GetArray("Effect");
+
+                for (UInt32 Element = 0; Element < Root.GetSize(); ++Element)
+                {
+                    mStaging.emplace_back(Root.GetSection(Element));
+                }
+            }
+        }
+        else
+        {
+            LOG_WARNING("Failed to reload effects from '{}'", Filename);
+        }
+
+        // Drop the archetypes whose content matches the live one, they need no patching.
+        std::erase_if(mStaging, [this](ConstRef<EffectArchetype> Archetype)
+        {
+            return BakeWriter::IsEqual(Archetype, Get(Archetype.GetHandle()));
+        });
+
+        Vector<Effect> Changed;
+        Changed.reserve(mStaging.size());
+
+        for (ConstRef<EffectArchetype> Archetype : mStaging)
+        {
+            Changed.push_back(Archetype.GetHandle());
+        }
+        return Changed;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void EffectRepository::Commit()
+    {
+        for (Ref<EffectArchetype> Archetype : mStaging)
+        {
+            const UInt32 ID = Archetype.GetHandle().GetID();
+
+            // Assign over the live slot, so instances holding a pointer to it observe the new definition.
+            if (mArchetypes[ID].IsValid())
+            {
+                mArchetypes[ID] = Move(Archetype);
+            }
+            else
+            {
+                mArchetypes.Acquire(ID, Move(Archetype));
+            }
+
+            // Keep patched archetypes resident, faulting them in again would read the old definition.
+            mStream.Pin(ID);
+        }
+        mStaging.clear();
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Bool EffectRepository::Stream(AnyRef<Blob> Data)
+    {
+        LOG_ASSERT(!mFrozen, "Cannot modify the effect repository while it is frozen.");
+
+        mArchetypes.Clear();
+
+        if (!mStream.Open(Move(Data), BakeKind::Effect, kMaxArchetypes))
+        {
+            LOG_WARNING("Failed to stream effect archetypes.");
+            return false;
+        }
+        return true;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void EffectRepository::Recompile()
+    {
+        const UInt32 Generation = TokenRepository::View().GetGeneration();
+
+        if (Generation == mGeneration)
+        {
+            return;
+        }
+
+        for (Ref<EffectArchetype> Archetype : mArchetypes.GetSpan())
+        {
+            if (Archetype.IsValid())
+            {
+                Archetype.Compile();
+            }
+        }
+        mGeneration = Generation;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void EffectRepository::Measure(Ref<MemoryUsage> Usage) const
+    {
+        constexpr ConstStr8 kOwner = "EffectRepository";
+
+        Usage.RecordBlock(kOwner, "Archetypes", mArchetypes, mArchetypes.GetSpan().size() * sizeof(EffectArchetype));
+        mStream.Measure(Usage, kOwner);
+        Usage.RecordVector(kOwner, "Staging", mStaging);
+    }
 }
\ No newline at end of file
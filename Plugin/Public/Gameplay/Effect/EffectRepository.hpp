@@ -12,9 +12,15 @@
 // [  HEADER  ]
 // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 
+#include "Gameplay/Arsenal/GameplayContext.hpp"
+#include "Gameplay/Bake/BakeStream.hpp"
 #include "Gameplay/Effect/EffectArchetype.hpp"
 #include <Zyphryon.Content/Service.hpp>
 
+#ifndef GAMEPLAY_MAX_EFFECT_ARCHETYPES
+    #define GAMEPLAY_MAX_EFFECT_ARCHETYPES 1'024
+#endif
+
 // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 // [   CODE   ]
 // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
@@ -22,17 +28,22 @@
 namespace Gameplay
 {
     /// \brief Manages a registry of effect archetypes, allowing loading and saving from/to TOML resources.
+    ///
+    /// Archetypes are either loaded up front, or streamed from a baked resource, in which case each one is read into
+    /// its slot the first time it is retrieved, and can be pinned by zones and evicted once no zone uses it.
     class EffectRepository final
     {
     public:
 
         /// \brief Maximum number of effect archetypes that can be registered.
-        static constexpr UInt32 kMaxArchetypes = 1'024;  // TODO: Macro Configurable
+        static constexpr UInt32 kMaxArchetypes = GAMEPLAY_MAX_EFFECT_ARCHETYPES;
 
     public:
 
         /// \brief Loads effect archetypes from the content service.
         ///
+        /// \note Both TOML and baked resources are accepted, baked resources are detected by their header.
+        ///
         /// \param Content  The content service to load from.
         /// \param Filename The filename of the resource to load.
         void Load(Ref<Content::Service> Content, ConstStr8 Filename);
@@ -43,11 +54,36 @@ namespace Gameplay
         /// \param Filename The filename of the resource to save.
         void Save(Ref<Content::Service> Content, ConstStr8 Filename) const;
 
+        /// \brief Bakes effect archetypes into a binary resource that loads without parsing.
+        ///
+        /// \param Content  The content service to save to.
+        /// \param Filename The filename of the resource to save.
+        void Bake(Ref<Content::Service> Content, ConstStr8 Filename) const;
+
+        /// \brief Parses a resource into a staging area, keeping only the effect archetypes that differ from the live ones.
+        ///
+        /// \note Live archetypes are left untouched until `Commit`, so instances can still be reverted against them.
+        ///
+        /// \param Content  The content service to load from.
+        /// \param Filename The filename of the resource to load.
+        /// \return The handles of the changed or new effect archetypes.
+        Vector<Effect> Stage(Ref<Content::Service> Content, ConstStr8 Filename);
+
+        /// \brief Patches the staged effect archetypes into their slots, so pointers to live archetypes stay valid.
+        ///
+        /// \note Archetypes missing from the staged resource are kept, since live instances may still refer to them.
+        ///       Allowed while frozen, as the only way to change a frozen repository. Readers hold pointers or
+        ///       references to live archetypes rather than copies, so the patched definition is observed on their
+        ///       next read without any cache to invalidate.
+        void Commit();
+
         /// \brief Allocates a new effect archetype in the repository.
         ///
         /// \return A reference to the newly allocated effect archetype.
         ZYPHRYON_INLINE Ref<EffectArchetype> Allocate()
         {
+            LOG_ASSERT(!mFrozen, "Cannot modify the effect repository while it is frozen.");
+
             const Effect Handle = mArchetypes.Allocate();
 
             Ref<EffectArchetype> Archetype = mArchetypes[Handle.GetID()];
@@ -55,11 +91,23 @@ namespace Gameplay
             return Archetype;
         }
 
+        /// \brief Inserts a parsed effect archetype into the slot of its handle.
+        ///
+        /// \param Archetype The effect archetype to insert.
+        ZYPHRYON_INLINE void Insert(AnyRef<EffectArchetype> Archetype)
+        {
+            LOG_ASSERT(!mFrozen, "Cannot modify the effect repository while it is frozen.");
+            LOG_ASSERT(Archetype.GetHandle().IsValid(), "Cannot insert an effect archetype with an invalid handle.");
+
+            mArchetypes.Acquire(Archetype.GetHandle().GetID(), Move(Archetype));
+        }
+
         /// \brief Deletes a effect archetype from the repository.
         ///
         /// \param Archetype The effect archetype to delete.
         ZYPHRYON_INLINE void Delete(ConstRef<EffectArchetype> Archetype)
         {
+            LOG_ASSERT(!mFrozen, "Cannot modify the effect repository while it is frozen.");
             LOG_ASSERT(Archetype.GetHandle().IsValid(), "Cannot delete a effect archetype with an invalid handle.");
 
             mArchetypes.Free(Archetype.GetHandle().GetID());
@@ -68,7 +116,40 @@ namespace Gameplay
         /// \brief Clears all effect archetypes from the repository.
         ZYPHRYON_INLINE void Clear()
         {
+            LOG_ASSERT(!mFrozen, "Cannot modify the effect repository while it is frozen.");
+
             mArchetypes.Clear();
+            mStream.Close();
+        }
+
+        /// \brief Freezes the repository, so it can be read from any thread without synchronization.
+        ///
+        /// \note While frozen, archetypes are only replaced through `Stage` and `Commit`, and `Commit` must run between
+        ///       ticks, when no other thread is reading.
+        ZYPHRYON_INLINE void Freeze()
+        {
+            Recompile();
+            mFrozen = true;
+        }
+
+        /// \brief Compiles the token queries of every archetype again if the token hierarchy was rebuilt since.
+        ///
+        /// \note Archetypes compile their queries when loaded, so registering tokens afterwards leaves them testing
+        ///       stale indices. Freezing recompiles them, otherwise this must be called once tokens are registered.
+        void Recompile();
+
+        /// \brief Thaws the repository, allowing it to be modified again.
+        ZYPHRYON_INLINE void Thaw()
+        {
+            mFrozen = false;
+        }
+
+        /// \brief Checks if the repository is frozen.
+        ///
+        /// \return `true` if the repository is read-only, `false` otherwise.
+        ZYPHRYON_INLINE Bool IsFrozen() const
+        {
+            return mFrozen;
         }
 
         /// \brief Retrieves an effect archetype by its handle.
@@ -77,9 +158,64 @@ namespace Gameplay
         /// \return The effect archetype associated with the given handle.
         ZYPHRYON_INLINE ConstRef<EffectArchetype> Get(Effect Handle) const
         {
+            if (const UInt32 ID = Handle.GetID(); mStream.IsPending(ID))
+            {
+                mStream.Fault(ID, [this, ID](Ref<BakeReader> Reader)
+                {
+                    mArchetypes.Acquire(ID, Reader);
+                });
+            }
             return mArchetypes[Handle.GetID()];
         }
 
+        /// \brief Streams effect archetypes from a baked resource, replacing the archetypes of the repository.
+        ///
+        /// \note Only the index of the resource is read, archetypes are faulted in by `Get` on first use, from any
+        ///       thread. `GetAll` only covers the archetypes faulted in so far.
+        ///
+        /// \param Data The baked resource to stream from, kept alive while streaming.
+        /// \return `true` if the resource was opened, `false` if it is invalid and the repository was left empty.
+        Bool Stream(AnyRef<Blob> Data);
+
+        /// \brief Pins an effect archetype for a zone, faulting it in if needed, so eviction keeps it resident.
+        ///
+        /// \note Must be called at a sync point, where no other thread is reading.
+        ///
+        /// \param Zone   The zone pinning the archetype.
+        /// \param Handle The handle of the archetype to pin.
+        ZYPHRYON_INLINE void Acquire(UInt32 Zone, Effect Handle)
+        {
+            const UInt32 ID = Handle.GetID();
+
+            mStream.Acquire(Zone, ID, [this, ID](Ref<BakeReader> Reader)
+            {
+                mArchetypes.Acquire(ID, Reader);
+            });
+        }
+
+        /// \brief Drops every pin held by a zone, such as when the zone is unloaded.
+        ///
+        /// \note Must be called at a sync point, where no other thread is reading.
+        ///
+        /// \param Zone The zone to release.
+        ZYPHRYON_INLINE void Release(UInt32 Zone)
+        {
+            mStream.Release(Zone);
+        }
+
+        /// \brief Unloads every streamed archetype that no zone pins.
+        ///
+        /// \note Must be called at a sync point, once no live instance refers to an unpinned archetype.
+        ///
+        /// \return The number of archetypes unloaded.
+        ZYPHRYON_INLINE UInt32 Evict()
+        {
+            return mStream.Evict([this](UInt32 ID)
+            {
+                mArchetypes.Free(ID);
+            });
+        }
+
         /// \brief Retrieves all registered effect archetypes.
         ///
         /// \return A span containing all stat archetypes.
@@ -90,15 +226,27 @@ namespace Gameplay
 
     public:
 
-        /// \brief Retrieves the singleton instance of the repository.
+        /// \brief Retrieves the repository of the context current on the calling thread.
         ///
-        /// \return A reference to the singleton repository instance.
+        /// \return A reference to the repository of the current context.
         ZYPHRYON_INLINE static Ref<EffectRepository> Instance()
         {
-            static EffectRepository Singleton;
-            return Singleton;
+            return GameplayContext::Current().GetEffects();
         }
 
+        /// \brief Retrieves the read-only view of the repository, safe to share between threads once frozen.
+        ///
+        /// \return A constant reference to the singleton repository instance.
+        ZYPHRYON_INLINE static ConstRef<EffectRepository> View()
+        {
+            return Instance();
+        }
+
+        /// \brief Records the memory held by the repository.
+        ///
+        /// \param Usage The report receiving the usage.
+        void Measure(Ref<MemoryUsage> Usage) const;
+
     private:
 
         /// \brief Loads effect archetypes from a TOML resource.
@@ -111,11 +259,25 @@ namespace Gameplay
         /// \param Parser The TOML resource to save effect archetype definitions into.
         void Save(Ref<TOMLParser> Parser) const;
 
+        /// \brief Loads effect archetypes from a baked resource.
+        ///
+        /// \param Reader The baked resource containing effect archetype definitions.
+        void Load(Ref<BakeReader> Reader);
+
+        /// \brief Saves effect archetypes to a baked resource.
+        ///
+        /// \param Writer The baked resource to save effect archetype definitions into.
+        void Save(Ref<BakeWriter> Writer) const;
+
     private:
 
         // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
         // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 
-        Pool<EffectArchetype, kMaxArchetypes> mArchetypes;
+        mutable Pool<EffectArchetype, kMaxArchetypes> mArchetypes;
+        mutable BakeStream                            mStream;
+        Vector<EffectArchetype>                       mStaging;
+        Bool                                          mFrozen = false;
+        UInt32                                        mGeneration = 0;
     };
 }
\ No newline at end of file
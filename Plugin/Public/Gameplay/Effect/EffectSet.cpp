@@ -10,4 +10,157 @@
 // [  HEADER  ]
 // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 
-#include "Gameplay/Effect/EffectSet.hpp"
\ No newline at end of file
+#include "Gameplay/Effect/EffectSet.hpp"
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [   CODE   ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+namespace Gameplay
+{
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void EffectSet::Load(Ref<BakeReader> Reader, ConstRef<EffectInstance::OnRemap> Remap)
+    {
+        Clear();
+
+        mCount = Min(Reader.Read<UInt32>(), kMaxInstances - 1);
+
+        while (mCount > 0 && mCount / kPageSize >= mPages.size())
+        {
+            mPages.emplace_back(std::make_shared<Page>());
+        }
+
+        for (UInt32 Element = 0, Count = Reader.Read<UInt32>(); Element < Count && Reader.IsValid(); ++Element)
+        {
+            EffectInstance Instance;
+            Instance.Load(Reader, Remap);
+
+            if (!Instance.IsValid() || Instance.GetHandle().GetID() > mCount)
+            {
+                LOG_WARNING("Discarding snapshot of an effect with an unknown archetype.");
+                continue;
+            }
+
+            Ref<EffectInstance> Inplace = Get(Instance.GetHandle().GetID());
+            Inplace = Instance;
+
+            // Schedule the effect again, its modifiers are already part of the restored stats.
+            mActives.Insert(Inplace.GetHandle(), Inplace.GetInterval());
+            Record(Inplace.GetHandle(), Event::Insert);
+            Categorize(Inplace, true);
+            Depend(Inplace, true);
+
+            if (Inplace.GetArchetype()->CanStack())
+            {
+                mStacks.Insert(Inplace.GetArchetype()->GetHandle(), Inplace.GetHandle());
+            }
+        }
+
+        // Release the identifiers left unused by the snapshot, so they are reused before the set grows.
+        for (UInt32 ID = mCount; ID > 0; --ID)
+        {
+            if (!Get(ID).IsValid())
+            {
+                mFree.emplace_back(ID);
+            }
+        }
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void EffectSet::Save(Ref<BakeWriter> Writer) const
+    {
+        UInt32 Count = 0;
+
+        Traverse([&Count](ConstRef<EffectInstance>)
+        {
+            ++Count;
+        });
+
+        Writer.Write(mCount);
+        Writer.Write(Count);
+
+        Traverse([&Writer](ConstRef<EffectInstance> Instance)
+        {
+            Instance.Save(Writer);
+        });
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void EffectSet::Capture(Ref<Snapshot> Target) const
+    {
+        Target.Pages    = mPages;
+        Target.Free     = mFree;
+        Target.Count    = mCount;
+        Target.Actives  = mActives;
+        Target.Stacks   = mStacks;
+        Target.Inserted = mInserted;
+        Target.Updated  = mUpdated;
+        Target.Removed  = mRemoved;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void EffectSet::Restore(ConstRef<Snapshot> Source)
+    {
+        mPages    = Source.Pages;
+        mFree     = Source.Free;
+        mCount    = Source.Count;
+        mActives  = Source.Actives;
+        mStacks   = Source.Stacks;
+        mInserted = Source.Inserted;
+        mUpdated  = Source.Updated;
+        mRemoved  = Source.Removed;
+
+        // The indices of categories and dependencies are rebuilt rather than captured, so captures never copy a table.
+        mCategories.clear();
+
+        for (Ref<Table<Stat, Array<UInt64, kWords>>> Dependents : mDependents)
+        {
+            Dependents.clear();
+        }
+
+        for (Ref<Table<Token, Array<UInt64, kWords>>> Dependents : mTokenDependents)
+        {
+            Dependents.clear();
+        }
+
+        // Traverse without modifying, so the pages stay shared with the snapshot.
+        std::as_const(* this).Traverse([this](ConstRef<EffectInstance> Instance)
+        {
+            Categorize(Instance, true);
+            Depend(Instance, true);
+        });
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void EffectSet::Measure(Ref<MemoryUsage> Usage) const
+    {
+        constexpr ConstStr8 kOwner = "EffectSet";
+
+        Usage.Record(kOwner, "Pages", mPages.size() * sizeof(Page), mCount * sizeof(EffectInstance));
+        Usage.RecordVector(kOwner, "Directory", mPages);
+        Usage.RecordVector(kOwner, "Free", mFree);
+        Usage.Record(kOwner, "Queue", mActives.GetReserved() * sizeof(Queue::Node), mActives.GetSize() * sizeof(Queue::Node));
+        Usage.RecordBlock(kOwner, "Stacks", mStacks, sizeof(mStacks));
+        Usage.RecordTable(kOwner, "Categories", mCategories);
+
+        for (ConstRef<Table<Stat, Array<UInt64, kWords>>> Dependents : mDependents)
+        {
+            Usage.RecordTable(kOwner, "Dependents", Dependents);
+        }
+
+        for (ConstRef<Table<Token, Array<UInt64, kWords>>> Dependents : mTokenDependents)
+        {
+            Usage.RecordTable(kOwner, "TokenDependents", Dependents);
+        }
+    }
+}
\ No newline at end of file
@@ -12,7 +12,25 @@
 // [  HEADER  ]
 // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 
+#include "Gameplay/Arsenal/FrameArena.hpp"
+#include "Gameplay/Arsenal/MemoryUsage.hpp"
+#include "Gameplay/Effect/EffectIndex.hpp"
 #include "Gameplay/Effect/EffectInstance.hpp"
+#include "Gameplay/Effect/EffectQueue.hpp"
+#include <memory>
+#include <numeric>
+
+#ifndef GAMEPLAY_MAX_EFFECT_INSTANCES
+    #define GAMEPLAY_MAX_EFFECT_INSTANCES 256
+#endif
+
+#ifndef GAMEPLAY_EFFECT_QUEUE_ARITY
+    #define GAMEPLAY_EFFECT_QUEUE_ARITY 4
+#endif
+
+#ifndef GAMEPLAY_EFFECT_PAGE_SIZE
+    #define GAMEPLAY_EFFECT_PAGE_SIZE 16
+#endif
 
 // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 // [   CODE   ]
@@ -21,92 +39,146 @@
 namespace Gameplay
 {
     /// \brief Manages a collection of effect instances.
+    ///
+    /// Instances are stored in pages allocated on demand, so a set only pays for the effects it has held at once
+    /// rather than for its maximum capacity. Pages are never moved, references to instances stay stable until the
+    /// set is restored from a snapshot.
+    ///
+    /// Pages are shared with the rollback snapshots captured from the set and copied on their first write, so a
+    /// capture only costs the bookkeeping structures and the pages modified since.
     class EffectSet final
     {
     public:
 
         /// \brief Maximum number of effect instances that can be managed.
-        static constexpr UInt32 kMaxInstances = 256;    // TODO: Macro Configurable
+        static constexpr UInt32 kMaxInstances = GAMEPLAY_MAX_EFFECT_INSTANCES;
+
+        /// \brief Number of children per node of the active queue.
+        static constexpr UInt32 kQueueArity   = GAMEPLAY_EFFECT_QUEUE_ARITY;
+
+        /// \brief Number of effect instances allocated together when the set grows.
+        static constexpr UInt32 kPageSize     = GAMEPLAY_EFFECT_PAGE_SIZE;
+
+        /// \brief Number of words in the change bitsets, one bit per effect instance.
+        static constexpr UInt32 kWords        = kMaxInstances / 64;
+
+        static_assert(kMaxInstances % 64 == 0, "The capacity must be a multiple of 64, as changes are tracked by 64-bit words.");
+
+        /// \brief Queue type used to order active effects by the time they are next due.
+        using Queue = EffectQueue<kMaxInstances, kQueueArity>;
+
+        /// \brief Represents a fixed block of effect instances.
+        using Page  = Array<EffectInstance, kPageSize>;
+
+        /// \brief Structure holding the state of a set captured for rollback.
+        struct Snapshot final
+        {
+            /// \brief The pages of effect instances, shared with the set until either side writes to them.
+            Vector<std::shared_ptr<Page>> Pages;
+
+            /// \brief The identifiers released for reuse.
+            Vector<UInt32>                Free;
+
+            /// \brief The highest identifier allocated.
+            UInt32                        Count = 0;
+
+            /// \brief The active effects ordered by the time they are next due.
+            Queue                         Actives;
+
+            /// \brief The index of stackable effects by archetype and instigator.
+            EffectIndex<kMaxInstances>    Stacks;
+
+            /// \brief The bitset of instances inserted since the last poll of changes.
+            Array<UInt64, kWords>         Inserted;
+
+            /// \brief The bitset of instances updated since the last poll of changes.
+            Array<UInt64, kWords>         Updated;
+
+            /// \brief The bitset of instances removed since the last poll of changes.
+            Array<UInt64, kWords>         Removed;
+        };
 
         /// \brief Events that can occur within the effect set.
         enum class Event : UInt8
         {
             Insert,     ///< A new effect instance has been inserted.
             Update,     ///< An existing effect instance has been updated.
+            Remove,     ///< An existing effect instance has been removed.
         };
 
     public:
 
         /// \brief Invoke the provided action for each expired effect instance.
         ///
+        /// \note Each active effect is visited at most once per poll, even if it becomes due again.
+        ///
         /// \param Time   The time interval to advance.
         /// \param Action The action to apply to each effect during the tick.
         template<typename Function>
         ZYPHRYON_INLINE void Poll(ConstRef<Time> Time, AnyRef<Function> Action)
         {
-            Vector<Ptr<EffectInstance>, 6> Threshold;
+            Poll(Time.GetAbsolute(), Action);
+        }
 
-            // Iterate over active effects in reverse order to handle expirations.
-            for (SInt32 Index = mActives.size() - 1; Index >= 0; --Index)
+        /// \brief Invoke the provided action for each effect instance due at the given timestamp.
+        ///
+        /// \note Each active effect is visited at most once per poll, even if it becomes due again.
+        ///
+        /// \param Timestamp The absolute time to poll at.
+        /// \param Action    The action to apply to each effect during the tick.
+        template<typename Function>
+        ZYPHRYON_INLINE void Poll(Real64 Timestamp, AnyRef<Function> Action)
+        {
+            for (UInt32 Budget = mActives.GetSize(); Budget > 0 && mActives.GetDeadline() <= Timestamp; --Budget)
             {
-                Ref<EffectInstance> EffectInstance = mRegistry[mActives[Index].GetID()];
+                const Effect        Handle   = mActives.GetTop().Handle;
+                Ref<EffectInstance> Instance = Get(Handle.GetID());
 
-                if (EffectInstance.GetInterval() > Time.GetAbsolute())
-                {
-                    break;
-                }
+                const UInt16 Stack      = Instance.GetStack();
+                const Real64 Expiration = Instance.GetExpiration();
 
-                if (Action(EffectInstance))
+                if (Action(Instance))
                 {
-                    // Free the effect instance from the registry.
-                    mRegistry.Free(EffectInstance.GetHandle().GetID());
+                    // Remove the effect from the active queue.
+                    Deactivate(Instance);
 
-                    // Remove the effect from the active list.
-                    mActives.erase(mActives.begin() + Index);
+                    // Free the effect instance from the registry.
+                    Free(Handle.GetID());
                 }
                 else
                 {
-                    if (Threshold.size() != Threshold.capacity())
-                    {
-                        Threshold.emplace_back(& EffectInstance);
-                    }
-                }
-            }
+                    // Reschedule the effect at its next interval.
+                    mActives.Update(Handle, Instance.GetInterval());
 
-            // Update intervals for effects that are still active.
-            if (Threshold.size() == Threshold.capacity())
-            {
-                // Re-sort the entire active list if all effects were processed.
-                std::sort(mActives.begin(), mActives.end(), [this](Effect First, Effect Second)
-                {
-                    ConstRef<EffectInstance> FirstEffect  = mRegistry[First.GetID()];
-                    ConstRef<EffectInstance> SecondEffect = mRegistry[Second.GetID()];
-                    return FirstEffect.GetInterval() >= SecondEffect.GetInterval();
-                });
-            }
-            else
-            {
-                // Reposition only the effects that were processed.
-                for (const Ptr<EffectInstance> EffectInstance : Threshold)
-                {
-                    // Reposition the effect in the active list if its remaining time has changed.
-                    if (const auto Position = FindBestPosition(* EffectInstance); Position != mActives.end())
+                    // Periodic ticks that leave the stack and expiration untouched are not worth reporting.
+                    if (Instance.GetStack() != Stack || Instance.GetExpiration() != Expiration)
                     {
-                        std::rotate(Position, mActives.end() - 1, mActives.end());
+                        Record(Handle, Event::Update);
                     }
                 }
             }
         }
 
+        /// \brief Checks whether the set has no room left for another effect instance.
+        ///
+        /// \return `true` if creating an instance would exceed the capacity, `false` otherwise.
+        ZYPHRYON_INLINE Bool IsFull() const
+        {
+            return mFree.empty() && mCount + 1 >= kMaxInstances;
+        }
+
         /// \brief Creates a new effect instance based on the provided archetype.
         ///
+        /// \note The set must not be full, see \ref IsFull.
+        ///
         /// \param Archetype The archetype defining the effect's properties.
         /// \return A reference to the newly allocated effect instance.
         ZYPHRYON_INLINE Ref<EffectInstance> Create(ConstRef<EffectArchetype> Archetype)
         {
-            const UInt32 ID = mRegistry.Allocate(Archetype);
+            const UInt32 ID = Allocate();
 
-            Ref<EffectInstance> Instance = mRegistry[ID];
+            Ref<EffectInstance> Instance = Get(ID);
+            Instance = EffectInstance(Archetype);
             Instance.SetHandle(ID);
             return Instance;
         }
@@ -119,7 +191,7 @@ namespace Gameplay
             LOG_ASSERT(Instance.IsValid(), "Attempting to delete an invalid effect instance.");
 
             // Free the effect instance from the registry.
-            mRegistry.Free(Instance.GetHandle().GetID());
+            Free(Instance.GetHandle().GetID());
         }
 
         /// \brief Retrieves an effect instance by its handle.
@@ -128,46 +200,66 @@ namespace Gameplay
         /// \return The effect instance associated with the given handle.
         ZYPHRYON_INLINE ConstRef<EffectInstance> GetByHandle(Effect Handle) const
         {
-            return mRegistry[Handle.GetID()];
+            return Get(Handle.GetID());
         }
 
-        /// \brief Activates a specific effect instance within the set.
+        /// \brief Finds the active instance that new applications of a stackable archetype merge into.
+        ///
+        /// \note Meant to be checked before creating an instance, so refreshes never allocate nor initialize one.
+        ///
+        /// \param Archetype The archetype being applied.
+        /// \return A pointer to the active instance, or `nullptr` if the archetype does not stack or is not active.
+        ZYPHRYON_INLINE Ptr<EffectInstance> FindStack(ConstRef<EffectArchetype> Archetype)
+        {
+            if (Archetype.CanStack())
+            {
+                if (const Effect Handle = mStacks.Find(Archetype.GetHandle()); Handle.IsValid())
+                {
+                    return & Get(Handle.GetID());
+                }
+            }
+            return nullptr;
+        }
+
+        /// \brief Updates an active effect instance in place, as found by `FindStack`.
+        ///
+        /// \param Instance The active effect instance to update.
+        /// \param Action   A function to apply to the effect instance before it is rescheduled.
+        template<typename Function>
+        ZYPHRYON_INLINE void Refresh(Ref<EffectInstance> Instance, AnyRef<Function> Action)
+        {
+            Action(Instance, Event::Update);
+
+            // Reschedule the effect in case its remaining time has changed.
+            mActives.Update(Instance.GetHandle(), Instance.GetInterval());
+            Record(Instance.GetHandle(), Event::Update);
+        }
+
+        /// \brief Activates a newly created effect instance within the set.
+        ///
+        /// \note Stackable archetypes already active must be merged through `FindStack` and `Refresh` instead.
         ///
         /// \param Instance The effect instance to activate.
-        /// \param Action   A function to apply to the effect instance upon activation or update.
+        /// \param Action   A function to apply to the effect instance upon activation.
         template<typename Function>
         ZYPHRYON_INLINE void Activate(Ref<EffectInstance> Instance, AnyRef<Function> Action)
         {
             const ConstPtr<EffectArchetype> Archetype = Instance.GetArchetype();
+            LOG_ASSERT(!FindStack(* Archetype), "Attempting to activate a second instance of a stackable effect.");
 
-            // Check if the effect can stack and if an instance already exists.
+            // Insert the new effect instance into the active queue.
+            mActives.Insert(Instance.GetHandle(), Instance.GetInterval());
+            Record(Instance.GetHandle(), Event::Insert);
+            Categorize(Instance, true);
+            Depend(Instance, true);
+
+            // Index stackable effects so later applications can find them without scanning.
             if (Archetype->CanStack())
             {
-                const auto Iterator = FindByArchetype(Instance.GetArchetype()->GetHandle());
-
-                if (Iterator != mActives.end())
-                {
-                    Ref<EffectInstance> Inplace = mRegistry[Iterator->GetID()];
-
-                    // EffectInstance is already active, update its properties.
-                    Action(Inplace, Event::Update);
-
-                    // Reposition the effect in the active list if its remaining time has changed.
-                    if (const auto Position = FindBestPosition(Inplace); Position != Iterator)
-                    {
-                        std::rotate(Min(Position, Iterator), Iterator, Max(Position, Iterator));
-                    }
-
-                    // No need to insert a new instance.
-                    Delete(Instance);
-                    return;
-                }
+                mStacks.Insert(Archetype->GetHandle(), Instance.GetHandle());
             }
 
-            // Insert the new effect instance into the active list, maintaining sorted order by remaining time.
-            mActives.insert(FindBestPosition(Instance), Instance.GetHandle());
-
-            // Notify that a new non-stackable effect has been added.
+            // Notify that a new effect has been added.
             Action(Instance, Event::Insert);
         }
 
@@ -176,7 +268,15 @@ namespace Gameplay
         /// \param Instance The effect instance to deactivate.
         ZYPHRYON_INLINE void Deactivate(ConstRef<EffectInstance> Instance)
         {
-            mActives.erase(FindByHandle(Instance.GetHandle()));
+            mActives.Remove(Instance.GetHandle());
+            Record(Instance.GetHandle(), Event::Remove);
+            Categorize(Instance, false);
+            Depend(Instance, false);
+
+            if (const ConstPtr<EffectArchetype> Archetype = Instance.GetArchetype(); Archetype->CanStack())
+            {
+                mStacks.Remove(Archetype->GetHandle(), Instance.GetHandle());
+            }
         }
 
         /// \brief Deactivates effect instances that match the given predicate.
@@ -186,35 +286,267 @@ namespace Gameplay
         template<typename Filter, typename Function>
         ZYPHRYON_INLINE void Deactivate(AnyRef<Filter> Predicate, AnyRef<Function> Action)
         {
-            for (auto Iterator = mActives.begin(); Iterator != mActives.end();)
-            {
-                Ref<EffectInstance> EffectInstance = mRegistry[Iterator->GetID()];
+            Ref<FrameArena>          Arena   = FrameArena::Current();
+            const FrameArena::Marker Marker  = Arena.GetMarker();
+            const Span<Effect>       Matches = Arena.Allocate<Effect>(mActives.GetSize());
+
+            UInt32 Count = 0;
 
-                if (Predicate(EffectInstance))
+            // Collect the matches first, removing from the queue reorders it.
+            for (ConstRef<Queue::Node> Node : mActives.GetNodes())
+            {
+                if (Predicate(Get(Node.Handle.GetID())))
                 {
-                    Action(EffectInstance);
+                    Matches[Count++] = Node.Handle;
+                }
+            }
 
-                    // Free the effect instance from the registry.
-                    mRegistry.Free(EffectInstance.GetHandle().GetID());
+            for (const Effect Handle : Matches.first(Count))
+            {
+                Ref<EffectInstance> Instance = Get(Handle.GetID());
 
-                    // Remove the effect from the active list.
-                    Iterator = mActives.erase(Iterator);
-                }
-                else
+                Action(Instance);
+
+                // Remove the effect from the active queue.
+                Deactivate(Instance);
+
+                // Free the effect instance from the registry.
+                Free(Handle.GetID());
+            }
+            Arena.Rewind(Marker);
+        }
+
+        /// \brief Deactivates every effect instance whose category holds the given token or one of its descendants.
+        ///
+        /// \note Only the matching instances are visited, through the index of categories kept by the set.
+        ///
+        /// \param Category The category token to dispel.
+        /// \param Action   A function to apply to each effect before deactivation.
+        template<typename Function>
+        ZYPHRYON_INLINE void Dispel(Token Category, AnyRef<Function> Action)
+        {
+            const auto Iterator = mCategories.find(Category);
+
+            if (Iterator == mCategories.end())
+            {
+                return;
+            }
+
+            // Iterate over a copy, deactivating an instance clears its bit in the index.
+            const Array<UInt64, kWords> Matches = Iterator->second;
+
+            ForEach(Matches, [&](UInt32 ID)
+            {
+                Ref<EffectInstance> Instance = Get(ID);
+
+                Action(Instance);
+
+                // Remove the effect from the active queue.
+                Deactivate(Instance);
+
+                // Free the effect instance from the registry.
+                Free(ID);
+            });
+        }
+
+        /// \brief Counts the effect instances whose category holds the given token or one of its descendants.
+        ///
+        /// \param Category The category token to count.
+        /// \return The number of matching effect instances.
+        ZYPHRYON_INLINE UInt32 Count(Token Category) const
+        {
+            const auto Iterator = mCategories.find(Category);
+
+            if (Iterator == mCategories.end())
+            {
+                return 0;
+            }
+            return std::accumulate(Iterator->second.begin(), Iterator->second.end(), 0u, [](UInt32 Total, UInt64 Word)
+            {
+                return Total + std::popcount(Word);
+            });
+        }
+
+        /// \brief Invokes the provided action for each active instance whose dynamic bonuses read the given stat or token.
+        ///
+        /// \note Only instances without a period are indexed, periodic ones resolve their bonuses on every tick.
+        ///
+        /// \param Handle The stat or token that changed.
+        /// \param Scope  The side of the effect the stat or token belongs to.
+        /// \param Action The action to invoke for each dependent effect instance.
+        template<typename Type, typename Function>
+        ZYPHRYON_INLINE void ForEachDependent(Type Handle, StatScope Scope, AnyRef<Function> Action)
+        {
+            ConstRef<Table<Type, Array<UInt64, kWords>>> Dependents = GetDependents<Type>(Scope);
+
+            const auto Iterator = Dependents.find(Handle);
+
+            if (Iterator == Dependents.end())
+            {
+                return;
+            }
+
+            // Iterate over a copy, the action may apply modifiers that activate or remove other instances.
+            const Array<UInt64, kWords> Matches = Iterator->second;
+
+            ForEach(Matches, [&](UInt32 ID)
+            {
+                Action(Get(ID));
+            });
+        }
+
+        /// \brief Invokes the provided action for each active instance whose dynamic bonuses read the given stat or token.
+        ///
+        /// \param Handle The stat or token that changed.
+        /// \param Scope  The side of the effect the stat or token belongs to.
+        /// \param Action The action to invoke for each dependent effect instance.
+        template<typename Type, typename Function>
+        ZYPHRYON_INLINE void ForEachDependent(Type Handle, StatScope Scope, AnyRef<Function> Action) const
+        {
+            ConstRef<Table<Type, Array<UInt64, kWords>>> Dependents = GetDependents<Type>(Scope);
+
+            if (const auto Iterator = Dependents.find(Handle); Iterator != Dependents.end())
+            {
+                ForEach(Iterator->second, [&](UInt32 ID)
                 {
-                    ++Iterator;
-                }
+                    Action(Get(ID));
+                });
             }
         }
 
+        /// \brief Checks if any active instance holds a dynamic bonus that reads a stat or a token.
+        ///
+        /// \return `true` if at least one instance is indexed by the stats or tokens it depends on, `false` otherwise.
+        ZYPHRYON_INLINE Bool HasDependents() const
+        {
+            return HasStatDependents() || HasTokenDependents();
+        }
+
+        /// \brief Checks if any active instance holds a dynamic bonus that reads a stat.
+        ///
+        /// \return `true` if at least one instance is indexed by the stats it depends on, `false` otherwise.
+        ZYPHRYON_INLINE Bool HasStatDependents() const
+        {
+            return std::ranges::any_of(mDependents, [](ConstRef<Table<Stat, Array<UInt64, kWords>>> Dependents)
+            {
+                return !Dependents.empty();
+            });
+        }
+
+        /// \brief Checks if any active instance holds a dynamic bonus that reads a token.
+        ///
+        /// \return `true` if at least one instance is indexed by the tokens it depends on, `false` otherwise.
+        ZYPHRYON_INLINE Bool HasTokenDependents() const
+        {
+            return std::ranges::any_of(mTokenDependents, [](ConstRef<Table<Token, Array<UInt64, kWords>>> Dependents)
+            {
+                return !Dependents.empty();
+            });
+        }
+
         /// \brief Clears all effect instances from the set.
         ZYPHRYON_INLINE void Clear()
         {
             // Clear all active effects.
-            mActives.clear();
+            mActives.Clear();
+            mStacks.Clear();
+            mCategories.clear();
+
+            for (Ref<Table<Stat, Array<UInt64, kWords>>> Dependents : mDependents)
+            {
+                Dependents.clear();
+            }
+
+            for (Ref<Table<Token, Array<UInt64, kWords>>> Dependents : mTokenDependents)
+            {
+                Dependents.clear();
+            }
+
+            // Free all effect instances from the registry, keeping the pages for later use.
+            Traverse([this](Ref<EffectInstance> Instance)
+            {
+                Record(Instance.GetHandle(), Event::Remove);
+                Instance.SetHandle(Effect());
+            });
+            mFree.clear();
+            mCount = 0;
+        }
+
+        /// \brief Polls the effect instances inserted, updated or removed since the last poll.
+        ///
+        /// \note Removals are reported first, then insertions and updates. An instance inserted and removed between
+        ///       two polls is not reported at all, and an insertion already carries any later update.
+        ///
+        /// \param Action The action to invoke with the handle, the event and the instance, `nullptr` when removed.
+        template<typename Function>
+        ZYPHRYON_INLINE void PollChanges(AnyRef<Function> Action)
+        {
+            ForEach(mRemoved, [&](UInt32 ID)
+            {
+                Action(Effect(ID), Event::Remove, ConstPtr<EffectInstance>(nullptr));
+            });
+
+            ForEach(mInserted, [&](UInt32 ID)
+            {
+                Action(Effect(ID), Event::Insert, ConstPtr<EffectInstance>(& Get(ID)));
+            });
+
+            ForEach(mUpdated, [&](UInt32 ID)
+            {
+                Action(Effect(ID), Event::Update, ConstPtr<EffectInstance>(& Get(ID)));
+            });
+
+            mRemoved.fill(0);
+            mInserted.fill(0);
+            mUpdated.fill(0);
+        }
+
+        /// \brief Checks if there are effect changes waiting to be polled.
+        ///
+        /// \return `true` if at least one effect was inserted, updated or removed since the last poll, `false` otherwise.
+        ZYPHRYON_INLINE Bool HasChanges() const
+        {
+            const auto IsSet = [](UInt64 Word) { return Word != 0; };
 
-            // Free all effect instances from the registry.
-            mRegistry.Clear();
+            return std::ranges::any_of(mRemoved, IsSet) || std::ranges::any_of(mInserted, IsSet) || std::ranges::any_of(mUpdated, IsSet);
+        }
+
+        /// \brief Retrieves the time at which the next active effect instance is due.
+        ///
+        /// \return The interval of the soonest active effect, or infinity if there are no active effects.
+        ZYPHRYON_INLINE Real64 GetDeadline() const
+        {
+            return mActives.GetDeadline();
+        }
+
+        /// \brief Checks if any effect instance due at the given time matches the predicate.
+        ///
+        /// \param Timestamp The current timestamp.
+        /// \param Predicate A function that returns `true` for the effects to look for.
+        /// \return `true` if a due effect matches the predicate, `false` otherwise.
+        template<typename Filter>
+        ZYPHRYON_INLINE Bool HasDue(Real64 Timestamp, AnyRef<Filter> Predicate) const
+        {
+            const auto OnVisit = [&](ConstRef<Queue::Node> Node)
+            {
+                return Predicate(Get(Node.Handle.GetID()));
+            };
+            return mActives.Any(Timestamp, OnVisit);
+        }
+
+        /// \brief Iterates over the effect instances due at the given time, without updating them.
+        ///
+        /// \param Timestamp The current timestamp.
+        /// \param Action    The action to apply to each due effect instance.
+        template<typename Function>
+        ZYPHRYON_INLINE void ForEachDue(Real64 Timestamp, AnyRef<Function> Action) const
+        {
+            const auto OnVisit = [&](ConstRef<Queue::Node> Node)
+            {
+                Action(Get(Node.Handle.GetID()));
+                return false;
+            };
+            mActives.Any(Timestamp, OnVisit);
         }
 
         /// \brief Iterates over all effect instances in the set.
@@ -223,56 +555,277 @@ namespace Gameplay
         template<typename Function>
         ZYPHRYON_INLINE void Traverse(AnyRef<Function> Action) const
         {
-            for (ConstRef<EffectInstance> Instance : mRegistry.GetSpan())
+            for (UInt32 ID = 1; ID <= mCount; ++ID)
+            {
+                if (ConstRef<EffectInstance> Instance = Get(ID); Instance.IsValid())
+                {
+                    Action(Instance);
+                }
+            }
+        }
+
+        /// \brief Iterates over all effect instances in the set, allowing them to be modified.
+        ///
+        /// \param Action The action to apply to each effect instance.
+        template<typename Function>
+        ZYPHRYON_INLINE void Traverse(AnyRef<Function> Action)
+        {
+            for (UInt32 ID = 1; ID <= mCount; ++ID)
             {
-                if (Instance.IsValid())
+                if (Ref<EffectInstance> Instance = Get(ID); Instance.IsValid())
                 {
                     Action(Instance);
                 }
             }
         }
 
+        /// \brief Loads the effect instances of the set from a baked snapshot, replacing its current content.
+        ///
+        /// \note Instances keep their handles and are scheduled again without being applied, their modifiers are
+        ///       expected to be part of the restored stats. Instances of unknown archetypes are discarded.
+        ///
+        /// \param Reader The baked snapshot to load from.
+        /// \param Remap  The delegate mapping saved instigators to their actors, or an empty delegate to drop them.
+        void Load(Ref<BakeReader> Reader, ConstRef<EffectInstance::OnRemap> Remap);
+
+        /// \brief Saves the effect instances of the set to a baked snapshot.
+        ///
+        /// \param Writer The baked snapshot to save to.
+        void Save(Ref<BakeWriter> Writer) const;
+
+        /// \brief Captures the state of the set for rollback, sharing its pages with the snapshot.
+        ///
+        /// \param Target The snapshot receiving the state, whose previous content is replaced.
+        void Capture(Ref<Snapshot> Target) const;
+
+        /// \brief Restores the state of the set from a rollback snapshot, including its changes not yet polled.
+        ///
+        /// \note Instances are restored without being applied, their modifiers are expected to be part of the
+        ///       restored stats. References to instances taken before the restore are invalidated.
+        ///
+        /// \param Source The snapshot previously filled by `Capture`.
+        void Restore(ConstRef<Snapshot> Source);
+
+        /// \brief Records the memory held by the set, including the instance pages and the indices.
+        ///
+        /// \param Usage The report receiving the usage.
+        void Measure(Ref<MemoryUsage> Usage) const;
+
     private:
 
-        /// \brief Finds an active effect instance by its unique handle.
+        /// \brief Retrieves the effect instance stored at the given identifier for modification.
         ///
-        /// \param Handle The handle of the effect instance to search for.
-        /// \return An iterator to the found effect instance, or the end iterator if not found.
-        ZYPHRYON_INLINE Vector<Effect>::iterator FindByHandle(Effect Handle)
+        /// \note The page holding the instance is copied first if a snapshot still shares it.
+        ///
+        /// \param ID The identifier of the effect instance.
+        /// \return A reference to the effect instance.
+        ZYPHRYON_INLINE Ref<EffectInstance> Get(UInt32 ID)
         {
-            const auto Filter = [Handle](Effect Other)
+            Ref<std::shared_ptr<Page>> Block = mPages[ID / kPageSize];
+
+            if (Block.use_count() > 1)
             {
-                return Other == Handle;
-            };
-            return std::ranges::find_if(mActives, Filter);
+                Block = std::make_shared<Page>(* Block);
+            }
+            return (* Block)[ID % kPageSize];
+        }
+
+        /// \brief Retrieves the effect instance stored at the given identifier.
+        ///
+        /// \param ID The identifier of the effect instance.
+        /// \return A reference to the effect instance.
+        ZYPHRYON_INLINE ConstRef<EffectInstance> Get(UInt32 ID) const
+        {
+            return (* mPages[ID / kPageSize])[ID % kPageSize];
         }
 
-        /// \brief Finds an active effect instance by its archetype handle.
+        /// \brief Allocates an identifier for a new effect instance, growing the set by a page if needed.
         ///
-        /// \param Handle The handle of the effect archetype to search for.
-        /// \return An iterator to the found effect instance, or the end iterator if not found.
-        ZYPHRYON_INLINE Vector<Effect>::iterator FindByArchetype(Effect Handle)
+        /// \return The identifier of the allocated effect instance, never zero.
+        ZYPHRYON_INLINE UInt32 Allocate()
         {
-            const auto Filter = [&](Effect Other)
+            if (!mFree.empty())
             {
-                return mRegistry[Other.GetID()].GetArchetype()->GetHandle() == Handle;
-            };
-            return std::ranges::find_if(mActives, Filter);
+                const UInt32 ID = mFree.back();
+                mFree.pop_back();
+                return ID;
+            }
+
+            const UInt32 ID = ++mCount;
+            LOG_ASSERT(ID < kMaxInstances, "Exceeded the maximum number of effect instances.");
+
+            if (ID / kPageSize >= mPages.size())
+            {
+                mPages.emplace_back(std::make_shared<Page>());
+            }
+            return ID;
+        }
+
+        /// \brief Records a change of an effect instance, to be reported by the next poll of changes.
+        ///
+        /// \param Handle The handle of the effect instance that changed.
+        /// \param Kind   The kind of change.
+        ZYPHRYON_INLINE void Record(Effect Handle, Event Kind)
+        {
+            const UInt32 Word = Handle.GetID() / 64;
+            const UInt64 Bit  = (1ull << (Handle.GetID() % 64));
+
+            switch (Kind)
+            {
+            case Event::Insert:
+                mInserted[Word] |= Bit;
+                break;
+            case Event::Update:
+                mUpdated[Word] |= (mInserted[Word] & Bit) ? 0 : Bit;
+                break;
+            case Event::Remove:
+                // Observers never learnt about instances inserted since the last poll, they can be dropped instead.
+                if (mInserted[Word] & Bit)
+                {
+                    mInserted[Word] &= ~Bit;
+                }
+                else
+                {
+                    mRemoved[Word] |= Bit;
+                }
+                mUpdated[Word] &= ~Bit;
+                break;
+            }
         }
 
-        /// \brief Finds the best position to insert an effect instance in the active list, sorted by remaining time.
+        /// \brief Adds or removes an effect instance from the index of categories, under every level of each token.
         ///
-        /// \param Instance The effect instance to find the position for.
-        /// \return An iterator to the position where the effect instance should be inserted.
-        ZYPHRYON_INLINE Vector<Effect>::iterator FindBestPosition(ConstRef<EffectInstance> Instance)
+        /// \param Instance The effect instance to index.
+        /// \param Insert   `true` to add the instance, `false` to remove it.
+        ZYPHRYON_INLINE void Categorize(ConstRef<EffectInstance> Instance, Bool Insert)
         {
-            const auto Filter = [this](Effect First, Effect Second)
+            const UInt32 Word = Instance.GetHandle().GetID() / 64;
+            const UInt64 Bit  = (1ull << (Instance.GetHandle().GetID() % 64));
+
+            for (const Token Category : Instance.GetArchetype()->GetCategory().GetChildren())
             {
-                ConstRef<EffectInstance> A = mRegistry[First.GetID()];
-                ConstRef<EffectInstance> B = mRegistry[Second.GetID()];
-                return A.GetInterval() >= B.GetInterval();
-            };
-            return std::ranges::upper_bound(mActives, Instance.GetHandle(), Filter);
+                Category.Iterate([&](Token Level)
+                {
+                    Assign(mCategories, Level, Word, Bit, Insert);
+                });
+            }
+        }
+
+        /// \brief Adds or removes an effect instance from the index of dynamic bonuses, under each stat and token they read.
+        ///
+        /// \param Instance The effect instance to index.
+        /// \param Insert   `true` to add the instance, `false` to remove it.
+        ZYPHRYON_INLINE void Depend(ConstRef<EffectInstance> Instance, Bool Insert)
+        {
+            // Periodic instances resolve their dynamic bonuses again on every tick, they need no index.
+            if (Insert && Instance.CanTick())
+            {
+                return;
+            }
+
+            const UInt32 Word = Instance.GetHandle().GetID() / 64;
+            const UInt64 Bit  = (1ull << (Instance.GetHandle().GetID() % 64));
+
+            for (ConstRef<EffectModifier> Modifier : Instance.GetArchetype()->GetBonuses())
+            {
+                if (Modifier.GetMode() != StatMode::Dynamic)
+                {
+                    continue;
+                }
+
+                for (const StatScope Scope : { StatScope::Source, StatScope::Target })
+                {
+                    Modifier.Traverse([&]<typename Type>(Type Dependency)
+                    {
+                        Assign(GetDependents<Type>(Scope), Dependency, Word, Bit, Insert);
+                    }, Scope);
+                }
+            }
+        }
+
+        /// \brief Sets or clears the bit of an effect instance under a key of an index, erasing the key once it is empty.
+        ///
+        /// \param Slots  The index to update.
+        /// \param Key    The key to update the instance under.
+        /// \param Word   The word of the bit of the instance.
+        /// \param Bit    The bit of the instance within its word.
+        /// \param Insert `true` to set the bit, `false` to clear it.
+        template<typename Type>
+        ZYPHRYON_INLINE static void Assign(Ref<Table<Type, Array<UInt64, kWords>>> Slots, Type Key, UInt32 Word, UInt64 Bit, Bool Insert)
+        {
+            if (Insert)
+            {
+                Slots[Key][Word] |= Bit;
+            }
+            else if (const auto Iterator = Slots.find(Key); Iterator != Slots.end())
+            {
+                Iterator->second[Word] &= ~Bit;
+
+                // Drop keys nothing depends on anymore, so an empty index reports no dependents.
+                if (std::ranges::all_of(Iterator->second, [](UInt64 Bits) { return Bits == 0; }))
+                {
+                    Slots.erase(Iterator);
+                }
+            }
+        }
+
+        /// \brief Retrieves the index of dynamic bonuses reading a stat or token on the given side of the effect.
+        ///
+        /// \param Scope The side of the effect the dependency belongs to.
+        /// \return A reference to the index of the dependency type for the scope.
+        template<typename Type>
+        ZYPHRYON_INLINE Ref<Table<Type, Array<UInt64, kWords>>> GetDependents(StatScope Scope)
+        {
+            if constexpr (std::is_same_v<Type, Stat>)
+            {
+                return mDependents[std::to_underlying(Scope)];
+            }
+            else
+            {
+                return mTokenDependents[std::to_underlying(Scope)];
+            }
+        }
+
+        /// \brief Retrieves the index of dynamic bonuses reading a stat or token on the given side of the effect.
+        ///
+        /// \param Scope The side of the effect the dependency belongs to.
+        /// \return A constant reference to the index of the dependency type for the scope.
+        template<typename Type>
+        ZYPHRYON_INLINE ConstRef<Table<Type, Array<UInt64, kWords>>> GetDependents(StatScope Scope) const
+        {
+            if constexpr (std::is_same_v<Type, Stat>)
+            {
+                return mDependents[std::to_underlying(Scope)];
+            }
+            else
+            {
+                return mTokenDependents[std::to_underlying(Scope)];
+            }
+        }
+
+        /// \brief Invokes the provided action for the index of each bit set in the bitset.
+        ///
+        /// \param Bitset The bitset to iterate.
+        /// \param Action The action to invoke for each set bit.
+        template<typename Function>
+        ZYPHRYON_INLINE static void ForEach(ConstRef<Array<UInt64, kWords>> Bitset, AnyRef<Function> Action)
+        {
+            for (UInt32 Word = 0; Word < kWords; ++Word)
+            {
+                for (UInt64 Bits = Bitset[Word]; Bits != 0; Bits &= Bits - 1)
+                {
+                    Action(Word * 64 + std::countr_zero(Bits));
+                }
+            }
+        }
+
+        /// \brief Releases the identifier of an effect instance so it can be reused.
+        ///
+        /// \param ID The identifier of the effect instance.
+        ZYPHRYON_INLINE void Free(UInt32 ID)
+        {
+            Get(ID).SetHandle(Effect());
+            mFree.emplace_back(ID);
         }
 
     private:
@@ -280,7 +833,16 @@ namespace Gameplay
         // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
         // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 
-        Catalog<EffectInstance, kMaxInstances> mRegistry;
-        Vector<Effect>                         mActives;
+        Vector<std::shared_ptr<Page>>                 mPages;
+        Vector<UInt32>                                mFree;
+        UInt32                                        mCount = 0;
+        Queue                                         mActives;
+        EffectIndex<kMaxInstances>                    mStacks;
+        Array<UInt64, kWords>                         mInserted { };
+        Array<UInt64, kWords>                         mUpdated  { };
+        Array<UInt64, kWords>                         mRemoved  { };
+        Table<Token, Array<UInt64, kWords>>           mCategories;
+        Array<Table<Stat,  Array<UInt64, kWords>>, 2> mDependents;
+        Array<Table<Token, Array<UInt64, kWords>>, 2> mTokenDependents;
     };
 }
\ No newline at end of file
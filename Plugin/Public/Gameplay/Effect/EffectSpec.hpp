@@ -130,6 +130,26 @@ namespace Gameplay
             mIntensity.Save(Array.AddArray());
         }
 
+        /// \brief Loads the effect specification data from a baked resource.
+        ///
+        /// \param Reader The baked resource to load from.
+        ZYPHRYON_INLINE void Load(Ref<BakeReader> Reader)
+        {
+            mTarget    = Reader.Read<UInt16>();
+            mStack.Load(Reader);
+            mIntensity.Load(Reader);
+        }
+
+        /// \brief Saves the effect specification data to a baked resource.
+        ///
+        /// \param Writer The baked resource to save to.
+        ZYPHRYON_INLINE void Save(Ref<BakeWriter> Writer) const
+        {
+            Writer.Write(mTarget.GetID());
+            mStack.Save(Writer);
+            mIntensity.Save(Writer);
+        }
+
     private:
 
         // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
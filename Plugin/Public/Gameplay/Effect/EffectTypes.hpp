@@ -12,7 +12,8 @@
 // [  HEADER  ]
 // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 
-#include <Zyphryon.Base/Base.hpp>
+#include "Gameplay/Bake/BakeReader.hpp"
+#include "Gameplay/Bake/BakeWriter.hpp"
 
 // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 // [   CODE   ]
@@ -67,6 +68,17 @@ namespace Gameplay
     /// \brief Defines the policy rules for effect behavior.
     class EffectPolicy final
     {
+    public:
+
+        /// \brief Defines the number of expiration policies.
+        static constexpr UInt32 kExpirations = 3;
+
+        /// \brief Defines the number of refresh policies.
+        static constexpr UInt32 kRefreshes   = 4;
+
+        /// \brief Defines the number of resolution policies.
+        static constexpr UInt32 kResolutions = 5;
+
     public:
 
         /// \brief Default constructor, initializes policies to default values.
@@ -189,6 +201,22 @@ namespace Gameplay
             }
         }
 
+        /// \brief Loads effect policies from a baked resource.
+        ///
+        /// \param Reader The baked resource to load effect policy data from.
+        ZYPHRYON_INLINE void Load(Ref<BakeReader> Reader)
+        {
+            mPolicies = Reader.Read<UInt16>();
+        }
+
+        /// \brief Saves effect policies to a baked resource.
+        ///
+        /// \param Writer The baked resource to save effect policy data into.
+        ZYPHRYON_INLINE void Save(Ref<BakeWriter> Writer) const
+        {
+            Writer.Write(mPolicies);
+        }
+
     private:
 
         // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
@@ -11,6 +11,7 @@
 // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 
 #include "Gameplay/Stat/StatArchetype.hpp"
+#include "Gameplay/Stat/StatLibrary.hpp"
 
 // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 // [   CODE   ]
@@ -29,7 +30,11 @@ namespace Gameplay
         mBase.Load(Section.GetArray("Base"));
         mMinimum.Load(Section.GetArray("Minimum"));
         mMaximum.Load(Section.GetArray("Maximum"));
-        // TODO Loading formulas is not supported yet.
+
+        const ConstStr8 Formula = Section.GetString("Formula");
+        mFormula   = (Formula.empty() ? nullptr : StatLibrary::Instance().Compile(Formula));
+        mAggregate = Section.GetBool("Aggregate");
+        mNotify.Load(Section.GetSection("Notify"));
     }
 
     // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
@@ -43,6 +48,62 @@ namespace Gameplay
         mBase.Save(Section.SetArray("Base"));
         mMinimum.Save(Section.SetArray("Minimum"));
         mMaximum.Save(Section.SetArray("Maximum"));
-        // TODO Saving formulas is not supported yet.
+        Section.SetBool("Aggregate", mAggregate);
+
+        if (!mNotify.IsAlways())
+        {
+            mNotify.Save(Section.SetSection("Notify"));
+        }
+
+        if (mFormula)
+        {
+            if (mFormula->IsProgram())
+            {
+                Section.SetString("Formula", mFormula->Save());
+            }
+            else
+            {
+                LOG_WARNING("Saving formulas defined in code is not supported.");
+            }
+        }
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void StatArchetype::Load(Ref<BakeReader> Reader)
+    {
+        mHandle = Reader.Read<UInt16>();
+        mName   = Reader.ReadString();
+        mKind   = Reader.Read<StatKind>();
+        mBase.Load(Reader);
+        mMinimum.Load(Reader);
+        mMaximum.Load(Reader);
+
+        const ConstStr8 Formula = Reader.ReadString();
+        mFormula   = (Formula.empty() ? nullptr : StatLibrary::Instance().Compile(Formula));
+        mAggregate = Reader.Read<Bool>();
+        mNotify.Load(Reader);
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void StatArchetype::Save(Ref<BakeWriter> Writer) const
+    {
+        Writer.Write(mHandle.GetID());
+        Writer.WriteString(mName);
+        Writer.Write(mKind);
+        mBase.Save(Writer);
+        mMinimum.Save(Writer);
+        mMaximum.Save(Writer);
+
+        if (mFormula && !mFormula->IsProgram())
+        {
+            LOG_WARNING("Saving formulas defined in code is not supported.");
+        }
+        Writer.WriteString(mFormula && mFormula->IsProgram() ? mFormula->Save() : Str8());
+        Writer.Write(mAggregate);
+        mNotify.Save(Writer);
     }
 }
\ No newline at end of file
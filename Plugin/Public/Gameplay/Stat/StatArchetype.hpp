@@ -13,6 +13,7 @@
 // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 
 #include "Gameplay/Stat/StatInput.hpp"
+#include "Gameplay/Stat/StatNotify.hpp"
 
 // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 // [   CODE   ]
@@ -27,12 +28,13 @@ namespace Gameplay
 
         /// \brief Default constructor, initializes members to default values.
         ZYPHRYON_INLINE StatArchetype()
-            : mHandle   { 0 },
-              mKind     { StatKind::Attribute },
-              mBase     { 0.0f },
-              mMinimum  { 0.0f },
-              mMaximum  { 0.0f },
-              mFormula  { nullptr }
+            : mHandle    { 0 },
+              mKind      { StatKind::Attribute },
+              mBase      { 0.0f },
+              mMinimum   { 0.0f },
+              mMaximum   { 0.0f },
+              mFormula   { nullptr },
+              mAggregate { false }
         {
         }
 
@@ -44,6 +46,14 @@ namespace Gameplay
             Load(Section);
         }
 
+        /// \brief Constructs a stat archetype by loading data from a baked resource.
+        ///
+        /// \param Reader The baked resource to load from.
+        ZYPHRYON_INLINE StatArchetype(Ref<BakeReader> Reader)
+        {
+            Load(Reader);
+        }
+
         /// \brief Destruct a stat archetype.
         ZYPHRYON_INLINE ~StatArchetype()
         {
@@ -170,6 +180,40 @@ namespace Gameplay
             return mFormula;
         }
 
+        /// \brief Sets whether the modifiers of this stat are recorded per source.
+        ///
+        /// \param Aggregate `true` to keep a ledger of the modifiers, `false` to adjust the stat in place.
+        ZYPHRYON_INLINE void SetAggregate(Bool Aggregate)
+        {
+            mAggregate = Aggregate;
+        }
+
+        /// \brief Checks whether the modifiers of this stat are recorded per source.
+        ///
+        /// \note Only attributes can be aggregated, as resources and progressions never revert their modifiers.
+        ///
+        /// \return `true` if the stat is an aggregated attribute, `false` otherwise.
+        ZYPHRYON_INLINE Bool IsAggregated() const
+        {
+            return mAggregate && mKind == StatKind::Attribute;
+        }
+
+        /// \brief Sets the policy deciding which changes of this stat are reported to listeners.
+        ///
+        /// \param Notify The notification policy to assign.
+        ZYPHRYON_INLINE void SetNotify(AnyRef<StatNotify> Notify)
+        {
+            mNotify = Move(Notify);
+        }
+
+        /// \brief Retrieves the policy deciding which changes of this stat are reported to listeners.
+        ///
+        /// \return The notification policy.
+        ZYPHRYON_INLINE ConstRef<StatNotify> GetNotify() const
+        {
+            return mNotify;
+        }
+
         /// \brief Calculates the effective stat value using the provided source context.
         ///
         /// \param Source     The source context to retrieve stat values from.
@@ -223,6 +267,16 @@ namespace Gameplay
         /// \param Section The TOML section to save to.
         void Save(TOMLSection Section) const;
 
+        /// \brief Loads the stat archetype data from a baked resource.
+        ///
+        /// \param Reader The baked resource to load from.
+        void Load(Ref<BakeReader> Reader);
+
+        /// \brief Saves the stat archetype data to a baked resource.
+        ///
+        /// \param Writer The baked resource to save to.
+        void Save(Ref<BakeWriter> Writer) const;
+
         /// \brief Generates a hash value for the stat archetype based on its handle.
         ///
         /// \return A hash value uniquely representing the stat archetype.
@@ -243,5 +297,7 @@ namespace Gameplay
         StatInput        mMinimum;
         StatInput        mMaximum;
         Ptr<StatFormula> mFormula;
+        Bool             mAggregate;
+        StatNotify       mNotify;
     };
 }
\ No newline at end of file
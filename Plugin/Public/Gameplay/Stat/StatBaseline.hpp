@@ -0,0 +1,112 @@
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// Copyright (C) 2025 by Agustin L. Alvarez. All rights reserved.
+//
+// This work is licensed under the terms of the MIT license.
+//
+// For a copy, see <https://opensource.org/licenses/MIT>.
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#pragma once
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [  HEADER  ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#include "Gameplay/Stat/StatRepository.hpp"
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [   CODE   ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+namespace Gameplay
+{
+    /// \brief Holds the precomputed default values of stats, shared read-only by every arsenal of an actor template.
+    ///
+    /// A default is the value an untouched stat resolves to, before any modifier lands on it. Arsenals referencing
+    /// a baseline read their untouched stats from it instead of resolving their inputs and formula on every access.
+    class StatBaseline final
+    {
+    public:
+
+        /// \brief Maximum number of stats held by a baseline, one slot per stat archetype.
+        static constexpr UInt32 kCapacity = StatRepository::kMaxArchetypes;
+
+        /// \brief Number of words in the presence bitset.
+        static constexpr UInt32 kWords    = StatRepository::kWords;
+
+    public:
+
+        /// \brief Default constructor, initializes an empty baseline.
+        ZYPHRYON_INLINE StatBaseline()
+            : mPresence { },
+              mValues   { }
+        {
+        }
+
+        /// \brief Computes the default value of every registered stat against the given context.
+        ///
+        /// \note The context should be a prototype of the actor template, carrying its tokens and no modifiers.
+        ///
+        /// \param Source The context used to resolve the default values.
+        template<typename Context>
+        ZYPHRYON_INLINE void Build(ConstRef<Context> Source)
+        {
+            Clear();
+
+            for (ConstRef<StatArchetype> Archetype : StatRepository::View().GetAll())
+            {
+                if (Archetype.IsValid())
+                {
+                    Insert(Archetype.GetHandle(), Archetype.Calculate(Source, 0.0f, 0.0f, 1.0f));
+                }
+            }
+        }
+
+        /// \brief Inserts or replaces the default value of a stat.
+        ///
+        /// \param Handle The handle of the stat.
+        /// \param Value  The default value of the stat.
+        ZYPHRYON_INLINE void Insert(Stat Handle, Real32 Value)
+        {
+            const UInt32 Index = Handle.GetID();
+
+            mPresence[Index / 64] |= (1ull << (Index % 64));
+            mValues[Index] = Value;
+        }
+
+        /// \brief Checks if the baseline holds a default value for the given stat.
+        ///
+        /// \param Handle The handle of the stat to check.
+        /// \return `true` if the stat is present, `false` otherwise.
+        ZYPHRYON_INLINE Bool Contains(Stat Handle) const
+        {
+            const UInt32 Index = Handle.GetID();
+            return (mPresence[Index / 64] >> (Index % 64)) & 1;
+        }
+
+        /// \brief Retrieves the default value of a stat.
+        ///
+        /// \param Handle The handle of the stat to retrieve, which must be present.
+        /// \return The default value of the stat.
+        ZYPHRYON_INLINE Real32 Get(Stat Handle) const
+        {
+            LOG_ASSERT(Contains(Handle), "Stat is not present in the baseline.");
+
+            return mValues[Handle.GetID()];
+        }
+
+        /// \brief Clears all default values from the baseline.
+        ZYPHRYON_INLINE void Clear()
+        {
+            mPresence.fill(0);
+        }
+
+    private:
+
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+        Array<UInt64, kWords>    mPresence;
+        Array<Real32, kCapacity> mValues;
+    };
+}
\ No newline at end of file
@@ -0,0 +1,500 @@
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// Copyright (C) 2025 by Agustin L. Alvarez. All rights reserved.
+//
+// This work is licensed under the terms of the MIT license.
+//
+// For a copy, see <https://opensource.org/licenses/MIT>.
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#pragma once
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [  HEADER  ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#include "Gameplay/Stat/StatFormula.hpp"
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [   CODE   ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+namespace Gameplay::Expression
+{
+    /// \brief Enumerates the components of a stat calculation that an expression can read.
+    enum class Component : UInt8
+    {
+        Base,         ///< The base value of the stat.
+        Flat,         ///< The flat addition to apply to the base value.
+        Additive,     ///< The percentage addition to apply to the base value.
+        Multiplier,   ///< The multiplier to apply to the base value.
+    };
+
+    /// \brief Enumerates the binary operators supported by expressions.
+    enum class Operator : UInt8
+    {
+        Add,          ///< Sum of both operands.
+        Subtract,     ///< Difference of both operands.
+        Multiply,     ///< Product of both operands.
+        Divide,       ///< Quotient of both operands.
+        Minimum,      ///< Smallest of both operands.
+        Maximum,      ///< Largest of both operands.
+    };
+
+    /// \brief Concept satisfied by every expression node.
+    template<typename Type>
+    concept IsExpression = requires { Type::kExpression; };
+
+    /// \brief Concept satisfied by every type that can take part in an expression.
+    template<typename Type>
+    concept IsOperand = IsExpression<Type> || std::is_arithmetic_v<Type>;
+
+    /// \brief Expression node holding a constant value.
+    struct Literal final
+    {
+        /// \brief Marks the type as an expression node.
+        static constexpr Bool kExpression = true;
+
+        /// \brief Evaluates the node.
+        ///
+        /// \param Reader The reader providing the calculation inputs.
+        /// \return The constant value.
+        template<typename Input>
+        ZYPHRYON_INLINE constexpr Real32 Evaluate(ConstRef<Input> Reader) const
+        {
+            return Value;
+        }
+
+        /// \brief Traverses the dependencies of the node, a literal has none.
+        ///
+        /// \param Action The action to invoke for each dependency.
+        template<typename Function>
+        ZYPHRYON_INLINE constexpr void Traverse(AnyRef<Function> Action) const
+        {
+        }
+
+        /// \brief The constant value.
+        Real32 Value;
+    };
+
+    /// \brief Expression node reading one of the components of the stat being calculated.
+    template<Component Kind>
+    struct ComponentTerm final
+    {
+        /// \brief Marks the type as an expression node.
+        static constexpr Bool kExpression = true;
+
+        /// \brief Evaluates the node.
+        ///
+        /// \param Reader The reader providing the calculation inputs.
+        /// \return The value of the component.
+        template<typename Input>
+        ZYPHRYON_INLINE constexpr Real32 Evaluate(ConstRef<Input> Reader) const
+        {
+            if constexpr (Kind == Component::Base)
+            {
+                return Reader.Base;
+            }
+            else if constexpr (Kind == Component::Flat)
+            {
+                return Reader.Flat;
+            }
+            else if constexpr (Kind == Component::Additive)
+            {
+                return Reader.Additive;
+            }
+            else
+            {
+                return Reader.Multiplier;
+            }
+        }
+
+        /// \brief Traverses the dependencies of the node, a component has none.
+        ///
+        /// \param Action The action to invoke for each dependency.
+        template<typename Function>
+        ZYPHRYON_INLINE constexpr void Traverse(AnyRef<Function> Action) const
+        {
+        }
+    };
+
+    /// \brief Expression node reading the value of a stat from the context of the given scope.
+    template<UInt16 ID, StatScope Scope>
+    struct StatTerm final
+    {
+        /// \brief Marks the type as an expression node.
+        static constexpr Bool kExpression = true;
+
+        /// \brief Evaluates the node.
+        ///
+        /// \param Reader The reader providing the calculation inputs.
+        /// \return The value of the stat.
+        template<typename Input>
+        ZYPHRYON_INLINE constexpr Real32 Evaluate(ConstRef<Input> Reader) const
+        {
+            return Reader.template GetStat<Scope>(Stat(ID));
+        }
+
+        /// \brief Traverses the dependencies of the node.
+        ///
+        /// \param Action The action to invoke for each dependency.
+        template<typename Function>
+        ZYPHRYON_INLINE constexpr void Traverse(AnyRef<Function> Action) const
+        {
+            Action(Stat(ID), Scope);
+        }
+    };
+
+    /// \brief Expression node reading the counter of a token from the context of the given scope.
+    template<UInt32 Key, StatScope Scope>
+    struct TokenTerm final
+    {
+        /// \brief Marks the type as an expression node.
+        static constexpr Bool kExpression = true;
+
+        /// \brief Evaluates the node.
+        ///
+        /// \param Reader The reader providing the calculation inputs.
+        /// \return The counter of the token.
+        template<typename Input>
+        ZYPHRYON_INLINE constexpr Real32 Evaluate(ConstRef<Input> Reader) const
+        {
+            return static_cast<Real32>(Reader.template GetToken<Scope>(Token(Key)));
+        }
+
+        /// \brief Traverses the dependencies of the node.
+        ///
+        /// \param Action The action to invoke for each dependency.
+        template<typename Function>
+        ZYPHRYON_INLINE constexpr void Traverse(AnyRef<Function> Action) const
+        {
+            Action(Token(Key), Scope);
+        }
+    };
+
+    /// \brief Expression node negating its operand.
+    template<typename Operand>
+    struct Negate final
+    {
+        /// \brief Marks the type as an expression node.
+        static constexpr Bool kExpression = true;
+
+        /// \brief Evaluates the node.
+        ///
+        /// \param Reader The reader providing the calculation inputs.
+        /// \return The negated value of the operand.
+        template<typename Input>
+        ZYPHRYON_INLINE constexpr Real32 Evaluate(ConstRef<Input> Reader) const
+        {
+            return -Value.Evaluate(Reader);
+        }
+
+        /// \brief Traverses the dependencies of the node.
+        ///
+        /// \param Action The action to invoke for each dependency.
+        template<typename Function>
+        ZYPHRYON_INLINE constexpr void Traverse(AnyRef<Function> Action) const
+        {
+            Value.Traverse(Action);
+        }
+
+        /// \brief The operand to negate.
+        Operand Value;
+    };
+
+    /// \brief Expression node combining two operands.
+    template<Operator Kind, typename First, typename Second>
+    struct Binary final
+    {
+        /// \brief Marks the type as an expression node.
+        static constexpr Bool kExpression = true;
+
+        /// \brief Evaluates the node.
+        ///
+        /// \param Reader The reader providing the calculation inputs.
+        /// \return The result of the operator applied to both operands.
+        template<typename Input>
+        ZYPHRYON_INLINE constexpr Real32 Evaluate(ConstRef<Input> Reader) const
+        {
+            const Real32 A = Left.Evaluate(Reader);
+            const Real32 B = Right.Evaluate(Reader);
+
+            if constexpr (Kind == Operator::Add)
+            {
+                return A + B;
+            }
+            else if constexpr (Kind == Operator::Subtract)
+            {
+                return A - B;
+            }
+            else if constexpr (Kind == Operator::Multiply)
+            {
+                return A * B;
+            }
+            else if constexpr (Kind == Operator::Divide)
+            {
+                return A / B;
+            }
+            else if constexpr (Kind == Operator::Minimum)
+            {
+                return A < B ? A : B;
+            }
+            else
+            {
+                return A > B ? A : B;
+            }
+        }
+
+        /// \brief Traverses the dependencies of the node.
+        ///
+        /// \param Action The action to invoke for each dependency.
+        template<typename Function>
+        ZYPHRYON_INLINE constexpr void Traverse(AnyRef<Function> Action) const
+        {
+            Left.Traverse(Action);
+            Right.Traverse(Action);
+        }
+
+        /// \brief The left-hand operand.
+        First  Left;
+
+        /// \brief The right-hand operand.
+        Second Right;
+    };
+
+    /// \brief Lifts an operand into an expression node, wrapping arithmetic values into literals.
+    ///
+    /// \param Value The operand to lift.
+    /// \return The operand as an expression node.
+    template<IsOperand Type>
+    ZYPHRYON_INLINE constexpr auto Lift(Type Value)
+    {
+        if constexpr (IsExpression<Type>)
+        {
+            return Value;
+        }
+        else
+        {
+            return Literal { static_cast<Real32>(Value) };
+        }
+    }
+
+    /// \brief Concept satisfied when two operands can be combined into an expression.
+    template<typename First, typename Second>
+    concept IsCombinable = IsOperand<First> && IsOperand<Second> && (IsExpression<First> || IsExpression<Second>);
+
+    /// \brief Combines two operands with the given operator.
+    template<Operator Kind, typename First, typename Second>
+    ZYPHRYON_INLINE constexpr auto Combine(First Left, Second Right)
+    {
+        using LeftNode  = decltype(Lift(Left));
+        using RightNode = decltype(Lift(Right));
+        return Binary<Kind, LeftNode, RightNode> { Lift(Left), Lift(Right) };
+    }
+
+    /// \brief Builds an expression adding both operands.
+    template<typename First, typename Second> requires IsCombinable<First, Second>
+    ZYPHRYON_INLINE constexpr auto operator+(First Left, Second Right)
+    {
+        return Combine<Operator::Add>(Left, Right);
+    }
+
+    /// \brief Builds an expression subtracting the right operand from the left one.
+    template<typename First, typename Second> requires IsCombinable<First, Second>
+    ZYPHRYON_INLINE constexpr auto operator-(First Left, Second Right)
+    {
+        return Combine<Operator::Subtract>(Left, Right);
+    }
+
+    /// \brief Builds an expression multiplying both operands.
+    template<typename First, typename Second> requires IsCombinable<First, Second>
+    ZYPHRYON_INLINE constexpr auto operator*(First Left, Second Right)
+    {
+        return Combine<Operator::Multiply>(Left, Right);
+    }
+
+    /// \brief Builds an expression dividing the left operand by the right one.
+    template<typename First, typename Second> requires IsCombinable<First, Second>
+    ZYPHRYON_INLINE constexpr auto operator/(First Left, Second Right)
+    {
+        return Combine<Operator::Divide>(Left, Right);
+    }
+
+    /// \brief Builds an expression negating the operand.
+    template<IsExpression Type>
+    ZYPHRYON_INLINE constexpr auto operator-(Type Value)
+    {
+        return Negate<Type> { Value };
+    }
+
+    /// \brief Builds an expression selecting the smallest of both operands.
+    template<typename First, typename Second> requires IsCombinable<First, Second>
+    ZYPHRYON_INLINE constexpr auto Minimum(First Left, Second Right)
+    {
+        return Combine<Operator::Minimum>(Left, Right);
+    }
+
+    /// \brief Builds an expression selecting the largest of both operands.
+    template<typename First, typename Second> requires IsCombinable<First, Second>
+    ZYPHRYON_INLINE constexpr auto Maximum(First Left, Second Right)
+    {
+        return Combine<Operator::Maximum>(Left, Right);
+    }
+
+    /// \brief Reads the base value of the stat being calculated.
+    inline constexpr ComponentTerm<Component::Base>       kBase       { };
+
+    /// \brief Reads the flat addition of the stat being calculated.
+    inline constexpr ComponentTerm<Component::Flat>       kFlat       { };
+
+    /// \brief Reads the percentage addition of the stat being calculated.
+    inline constexpr ComponentTerm<Component::Additive>   kAdditive   { };
+
+    /// \brief Reads the multiplier of the stat being calculated.
+    inline constexpr ComponentTerm<Component::Multiplier> kMultiplier { };
+
+    /// \brief Reads a stat from the source context.
+    template<UInt16 ID>
+    inline constexpr StatTerm<ID, StatScope::Source>  SourceStat  { };
+
+    /// \brief Reads a stat from the target context.
+    template<UInt16 ID>
+    inline constexpr StatTerm<ID, StatScope::Target>  TargetStat  { };
+
+    /// \brief Reads a token counter from the source context.
+    template<UInt32 Key>
+    inline constexpr TokenTerm<Key, StatScope::Source> SourceToken { };
+
+    /// \brief Reads a token counter from the target context.
+    template<UInt32 Key>
+    inline constexpr TokenTerm<Key, StatScope::Target> TargetToken { };
+}
+
+namespace Gameplay
+{
+    /// \brief A stat formula whose expression is known at compile time and evaluated as straight-line code.
+    ///
+    /// Only the stats and tokens referenced by the expression are read, directly from the contexts, e.g.
+    /// `StaticStatFormula<(kBase + kFlat) * (1.0f + SourceStat<kStrength> * 0.02f)>`.
+    template<auto Definition> requires Expression::IsExpression<decltype(Definition)>
+    class StaticStatFormula final
+    {
+    public:
+
+        /// \brief Calculates the effective stat value using the provided source context.
+        ///
+        /// \param Source     The source context to retrieve stat values from.
+        /// \param Base       The base value of the stat.
+        /// \param Flat       The flat addition to apply to the base value.
+        /// \param Additive   The percentage addition to apply to the base value.
+        /// \param Multiplier The multiplier to apply to the base value.
+        /// \return The calculated stat value.
+        template<typename Context>
+        ZYPHRYON_INLINE static Real32 Calculate(ConstRef<Context> Source, Real32 Base, Real32 Flat, Real32 Additive, Real32 Multiplier)
+        {
+            return Definition.Evaluate(Reader<Context, Context> { Base, Flat, Additive, Multiplier, Source, Source });
+        }
+
+        /// \brief Calculates the effective stat value using both source and target contexts.
+        ///
+        /// \param Source     The source context to retrieve stat values from.
+        /// \param Target     The target context to retrieve stat values from.
+        /// \param Base       The base value of the stat.
+        /// \param Flat       The flat addition to apply to the base value.
+        /// \param Additive   The percentage addition to apply to the base value.
+        /// \param Multiplier The multiplier to apply to the base value.
+        /// \return The calculated stat value.
+        template<typename SourceContext, typename TargetContext>
+        ZYPHRYON_INLINE static Real32 Calculate(ConstRef<SourceContext> Source, ConstRef<TargetContext> Target, Real32 Base, Real32 Flat, Real32 Additive, Real32 Multiplier)
+        {
+            return Definition.Evaluate(Reader<SourceContext, TargetContext> { Base, Flat, Additive, Multiplier, Source, Target });
+        }
+
+        /// \brief Compiles the expression into a runtime formula with its dependencies registered.
+        ///
+        /// \return A formula that evaluates the expression.
+        ZYPHRYON_INLINE static StatFormula Compile()
+        {
+            StatFormula Formula(& Evaluate);
+
+            Definition.Traverse([&Formula](auto Dependency, StatScope Scope)
+            {
+                // Skip dependencies already registered, the expression may reference them more than once.
+                using Type = decltype(Dependency);
+
+                Bool Registered = false;
+
+                Formula.Traverse([&](auto Existing)
+                {
+                    if constexpr (std::is_same_v<decltype(Existing), Type>)
+                    {
+                        Registered |= (Existing == Dependency);
+                    }
+                }, Scope);
+
+                if (!Registered)
+                {
+                    if (Scope == StatScope::Source)
+                    {
+                        Formula.AddSourceDependency(Dependency);
+                    }
+                    else
+                    {
+                        Formula.AddTargetDependency(Dependency);
+                    }
+                }
+            });
+            return Formula;
+        }
+
+    private:
+
+        /// \brief Reader exposing the calculation inputs straight from the contexts.
+        template<typename SourceContext, typename TargetContext>
+        struct Reader final
+        {
+            /// \brief Retrieves a stat value from the context of the given scope.
+            template<StatScope Scope>
+            ZYPHRYON_INLINE Real32 GetStat(Stat Handle) const
+            {
+                if constexpr (Scope == StatScope::Source)
+                {
+                    return Source.GetStat(Handle);
+                }
+                else
+                {
+                    return Target.GetStat(Handle);
+                }
+            }
+
+            /// \brief Retrieves a token counter from the context of the given scope.
+            template<StatScope Scope>
+            ZYPHRYON_INLINE UInt32 GetToken(Token Handle) const
+            {
+                if constexpr (Scope == StatScope::Source)
+                {
+                    return Source.GetToken(Handle);
+                }
+                else
+                {
+                    return Target.GetToken(Handle);
+                }
+            }
+
+            Real32                   Base;
+            Real32                   Flat;
+            Real32                   Additive;
+            Real32                   Multiplier;
+            ConstRef<SourceContext>  Source;
+            ConstRef<TargetContext>  Target;
+        };
+
+        /// \brief Evaluates the expression through the type-erased inputs of a runtime formula.
+        ///
+        /// \param Evaluation The inputs of the calculation.
+        /// \return The calculated stat value.
+        static Real32 Evaluate(ConstRef<StatFormula::Evaluation> Evaluation)
+        {
+            return Definition.Evaluate(Evaluation);
+        }
+    };
+}
\ No newline at end of file
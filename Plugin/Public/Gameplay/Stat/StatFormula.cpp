@@ -10,4 +10,66 @@
 // [  HEADER  ]
 // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 
-#include "Gameplay/Stat/StatFormula.hpp"
\ No newline at end of file
+#include "Gameplay/Stat/StatFormula.hpp"
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [   CODE   ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+namespace Gameplay
+{
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Bool StatFormula::Load(ConstStr8 Text)
+    {
+        StatProgram Program;
+
+        if (!Program.Compile(Text))
+        {
+            return false;
+        }
+
+        Graph Dependencies;
+        Bool  Overflow = false;
+
+        Program.Traverse([&]<typename Type>(Type Dependency, StatScope Scope)
+        {
+            if (Dependencies.Contains(Dependency, Scope))
+            {
+                return;
+            }
+
+            if constexpr (std::is_same_v<Type, Stat>)
+            {
+                Overflow |= (Dependencies.mStats.size() == kMaxStats);
+            }
+            else
+            {
+                Overflow |= (Dependencies.mTokens.size() == kMaxTokens);
+            }
+
+            if (!Overflow)
+            {
+                if (Scope == StatScope::Source)
+                {
+                    Dependencies.AddSourceDependency(Dependency);
+                }
+                else
+                {
+                    Dependencies.AddTargetDependency(Dependency);
+                }
+            }
+        });
+
+        if (Overflow)
+        {
+            LOG_WARNING("Formula '{}' exceeds the maximum number of dependencies.", Text);
+            return false;
+        }
+
+        mProgram      = Program;
+        mDependencies = Dependencies;
+        return true;
+    }
+}
\ No newline at end of file
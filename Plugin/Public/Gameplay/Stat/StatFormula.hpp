@@ -12,9 +12,15 @@
 // [  HEADER  ]
 // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 
-#include "Gameplay/Stat/Stat.hpp"
-#include "Gameplay/Stat/StatTypes.hpp"
-#include "Gameplay/Token/Token.hpp"
+#include "Gameplay/Stat/StatProgram.hpp"
+
+#ifndef GAMEPLAY_MAX_FORMULA_STATS
+    #define GAMEPLAY_MAX_FORMULA_STATS 10
+#endif
+
+#ifndef GAMEPLAY_MAX_FORMULA_TOKENS
+    #define GAMEPLAY_MAX_FORMULA_TOKENS 4
+#endif
 
 // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 // [   CODE   ]
@@ -28,10 +34,10 @@ namespace Gameplay
     public:
 
         /// \brief Maximum number of stats in a computation snapshot.
-        static constexpr UInt32 kMaxStats  = 10;   // TODO: Macro Configurable
+        static constexpr UInt32 kMaxStats  = GAMEPLAY_MAX_FORMULA_STATS;
 
         /// \brief Maximum number of tokens in a computation snapshot.
-        static constexpr UInt32 kMaxTokens = 4;    // TODO: Macro Configurable
+        static constexpr UInt32 kMaxTokens = GAMEPLAY_MAX_FORMULA_TOKENS;
 
         /// \brief Structure representing the dependency graph for a stat calculation.
         struct Graph final
@@ -86,6 +92,26 @@ namespace Gameplay
                 mTokens.emplace_back(Dependency);
             }
 
+            /// \brief Checks if the graph already holds a dependency within the given scope.
+            ///
+            /// \param Dependency The stat or token handle to look for.
+            /// \param Scope      The scope of the dependency.
+            /// \return `true` if the dependency is registered, `false` otherwise.
+            template<typename Type>
+            ZYPHRYON_INLINE Bool Contains(Type Dependency, StatScope Scope) const
+            {
+                Bool Found = false;
+
+                Traverse([&](auto Existing)
+                {
+                    if constexpr (std::is_same_v<decltype(Existing), Type>)
+                    {
+                        Found |= (Existing == Dependency);
+                    }
+                }, Scope);
+                return Found;
+            }
+
             /// \brief Traverses all dependencies in the graph, invoking the provided action for each.
             ///
             /// \param Action The action to invoke for each dependency.
@@ -232,6 +258,106 @@ namespace Gameplay
         /// \brief Type alias for a function that computes a stat value from a `Computation`.
         using Calculator = Delegate<Real32(ConstRef<Computation>), DelegateInlineSize::Smallest>;
 
+        /// \brief Structure exposing the inputs of a compiled formula without populating a full snapshot.
+        struct Evaluation final
+        {
+            /// \brief Type alias for a function that reads a stat value from a type-erased context.
+            using StatReader  = Real32(*)(ConstPtr<void>, Stat);
+
+            /// \brief Type alias for a function that reads a token counter from a type-erased context.
+            using TokenReader = UInt32(*)(ConstPtr<void>, Token);
+
+            /// \brief Constructs an evaluation over the given contexts and stat components.
+            ///
+            /// \param Source     The source context to retrieve stat values from.
+            /// \param Target     The target context to retrieve stat values from.
+            /// \param Base       The base value of the stat.
+            /// \param Flat       The flat addition to apply to the base value.
+            /// \param Additive   The percentage addition to apply to the base value.
+            /// \param Multiplier The multiplier to apply to the base value.
+            template<typename SourceContext, typename TargetContext>
+            ZYPHRYON_INLINE Evaluation(ConstRef<SourceContext> Source, ConstRef<TargetContext> Target, Real32 Base, Real32 Flat, Real32 Additive, Real32 Multiplier)
+                : Base        { Base },
+                  Flat        { Flat },
+                  Additive    { Additive },
+                  Multiplier  { Multiplier },
+                  Source      { & Source },
+                  Target      { & Target },
+                  SourceStat  { & ReadStat<SourceContext> },
+                  TargetStat  { & ReadStat<TargetContext> },
+                  SourceToken { & ReadToken<SourceContext> },
+                  TargetToken { & ReadToken<TargetContext> }
+            {
+            }
+
+            /// \brief Retrieves a stat value from the context of the given scope.
+            ///
+            /// \param Handle The handle of the stat to retrieve.
+            /// \return The value of the stat.
+            template<StatScope Scope>
+            ZYPHRYON_INLINE Real32 GetStat(Stat Handle) const
+            {
+                return Scope == StatScope::Source ? SourceStat(Source, Handle) : TargetStat(Target, Handle);
+            }
+
+            /// \brief Retrieves a token counter from the context of the given scope.
+            ///
+            /// \param Handle The handle of the token to retrieve.
+            /// \return The counter of the token.
+            template<StatScope Scope>
+            ZYPHRYON_INLINE UInt32 GetToken(Token Handle) const
+            {
+                return Scope == StatScope::Source ? SourceToken(Source, Handle) : TargetToken(Target, Handle);
+            }
+
+            /// \brief Reads a stat value from a type-erased context.
+            template<typename Context>
+            ZYPHRYON_INLINE static Real32 ReadStat(ConstPtr<void> Instance, Stat Handle)
+            {
+                return static_cast<ConstPtr<Context>>(Instance)->GetStat(Handle);
+            }
+
+            /// \brief Reads a token counter from a type-erased context.
+            template<typename Context>
+            ZYPHRYON_INLINE static UInt32 ReadToken(ConstPtr<void> Instance, Token Handle)
+            {
+                return static_cast<ConstPtr<Context>>(Instance)->GetToken(Handle);
+            }
+
+            /// \brief The base value of the stat.
+            Real32         Base;
+
+            /// \brief The flat addition to apply to the base value.
+            Real32         Flat;
+
+            /// \brief The percentage addition to apply to the base value.
+            Real32         Additive;
+
+            /// \brief The multiplier to apply to the base value.
+            Real32         Multiplier;
+
+            /// \brief The source context.
+            ConstPtr<void> Source;
+
+            /// \brief The target context.
+            ConstPtr<void> Target;
+
+            /// \brief The stat reader of the source context.
+            StatReader     SourceStat;
+
+            /// \brief The stat reader of the target context.
+            StatReader     TargetStat;
+
+            /// \brief The token reader of the source context.
+            TokenReader    SourceToken;
+
+            /// \brief The token reader of the target context.
+            TokenReader    TargetToken;
+        };
+
+        /// \brief Type alias for a compiled function that computes a stat value from an `Evaluation`.
+        using Evaluator  = Real32(*)(ConstRef<Evaluation>);
+
     public:
 
         /// \brief Default constructor, initializes with an empty calculator.
@@ -245,6 +371,60 @@ namespace Gameplay
         {
         }
 
+        /// \brief Constructs a formula with the specified compiled function.
+        ///
+        /// \param Evaluator The compiled function used to compute the stat value.
+        ZYPHRYON_INLINE StatFormula(Evaluator Evaluator)
+            : mEvaluator { Evaluator }
+        {
+        }
+
+        /// \brief Sets the compiled function for this formula, which takes precedence over the calculator.
+        ///
+        /// \param Evaluator The compiled function used to compute the stat value.
+        ZYPHRYON_INLINE void SetEvaluator(Evaluator Evaluator)
+        {
+            mEvaluator = Evaluator;
+        }
+
+        /// \brief Checks if the formula runs a compiled function instead of a calculator.
+        ///
+        /// \return `true` if the formula is compiled, `false` otherwise.
+        ZYPHRYON_INLINE Bool IsCompiled() const
+        {
+            return mEvaluator != nullptr;
+        }
+
+        /// \brief Checks if the formula runs a bytecode program instead of a calculator.
+        ///
+        /// \return `true` if the formula has a program, `false` otherwise.
+        ZYPHRYON_INLINE Bool IsProgram() const
+        {
+            return mProgram.IsValid();
+        }
+
+        /// \brief Checks if the formula runs a bytecode program that reads no stat or token.
+        ///
+        /// \return `true` if the formula always yields the same value for the same stat components, `false` otherwise.
+        ZYPHRYON_INLINE Bool IsConstant() const
+        {
+            return !mEvaluator && mProgram.IsValid() && mProgram.IsConstant();
+        }
+
+        /// \brief Compiles a textual formula into a bytecode program and registers its dependencies.
+        ///
+        /// \param Text The formula text to compile.
+        /// \return `true` if the formula was compiled, `false` otherwise.
+        Bool Load(ConstStr8 Text);
+
+        /// \brief Retrieves the textual form of the bytecode program.
+        ///
+        /// \return The formula text, or an empty string if the formula has no program.
+        ZYPHRYON_INLINE Str8 Save() const
+        {
+            return mProgram.Decompile();
+        }
+
         /// \brief Sets the calculation function for this formula.
         ///
         /// \param Calculator The function used to compute the stat value.
@@ -296,6 +476,16 @@ namespace Gameplay
         template<typename Context>
         ZYPHRYON_INLINE Real32 Calculate(ConstRef<Context> Source, Real32 Base, Real32 Flat, Real32 Additive, Real32 Multiplier) const
         {
+            if (mEvaluator)
+            {
+                return mEvaluator(Evaluation(Source, Source, Base, Flat, Additive, Multiplier));
+            }
+
+            if (mProgram.IsValid())
+            {
+                return mProgram.Execute(Source, Source, Base, Flat, Additive, Multiplier);
+            }
+
             Computation Computation(Base, Flat, Additive, Multiplier);
             Computation.Populate(Source, mDependencies);
 
@@ -309,6 +499,16 @@ namespace Gameplay
         template<typename Context>
         ZYPHRYON_INLINE Real32 Calculate(ConstRef<Context> Source) const
         {
+            if (mEvaluator)
+            {
+                return mEvaluator(Evaluation(Source, Source, 0.0f, 0.0f, 0.0f, 1.0f));
+            }
+
+            if (mProgram.IsValid())
+            {
+                return mProgram.Execute(Source, Source, 0.0f, 0.0f, 0.0f, 1.0f);
+            }
+
             Computation Computation;
             Computation.Populate(Source, mDependencies);
 
@@ -323,6 +523,16 @@ namespace Gameplay
         template<typename Context>
         ZYPHRYON_INLINE Real32 Calculate(ConstRef<Context> Source, ConstRef<Context> Target) const
         {
+            if (mEvaluator)
+            {
+                return mEvaluator(Evaluation(Source, Target, 0.0f, 0.0f, 0.0f, 1.0f));
+            }
+
+            if (mProgram.IsValid())
+            {
+                return mProgram.Execute(Source, Target, 0.0f, 0.0f, 0.0f, 1.0f);
+            }
+
             Computation Computation;
             Computation.Populate(Source, Target, mDependencies);
 
@@ -367,7 +577,9 @@ namespace Gameplay
         // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
         // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 
-        Calculator mCalculator;
-        Graph      mDependencies;
+        Calculator  mCalculator;
+        Evaluator   mEvaluator = nullptr;
+        StatProgram mProgram;
+        Graph       mDependencies;
     };
 }
\ No newline at end of file
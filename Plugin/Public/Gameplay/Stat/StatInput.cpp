@@ -10,4 +10,161 @@
 // [  HEADER  ]
 // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 
-#include "Gameplay/Stat/StatInput.hpp"
\ No newline at end of file
+#include "Gameplay/Stat/StatInput.hpp"
+#include "Gameplay/Stat/StatLibrary.hpp"
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [   CODE   ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+namespace Gameplay
+{
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void StatInput::Load(TOMLArray Array)
+    {
+        const ConstStr8 Type = Array.GetString(0);
+
+        if (Type == "Float")
+        {
+            mBits = Pack(static_cast<Real32>(Array.GetReal(1)));
+        }
+        else if (Type == "Ref")
+        {
+            Reference Data;
+            Data.Load(Array);
+            mBits = Pack(Data);
+        }
+        else if (Type == "Formula")
+        {
+            Assign(StatLibrary::Instance().Compile(Array.GetString(1)));
+        }
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void StatInput::Save(TOMLArray Array) const
+    {
+        switch (GetKind())
+        {
+        case Kind::Float:
+            Array.AddString("Float");
+            Array.AddReal(GetValue());
+            break;
+        case Kind::Ref:
+            Array.AddString("Ref");
+            GetReference().Save(Array);
+            break;
+        case Kind::Formula:
+        {
+            ConstPtr<StatFormula> Formula = GetFormula();
+
+            Array.AddString("Formula");
+
+            if (Formula->IsProgram())
+            {
+                Array.AddString(Formula->Save());
+            }
+            else
+            {
+                LOG_WARNING("Saving formulas defined in code is not supported.");
+            }
+            break;
+        }
+        }
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void StatInput::Load(Ref<BakeReader> Reader)
+    {
+        switch (Reader.Read<Kind>())
+        {
+        case Kind::Float:
+            mBits = Pack(Reader.Read<Real32>());
+            break;
+        case Kind::Ref:
+            mBits = Pack(Reader.Read<Reference>());
+            break;
+        case Kind::Formula:
+        {
+            // Formulas are baked as source and compiled again, the only fixup that is not a plain copy.
+            Assign(StatLibrary::Instance().Compile(Reader.ReadString()));
+            break;
+        }
+        }
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void StatInput::Save(Ref<BakeWriter> Writer) const
+    {
+        Writer.Write(GetKind());
+
+        switch (GetKind())
+        {
+        case Kind::Float:
+            Writer.Write(GetValue());
+            break;
+        case Kind::Ref:
+            Writer.Write(GetReference());
+            break;
+        case Kind::Formula:
+        {
+            ConstPtr<StatFormula> Formula = GetFormula();
+
+            if (Formula->IsProgram())
+            {
+                Writer.WriteString(Formula->Save());
+            }
+            else
+            {
+                LOG_WARNING("Saving formulas defined in code is not supported.");
+                Writer.WriteString("");
+            }
+            break;
+        }
+        }
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void StatInput::Assign(Ptr<StatFormula> Formula)
+    {
+        /// \brief Context handed to constant formulas, which never read from it.
+        struct Constant final
+        {
+            /// \brief Never called, constant formulas read no stat.
+            ZYPHRYON_INLINE Real32 GetStat(Stat) const
+            {
+                return 0.0f;
+            }
+
+            /// \brief Never called, constant formulas read no token.
+            ZYPHRYON_INLINE UInt32 GetToken(Token) const
+            {
+                return 0;
+            }
+        };
+
+        if (!Formula)
+        {
+            return;
+        }
+
+        // Formulas that read no stat or token always yield the same value, so they are folded into it.
+        if (Formula->IsConstant())
+        {
+            mBits = Pack(Formula->Calculate(Constant()));
+        }
+        else
+        {
+            mBits = Pack(Formula);
+        }
+    }
+}
\ No newline at end of file
@@ -12,6 +12,8 @@
 // [  HEADER  ]
 // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 
+#include "Gameplay/Bake/BakeReader.hpp"
+#include "Gameplay/Bake/BakeWriter.hpp"
 #include "Gameplay/Stat/StatFormula.hpp"
 
 // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
@@ -21,10 +23,12 @@
 namespace Gameplay
 {
     /// \brief An expression representing a direct value, a reference to another stat, or a formula.
+    ///
+    /// The input is packed into a single 64-bit word tagged by its kind in the lowest bits, so archetypes embedding
+    /// several inputs stay compact. A value keeps its bits in the upper half, a reference packs its handle, scope,
+    /// base and coefficient, and a formula keeps its pointer, whose alignment leaves the tag bits free.
     class StatInput final
     {
-        // TODO: Refactor Formula pointer to be a handle type instead of a pointer (from 16b to 8b).
-
     public:
 
         /// \brief Defines the kind of data held by the stat input.
@@ -75,14 +79,17 @@ namespace Gameplay
 
     public:
 
-        /// \brief Default constructor, initializes an empty stat input.
-        ZYPHRYON_INLINE StatInput() = default;
+        /// \brief Default constructor, initializes a stat input holding zero.
+        ZYPHRYON_INLINE StatInput()
+            : mBits { 0 }
+        {
+        }
 
         /// \brief Constructs a stat input from a floating-point value.
         ///
         /// \param Value The floating-point value to use.
         ZYPHRYON_INLINE StatInput(Real32 Value)
-            : mContainer { Value }
+            : mBits { Pack(Value) }
         {
         }
 
@@ -93,7 +100,7 @@ namespace Gameplay
         /// \param Base        The base value applied when referencing the stat.
         /// \param Coefficient The coefficient applied to the referenced stat.
         ZYPHRYON_INLINE StatInput(Stat Handle, StatScope Scope, Real32 Base, Real32 Coefficient)
-            : mContainer { Reference { Handle, Scope, FloatToHalf(Base), FloatToHalf(Coefficient) } }
+            : mBits { Pack(Reference { Handle, Scope, FloatToHalf(Base), FloatToHalf(Coefficient) }) }
         {
         }
 
@@ -101,7 +108,7 @@ namespace Gameplay
         ///
         /// \param Formula The formula pointer to use.
         ZYPHRYON_INLINE StatInput(Ptr<StatFormula> Formula)
-            : mContainer { Formula }
+            : mBits { Pack(Formula) }
         {
         }
 
@@ -109,6 +116,7 @@ namespace Gameplay
         ///
         /// \param Array The TOML array to load from.
         ZYPHRYON_INLINE StatInput(TOMLArray Array)
+            : mBits { 0 }
         {
             Load(Array);
         }
@@ -118,16 +126,36 @@ namespace Gameplay
         /// \return The kind of data.
         ZYPHRYON_INLINE Kind GetKind() const
         {
-            return static_cast<Kind>(mContainer.GetIndex());
+            return static_cast<Kind>(mBits & kTagMask);
+        }
+
+        /// \brief Retrieves the floating-point value held by the stat input.
+        ///
+        /// \return The value, which is only meaningful if the input is a value.
+        ZYPHRYON_INLINE Real32 GetValue() const
+        {
+            return std::bit_cast<Real32>(static_cast<UInt32>(mBits >> 32));
         }
 
-        /// \brief Retrieves the underlying data of the stat input.
+        /// \brief Retrieves the stat reference held by the stat input.
         ///
-        /// \return A constant reference to the underlying data.
-        template<typename Type>
-        ZYPHRYON_INLINE ConstRef<Type> GetData() const
+        /// \return The reference, which is only meaningful if the input is a reference.
+        ZYPHRYON_INLINE Reference GetReference() const
         {
-            return mContainer.GetData<Type>();
+            Reference Result;
+            Result.Handle      = static_cast<UInt16>(mBits >> 16);
+            Result.Scope       = static_cast<StatScope>((mBits >> 8) & 0xFF);
+            Result.Base        = static_cast<Real16>(mBits >> 32);
+            Result.Coefficient = static_cast<Real16>(mBits >> 48);
+            return Result;
+        }
+
+        /// \brief Retrieves the formula held by the stat input.
+        ///
+        /// \return The formula, which is only meaningful if the input is a formula.
+        ZYPHRYON_INLINE Ptr<StatFormula> GetFormula() const
+        {
+            return reinterpret_cast<Ptr<StatFormula>>(static_cast<UInt>(mBits & ~kTagMask));
         }
 
         /// \brief Resolves the stat input using the source context.
@@ -139,15 +167,15 @@ namespace Gameplay
             switch (GetKind())
             {
             case Kind::Float:
-                return GetData<Real32>();
+                return GetValue();
             case Kind::Ref:
             {
-                ConstRef<Reference> Data = GetData<Reference>();
+                const Reference Data = GetReference();
                 return HalfToFloat(Data.Base) + Source.GetStat(Data.Handle) * HalfToFloat(Data.Coefficient);
             }
             case Kind::Formula:
             {
-                return GetData<Ptr<StatFormula>>()->Calculate(Source);
+                return GetFormula()->Calculate(Source);
             }
             }
             return 0.0f;
@@ -163,10 +191,10 @@ namespace Gameplay
             switch (GetKind())
             {
             case Kind::Float:
-                return GetData<Real32>();
+                return GetValue();
             case Kind::Ref:
             {
-                const auto [Handle, Scope, Base, Coefficient] = GetData<Reference>();
+                const auto [Handle, Scope, Base, Coefficient] = GetReference();
 
                 switch (Scope)
                 {
@@ -178,7 +206,7 @@ namespace Gameplay
             }
             case Kind::Formula:
             {
-                return GetData<Ptr<StatFormula>>()->Calculate(Source, Target);
+                return GetFormula()->Calculate(Source, Target);
             }
             }
             return 0.0f;
@@ -194,12 +222,12 @@ namespace Gameplay
             {
             case Kind::Ref:
             {
-                Action(GetData<Reference>().Handle);
+                Action(GetReference().Handle);
                 break;
             }
             case Kind::Formula:
             {
-                GetData<Ptr<StatFormula>>()->Traverse(Action);
+                GetFormula()->Traverse(Action);
                 break;
             }
             default:
@@ -218,7 +246,7 @@ namespace Gameplay
             {
             case Kind::Ref:
             {
-                ConstRef<Reference> Data = GetData<Reference>();
+                const Reference Data = GetReference();
 
                 if (Data.Scope == Scope)
                 {
@@ -228,7 +256,7 @@ namespace Gameplay
             }
             case Kind::Formula:
             {
-                GetData<Ptr<StatFormula>>()->Traverse(Action, Scope);
+                GetFormula()->Traverse(Action, Scope);
                 break;
             }
             default:
@@ -236,48 +264,40 @@ namespace Gameplay
             }
         }
 
-        /// \brief Loads the stat input from a TOML array.
+        /// \brief Checks whether the stat input reads any stat from the given scope.
         ///
-        /// \param Array The TOML array to load from.
-        ZYPHRYON_INLINE void Load(TOMLArray Array)
+        /// \param Scope The scope to check.
+        /// \return `true` if at least one dependency belongs to the scope, `false` otherwise.
+        ZYPHRYON_INLINE Bool IsScoped(StatScope Scope) const
         {
-            const ConstStr8 Type = Array.GetString(0);
+            Bool Result = false;
 
-            if (Type == "Float")
-            {
-                mContainer.Emplace<Real32>(static_cast<Real32>(Array.GetReal(1)));
-            }
-            else if (Type == "Ref")
-            {
-                mContainer.Emplace<Reference>().Load(Array);
-            }
-            else if (Type == "Formula")
+            Traverse([&Result](auto)
             {
-                LOG_WARNING("Loading formulas is not supported yet.");
-            }
+                Result = true;
+            }, Scope);
+            return Result;
         }
 
+        /// \brief Loads the stat input from a TOML array.
+        ///
+        /// \param Array The TOML array to load from.
+        void Load(TOMLArray Array);
+
         /// \brief Saves the stat input to a TOML array.
         ///
         /// \param Array The TOML array to save to.
-        ZYPHRYON_INLINE void Save(TOMLArray Array) const
-        {
-            switch (GetKind())
-            {
-            case Kind::Float:
-                Array.AddString("Float");
-                Array.AddReal(mContainer.GetData<Real32>());
-                break;
-            case Kind::Ref:
-                Array.AddString("Ref");
-                GetData<Reference>().Save(Array);
-                break;
-            case Kind::Formula:
-                Array.AddString("Formula");
-                LOG_WARNING("Saving formulas is not supported yet.");
-                break;
-            }
-        }
+        void Save(TOMLArray Array) const;
+
+        /// \brief Loads the stat input from a baked resource.
+        ///
+        /// \param Reader The baked resource to load from.
+        void Load(Ref<BakeReader> Reader);
+
+        /// \brief Saves the stat input to a baked resource.
+        ///
+        /// \param Writer The baked resource to save to.
+        void Save(Ref<BakeWriter> Writer) const;
 
     public:
 
@@ -303,11 +323,54 @@ namespace Gameplay
             return StatInput(Handle, StatScope::Target, Base, Coefficient);
         }
 
+    private:
+
+        /// \brief Assigns a compiled formula, folding it into a value when it reads nothing from its context.
+        ///
+        /// \param Formula The compiled formula, or `nullptr` to leave the input unchanged.
+        void Assign(Ptr<StatFormula> Formula);
+
+        /// \brief Mask selecting the kind tag in the packed word.
+        static constexpr UInt64 kTagMask = 0b11;
+
+        static_assert(alignof(StatFormula) > kTagMask, "Formula pointers must leave the tag bits free.");
+
+        /// \brief Packs a floating-point value.
+        ///
+        /// \param Value The value to pack.
+        /// \return The packed word.
+        ZYPHRYON_INLINE static UInt64 Pack(Real32 Value)
+        {
+            return (static_cast<UInt64>(std::bit_cast<UInt32>(Value)) << 32) | static_cast<UInt64>(Kind::Float);
+        }
+
+        /// \brief Packs a stat reference.
+        ///
+        /// \param Data The reference to pack.
+        /// \return The packed word.
+        ZYPHRYON_INLINE static UInt64 Pack(ConstRef<Reference> Data)
+        {
+            return (static_cast<UInt64>(Data.Coefficient)     << 48)
+                 | (static_cast<UInt64>(Data.Base)            << 32)
+                 | (static_cast<UInt64>(Data.Handle.GetID())  << 16)
+                 | (static_cast<UInt64>(Data.Scope)           << 8)
+                 | (static_cast<UInt64>(Kind::Ref));
+        }
+
+        /// \brief Packs a formula pointer.
+        ///
+        /// \param Formula The formula to pack.
+        /// \return The packed word.
+        ZYPHRYON_INLINE static UInt64 Pack(Ptr<StatFormula> Formula)
+        {
+            return static_cast<UInt64>(reinterpret_cast<UInt>(Formula)) | static_cast<UInt64>(Kind::Formula);
+        }
+
     private:
 
         // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
         // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 
-        Variant<Real32, Reference, Ptr<StatFormula>> mContainer;
+        UInt64 mBits;
     };
 }
\ No newline at end of file
@@ -12,7 +12,7 @@
 // [  HEADER  ]
 // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 
-#include "Gameplay/Stat/StatArchetype.hpp"
+#include "Gameplay/Stat/StatRepository.hpp"
 
 // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 // [   CODE   ]
@@ -21,19 +21,122 @@
 namespace Gameplay
 {
     /// \brief Represents an instance of a stat with its modifiers and effective value.
+    ///
+    /// The instance is a view over the columns of the owning set, indexed by the identifier of its archetype.
     class StatInstance final
     {
+    public:
+
+        /// \brief Column storage of the stats owned by a set, each column indexed by stat identifier.
+        ///
+        /// The columns are laid out back to back in a single buffer, so they are captured for rollback as one block
+        /// and only cover the stats the set actually reached instead of every archetype that could be registered.
+        struct Storage final
+        {
+            /// \brief Number of values stored per stat, one column each.
+            static constexpr UInt32 kColumns = 6;
+
+            /// \brief The flat, additive, multiplier, effective, minimum and maximum columns, `Stride` values each.
+            Vector<Real32>                        Columns;
+
+            /// \brief The number of stats covered by every column.
+            UInt32                                Stride = 0;
+
+            /// \brief The bitset of attributes whose effective value is stale.
+            Array<UInt64, StatRepository::kWords> Dirty;
+
+            /// \brief The bitset of stats whose resolved bounds are up to date.
+            Array<UInt64, StatRepository::kWords> Bounded;
+
+            /// \brief The bitset of aggregated attributes whose effective value is forced by a recorded set modifier.
+            Array<UInt64, StatRepository::kWords> Overridden;
+
+            /// \brief Retrieves the flat modifier column.
+            ///
+            /// \return A pointer to the flat modifier of the first stat.
+            ZYPHRYON_INLINE Ptr<Real32> GetFlat()
+            {
+                return Columns.data();
+            }
+
+            /// \brief Retrieves the additive modifier column.
+            ///
+            /// \return A pointer to the additive modifier of the first stat.
+            ZYPHRYON_INLINE Ptr<Real32> GetAdditive()
+            {
+                return Columns.data() + Stride;
+            }
+
+            /// \brief Retrieves the multiplier modifier column.
+            ///
+            /// \return A pointer to the multiplier modifier of the first stat.
+            ZYPHRYON_INLINE Ptr<Real32> GetMultiplier()
+            {
+                return Columns.data() + Stride * 2;
+            }
+
+            /// \brief Retrieves the effective value column.
+            ///
+            /// \return A pointer to the effective value of the first stat.
+            ZYPHRYON_INLINE Ptr<Real32> GetEffective()
+            {
+                return Columns.data() + Stride * 3;
+            }
+
+            /// \brief Retrieves the resolved minimum bound column, valid while a stat's bit in `Bounded` is set.
+            ///
+            /// \return A pointer to the minimum bound of the first stat.
+            ZYPHRYON_INLINE Ptr<Real32> GetMinimum()
+            {
+                return Columns.data() + Stride * 4;
+            }
+
+            /// \brief Retrieves the resolved maximum bound column, valid while a stat's bit in `Bounded` is set.
+            ///
+            /// \return A pointer to the maximum bound of the first stat.
+            ZYPHRYON_INLINE Ptr<Real32> GetMaximum()
+            {
+                return Columns.data() + Stride * 5;
+            }
+
+            /// \brief Grows every column to cover more stats, keeping the values of the stats already covered.
+            ///
+            /// \param Capacity The number of stats to cover, greater than the current stride.
+            ZYPHRYON_INLINE void Resize(UInt32 Capacity)
+            {
+                Vector<Real32> Grown(kColumns * Capacity, 0.0f);
+
+                for (UInt32 Column = 0; Column < kColumns; ++Column)
+                {
+                    std::copy_n(Columns.data() + Column * Stride, Stride, Grown.data() + Column * Capacity);
+                }
+                std::fill(Grown.data() + Capacity * 2 + Stride, Grown.data() + Capacity * 3, 1.0f);
+
+                Columns = Move(Grown);
+                Stride  = Capacity;
+            }
+
+            /// \brief Resets every value to the one of a stat without modifiers, keeping the columns allocated.
+            ZYPHRYON_INLINE void Reset()
+            {
+                std::ranges::fill(Columns, 0.0f);
+                std::fill_n(GetMultiplier(), Stride, 1.0f);
+
+                Dirty.fill(0);
+                Bounded.fill(0);
+                Overridden.fill(0);
+            }
+        };
+
     public:
 
         /// \brief Constructs a stat instance based on the provided archetype.
         ///
         /// \param Archetype The archetype defining the stat's properties.
-        ZYPHRYON_INLINE StatInstance(ConstRef<StatArchetype> Archetype)
-            : mArchetype  { & Archetype },
-              mFlat       { 0.0f },
-              mAdditive   { 0.0f },
-              mMultiplier { 1.0f },
-              mEffective  { 0.0f }
+        /// \param Storage   The columns holding the stat's modifiers and effective value.
+        ZYPHRYON_INLINE StatInstance(ConstRef<StatArchetype> Archetype, Ref<Storage> Storage)
+            : mArchetype { & Archetype },
+              mStorage   { & Storage }
         {
         }
 
@@ -50,7 +153,7 @@ namespace Gameplay
         /// \param Flat The flat value to assign.
         ZYPHRYON_INLINE void SetFlat(Real32 Flat)
         {
-            mFlat  = Flat;
+            mStorage->GetFlat()[GetIndex()] = Flat;
         }
 
         /// \brief Retrieves the flat modifier of this stat.
@@ -58,7 +161,7 @@ namespace Gameplay
         /// \return The flat modifier value.
         ZYPHRYON_INLINE Real32 GetFlat() const
         {
-            return mFlat;
+            return mStorage->GetFlat()[GetIndex()];
         }
 
         /// \brief Sets the additive modifier for this stat.
@@ -66,7 +169,7 @@ namespace Gameplay
         /// \param Additive The additive value to assign.
         ZYPHRYON_INLINE void SetAdditive(Real32 Additive)
         {
-            mAdditive = Additive;
+            mStorage->GetAdditive()[GetIndex()] = Additive;
         }
 
         /// \brief Retrieves the additive modifier of this stat.
@@ -74,7 +177,7 @@ namespace Gameplay
         /// \return The additive modifier value.
         ZYPHRYON_INLINE Real32 GetAdditive() const
         {
-            return mAdditive;
+            return mStorage->GetAdditive()[GetIndex()];
         }
 
         /// \brief Sets the multiplier modifier for this stat.
@@ -82,7 +185,7 @@ namespace Gameplay
         /// \param Multiplier The multiplier value to assign.
         ZYPHRYON_INLINE void SetMultiplier(Real32 Multiplier)
         {
-            mMultiplier = Multiplier;
+            mStorage->GetMultiplier()[GetIndex()] = Multiplier;
         }
 
         /// \brief Retrieves the multiplier modifier of this stat.
@@ -90,20 +193,38 @@ namespace Gameplay
         /// \return The multiplier modifier value.
         ZYPHRYON_INLINE Real32 GetMultiplier() const
         {
-            return mMultiplier;
+            return mStorage->GetMultiplier()[GetIndex()];
         }
 
         /// \brief Directly sets and clamps the effective value to min/max using the provided context.
         ///
+        /// \note The bounds are only resolved again once the stat has been invalidated since they were cached.
+        ///
         /// \param Target    The context providing access to other stats if needed.
         /// \param Effective The effective value to assign.
         template<typename Context>
         ZYPHRYON_INLINE void SetEffective(ConstRef<Context> Target, Real32 Effective)
         {
-            const Real32 Minimum = mArchetype->GetMinimum().Resolve(Target);
-            const Real32 Maximum = mArchetype->GetMaximum().Resolve(Target);
+            const UInt32 Index = GetIndex();
+
+            if (!((mStorage->Bounded[Index / 64] >> (Index % 64)) & 1))
+            {
+                mStorage->GetMinimum()[Index] = mArchetype->GetMinimum().Resolve(Target);
+                mStorage->GetMaximum()[Index] = mArchetype->GetMaximum().Resolve(Target);
+                mStorage->Bounded[Index / 64] |= (1ull << (Index % 64));
+            }
 
-            mEffective = Clamp(Effective, Minimum, Maximum);
+            mStorage->GetEffective()[Index] = Clamp(Effective, mStorage->GetMinimum()[Index], mStorage->GetMaximum()[Index]);
+            Clean();
+        }
+
+        /// \brief Directly sets the effective value, which the caller has already clamped.
+        ///
+        /// \param Effective The effective value to assign.
+        ZYPHRYON_INLINE void SetEffective(Real32 Effective)
+        {
+            mStorage->GetEffective()[GetIndex()] = Effective;
+            Clean();
         }
 
         /// \brief Retrieves the current effective value of this stat without recalculating.
@@ -111,7 +232,98 @@ namespace Gameplay
         /// \return The effective stat value.
         ZYPHRYON_INLINE Real32 GetEffective() const
         {
-            return mEffective;
+            return mStorage->GetEffective()[GetIndex()];
+        }
+
+        /// \brief Retrieves the effective value of this stat, recalculating it first if it is stale.
+        ///
+        /// \param Target The context providing access to other stats if needed.
+        /// \return The up to date effective stat value.
+        template<typename Context>
+        ZYPHRYON_INLINE Real32 GetEffective(ConstRef<Context> Target)
+        {
+            return IsDirty() ? Resolve(Target) : GetEffective();
+        }
+
+        /// \brief Calculates the up to date effective value of this stat without storing it.
+        ///
+        /// \note Only reads the columns, so it is safe from any thread reading the owning set. A stale value is
+        ///       calculated again on every call until the owner resolves it.
+        ///
+        /// \param Target The context providing access to other stats if needed.
+        /// \return The up to date effective stat value.
+        template<typename Context>
+        ZYPHRYON_INLINE Real32 Evaluate(ConstRef<Context> Target) const
+        {
+            const UInt32 Index = GetIndex();
+
+            if (IsDirty())
+            {
+                return mArchetype->Calculate(Target, mStorage->GetFlat()[Index], mStorage->GetAdditive()[Index],
+                                             mStorage->GetMultiplier()[Index]);
+            }
+            return mStorage->GetEffective()[Index];
+        }
+
+        /// \brief Checks if a modifier changed since the effective value was last calculated.
+        ///
+        /// \return `true` if the effective value is stale, `false` otherwise.
+        ZYPHRYON_INLINE Bool IsDirty() const
+        {
+            const UInt32 Index = GetIndex();
+            return (mStorage->Dirty[Index / 64] >> (Index % 64)) & 1;
+        }
+
+        /// \brief Checks if the effective value is forced by a set modifier recorded in the ledger of the stat.
+        ///
+        /// \return `true` if the effective value is overridden, `false` otherwise.
+        ZYPHRYON_INLINE Bool IsOverridden() const
+        {
+            const UInt32 Index = GetIndex();
+            return (mStorage->Overridden[Index / 64] >> (Index % 64)) & 1;
+        }
+
+        /// \brief Marks whether the effective value is forced by a set modifier, so it is never recalculated.
+        ///
+        /// \param Overridden `true` if a set modifier forces the value, `false` once none remains.
+        ZYPHRYON_INLINE void SetOverridden(Bool Overridden)
+        {
+            const UInt32 Index = GetIndex();
+
+            if (Overridden)
+            {
+                mStorage->Overridden[Index / 64] |= (1ull << (Index % 64));
+            }
+            else
+            {
+                mStorage->Overridden[Index / 64] &= ~(1ull << (Index % 64));
+            }
+        }
+
+        /// \brief Marks the effective value as stale, so the next read recalculates it.
+        ///
+        /// Only attributes are derived from their modifiers, resources and progressions are left untouched. The cached
+        /// bounds of every kind are dropped, since the dependencies that reach the stat include those of its bounds.
+        /// Overridden attributes keep their forced value, clamped when the override was recorded.
+        ///
+        /// \return `false` if the stat was already stale, `true` otherwise.
+        ZYPHRYON_INLINE Bool Invalidate()
+        {
+            const UInt32 Index = GetIndex();
+            mStorage->Bounded[Index / 64] &= ~(1ull << (Index % 64));
+
+            if (mArchetype->GetKind() != StatKind::Attribute || IsOverridden())
+            {
+                return true;
+            }
+
+            if (IsDirty())
+            {
+                return false;
+            }
+
+            mStorage->Dirty[Index / 64] |= (1ull << (Index % 64));
+            return true;
         }
 
         /// \brief Recalculates and updates the effective value based on the current modifiers and archetype formula.
@@ -121,11 +333,18 @@ namespace Gameplay
         template<typename Context>
         ZYPHRYON_INLINE Real32 Resolve(ConstRef<Context> Target)
         {
-            if (mArchetype->GetKind() == StatKind::Attribute)
+            const UInt32 Index = GetIndex();
+
+            if (mArchetype->GetKind() == StatKind::Attribute && !IsOverridden())
             {
-                mEffective = mArchetype->Calculate(Target, mFlat, mAdditive, mMultiplier);
+                Trace::Increment(TraceCounter::Recomputes);
+
+                mStorage->GetEffective()[Index] = mArchetype->Calculate(Target, mStorage->GetFlat()[Index],
+                                                                        mStorage->GetAdditive()[Index],
+                                                                        mStorage->GetMultiplier()[Index]);
+                Clean();
             }
-            return mEffective;
+            return mStorage->GetEffective()[Index];
         }
 
         /// \brief Applies a modification to the stat based on the specified operator and amount.
@@ -150,33 +369,73 @@ namespace Gameplay
             Modify<false>(Target, Operation, Magnitude);
         }
 
-        /// \brief Checks if this stat instance corresponds to the given stat handle.
+        /// \brief Replaces a previously applied modification with a new one in a single step.
         ///
-        /// \param Handle The stat handle to compare with.
-        /// \return `true` if the stat instance matches the handle, `false` otherwise.
-        ZYPHRYON_INLINE Bool operator==(Stat Handle) const
+        /// \note Equivalent to reverting the previous magnitude and applying the current one.
+        ///
+        /// \param Target    The context providing access to other stats if needed.
+        /// \param Operation The type of modification to replace.
+        /// \param Previous  The amount previously applied.
+        /// \param Current   The amount to apply instead.
+        template<typename Context>
+        ZYPHRYON_INLINE void Exchange(ConstRef<Context> Target, StatOp Operation, Real32 Previous, Real32 Current)
         {
-            return mArchetype->GetHandle() == Handle;
+            const UInt32 Index = GetIndex();
+
+            // Resources and progressions can't be reverted, so the new magnitude is applied in full.
+            if (mArchetype->GetKind() != StatKind::Attribute)
+            {
+                Modify<true>(Target, Operation, Current);
+                return;
+            }
+
+            switch (Operation)
+            {
+            case StatOp::Add:
+                mStorage->GetFlat()[Index] += Current - Previous;
+                Invalidate();
+                break;
+            case StatOp::Percent:
+                mStorage->GetAdditive()[Index] += Current - Previous;
+                Invalidate();
+                break;
+            case StatOp::Scale:
+                mStorage->GetMultiplier()[Index] *= Current / Previous;
+                Invalidate();
+                break;
+            case StatOp::Set:
+                SetEffective(Target, Current);
+                break;
+            }
         }
 
-        /// \brief Checks if this stat instance corresponds to the given stat archetype.
+        /// \brief Checks whether replacing a modification would leave the stat unchanged.
         ///
-        /// \param Archetype The stat archetype to compare with.
-        /// \return `true` if the stat instance matches the archetype, `false` otherwise.
-        ZYPHRYON_INLINE Bool operator==(ConstRef<StatArchetype> Archetype) const
+        /// \param Operation The type of modification to replace.
+        /// \param Previous  The amount previously applied.
+        /// \param Current   The amount to apply instead.
+        /// \return `true` if the exchange can be skipped, `false` otherwise.
+        ZYPHRYON_INLINE Bool IsNeutral(StatOp Operation, Real32 Previous, Real32 Current) const
         {
-            return mArchetype->GetHandle() == Archetype.GetHandle();
+            return mArchetype->GetKind() == StatKind::Attribute && Operation != StatOp::Set && Previous == Current;
         }
 
-        /// \brief Computes a hash value for the stat instance based on its archetype.
+    private:
+
+        /// \brief Retrieves the column index of this stat.
         ///
-        /// \return A hash value uniquely representing the stat instance.
-        ZYPHRYON_INLINE UInt64 Hash() const
+        /// \return The identifier of the stat archetype.
+        ZYPHRYON_INLINE UInt32 GetIndex() const
         {
-            return mArchetype->Hash();
+            return mArchetype->GetHandle().GetID();
         }
 
-    private:
+        /// \brief Clears the stale flag of this stat once its effective value is up to date.
+        ZYPHRYON_INLINE void Clean()
+        {
+            const UInt32 Index = GetIndex();
+            mStorage->Dirty[Index / 64] &= ~(1ull << (Index % 64));
+        }
 
         /// \brief Modifies the stat based on the specified operator and amount, applying or reverting the change.
         ///
@@ -186,19 +445,24 @@ namespace Gameplay
         template<Bool Apply, typename Context>
         void Modify(ConstRef<Context> Target, StatOp Operation, Real32 Magnitude)
         {
+            const UInt32 Index = GetIndex();
+
             switch (mArchetype->GetKind())
             {
             case StatKind::Attribute:
                 switch (Operation)
                 {
                 case StatOp::Add:
-                    mFlat += Apply ? Magnitude : -Magnitude;
+                    mStorage->GetFlat()[Index] += Apply ? Magnitude : -Magnitude;
+                    Invalidate();
                     break;
                 case StatOp::Percent:
-                    mAdditive += Apply ? Magnitude : -Magnitude;
+                    mStorage->GetAdditive()[Index] += Apply ? Magnitude : -Magnitude;
+                    Invalidate();
                     break;
                 case StatOp::Scale:
-                    mMultiplier *= Apply ? Magnitude : 1.0f / Magnitude;
+                    mStorage->GetMultiplier()[Index] *= Apply ? Magnitude : 1.0f / Magnitude;
+                    Invalidate();
                     break;
                 case StatOp::Set:
                     if constexpr (Apply)
@@ -215,13 +479,13 @@ namespace Gameplay
                     switch (Operation)
                     {
                     case StatOp::Add:
-                        SetEffective(Target, mEffective + Magnitude);
+                        SetEffective(Target, mStorage->GetEffective()[Index] + Magnitude);
                         break;
                     case StatOp::Percent:
-                        SetEffective(Target, mEffective * (1.0f + Magnitude));
+                        SetEffective(Target, mStorage->GetEffective()[Index] * (1.0f + Magnitude));
                         break;
                     case StatOp::Scale:
-                        SetEffective(Target, mEffective * Magnitude);
+                        SetEffective(Target, mStorage->GetEffective()[Index] * Magnitude);
                         break;
                     case StatOp::Set:
                         SetEffective(Target, Magnitude);
@@ -238,9 +502,6 @@ namespace Gameplay
         // -=-=-=-=-=-=-=-=-=-=-=-=-=-==-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 
         ConstPtr<StatArchetype> mArchetype;
-        Real32                  mFlat;
-        Real32                  mAdditive;
-        Real32                  mMultiplier;
-        Real32                  mEffective;
+        Ptr<Storage>            mStorage;
     };
 }
\ No newline at end of file
@@ -0,0 +1,177 @@
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// Copyright (C) 2025 by Agustin L. Alvarez. All rights reserved.
+//
+// This work is licensed under the terms of the MIT license.
+//
+// For a copy, see <https://opensource.org/licenses/MIT>.
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [  HEADER  ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#include "Gameplay/Stat/StatLedger.hpp"
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [   CODE   ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+namespace Gameplay
+{
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void StatLedger::Insert(UInt32 Source, StatOp Operation, Real32 Magnitude)
+    {
+        // Loose set modifiers are still recorded, so they can be reverted like any other.
+        if (Source == kLoose && Operation != StatOp::Set)
+        {
+            Fold(Operation, Magnitude, true);
+            return;
+        }
+
+        if (const Ptr<Bucket> Entry = Find(Source, Operation))
+        {
+            switch (Operation)
+            {
+            case StatOp::Add:
+            case StatOp::Percent:
+                Entry->Magnitude += Magnitude;
+                break;
+            case StatOp::Scale:
+                Entry->Magnitude *= Magnitude;
+                break;
+            case StatOp::Set:
+                Entry->Magnitude = Magnitude;
+                break;
+            }
+            ++Entry->Count;
+        }
+        else
+        {
+            mBuckets.push_back(Bucket { Source, Operation, 1, Magnitude });
+        }
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void StatLedger::Remove(UInt32 Source, StatOp Operation, Real32 Magnitude)
+    {
+        if (Source == kLoose && Operation != StatOp::Set)
+        {
+            Fold(Operation, Magnitude, false);
+            return;
+        }
+
+        const Ptr<Bucket> Entry = Find(Source, Operation);
+
+        if (!Entry)
+        {
+            LOG_WARNING("Removing a modifier that was never recorded in the ledger.");
+            return;
+        }
+
+        if (--Entry->Count == 0)
+        {
+            // Preserve the application order, the latest set modifier overrides the earlier ones.
+            mBuckets.erase(mBuckets.begin() + (Entry - mBuckets.data()));
+        }
+        else
+        {
+            switch (Operation)
+            {
+            case StatOp::Add:
+            case StatOp::Percent:
+                Entry->Magnitude -= Magnitude;
+                break;
+            case StatOp::Scale:
+                Entry->Magnitude /= Magnitude;
+                break;
+            case StatOp::Set:
+                break;
+            }
+        }
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void StatLedger::Exchange(UInt32 Source, StatOp Operation, Real32 Previous, Real32 Current)
+    {
+        const Ptr<Bucket> Entry = (Source == kLoose && Operation != StatOp::Set ? nullptr : Find(Source, Operation));
+
+        // A bucket holding a single modifier takes the new magnitude as is, without accumulating any rounding.
+        if (Entry && Entry->Count == 1)
+        {
+            Entry->Magnitude = Current;
+        }
+        else
+        {
+            Remove(Source, Operation, Previous);
+            Insert(Source, Operation, Current);
+        }
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void StatLedger::Load(Ref<BakeReader> Reader)
+    {
+        mFlat       = Reader.Read<Real32>();
+        mAdditive   = Reader.Read<Real32>();
+        mMultiplier = Reader.Read<Real32>();
+
+        mBuckets.clear();
+
+        for (UInt32 Element = 0, Count = Reader.Read<UInt32>(); Element < Count && Reader.IsValid(); ++Element)
+        {
+            Ref<Bucket> Entry = mBuckets.emplace_back();
+            Entry.Source    = Reader.Read<UInt32>();
+            Entry.Operation = Reader.Read<StatOp>();
+            Entry.Count     = Reader.Read<UInt16>();
+            Entry.Magnitude = Reader.Read<Real32>();
+        }
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void StatLedger::Save(Ref<BakeWriter> Writer) const
+    {
+        Writer.Write(mFlat);
+        Writer.Write(mAdditive);
+        Writer.Write(mMultiplier);
+        Writer.Write(static_cast<UInt32>(mBuckets.size()));
+
+        // Buckets are written one field at a time, so their padding never reaches the snapshot.
+        for (ConstRef<Bucket> Entry : mBuckets)
+        {
+            Writer.Write(Entry.Source);
+            Writer.Write(Entry.Operation);
+            Writer.Write(Entry.Count);
+            Writer.Write(Entry.Magnitude);
+        }
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void StatLedger::Fold(StatOp Operation, Real32 Magnitude, Bool Apply)
+    {
+        switch (Operation)
+        {
+        case StatOp::Add:
+            mFlat += Apply ? Magnitude : -Magnitude;
+            break;
+        case StatOp::Percent:
+            mAdditive += Apply ? Magnitude : -Magnitude;
+            break;
+        case StatOp::Scale:
+            mMultiplier *= Apply ? Magnitude : 1.0f / Magnitude;
+            break;
+        case StatOp::Set:
+            break;
+        }
+    }
+}
\ No newline at end of file
@@ -0,0 +1,200 @@
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// Copyright (C) 2025 by Agustin L. Alvarez. All rights reserved.
+//
+// This work is licensed under the terms of the MIT license.
+//
+// For a copy, see <https://opensource.org/licenses/MIT>.
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#pragma once
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [  HEADER  ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#include "Gameplay/Bake/BakeReader.hpp"
+#include "Gameplay/Bake/BakeWriter.hpp"
+#include "Gameplay/Stat/StatTypes.hpp"
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [   CODE   ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+namespace Gameplay
+{
+    /// \brief Records the modifiers applied to an attribute, grouped in one bucket per source and operation.
+    ///
+    /// Removing a source drops its bucket and the totals are summed again from the remaining ones, so stacking
+    /// and removing scale modifiers never drifts and set modifiers can be reverted. Modifiers without a source
+    /// are folded into a loose part that behaves like the plain attribute columns, except for set modifiers.
+    class StatLedger final
+    {
+        /// \brief Source reserved for modifiers that are not tracked individually.
+        static constexpr UInt32 kLoose = 0;
+
+    public:
+
+        /// \brief Represents the modifiers of a single source and operation.
+        struct Bucket final
+        {
+            /// \brief The source that applied the modifiers.
+            UInt32 Source;
+
+            /// \brief The operation of the modifiers.
+            StatOp Operation;
+
+            /// \brief The number of modifiers folded into the bucket.
+            UInt16 Count;
+
+            /// \brief The combined magnitude of the modifiers.
+            Real32 Magnitude;
+        };
+
+    public:
+
+        /// \brief Default constructor, initializes an empty ledger.
+        ZYPHRYON_INLINE StatLedger()
+            : mFlat       { 0.0f },
+              mAdditive   { 0.0f },
+              mMultiplier { 1.0f }
+        {
+        }
+
+        /// \brief Records a modifier applied by the given source.
+        ///
+        /// \param Source    The source applying the modifier, or `0` to fold it into the loose part.
+        /// \param Operation The operation of the modifier.
+        /// \param Magnitude The magnitude of the modifier.
+        void Insert(UInt32 Source, StatOp Operation, Real32 Magnitude);
+
+        /// \brief Removes a modifier previously applied by the given source.
+        ///
+        /// \note The bucket is dropped once its last modifier is removed, discarding any rounding it accumulated.
+        ///
+        /// \param Source    The source that applied the modifier, or `0` to unfold it from the loose part.
+        /// \param Operation The operation of the modifier.
+        /// \param Magnitude The magnitude of the modifier.
+        void Remove(UInt32 Source, StatOp Operation, Real32 Magnitude);
+
+        /// \brief Replaces a modifier previously applied by the given source with a new magnitude.
+        ///
+        /// \param Source    The source that applied the modifier, or `0` to replace it in the loose part.
+        /// \param Operation The operation of the modifier.
+        /// \param Previous  The magnitude previously applied.
+        /// \param Current   The magnitude to apply instead.
+        void Exchange(UInt32 Source, StatOp Operation, Real32 Previous, Real32 Current);
+
+        /// \brief Sums the flat modifiers of every source.
+        ///
+        /// \return The total flat modifier.
+        ZYPHRYON_INLINE Real32 GetFlat() const
+        {
+            Real32 Total = mFlat;
+
+            for (ConstRef<Bucket> Entry : mBuckets)
+            {
+                Total += (Entry.Operation == StatOp::Add ? Entry.Magnitude : 0.0f);
+            }
+            return Total;
+        }
+
+        /// \brief Sums the additive modifiers of every source.
+        ///
+        /// \return The total additive modifier.
+        ZYPHRYON_INLINE Real32 GetAdditive() const
+        {
+            Real32 Total = mAdditive;
+
+            for (ConstRef<Bucket> Entry : mBuckets)
+            {
+                Total += (Entry.Operation == StatOp::Percent ? Entry.Magnitude : 0.0f);
+            }
+            return Total;
+        }
+
+        /// \brief Multiplies the scale modifiers of every source.
+        ///
+        /// \return The total multiplier.
+        ZYPHRYON_INLINE Real32 GetMultiplier() const
+        {
+            Real32 Total = mMultiplier;
+
+            for (ConstRef<Bucket> Entry : mBuckets)
+            {
+                Total *= (Entry.Operation == StatOp::Scale ? Entry.Magnitude : 1.0f);
+            }
+            return Total;
+        }
+
+        /// \brief Retrieves the value forced by the most recent set modifier still applied, if any.
+        ///
+        /// \param Value Receives the forced value when one is found.
+        /// \return `true` if a set modifier is still applied, `false` otherwise.
+        ZYPHRYON_INLINE Bool GetOverride(Ref<Real32> Value) const
+        {
+            for (auto Iterator = mBuckets.rbegin(); Iterator != mBuckets.rend(); ++Iterator)
+            {
+                if (Iterator->Operation == StatOp::Set)
+                {
+                    Value = Iterator->Magnitude;
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        /// \brief Checks if the ledger holds no modifier at all.
+        ///
+        /// \return `true` if the ledger is empty, `false` otherwise.
+        ZYPHRYON_INLINE Bool IsEmpty() const
+        {
+            return mBuckets.empty() && mFlat == 0.0f && mAdditive == 0.0f && mMultiplier == 1.0f;
+        }
+
+        /// \brief Loads the ledger from a baked resource.
+        ///
+        /// \param Reader The baked resource to load from.
+        void Load(Ref<BakeReader> Reader);
+
+        /// \brief Saves the ledger to a baked resource.
+        ///
+        /// \param Writer The baked resource to save to.
+        void Save(Ref<BakeWriter> Writer) const;
+
+    private:
+
+        /// \brief Finds the bucket of the given source and operation.
+        ///
+        /// \param Source    The source to look for.
+        /// \param Operation The operation to look for.
+        /// \return A pointer to the bucket, or `nullptr` if the source has no modifier of that operation.
+        ZYPHRYON_INLINE Ptr<Bucket> Find(UInt32 Source, StatOp Operation)
+        {
+            for (Ref<Bucket> Entry : mBuckets)
+            {
+                if (Entry.Source == Source && Entry.Operation == Operation)
+                {
+                    return &Entry;
+                }
+            }
+            return nullptr;
+        }
+
+        /// \brief Folds a modifier into the loose part, or unfolds it when reverting.
+        ///
+        /// \param Operation The operation of the modifier.
+        /// \param Magnitude The magnitude of the modifier.
+        /// \param Apply     `true` to fold the modifier in, `false` to unfold it.
+        void Fold(StatOp Operation, Real32 Magnitude, Bool Apply);
+
+    private:
+
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+        Real32         mFlat;
+        Real32         mAdditive;
+        Real32         mMultiplier;
+        Vector<Bucket> mBuckets;
+    };
+}
\ No newline at end of file
@@ -0,0 +1,66 @@
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// Copyright (C) 2025 by Agustin L. Alvarez. All rights reserved.
+//
+// This work is licensed under the terms of the MIT license.
+//
+// For a copy, see <https://opensource.org/licenses/MIT>.
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#pragma once
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [  HEADER  ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#include "Gameplay/Stat/StatFormula.hpp"
+
+#ifndef GAMEPLAY_MAX_STAT_FORMULAS
+    #define GAMEPLAY_MAX_STAT_FORMULAS 512
+#endif
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [   CODE   ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+namespace Gameplay
+{
+    /// \brief Owns the formulas loaded from data, compiling each distinct formula text exactly once.
+    class StatLibrary final
+    {
+    public:
+
+        /// \brief Maximum number of distinct formulas that can be loaded.
+        static constexpr UInt32 kMaxFormulas = GAMEPLAY_MAX_STAT_FORMULAS;
+
+    public:
+
+        /// \brief Retrieves the formula compiled from the given text, compiling it on first use.
+        ///
+        /// \param Text The formula text to compile.
+        /// \return The compiled formula, or `nullptr` if the text is malformed or the library is full.
+        Ptr<StatFormula> Compile(ConstStr8 Text);
+
+        /// \brief Releases all formulas, invalidating every pointer previously returned.
+        void Clear();
+
+    public:
+
+        /// \brief Retrieves the singleton instance of the library.
+        ///
+        /// \return A reference to the singleton library instance.
+        ZYPHRYON_INLINE static Ref<StatLibrary> Instance()
+        {
+            static StatLibrary Singleton;
+            return Singleton;
+        }
+
+    private:
+
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+        Pool<StatFormula, kMaxFormulas> mFormulas;
+        TextTable<UInt32>               mIndex;
+        std::mutex                      mMutex;
+    };
+}
\ No newline at end of file
@@ -0,0 +1,106 @@
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// Copyright (C) 2025 by Agustin L. Alvarez. All rights reserved.
+//
+// This work is licensed under the terms of the MIT license.
+//
+// For a copy, see <https://opensource.org/licenses/MIT>.
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#pragma once
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [  HEADER  ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#include "Gameplay/Stat/Stat.hpp"
+#include "Gameplay/Token/Token.hpp"
+
+#ifndef GAMEPLAY_STAT_MEMO_CAPACITY
+    #define GAMEPLAY_STAT_MEMO_CAPACITY 8
+#endif
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [   CODE   ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+namespace Gameplay
+{
+    /// \brief A short-lived context that remembers the stats read from another context.
+    ///
+    /// Meant to live for a single effect application or ability activation, where the same few stats are read by
+    /// several inputs in a row. Every input resolved through the memo sees the value a stat had on its first read,
+    /// even if a modifier landed on it in between. Stats read once the memo is full are forwarded without caching.
+    template<typename Context>
+    class StatMemo final
+    {
+    public:
+
+        /// \brief Maximum number of stats remembered by the memo.
+        static constexpr UInt32 kCapacity = GAMEPLAY_STAT_MEMO_CAPACITY;
+
+    public:
+
+        /// \brief Constructs an empty memo over the given context.
+        ///
+        /// \param Owner The context to read stats and tokens from, which must outlive the memo.
+        ZYPHRYON_INLINE explicit StatMemo(ConstRef<Context> Owner)
+            : mOwner { & Owner },
+              mSize  { 0 }
+        {
+        }
+
+        /// \brief Retrieves the context the memo reads from.
+        ///
+        /// \return The underlying context.
+        ZYPHRYON_INLINE ConstRef<Context> GetOwner() const
+        {
+            return * mOwner;
+        }
+
+        /// \brief Retrieves the value of a stat, reading it from the context only on its first access.
+        ///
+        /// \param Handle The handle of the stat to retrieve.
+        /// \return The value of the stat.
+        ZYPHRYON_INLINE Real32 GetStat(Stat Handle) const
+        {
+            for (UInt32 Index = 0; Index < mSize; ++Index)
+            {
+                if (mKeys[Index] == Handle)
+                {
+                    return mValues[Index];
+                }
+            }
+
+            const Real32 Value = mOwner->GetStat(Handle);
+
+            if (mSize < kCapacity)
+            {
+                mKeys[mSize]   = Handle;
+                mValues[mSize] = Value;
+                ++mSize;
+            }
+            return Value;
+        }
+
+        /// \brief Retrieves the count of a token from the context.
+        ///
+        /// \note Token counts are a single table lookup, so they are not remembered.
+        ///
+        /// \param Handle The handle of the token to retrieve.
+        /// \return The count of the token.
+        ZYPHRYON_INLINE UInt32 GetToken(Token Handle) const
+        {
+            return mOwner->GetToken(Handle);
+        }
+
+    private:
+
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+        ConstPtr<Context>                mOwner;
+        mutable UInt32                   mSize;
+        mutable Array<Stat, kCapacity>   mKeys;
+        mutable Array<Real32, kCapacity> mValues;
+    };
+}
\ No newline at end of file
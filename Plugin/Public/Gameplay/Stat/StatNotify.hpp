@@ -0,0 +1,225 @@
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// Copyright (C) 2025 by Agustin L. Alvarez. All rights reserved.
+//
+// This work is licensed under the terms of the MIT license.
+//
+// For a copy, see <https://opensource.org/licenses/MIT>.
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#pragma once
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [  HEADER  ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#include "Gameplay/Bake/BakeReader.hpp"
+#include "Gameplay/Bake/BakeWriter.hpp"
+#include <cmath>
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [   CODE   ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+namespace Gameplay
+{
+    /// \brief Defines which changes of a stat are notable enough to be reported to listeners.
+    ///
+    /// Changes are measured against the value last reported, so a stat drifting in small steps is still reported
+    /// once the accumulated change becomes notable.
+    class StatNotify final
+    {
+    public:
+
+        /// \brief Maximum number of thresholds a policy can have.
+        static constexpr UInt32 kMaxThresholds = 4;
+
+        /// \brief Defines how changes are filtered.
+        enum class Mode : UInt8
+        {
+            Always,     ///< Every change is reported.
+            Absolute,   ///< Changes are reported once they reach the tolerance.
+            Relative,   ///< Changes are reported once they reach the tolerance times the value last reported.
+            Quantize,   ///< Changes are reported when the value moves into another step of tolerance size.
+            Threshold,  ///< Changes are reported when the value crosses a threshold, as a fraction of the maximum.
+        };
+
+    public:
+
+        /// \brief Default constructor, reports every change.
+        ZYPHRYON_INLINE StatNotify()
+            : mMode      { Mode::Always },
+              mTolerance { 0.0f }
+        {
+        }
+
+        /// \brief Sets the mode used to filter changes.
+        ///
+        /// \param Mode The mode to assign.
+        ZYPHRYON_INLINE void SetMode(Mode Mode)
+        {
+            mMode = Mode;
+        }
+
+        /// \brief Retrieves the mode used to filter changes.
+        ///
+        /// \return The filter mode.
+        ZYPHRYON_INLINE Mode GetMode() const
+        {
+            return mMode;
+        }
+
+        /// \brief Sets the tolerance, or step size, of the filter.
+        ///
+        /// \param Tolerance The tolerance to assign.
+        ZYPHRYON_INLINE void SetTolerance(Real32 Tolerance)
+        {
+            mTolerance = Tolerance;
+        }
+
+        /// \brief Retrieves the tolerance, or step size, of the filter.
+        ///
+        /// \return The filter tolerance.
+        ZYPHRYON_INLINE Real32 GetTolerance() const
+        {
+            return mTolerance;
+        }
+
+        /// \brief Sets the thresholds whose crossings are reported, as fractions of the maximum.
+        ///
+        /// \param Thresholds A span of thresholds to assign.
+        ZYPHRYON_INLINE void SetThresholds(ConstSpan<Real32> Thresholds)
+        {
+            mThresholds.assign(Thresholds.begin(), Thresholds.end());
+        }
+
+        /// \brief Retrieves the thresholds whose crossings are reported, as fractions of the maximum.
+        ///
+        /// \return A span of thresholds.
+        ZYPHRYON_INLINE ConstSpan<Real32> GetThresholds() const
+        {
+            return mThresholds;
+        }
+
+        /// \brief Checks whether every change is reported.
+        ///
+        /// \return `true` if changes are not filtered, `false` otherwise.
+        ZYPHRYON_INLINE Bool IsAlways() const
+        {
+            return mMode == Mode::Always;
+        }
+
+        /// \brief Checks whether a change is notable enough to be reported.
+        ///
+        /// \param Reported The value last reported.
+        /// \param Current  The current value.
+        /// \param Maximum  The maximum of the stat, only read by threshold policies.
+        /// \return `true` if the change should be reported, `false` otherwise.
+        ZYPHRYON_INLINE Bool IsNotable(Real32 Reported, Real32 Current, Real32 Maximum) const
+        {
+            if (Current == Reported)
+            {
+                return false;
+            }
+
+            switch (mMode)
+            {
+            case Mode::Absolute:
+                return Abs(Current - Reported) >= mTolerance;
+            case Mode::Relative:
+                return Abs(Current - Reported) >= mTolerance * Abs(Reported);
+            case Mode::Quantize:
+                return mTolerance <= 0.0f || std::floor(Current / mTolerance) != std::floor(Reported / mTolerance);
+            case Mode::Threshold:
+                for (const Real32 Threshold : mThresholds)
+                {
+                    if ((Reported < Threshold * Maximum) != (Current < Threshold * Maximum))
+                    {
+                        return true;
+                    }
+                }
+                return false;
+            default:
+                return true;
+            }
+        }
+
+        /// \brief Loads the notification policy from a TOML section.
+        ///
+        /// \param Section The TOML section to load from.
+        ZYPHRYON_INLINE void Load(TOMLSection Section)
+        {
+            mMode      = Section.GetEnum("Mode", Mode::Always);
+            mTolerance = Section.GetReal("Tolerance");
+            mThresholds.clear();
+
+            const TOMLArray Thresholds = Section.GetArray("Thresholds");
+
+            for (UInt32 Element = 0; Element < Thresholds.GetSize() && Element < kMaxThresholds; ++Element)
+            {
+                mThresholds.emplace_back(Thresholds.GetReal(Element));
+            }
+        }
+
+        /// \brief Saves the notification policy to a TOML section.
+        ///
+        /// \param Section The TOML section to save to.
+        ZYPHRYON_INLINE void Save(TOMLSection Section) const
+        {
+            Section.SetEnum("Mode", mMode);
+
+            if (mMode != Mode::Always && mMode != Mode::Threshold)
+            {
+                Section.SetReal("Tolerance", mTolerance);
+            }
+
+            if (mMode == Mode::Threshold)
+            {
+                TOMLArray Thresholds = Section.SetArray("Thresholds");
+
+                for (const Real32 Threshold : mThresholds)
+                {
+                    Thresholds.AddReal(Threshold);
+                }
+            }
+        }
+
+        /// \brief Loads the notification policy from a baked resource.
+        ///
+        /// \param Reader The baked resource to load from.
+        ZYPHRYON_INLINE void Load(Ref<BakeReader> Reader)
+        {
+            mMode      = Reader.Read<Mode>();
+            mTolerance = Reader.Read<Real32>();
+            mThresholds.clear();
+
+            for (UInt8 Element = 0, Count = Reader.Read<UInt8>(); Element < Count; ++Element)
+            {
+                mThresholds.emplace_back(Reader.Read<Real32>());
+            }
+        }
+
+        /// \brief Saves the notification policy to a baked resource.
+        ///
+        /// \param Writer The baked resource to save to.
+        ZYPHRYON_INLINE void Save(Ref<BakeWriter> Writer) const
+        {
+            Writer.Write(mMode);
+            Writer.Write(mTolerance);
+            Writer.Write(static_cast<UInt8>(mThresholds.size()));
+
+            for (const Real32 Threshold : mThresholds)
+            {
+                Writer.Write(Threshold);
+            }
+        }
+
+    private:
+
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+        Mode                           mMode;
+        Real32                         mTolerance;
+        Vector<Real32, kMaxThresholds> mThresholds;
+    };
+}
\ No newline at end of file
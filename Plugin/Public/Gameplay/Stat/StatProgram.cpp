@@ -0,0 +1,435 @@
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// Copyright (C) 2025 by Agustin L. Alvarez. All rights reserved.
+//
+// This work is licensed under the terms of the MIT license.
+//
+// For a copy, see <https://opensource.org/licenses/MIT>.
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [  HEADER  ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#include "Gameplay/Stat/StatProgram.hpp"
+#include "Gameplay/Token/TokenRepository.hpp"
+#include <charconv>
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [   CODE   ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+namespace Gameplay
+{
+    namespace
+    {
+        /// \brief Precedence of an operand from loosest to tightest binding, used to place parentheses.
+        enum class Precedence : UInt8
+        {
+            Sum,        ///< Additive expressions.
+            Product,    ///< Multiplicative expressions.
+            Unary,      ///< Negated expressions.
+            Primary,    ///< Literals, references, function calls.
+        };
+
+        /// \brief Structure representing the text held by a register while decompiling.
+        struct Fragment final
+        {
+            /// \brief The text of the expression.
+            Str8       Text;
+
+            /// \brief The precedence of the expression.
+            Precedence Level = Precedence::Primary;
+        };
+
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+        void Skip(Ref<ConstStr8> Text)
+        {
+            while (!Text.empty() && std::isspace(static_cast<UInt8>(Text.front())))
+            {
+                Text.remove_prefix(1);
+            }
+        }
+
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+        Bool Accept(Ref<ConstStr8> Text, Char Symbol)
+        {
+            Skip(Text);
+
+            if (Text.empty() || Text.front() != Symbol)
+            {
+                return false;
+            }
+            Text.remove_prefix(1);
+            return true;
+        }
+
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+        ConstStr8 Identifier(Ref<ConstStr8> Text)
+        {
+            Skip(Text);
+
+            UInt32 Length = 0;
+
+            while (Length < Text.size() && (std::isalnum(static_cast<UInt8>(Text[Length])) || (Length > 0 && Text[Length] == '.')))
+            {
+                ++Length;
+            }
+
+            const ConstStr8 Name = Text.substr(0, Length);
+            Text.remove_prefix(Length);
+            return Name;
+        }
+
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+        template<typename Type>
+        Bool Number(Ref<ConstStr8> Text, Ref<Type> Value)
+        {
+            Skip(Text);
+
+            const auto [Last, Error] = std::from_chars(Text.data(), Text.data() + Text.size(), Value);
+
+            if (Error != std::errc())
+            {
+                return false;
+            }
+            Text.remove_prefix(Last - Text.data());
+            return true;
+        }
+
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+        Bool Argument(Ref<ConstStr8> Text, Ref<UInt32> Value)
+        {
+            return Accept(Text, '(') && Number(Text, Value) && Accept(Text, ')');
+        }
+
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+        Bool TokenArgument(Ref<ConstStr8> Text, Ref<UInt32> Value)
+        {
+            if (!Accept(Text, '('))
+            {
+                return false;
+            }
+            Skip(Text);
+
+            // Tokens are referenced either by key or by name, names are resolved once against the registered tokens.
+            if (!Text.empty() && std::isalpha(static_cast<UInt8>(Text.front())))
+            {
+                const ConstStr8 Name   = Identifier(Text);
+                const Token     Handle = TokenRepository::View().GetByName(Name);
+
+                if (Handle.IsEmpty())
+                {
+                    LOG_WARNING("Formula references unknown token '{}'.", Name);
+                    return false;
+                }
+                Value = Handle.GetID();
+            }
+            else if (!Number(Text, Value))
+            {
+                return false;
+            }
+            return Accept(Text, ')');
+        }
+
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+        Str8 Wrap(ConstRef<Fragment> Operand, Precedence Level)
+        {
+            return Operand.Level < Level ? "(" + Operand.Text + ")" : Operand.Text;
+        }
+
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+        Fragment Combine(ConstRef<Fragment> Left, ConstStr8 Operator, ConstRef<Fragment> Right, Precedence Level)
+        {
+            // Operators are left-associative, so the right operand must bind tighter to round-trip.
+            const Precedence Tighter = static_cast<Precedence>(Enum::Cast(Level) + 1);
+            return Fragment { Wrap(Left, Level) + Str8(Operator) + Wrap(Right, Tighter), Level };
+        }
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Bool StatProgram::Compile(ConstStr8 Text)
+    {
+        mSize          = 0;
+        mConstantsSize = 0;
+
+        ConstStr8 Remaining = Text;
+
+        if (!CompileSum(Remaining, 0) || (Skip(Remaining), !Remaining.empty()))
+        {
+            LOG_WARNING("Failed to compile formula '{}' near '{}'", Text, Remaining);
+
+            mSize          = 0;
+            mConstantsSize = 0;
+            return false;
+        }
+        return true;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Str8 StatProgram::Decompile() const
+    {
+        Array<Fragment, kMaxRegisters> Registers;
+
+        for (ConstRef<Instruction> Code : GetInstructions())
+        {
+            Ref<Fragment> Result = Registers[Code.Destination];
+
+            switch (Code.Code)
+            {
+            case Opcode::Base:
+                Result = Fragment { "Base" };
+                break;
+            case Opcode::Flat:
+                Result = Fragment { "Flat" };
+                break;
+            case Opcode::Additive:
+                Result = Fragment { "Additive" };
+                break;
+            case Opcode::Multiplier:
+                Result = Fragment { "Multiplier" };
+                break;
+            case Opcode::Constant:
+            {
+                Array<Char, 32> Buffer;
+
+                const auto [Last, Error] = std::to_chars(Buffer.data(), Buffer.data() + Buffer.size(), std::bit_cast<Real32>(mConstants[Code.Operand]));
+                Result = Fragment { Str8(Buffer.data(), Last) };
+                break;
+            }
+            case Opcode::SourceStat:
+                Result = Fragment { "Source.Stat(" + std::to_string(Code.Operand) + ")" };
+                break;
+            case Opcode::TargetStat:
+                Result = Fragment { "Target.Stat(" + std::to_string(Code.Operand) + ")" };
+                break;
+            case Opcode::SourceToken:
+                Result = Fragment { "Source.Token(" + std::to_string(mConstants[Code.Operand]) + ")" };
+                break;
+            case Opcode::TargetToken:
+                Result = Fragment { "Target.Token(" + std::to_string(mConstants[Code.Operand]) + ")" };
+                break;
+            case Opcode::Add:
+                Result = Combine(Result, " + ", Registers[Code.Operand], Precedence::Sum);
+                break;
+            case Opcode::Subtract:
+                Result = Combine(Result, " - ", Registers[Code.Operand], Precedence::Sum);
+                break;
+            case Opcode::Multiply:
+                Result = Combine(Result, " * ", Registers[Code.Operand], Precedence::Product);
+                break;
+            case Opcode::Divide:
+                Result = Combine(Result, " / ", Registers[Code.Operand], Precedence::Product);
+                break;
+            case Opcode::Minimum:
+                Result = Fragment { "Min(" + Result.Text + ", " + Registers[Code.Operand].Text + ")" };
+                break;
+            case Opcode::Maximum:
+                Result = Fragment { "Max(" + Result.Text + ", " + Registers[Code.Operand].Text + ")" };
+                break;
+            case Opcode::Negate:
+                Result = Fragment { "-" + Wrap(Result, Precedence::Unary), Precedence::Unary };
+                break;
+            }
+        }
+        return IsValid() ? Registers[0].Text : Str8();
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Bool StatProgram::CompileSum(Ref<ConstStr8> Text, UInt32 Register)
+    {
+        if (!CompileProduct(Text, Register))
+        {
+            return false;
+        }
+
+        for (;;)
+        {
+            Opcode Code;
+
+            if (Accept(Text, '+'))
+            {
+                Code = Opcode::Add;
+            }
+            else if (Accept(Text, '-'))
+            {
+                Code = Opcode::Subtract;
+            }
+            else
+            {
+                return true;
+            }
+
+            if (Register + 1 >= kMaxRegisters || !CompileProduct(Text, Register + 1) || !Emit(Code, Register, Register + 1))
+            {
+                return false;
+            }
+        }
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Bool StatProgram::CompileProduct(Ref<ConstStr8> Text, UInt32 Register)
+    {
+        if (!CompileUnary(Text, Register))
+        {
+            return false;
+        }
+
+        for (;;)
+        {
+            Opcode Code;
+
+            if (Accept(Text, '*'))
+            {
+                Code = Opcode::Multiply;
+            }
+            else if (Accept(Text, '/'))
+            {
+                Code = Opcode::Divide;
+            }
+            else
+            {
+                return true;
+            }
+
+            if (Register + 1 >= kMaxRegisters || !CompileUnary(Text, Register + 1) || !Emit(Code, Register, Register + 1))
+            {
+                return false;
+            }
+        }
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Bool StatProgram::CompileUnary(Ref<ConstStr8> Text, UInt32 Register)
+    {
+        if (Accept(Text, '-'))
+        {
+            return CompileUnary(Text, Register) && Emit(Opcode::Negate, Register);
+        }
+        return CompilePrimary(Text, Register);
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Bool StatProgram::CompilePrimary(Ref<ConstStr8> Text, UInt32 Register)
+    {
+        if (Accept(Text, '('))
+        {
+            return CompileSum(Text, Register) && Accept(Text, ')');
+        }
+
+        // Literals never carry a sign, negative values are compiled as a negation.
+        if (!Text.empty() && (std::isdigit(static_cast<UInt8>(Text.front())) || Text.front() == '.'))
+        {
+            Real32 Value;
+            return Number(Text, Value) && EmitConstant(Opcode::Constant, Register, std::bit_cast<UInt32>(Value));
+        }
+
+        const ConstStr8 Name = Identifier(Text);
+
+        if (Name == "Base")
+        {
+            return Emit(Opcode::Base, Register);
+        }
+        if (Name == "Flat")
+        {
+            return Emit(Opcode::Flat, Register);
+        }
+        if (Name == "Additive")
+        {
+            return Emit(Opcode::Additive, Register);
+        }
+        if (Name == "Multiplier")
+        {
+            return Emit(Opcode::Multiplier, Register);
+        }
+
+        if (Name == "Min" || Name == "Max")
+        {
+            const Opcode Code = (Name == "Min" ? Opcode::Minimum : Opcode::Maximum);
+
+            return Register + 1 < kMaxRegisters
+                && Accept(Text, '(') && CompileSum(Text, Register)
+                && Accept(Text, ',') && CompileSum(Text, Register + 1)
+                && Accept(Text, ')') && Emit(Code, Register, Register + 1);
+        }
+
+        UInt32 Value;
+
+        if (Name == "Source.Stat" || Name == "Target.Stat")
+        {
+            const Opcode Code = (Name == "Source.Stat" ? Opcode::SourceStat : Opcode::TargetStat);
+            return Argument(Text, Value) && Value <= std::numeric_limits<UInt16>::max() && Emit(Code, Register, Value);
+        }
+
+        if (Name == "Source.Token" || Name == "Target.Token")
+        {
+            const Opcode Code = (Name == "Source.Token" ? Opcode::SourceToken : Opcode::TargetToken);
+            return TokenArgument(Text, Value) && EmitConstant(Code, Register, Value);
+        }
+        return false;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Bool StatProgram::Emit(Opcode Code, UInt32 Destination, UInt32 Operand)
+    {
+        if (mSize == kMaxInstructions)
+        {
+            return false;
+        }
+
+        mInstructions[mSize++] = Instruction { Code, static_cast<UInt8>(Destination), static_cast<UInt16>(Operand) };
+        return true;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Bool StatProgram::EmitConstant(Opcode Code, UInt32 Destination, UInt32 Value)
+    {
+        UInt32 Index = 0;
+
+        while (Index < mConstantsSize && mConstants[Index] != Value)
+        {
+            ++Index;
+        }
+
+        if (Index == mConstantsSize)
+        {
+            if (mConstantsSize == kMaxConstants)
+            {
+                return false;
+            }
+            mConstants[mConstantsSize++] = Value;
+        }
+        return Emit(Code, Destination, Index);
+    }
+}
\ No newline at end of file
@@ -0,0 +1,305 @@
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// Copyright (C) 2025 by Agustin L. Alvarez. All rights reserved.
+//
+// This work is licensed under the terms of the MIT license.
+//
+// For a copy, see <https://opensource.org/licenses/MIT>.
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#pragma once
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [  HEADER  ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#include "Gameplay/Stat/Stat.hpp"
+#include "Gameplay/Stat/StatTypes.hpp"
+#include "Gameplay/Token/Token.hpp"
+#include <bit>
+
+#ifndef GAMEPLAY_MAX_PROGRAM_INSTRUCTIONS
+    #define GAMEPLAY_MAX_PROGRAM_INSTRUCTIONS 32
+#endif
+
+#ifndef GAMEPLAY_MAX_PROGRAM_CONSTANTS
+    #define GAMEPLAY_MAX_PROGRAM_CONSTANTS 8
+#endif
+
+#ifndef GAMEPLAY_MAX_PROGRAM_REGISTERS
+    #define GAMEPLAY_MAX_PROGRAM_REGISTERS 8
+#endif
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [   CODE   ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+namespace Gameplay
+{
+    /// \brief A register-based bytecode program compiled from a textual stat formula.
+    ///
+    /// The grammar accepts `+ - * /`, unary `-`, parentheses, numeric literals, `Min(A, B)`, `Max(A, B)`, the
+    /// components `Base`, `Flat`, `Additive`, `Multiplier` and the references `Source.Stat(ID)`, `Target.Stat(ID)`,
+    /// `Source.Token(Key)` and `Target.Token(Key)`. Tokens may also be referenced by name, such as
+    /// `Target.Token(Status.Burning)`, resolved against the tokens registered when compiling. Stats are referenced by
+    /// identifier only, as formulas compile while their own repository is still being loaded.
+    class StatProgram final
+    {
+    public:
+
+        /// \brief Maximum number of instructions in a program.
+        static constexpr UInt32 kMaxInstructions = GAMEPLAY_MAX_PROGRAM_INSTRUCTIONS;
+
+        /// \brief Maximum number of constants (literals and token keys) in a program.
+        static constexpr UInt32 kMaxConstants    = GAMEPLAY_MAX_PROGRAM_CONSTANTS;
+
+        /// \brief Maximum number of registers used while executing a program.
+        static constexpr UInt32 kMaxRegisters    = GAMEPLAY_MAX_PROGRAM_REGISTERS;
+
+        /// \brief Enumerates the operations of the bytecode.
+        enum class Opcode : UInt8
+        {
+            Base,          ///< Loads the base value into the destination register.
+            Flat,          ///< Loads the flat addition into the destination register.
+            Additive,      ///< Loads the percentage addition into the destination register.
+            Multiplier,    ///< Loads the multiplier into the destination register.
+            Constant,      ///< Loads the constant at the operand index into the destination register.
+            SourceStat,    ///< Loads the source stat identified by the operand into the destination register.
+            TargetStat,    ///< Loads the target stat identified by the operand into the destination register.
+            SourceToken,   ///< Loads the source token whose key is the constant at the operand index.
+            TargetToken,   ///< Loads the target token whose key is the constant at the operand index.
+            Add,           ///< Adds the operand register to the destination register.
+            Subtract,      ///< Subtracts the operand register from the destination register.
+            Multiply,      ///< Multiplies the destination register by the operand register.
+            Divide,        ///< Divides the destination register by the operand register.
+            Minimum,       ///< Keeps the smallest of the destination and operand registers.
+            Maximum,       ///< Keeps the largest of the destination and operand registers.
+            Negate,        ///< Negates the destination register.
+        };
+
+        /// \brief Structure representing a single instruction of the bytecode.
+        struct Instruction final
+        {
+            /// \brief The operation to perform.
+            Opcode Code;
+
+            /// \brief The register that receives the result.
+            UInt8  Destination;
+
+            /// \brief The operand of the operation: a register, a constant index or a stat identifier.
+            UInt16 Operand;
+        };
+
+    public:
+
+        /// \brief Default constructor, initializes an empty program.
+        ZYPHRYON_INLINE StatProgram()
+            : mSize          { 0 },
+              mConstantsSize { 0 },
+              mInstructions  { },
+              mConstants     { }
+        {
+        }
+
+        /// \brief Checks if the program contains any instruction.
+        ///
+        /// \return `true` if the program is valid, `false` otherwise.
+        ZYPHRYON_INLINE Bool IsValid() const
+        {
+            return mSize > 0;
+        }
+
+        /// \brief Retrieves the instructions of the program.
+        ///
+        /// \return A span containing the instructions of the program.
+        ZYPHRYON_INLINE ConstSpan<Instruction> GetInstructions() const
+        {
+            return ConstSpan<Instruction>(mInstructions.data(), mSize);
+        }
+
+        /// \brief Checks if the program reads no stat or token, so its result only depends on the stat components.
+        ///
+        /// \return `true` if the program never reads from a context, `false` otherwise.
+        ZYPHRYON_INLINE Bool IsConstant() const
+        {
+            for (ConstRef<Instruction> Code : GetInstructions())
+            {
+                if (Code.Code >= Opcode::SourceStat && Code.Code <= Opcode::TargetToken)
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        /// \brief Compiles a textual formula into this program, replacing any previous content.
+        ///
+        /// \param Text The formula text to compile.
+        /// \return `true` if the formula was compiled, `false` if it is malformed or exceeds the program limits.
+        Bool Compile(ConstStr8 Text);
+
+        /// \brief Decompiles the program back into a textual formula that compiles to the same bytecode.
+        ///
+        /// \return The formula text of the program.
+        Str8 Decompile() const;
+
+        /// \brief Executes the program.
+        ///
+        /// \param Source     The source context to retrieve stat values from.
+        /// \param Target     The target context to retrieve stat values from.
+        /// \param Base       The base value of the stat.
+        /// \param Flat       The flat addition to apply to the base value.
+        /// \param Additive   The percentage addition to apply to the base value.
+        /// \param Multiplier The multiplier to apply to the base value.
+        /// \return The calculated stat value.
+        template<typename SourceContext, typename TargetContext>
+        ZYPHRYON_INLINE Real32 Execute(ConstRef<SourceContext> Source, ConstRef<TargetContext> Target, Real32 Base, Real32 Flat, Real32 Additive, Real32 Multiplier) const
+        {
+            Array<Real32, kMaxRegisters> Registers;
+
+            for (UInt32 Index = 0; Index < mSize; ++Index)
+            {
+                const Instruction Code   = mInstructions[Index];
+                Ref<Real32>       Result = Registers[Code.Destination];
+
+                switch (Code.Code)
+                {
+                case Opcode::Base:
+                    Result = Base;
+                    break;
+                case Opcode::Flat:
+                    Result = Flat;
+                    break;
+                case Opcode::Additive:
+                    Result = Additive;
+                    break;
+                case Opcode::Multiplier:
+                    Result = Multiplier;
+                    break;
+                case Opcode::Constant:
+                    Result = std::bit_cast<Real32>(mConstants[Code.Operand]);
+                    break;
+                case Opcode::SourceStat:
+                    Result = Source.GetStat(Stat(Code.Operand));
+                    break;
+                case Opcode::TargetStat:
+                    Result = Target.GetStat(Stat(Code.Operand));
+                    break;
+                case Opcode::SourceToken:
+                    Result = static_cast<Real32>(Source.GetToken(Token(mConstants[Code.Operand])));
+                    break;
+                case Opcode::TargetToken:
+                    Result = static_cast<Real32>(Target.GetToken(Token(mConstants[Code.Operand])));
+                    break;
+                case Opcode::Add:
+                    Result += Registers[Code.Operand];
+                    break;
+                case Opcode::Subtract:
+                    Result -= Registers[Code.Operand];
+                    break;
+                case Opcode::Multiply:
+                    Result *= Registers[Code.Operand];
+                    break;
+                case Opcode::Divide:
+                    Result /= Registers[Code.Operand];
+                    break;
+                case Opcode::Minimum:
+                    Result = Min(Result, Registers[Code.Operand]);
+                    break;
+                case Opcode::Maximum:
+                    Result = Max(Result, Registers[Code.Operand]);
+                    break;
+                case Opcode::Negate:
+                    Result = -Result;
+                    break;
+                }
+            }
+            return Registers[0];
+        }
+
+        /// \brief Traverses all stats and tokens read by the program, invoking the provided action for each.
+        ///
+        /// \param Action The action to invoke with each dependency and its scope.
+        template<typename Function>
+        ZYPHRYON_INLINE void Traverse(AnyRef<Function> Action) const
+        {
+            for (UInt32 Index = 0; Index < mSize; ++Index)
+            {
+                const Instruction Code = mInstructions[Index];
+
+                switch (Code.Code)
+                {
+                case Opcode::SourceStat:
+                    Action(Stat(Code.Operand), StatScope::Source);
+                    break;
+                case Opcode::TargetStat:
+                    Action(Stat(Code.Operand), StatScope::Target);
+                    break;
+                case Opcode::SourceToken:
+                    Action(Token(mConstants[Code.Operand]), StatScope::Source);
+                    break;
+                case Opcode::TargetToken:
+                    Action(Token(mConstants[Code.Operand]), StatScope::Target);
+                    break;
+                default:
+                    break;
+                }
+            }
+        }
+
+    private:
+
+        /// \brief Compiles an additive expression into the given register.
+        ///
+        /// \param Text     The remaining text to compile, advanced past the expression.
+        /// \param Register The register that receives the result.
+        /// \return `true` if the expression was compiled, `false` otherwise.
+        Bool CompileSum(Ref<ConstStr8> Text, UInt32 Register);
+
+        /// \brief Compiles a multiplicative expression into the given register.
+        ///
+        /// \param Text     The remaining text to compile, advanced past the expression.
+        /// \param Register The register that receives the result.
+        /// \return `true` if the expression was compiled, `false` otherwise.
+        Bool CompileProduct(Ref<ConstStr8> Text, UInt32 Register);
+
+        /// \brief Compiles a unary expression into the given register.
+        ///
+        /// \param Text     The remaining text to compile, advanced past the expression.
+        /// \param Register The register that receives the result.
+        /// \return `true` if the expression was compiled, `false` otherwise.
+        Bool CompileUnary(Ref<ConstStr8> Text, UInt32 Register);
+
+        /// \brief Compiles a literal, a reference, a function call or a parenthesized expression.
+        ///
+        /// \param Text     The remaining text to compile, advanced past the expression.
+        /// \param Register The register that receives the result.
+        /// \return `true` if the expression was compiled, `false` otherwise.
+        Bool CompilePrimary(Ref<ConstStr8> Text, UInt32 Register);
+
+        /// \brief Appends an instruction to the program.
+        ///
+        /// \param Code        The operation to perform.
+        /// \param Destination The register that receives the result.
+        /// \param Operand     The operand of the operation.
+        /// \return `true` if the instruction was appended, `false` if the program is full.
+        Bool Emit(Opcode Code, UInt32 Destination, UInt32 Operand = 0);
+
+        /// \brief Appends an instruction that reads a constant, reusing an existing slot holding the same value.
+        ///
+        /// \param Code        The operation to perform.
+        /// \param Destination The register that receives the result.
+        /// \param Value       The raw bits of the constant.
+        /// \return `true` if the instruction was appended, `false` if the program is full.
+        Bool EmitConstant(Opcode Code, UInt32 Destination, UInt32 Value);
+
+    private:
+
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+        UInt8                                 mSize;
+        UInt8                                 mConstantsSize;
+        Array<Instruction, kMaxInstructions>  mInstructions;
+        Array<UInt32, kMaxConstants>          mConstants;
+    };
+}
\ No newline at end of file
@@ -23,10 +23,20 @@ namespace Gameplay
 
     void StatRepository::Load(Ref<Content::Service> Content, ConstStr8 Filename)
     {
+        LOG_ASSERT(!mFrozen, "Cannot modify the stat repository while it is frozen.");
+
         if (const Blob Data = Content.Find(Filename); Data)
         {
-            TOMLParser Parser(Data.GetText());
-            Load(Parser);
+            if (BakeReader::IsBaked(Data.GetSpan()))
+            {
+                BakeReader Reader(Data.GetSpan());
+                Load(Reader);
+            }
+            else
+            {
+                TOMLParser Parser(Data.GetText());
+                Load(Parser);
+            }
         }
         else
         {
@@ -48,6 +58,94 @@ namespace Gameplay
     // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
     // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 
+    void StatRepository::Bake(Ref<Content::Service> Content, ConstStr8 Filename) const
+    {
+        BakeWriter Writer(BakeKind::Stat);
+        Save(Writer);
+
+        Content.Save(Filename, Writer.GetData());
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void StatRepository::Rebuild()
+    {
+        Array<UInt16, kMaxArchetypes> Degrees { };
+
+        for (const auto & [Dependency, Dependants] : mValueDependencies)
+        {
+            for (const Stat Dependant : Dependants)
+            {
+                ++Degrees[Dependant.GetID()];
+            }
+        }
+
+        // Order the stats with Kahn's algorithm, the sorted array doubles as the work queue.
+        UInt32 Head = 0;
+        UInt32 Tail = 0;
+
+        for (UInt32 Index = 0; Index < kMaxArchetypes; ++Index)
+        {
+            if (Degrees[Index] == 0)
+            {
+                mSorted[Tail++] = Stat(Index);
+            }
+        }
+
+        while (Head < Tail)
+        {
+            if (const auto Iterator = mValueDependencies.find(mSorted[Head++]); Iterator != mValueDependencies.end())
+            {
+                for (const Stat Dependant : Iterator->second)
+                {
+                    if (--Degrees[Dependant.GetID()] == 0)
+                    {
+                        mSorted[Tail++] = Dependant;
+                    }
+                }
+            }
+        }
+
+        if (Tail < kMaxArchetypes)
+        {
+            LOG_WARNING("Cyclic stat dependencies detected, changes may not reach every dependent stat.");
+
+            for (UInt32 Index = 0; Index < kMaxArchetypes; ++Index)
+            {
+                if (Degrees[Index] != 0)
+                {
+                    mSorted[Tail++] = Stat(Index);
+                }
+            }
+        }
+
+        for (UInt32 Rank = 0; Rank < kMaxArchetypes; ++Rank)
+        {
+            mRanks[mSorted[Rank].GetID()] = Rank;
+        }
+
+        // Flatten the adjacency by rank, so propagation walks contiguous memory.
+        mDependents.clear();
+
+        for (UInt32 Rank = 0; Rank < kMaxArchetypes; ++Rank)
+        {
+            mOffsets[Rank] = mDependents.size();
+
+            if (const auto Iterator = mValueDependencies.find(mSorted[Rank]); Iterator != mValueDependencies.end())
+            {
+                for (const Stat Dependant : Iterator->second)
+                {
+                    mDependents.emplace_back(mRanks[Dependant.GetID()]);
+                }
+            }
+        }
+        mOffsets[kMaxArchetypes] = mDependents.size();
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
     void StatRepository::Load(Ref<TOMLParser> Parser)
     {
         const TOMLArray Root = Parser.GetArray("Stat");
@@ -66,6 +164,7 @@ namespace Gameplay
                 InsertDependencies(Archetype);
             }
         }
+        Rebuild();
     }
 
     // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
@@ -83,4 +182,154 @@ namespace Gameplay
             }
         }
     }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void StatRepository::Load(Ref<BakeReader> Reader)
+    {
+        if (!Reader.Open(BakeKind::Stat))
+        {
+            return;
+        }
+
+        for (UInt32 Element = 0, Count = Reader.Read<UInt32>(); Element < Count && Reader.IsValid(); ++Element)
+        {
+            mArchetypes.Acquire(Reader.Peek<UInt16>(), Reader);
+        }
+
+        // Insert dependencies after all archetypes have been loaded.
+        for (ConstRef<StatArchetype> Archetype : mArchetypes.GetSpan())
+        {
+            if (Archetype.IsValid())
+            {
+                InsertDependencies(Archetype);
+            }
+        }
+        Rebuild();
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void StatRepository::Save(Ref<BakeWriter> Writer) const
+    {
+        const ConstSpan<StatArchetype> Archetypes = mArchetypes.GetSpan();
+
+        Writer.Write(static_cast<UInt32>(std::ranges::count_if(Archetypes, &StatArchetype::IsValid)));
+
+        for (ConstRef<StatArchetype> Archetype : Archetypes)
+        {
+            if (Archetype.IsValid())
+            {
+                Archetype.Save(Writer);
+            }
+        }
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Vector<Stat> StatRepository::Stage(Ref<Content::Service> Content, ConstStr8 Filename)
+    {
+        mStaging.clear();
+
+        if (const Blob Data = Content.Find(Filename); Data)
+        {
+            if (BakeReader::IsBaked(Data.GetSpan()))
+            {
+                BakeReader Reader(Data.GetSpan());
+
+                if (Reader.Open(BakeKind::Stat))
+                {
+                    for (UInt32 Element = 0, Count = Reader.Read<UInt32>(); Element < Count && Reader.IsValid(); ++Element)
+                    {
+                        mStaging.emplace_back(Reader);
+                    }
+                }
+            }
+            else
+            {
+                TOMLParser      Parser(Data.GetText());
+                const TOMLArray Root = Parser.GetArray("Stat");
+
+                for (UInt32 Element = 0; Element < Root.GetSize(); ++Element)
+                {
+                    mStaging.emplace_back(Root.GetSection(Element));
+                }
+            }
+        }
+        else
+        {
+            LOG_WARNING("Failed to reload stats from '{}'", Filename);
+        }
+
+        // Drop the archetypes whose content matches the live one, they need no patching.
+        std::erase_if(mStaging, [this](ConstRef<StatArchetype> Archetype)
+        {
+            return BakeWriter::IsEqual(Archetype, Get(Archetype.GetHandle()));
+        });
+
+        Vector<Stat> Changed;
+        Changed.reserve(mStaging.size());
+
+        for (ConstRef<StatArchetype> Archetype : mStaging)
+        {
+            Changed.push_back(Archetype.GetHandle());
+        }
+        return Changed;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void StatRepository::Commit()
+    {
+        for (Ref<StatArchetype> Archetype : mStaging)
+        {
+            const UInt32 ID = Archetype.GetHandle().GetID();
+
+            if (ConstRef<StatArchetype> Live = mArchetypes[ID]; Live.IsValid())
+            {
+                DeleteDependencies(Live);
+                mArchetypes[ID] = Move(Archetype);
+            }
+            else
+            {
+                mArchetypes.Acquire(ID, Move(Archetype));
+            }
+            InsertDependencies(mArchetypes[ID]);
+        }
+        mStaging.clear();
+
+        Rebuild();
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void StatRepository::Measure(Ref<MemoryUsage> Usage) const
+    {
+        constexpr ConstStr8 kOwner = "StatRepository";
+
+        Usage.RecordBlock(kOwner, "Archetypes", mArchetypes, mArchetypes.GetSpan().size() * sizeof(StatArchetype));
+        Usage.RecordTable(kOwner, "ValueDependencies", mValueDependencies);
+        Usage.RecordTable(kOwner, "TokenDependencies", mTokenDependencies);
+
+        for (const auto & [Dependency, Dependants] : mValueDependencies)
+        {
+            Usage.RecordTable(kOwner, "ValueDependencies", Dependants);
+        }
+
+        for (const auto & [Dependency, Dependants] : mTokenDependencies)
+        {
+            Usage.RecordTable(kOwner, "TokenDependencies", Dependants);
+        }
+
+        Usage.RecordBlock(kOwner, "Ranks", mRanks, sizeof(mRanks));
+        Usage.RecordBlock(kOwner, "Sorted", mSorted, sizeof(mSorted));
+        Usage.RecordBlock(kOwner, "Offsets", mOffsets, sizeof(mOffsets));
+        Usage.RecordVector(kOwner, "Dependents", mDependents);
+        Usage.RecordVector(kOwner, "Staging", mStaging);
+    }
 }
\ No newline at end of file
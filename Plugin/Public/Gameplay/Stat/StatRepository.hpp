@@ -12,9 +12,15 @@
 // [  HEADER  ]
 // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 
+#include "Gameplay/Arsenal/GameplayContext.hpp"
+#include "Gameplay/Arsenal/Trace.hpp"
 #include "Gameplay/Stat/StatArchetype.hpp"
 #include <Zyphryon.Content/Service.hpp>
 
+#ifndef GAMEPLAY_MAX_STAT_ARCHETYPES
+    #define GAMEPLAY_MAX_STAT_ARCHETYPES 256
+#endif
+
 // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 // [   CODE   ]
 // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
@@ -27,12 +33,25 @@ namespace Gameplay
     public:
 
         /// \brief Maximum number of stat archetypes that can be registered.
-        static constexpr UInt32 kMaxArchetypes = 256;   // TODO: Macro Configurable
+        static constexpr UInt32 kMaxArchetypes = GAMEPLAY_MAX_STAT_ARCHETYPES;
+
+        /// \brief Number of words in a bitset holding one bit per stat archetype.
+        static constexpr UInt32 kWords         = kMaxArchetypes / 64;
+
+        static_assert(kMaxArchetypes % 64 == 0, "The capacity must be a multiple of 64, as it is tracked by 64-bit words.");
 
     public:
 
+        /// \brief Default constructor, initializes an empty repository.
+        ZYPHRYON_INLINE StatRepository()
+        {
+            Rebuild();
+        }
+
         /// \brief Loads stats archetypes from the content service.
         ///
+        /// \note Both TOML and baked resources are accepted, baked resources are detected by their header.
+        ///
         /// \param Content  The content service to load from.
         /// \param Filename The filename of the resource to load.
         void Load(Ref<Content::Service> Content, ConstStr8 Filename);
@@ -43,11 +62,36 @@ namespace Gameplay
         /// \param Filename The filename of the resource to save.
         void Save(Ref<Content::Service> Content, ConstStr8 Filename) const;
 
+        /// \brief Bakes stat archetypes into a binary resource that loads without parsing.
+        ///
+        /// \param Content  The content service to save to.
+        /// \param Filename The filename of the resource to save.
+        void Bake(Ref<Content::Service> Content, ConstStr8 Filename) const;
+
+        /// \brief Parses a resource into a staging area, keeping only the stat archetypes that differ from the live ones.
+        ///
+        /// \note Live archetypes are left untouched until `Commit`, so instances can still be reverted against them.
+        ///
+        /// \param Content  The content service to load from.
+        /// \param Filename The filename of the resource to load.
+        /// \return The handles of the changed or new stat archetypes.
+        Vector<Stat> Stage(Ref<Content::Service> Content, ConstStr8 Filename);
+
+        /// \brief Patches the staged stat archetypes into their slots, so pointers to live archetypes stay valid.
+        ///
+        /// \note Archetypes missing from the staged resource are kept, since live instances may still refer to them.
+        ///       Allowed while frozen, as the only way to change a frozen repository. Readers hold pointers or
+        ///       references to live archetypes rather than copies, so the patched definition is observed on their
+        ///       next read without any cache to invalidate.
+        void Commit();
+
         /// \brief Allocates a new stat archetype in the repository.
         ///
         /// \return A reference to the newly allocated stat archetype.
         ZYPHRYON_INLINE Ref<StatArchetype> Allocate()
         {
+            LOG_ASSERT(!mFrozen, "Cannot modify the stat repository while it is frozen.");
+
             const Stat Handle = mArchetypes.Allocate();
 
             Ref<StatArchetype> Archetype = mArchetypes[Handle.GetID()];
@@ -55,14 +99,29 @@ namespace Gameplay
             return Archetype;
         }
 
+        /// \brief Inserts a parsed stat archetype into the slot of its handle.
+        ///
+        /// \note Dependencies are not inserted, use `InsertDependency` and `Rebuild` once the batch is complete.
+        ///
+        /// \param Archetype The stat archetype to insert.
+        ZYPHRYON_INLINE void Insert(AnyRef<StatArchetype> Archetype)
+        {
+            LOG_ASSERT(!mFrozen, "Cannot modify the stat repository while it is frozen.");
+            LOG_ASSERT(Archetype.GetHandle().IsValid(), "Cannot insert a stat archetype with an invalid handle.");
+
+            mArchetypes.Acquire(Archetype.GetHandle().GetID(), Move(Archetype));
+        }
+
         /// \brief Deletes a stat archetype from the repository.
         ///
         /// \param Archetype The stat archetype to delete.
         ZYPHRYON_INLINE void Delete(ConstRef<StatArchetype> Archetype)
         {
+            LOG_ASSERT(!mFrozen, "Cannot modify the stat repository while it is frozen.");
             LOG_ASSERT(Archetype.GetHandle().IsValid(), "Cannot delete a stat archetype with an invalid handle.");
 
             DeleteDependencies(Archetype);
+            Rebuild();
 
             mArchetypes.Free(Archetype.GetHandle().GetID());
         }
@@ -70,9 +129,34 @@ namespace Gameplay
         /// \brief Clears all stat archetypes from the repository.
         ZYPHRYON_INLINE void Clear()
         {
+            LOG_ASSERT(!mFrozen, "Cannot modify the stat repository while it is frozen.");
+
             mArchetypes.Clear();
         }
 
+        /// \brief Freezes the repository, so it can be read from any thread without synchronization.
+        ///
+        /// \note While frozen, archetypes are only replaced through `Stage` and `Commit`, and `Commit` must run between
+        ///       ticks, when no other thread is reading.
+        ZYPHRYON_INLINE void Freeze()
+        {
+            mFrozen = true;
+        }
+
+        /// \brief Thaws the repository, allowing it to be modified again.
+        ZYPHRYON_INLINE void Thaw()
+        {
+            mFrozen = false;
+        }
+
+        /// \brief Checks if the repository is frozen.
+        ///
+        /// \return `true` if the repository is read-only, `false` otherwise.
+        ZYPHRYON_INLINE Bool IsFrozen() const
+        {
+            return mFrozen;
+        }
+
         /// \brief Retrieves a stat archetype by its handle.
         ///
         /// \param Handle The handle of the stat archetype to retrieve.
@@ -92,6 +176,8 @@ namespace Gameplay
 
         /// \brief Inserts a dependency relationship between two stats.
         ///
+        /// \note Call `Rebuild` once all edits are done to refresh the propagation order.
+        ///
         /// \param Dependant  The stat that depends on another stat.
         /// \param Dependency The stat that is depended upon.
         ZYPHRYON_INLINE void InsertDependency(Stat Dependant, Stat Dependency)
@@ -110,6 +196,8 @@ namespace Gameplay
 
         /// \brief Removes a dependency relationship between two stats.
         ///
+        /// \note Call `Rebuild` once all edits are done to refresh the propagation order.
+        ///
         /// \param Dependant  The stat that depends on another stat.
         /// \param Dependency The stat that is depended upon.
         ZYPHRYON_INLINE void RemoveDependency(Stat Dependant, Stat Dependency)
@@ -142,41 +230,82 @@ namespace Gameplay
             }
         }
 
+        /// \brief Rebuilds the topological order and flattened adjacency used to propagate changes.
+        void Rebuild();
+
         /// \brief Notifies all stats that depend on the given stat by invoking the provided action.
         ///
+        /// Dependents are visited once each in topological order; the dependents of a stat are only visited when
+        /// the action returns `true` for it.
+        ///
         /// \param Dependant The stat whose dependents should be notified.
         /// \param Action    The action to invoke for each dependent stat.
         template<typename Function>
-        ZYPHRYON_INLINE void NotifyDependency(Stat Dependant, AnyRef<Function> Action)
+        ZYPHRYON_INLINE void NotifyDependency(Stat Dependant, AnyRef<Function> Action) const
+        {
+            GAMEPLAY_TRACE_ZONE("StatRepository::NotifyDependency");
+
+            Array<UInt64, kWords> Dirty { };
+            Mark(Dirty, mRanks[Dependant.GetID()]);
+            Propagate(Dirty, Action);
+        }
+
+        /// \brief Notifies all stats that depend on any of the given stats by invoking the provided action.
+        ///
+        /// \note Dependents shared by several of the stats are visited once, in a single propagation pass.
+        ///
+        /// \param Dependants The stats whose dependents should be notified.
+        /// \param Action     The action to invoke for each dependent stat.
+        template<typename Function>
+        ZYPHRYON_INLINE void NotifyDependency(ConstSpan<Stat> Dependants, AnyRef<Function> Action) const
         {
-            if (const auto Iterator = mValueDependencies.find(Dependant); Iterator != mValueDependencies.end())
+            GAMEPLAY_TRACE_ZONE("StatRepository::NotifyDependency");
+
+            Array<UInt64, kWords> Dirty { };
+
+            for (const Stat Dependant : Dependants)
             {
-                for (const Stat Dependent : Iterator->second)
-                {
-                    if (Action(Dependent))
-                    {
-                        NotifyDependency(Dependent, Action);
-                    }
-                }
+                Mark(Dirty, mRanks[Dependant.GetID()]);
             }
+            Propagate(Dirty, Action);
         }
 
-        /// \brief Notifies all stats that depend on the given token by invoking the provided action.
+        /// \brief Notifies all stats that depend on the given token or any of its ancestors by invoking the provided action.
+        ///
+        /// \note Changing a token changes the count of every ancestor as well, so stats reading a parent token are
+        ///       notified together with the stats reading the token itself.
         ///
         /// \param Dependant The token whose dependents should be notified.
         /// \param Action    The action to invoke for each dependent stat.
         template<typename Function>
-        ZYPHRYON_INLINE void NotifyDependency(Token Dependant, AnyRef<Function> Action)
+        ZYPHRYON_INLINE void NotifyDependency(Token Dependant, AnyRef<Function> Action) const
         {
-            if (const auto Iterator = mTokenDependencies.find(Dependant); Iterator != mTokenDependencies.end())
+            GAMEPLAY_TRACE_ZONE("StatRepository::NotifyDependency");
+
+            if (mTokenDependencies.empty())
+            {
+                return;
+            }
+
+            Array<UInt64, kWords> Dirty { };
+            Bool                  Found = false;
+
+            Dependant.Iterate([&](Token Ancestor)
             {
-                for (const Stat Dependent : Iterator->second)
+                if (const auto Iterator = mTokenDependencies.find(Ancestor); Iterator != mTokenDependencies.end())
                 {
-                    if (Action(Dependent))
+                    for (const Stat Dependent : Iterator->second)
                     {
-                        NotifyDependency(Dependent, Action);
+                        const UInt32 Rank = mRanks[Dependent.GetID()];
+                        Dirty[Rank / 64] |= (1ull << (Rank % 64));
                     }
+                    Found = true;
                 }
+            });
+
+            if (Found)
+            {
+                Propagate(Dirty, Action);
             }
         }
 
@@ -192,6 +321,59 @@ namespace Gameplay
         /// \param Parser The TOML resource to save stat archetype definitions into.
         void Save(Ref<TOMLParser> Parser) const;
 
+        /// \brief Loads stat archetypes from a baked resource.
+        ///
+        /// \param Reader The baked resource containing stat archetype definitions.
+        void Load(Ref<BakeReader> Reader);
+
+        /// \brief Saves stat archetypes to a baked resource.
+        ///
+        /// \param Writer The baked resource to save stat archetype definitions into.
+        void Save(Ref<BakeWriter> Writer) const;
+
+        /// \brief Marks the direct dependents of the stat at the given rank as dirty.
+        ///
+        /// \param Dirty The bitset of dirty ranks.
+        /// \param Rank  The topological rank of the changed stat.
+        ZYPHRYON_INLINE void Mark(Ref<Array<UInt64, kWords>> Dirty, UInt32 Rank) const
+        {
+            for (UInt32 Edge = mOffsets[Rank]; Edge < mOffsets[Rank + 1]; ++Edge)
+            {
+                const UInt32 Dependent = mDependents[Edge];
+                Dirty[Dependent / 64] |= (1ull << (Dependent % 64));
+            }
+        }
+
+        /// \brief Visits the dirty stats in topological order, marking the dependents of each notified stat.
+        ///
+        /// \param Dirty  The bitset of dirty ranks, consumed by the pass.
+        /// \param Action The action to invoke for each dirty stat.
+        template<typename Function>
+        ZYPHRYON_INLINE void Propagate(Ref<Array<UInt64, kWords>> Dirty, AnyRef<Function> Action) const
+        {
+            UInt64 Reach = 0;
+
+            // Dependents always rank after their dependencies, so a single forward sweep reaches all of them.
+            for (UInt32 Word = 0; Word < kWords; ++Word)
+            {
+                while (Dirty[Word] != 0)
+                {
+                    const UInt32 Rank = Word * 64 + std::countr_zero(Dirty[Word]);
+                    Dirty[Word] &= Dirty[Word] - 1;
+
+                    ++Reach;
+
+                    if (Action(mSorted[Rank]))
+                    {
+                        Mark(Dirty, Rank);
+                    }
+                }
+            }
+
+            Trace::Increment(TraceCounter::Propagations);
+            Trace::Raise(TraceCounter::Reach, Reach);
+        }
+
         /// \brief Inserts all dependencies of a stat archetype into the repository.
         ///
         /// \param Archetype The stat archetype whose dependencies to insert.
@@ -216,15 +398,27 @@ namespace Gameplay
 
     public:
 
-        /// \brief Retrieves the singleton instance of the repository.
+        /// \brief Retrieves the repository of the context current on the calling thread.
         ///
-        /// \return A reference to the singleton repository instance.
+        /// \return A reference to the repository of the current context.
         ZYPHRYON_INLINE static Ref<StatRepository> Instance()
         {
-            static StatRepository Singleton;
-            return Singleton;
+            return GameplayContext::Current().GetStats();
         }
 
+        /// \brief Retrieves the read-only view of the repository, safe to share between threads once frozen.
+        ///
+        /// \return A constant reference to the singleton repository instance.
+        ZYPHRYON_INLINE static ConstRef<StatRepository> View()
+        {
+            return Instance();
+        }
+
+        /// \brief Records the memory held by the repository.
+        ///
+        /// \param Usage The report receiving the usage.
+        void Measure(Ref<MemoryUsage> Usage) const;
+
     private:
 
         // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
@@ -233,5 +427,11 @@ namespace Gameplay
         Pool<StatArchetype, kMaxArchetypes> mArchetypes;
         Table<Stat,  Set<Stat>>             mValueDependencies;
         Table<Token, Set<Stat>>             mTokenDependencies;
+        Array<UInt16, kMaxArchetypes>       mRanks;
+        Array<Stat, kMaxArchetypes>         mSorted;
+        Array<UInt16, kMaxArchetypes + 1>   mOffsets;
+        Vector<UInt16>                      mDependents;
+        Vector<StatArchetype>               mStaging;
+        Bool                                mFrozen = false;
     };
 }
\ No newline at end of file
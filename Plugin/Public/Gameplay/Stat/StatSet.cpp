@@ -10,4 +10,223 @@
 // [  HEADER  ]
 // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 
-#include "Gameplay/Stat/StatSet.hpp"
\ No newline at end of file
+#include "Gameplay/Stat/StatSet.hpp"
+
+#if defined(__AVX__)
+    #include <immintrin.h>
+#elif defined(__ARM_NEON)
+    #include <arm_neon.h>
+#endif
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+    #include <xmmintrin.h>
+#endif
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [   CODE   ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+namespace Gameplay
+{
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void StatSet::Prefetch(Stat Handle) const
+    {
+        const UInt32 Index = Handle.GetID();
+
+        const auto Fetch = [](ConstPtr<void> Address)
+        {
+#if defined(__GNUC__) || defined(__clang__)
+            __builtin_prefetch(Address, 0, 3);
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+            _mm_prefetch(static_cast<ConstPtr<Char>>(Address), _MM_HINT_T0);
+#endif
+        };
+
+        // A read checks presence and staleness first, then loads the effective value.
+        Fetch(& mPresence[Index / 64]);
+        Fetch(& mStorage.Dirty[Index / 64]);
+
+        if (Index < mStorage.Stride)
+        {
+            Fetch(mStorage.GetEffective() + Index);
+        }
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void StatSet::Calculate(Ref<Block> Lanes)
+    {
+        static_assert(kLanes == 8, "The vectorized kernels process eight lanes.");
+
+#if defined(__AVX__)
+
+        const __m256 One    = _mm256_set1_ps(1.0f);
+        const __m256 Scaled = _mm256_mul_ps(_mm256_add_ps(_mm256_load_ps(Lanes.Base.data()), _mm256_load_ps(Lanes.Flat.data())),
+                                            _mm256_add_ps(One, _mm256_load_ps(Lanes.Additive.data())));
+        const __m256 Result = _mm256_mul_ps(Scaled, _mm256_load_ps(Lanes.Multiplier.data()));
+
+        // Clamp with the result as the first operand, so idle lanes pick their current value even on NaN.
+        const __m256 Lower  = _mm256_max_ps(Result, _mm256_load_ps(Lanes.Minimum.data()));
+        _mm256_store_ps(Lanes.Effective.data(), _mm256_min_ps(Lower, _mm256_load_ps(Lanes.Maximum.data())));
+
+#elif defined(__ARM_NEON)
+
+        for (UInt32 Lane = 0; Lane < kLanes; Lane += 4)
+        {
+            const float32x4_t Scaled = vmulq_f32(vaddq_f32(vld1q_f32(& Lanes.Base[Lane]), vld1q_f32(& Lanes.Flat[Lane])),
+                                                 vaddq_f32(vdupq_n_f32(1.0f), vld1q_f32(& Lanes.Additive[Lane])));
+            const float32x4_t Result = vmulq_f32(Scaled, vld1q_f32(& Lanes.Multiplier[Lane]));
+            const float32x4_t Lower  = vmaxnmq_f32(Result, vld1q_f32(& Lanes.Minimum[Lane]));
+
+            vst1q_f32(& Lanes.Effective[Lane], vminnmq_f32(Lower, vld1q_f32(& Lanes.Maximum[Lane])));
+        }
+
+#else
+
+        for (UInt32 Lane = 0; Lane < kLanes; ++Lane)
+        {
+            const Real32 Result = StatFormula::Default(Lanes.Base[Lane], Lanes.Flat[Lane], Lanes.Additive[Lane], Lanes.Multiplier[Lane]);
+            Lanes.Effective[Lane] = Clamp(Result, Lanes.Minimum[Lane], Lanes.Maximum[Lane]);
+        }
+
+#endif
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void StatSet::Load(Ref<BakeReader> Reader)
+    {
+        Clear();
+        Discard();
+
+        mPresence      = Reader.Read<Array<UInt64, kWords>>();
+        mDiverged      = Reader.Read<Array<UInt64, kWords>>();
+        mStorage.Dirty = Reader.Read<Array<UInt64, kWords>>();
+
+        ForEach(mPresence, [&](UInt32 Index)
+        {
+            Reserve(Index);
+
+            mStorage.GetFlat()[Index]       = Reader.Read<Real32>();
+            mStorage.GetAdditive()[Index]   = Reader.Read<Real32>();
+            mStorage.GetMultiplier()[Index] = Reader.Read<Real32>();
+            mStorage.GetEffective()[Index]  = Reader.Read<Real32>();
+
+            // Drop the stats whose archetype is no longer registered, their values are still consumed above.
+            if (!StatRepository::View().Get(Stat(Index)).IsValid())
+            {
+                LOG_WARNING("Discarding snapshot of unknown stat {}.", Index);
+
+                mPresence[Index / 64]      &= ~(1ull << (Index % 64));
+                mStorage.Dirty[Index / 64] &= ~(1ull << (Index % 64));
+            }
+        });
+
+        for (UInt32 Element = 0, Count = Reader.Read<UInt32>(); Element < Count && Reader.IsValid(); ++Element)
+        {
+            const Stat      Handle = Reader.Read<UInt16>();
+            Ref<StatLedger> Ledger = GetLedgers()[Handle];
+            Ledger.Load(Reader);
+
+            // The forced value is saved as the effective one, only the flag has to be derived again.
+            if (Real32 Override; Contains(Handle) && Ledger.GetOverride(Override))
+            {
+                mStorage.Overridden[Handle.GetID() / 64] |= (1ull << (Handle.GetID() % 64));
+            }
+        }
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void StatSet::Save(Ref<BakeWriter> Writer) const
+    {
+        Writer.Write(mPresence);
+        Writer.Write(mDiverged);
+        Writer.Write(mStorage.Dirty);
+
+        ForEach(mPresence, [&](UInt32 Index)
+        {
+            Writer.Write(mStorage.GetFlat()[Index]);
+            Writer.Write(mStorage.GetAdditive()[Index]);
+            Writer.Write(mStorage.GetMultiplier()[Index]);
+            Writer.Write(mStorage.GetEffective()[Index]);
+        });
+
+        Writer.Write(static_cast<UInt32>(mLedgers->size()));
+
+        for (const auto & [Handle, Ledger] : * mLedgers)
+        {
+            Writer.Write(Handle.GetID());
+            Ledger.Save(Writer);
+        }
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void StatSet::Capture(Ref<Snapshot> Target) const
+    {
+        mPages.Capture(mStorage.Columns, Target.Columns);
+
+        Target.Stride     = mStorage.Stride;
+        Target.Dirty      = mStorage.Dirty;
+        Target.Bounded    = mStorage.Bounded;
+        Target.Overridden = mStorage.Overridden;
+        Target.Presence   = mPresence;
+        Target.Diverged   = mDiverged;
+        Target.Ledgers    = mLedgers;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void StatSet::Restore(ConstRef<Snapshot> Source)
+    {
+        mStorage.Columns.resize(StatInstance::Storage::kColumns * Source.Stride);
+        mPages.Restore(mStorage.Columns, Source.Columns);
+
+        mStorage.Stride     = Source.Stride;
+        mStorage.Dirty      = Source.Dirty;
+        mStorage.Bounded    = Source.Bounded;
+        mStorage.Overridden = Source.Overridden;
+        mPresence           = Source.Presence;
+        mDiverged           = Source.Diverged;
+        mLedgers            = Source.Ledgers;
+        Discard();
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void StatSet::Measure(Ref<MemoryUsage> Usage) const
+    {
+        constexpr ConstStr8 kOwner = "StatSet";
+
+        UInt32 Live = 0;
+
+        for (const UInt64 Word : mPresence)
+        {
+            Live += std::popcount(Word);
+        }
+
+        constexpr UInt64 kRow = StatInstance::Storage::kColumns * sizeof(Real32);
+
+        Usage.Record(kOwner, "Columns", mStorage.Columns.capacity() * sizeof(Real32), Live * kRow);
+        Usage.RecordVector(kOwner, "Changed", mChanged);
+        Usage.RecordVector(kOwner, "Previous", mPrevious);
+        Usage.RecordTable(kOwner, "Reported", mReported);
+
+        if (mLedgers)
+        {
+            Usage.RecordTable(kOwner, "Ledgers", * mLedgers);
+        }
+
+        const UInt64 Retained = mPages.GetRetained();
+        Usage.Record(kOwner, "Rollback", Retained, Retained);
+    }
+}
\ No newline at end of file
@@ -12,7 +12,11 @@
 // [  HEADER  ]
 // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 
+#include "Gameplay/Arsenal/MemoryUsage.hpp"
+#include "Gameplay/Arsenal/RollbackPages.hpp"
+#include "Gameplay/Stat/StatBaseline.hpp"
 #include "Gameplay/Stat/StatInstance.hpp"
+#include "Gameplay/Stat/StatLedger.hpp"
 #include "Gameplay/Stat/StatRepository.hpp"
 
 // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
@@ -22,68 +26,329 @@
 namespace Gameplay
 {
     /// \brief Manages a collection of stats.
+    ///
+    /// Stats are stored as columns indexed by stat identifier, so dirty attributes using the default formula can
+    /// be recomputed several lanes at a time. The columns grow to the highest stat inserted, rounded up to a block
+    /// of lanes, so an actor holding a few stats does not pay for every archetype that could be registered.
+    /// Modifiers only mark attributes as dirty, the effective value is recalculated by the next read or poll, no
+    /// matter how many modifiers were stacked in between.
+    ///
+    /// Stats without an instance read their default from the shared baseline, if any, until one of their
+    /// dependencies changes in this set. From then on they are resolved against the set as before.
+    ///
+    /// Aggregated attributes keep a ledger of their modifiers per source, and their columns are rebuilt from it
+    /// whenever the ledger changes instead of being adjusted in place.
     class StatSet final
     {
     public:
 
+        /// \brief Maximum number of stats held by a set, one slot per stat archetype.
+        static constexpr UInt32 kCapacity = StatRepository::kMaxArchetypes;
+
+        /// \brief Number of stats recomputed together by the vectorized default formula.
+        static constexpr UInt32 kLanes    = 8;
+
+        /// \brief Number of words in the presence bitset.
+        static constexpr UInt32 kWords    = kCapacity / 64;
+
+        /// \brief Structure holding the inputs and output of the default formula for a block of stats.
+        struct alignas(32) Block final
+        {
+            /// \brief The base value of each lane.
+            Array<Real32, kLanes> Base;
+
+            /// \brief The flat modifier of each lane.
+            Array<Real32, kLanes> Flat;
+
+            /// \brief The additive modifier of each lane.
+            Array<Real32, kLanes> Additive;
+
+            /// \brief The multiplier modifier of each lane.
+            Array<Real32, kLanes> Multiplier;
+
+            /// \brief The minimum value of each lane.
+            Array<Real32, kLanes> Minimum;
+
+            /// \brief The maximum value of each lane.
+            Array<Real32, kLanes> Maximum;
+
+            /// \brief The clamped result of each lane.
+            Array<Real32, kLanes> Effective;
+        };
+
+        /// \brief Structure holding the state of a set captured for rollback.
+        struct Snapshot final
+        {
+            /// \brief The pages of the stat columns.
+            RollbackPages<Real32>::Pages             Columns;
+
+            /// \brief The number of stats covered by every column.
+            UInt32                                   Stride;
+
+            /// \brief The bitset of attributes whose effective value is stale.
+            Array<UInt64, kWords>                    Dirty;
+
+            /// \brief The bitset of stats whose resolved bounds are up to date.
+            Array<UInt64, kWords>                    Bounded;
+
+            /// \brief The bitset of aggregated attributes whose effective value is forced by a set modifier.
+            Array<UInt64, kWords>                    Overridden;
+
+            /// \brief The presence bitset.
+            Array<UInt64, kWords>                    Presence;
+
+            /// \brief The bitset of stats that no longer read their default from the baseline.
+            Array<UInt64, kWords>                    Diverged;
+
+            /// \brief The ledgers of the aggregated attributes, shared with the set until either side changes them.
+            std::shared_ptr<Table<Stat, StatLedger>> Ledgers;
+        };
+
+    public:
+
+        /// \brief Default constructor, initializes an empty set.
+        ZYPHRYON_INLINE StatSet()
+            : mPresence  { },
+              mDiverged  { },
+              mBaseline  { nullptr },
+              mLedgers   { std::make_shared<Table<Stat, StatLedger>>() },
+              mPublished { }
+        {
+            Clear();
+        }
+
         /// \brief Polls all recorded stat change events and invokes the provided action for each event.
         ///
+        /// \note Events of stats outside the filter are discarded without resolving their current value. Changes the
+        ///       notification policy of a stat deems unimportant are suppressed, and reported as part of the next
+        ///       notable change.
+        ///
         /// \param Source The context used to evaluate stat outcomes.
+        /// \param Filter The bitset of stats, indexed by identifier, whose events should be reported.
         /// \param Action The action to invoke for each stat change event.
         template<typename Context, typename Function>
-        ZYPHRYON_INLINE void Poll(ConstRef<Context> Source, AnyRef<Function> Action)
+        ZYPHRYON_INLINE void Poll(ConstRef<Context> Source, ConstRef<Array<UInt64, kWords>> Filter, AnyRef<Function> Action)
         {
-            for (const auto [Handle, Value] : mNotifications)
+            GAMEPLAY_TRACE_ZONE("StatSet::Poll");
+
+            Array<UInt64, kWords> Batch { };
+
+            const auto IsReported = [&](Stat Handle)
             {
+                return (Filter[Handle.GetID() / 64] >> (Handle.GetID() % 64)) & 1;
+            };
+
+            // Gather the stale attributes using the default formula, so they are recomputed together.
+            for (const Stat Handle : mChanged)
+            {
+                if (!IsReported(Handle) || !Contains(Handle))
+                {
+                    continue;
+                }
+
+                if (ConstRef<StatArchetype> Archetype = StatRepository::View().Get(Handle); !Archetype.GetFormula())
+                {
+                    if (StatInstance(Archetype, mStorage).IsDirty())
+                    {
+                        Batch[Handle.GetID() / 64] |= (1ull << (Handle.GetID() % 64));
+                    }
+                }
+            }
+
+            Recompute(Source, Batch);
+
+            // Attributes with custom formulas are recomputed on read, at most once since their last change.
+            for (UInt32 Change = 0; Change < mChanged.size(); ++Change)
+            {
+                const Stat Handle = mChanged[Change];
+
+                if (!IsReported(Handle))
+                {
+                    continue;
+                }
+
+                Real32 Value = mPrevious[Change];
                 Real32 Current;
 
-                if (const Ptr<StatInstance> Instance = const_cast<Ptr<StatInstance>>(TryGet(Handle)); Instance)
+                if (Contains(Handle))
                 {
-                    Current = Instance->Resolve(Source);
+                    Current = GetEffective(Source, Handle);
                 }
                 else
                 {
-                    Current = StatRepository::Instance().Get(Handle).Calculate(Source, 0.0f, 0.0f, 1.0f);
+                    Current = GetDefault(Source, Handle);
                 }
 
-                if (Current != Value)
+                if (Current == Value)
                 {
-                    Action(Handle, Value, Current);
+                    continue;
+                }
+
+                // Filtered stats are measured against the value last reported, anchored on their first change.
+                if (ConstRef<StatArchetype> Archetype = StatRepository::View().Get(Handle); !Archetype.GetNotify().IsAlways())
+                {
+                    ConstRef<StatNotify> Policy  = Archetype.GetNotify();
+                    const Real32         Maximum = (Policy.GetMode() == StatNotify::Mode::Threshold ? Archetype.GetMaximum().Resolve(Source) : 0.0f);
+
+                    if (const auto Anchor = mReported.find(Handle); Anchor != mReported.end())
+                    {
+                        Value = Anchor->second;
+                    }
+
+                    if (!Policy.IsNotable(Value, Current, Maximum))
+                    {
+                        mReported[Handle] = Value;
+                        continue;
+                    }
+                    mReported[Handle] = Current;
+                }
+
+                Trace::Increment(TraceCounter::Notifications);
+                Action(Handle, Value, Current);
+            }
+            Discard();
+        }
+
+        /// \brief Checks if the set holds an instance of the given stat.
+        ///
+        /// \param Handle The handle of the stat to check.
+        /// \return `true` if the stat is present, `false` otherwise.
+        ZYPHRYON_INLINE Bool Contains(Stat Handle) const
+        {
+            const UInt32 Index = Handle.GetID();
+            return (mPresence[Index / 64] >> (Index % 64)) & 1;
+        }
+
+        /// \brief Retrieves the effective value of a stat held by the set, calculating it if it is stale.
+        ///
+        /// \note Never writes the set, since other actors read it from parallel workers. Stale values are stored by
+        ///       the owner through `Resolve`, on poll or when it publishes a change.
+        ///
+        /// \param Source The context used to calculate the stat if needed.
+        /// \param Handle The handle of the stat to retrieve, which must be present.
+        /// \return The effective value of the stat.
+        template<typename Context>
+        ZYPHRYON_INLINE Real32 GetEffective(ConstRef<Context> Source, Stat Handle) const
+        {
+            LOG_ASSERT(Contains(Handle), "Stat is not present in the set.");
+
+            return StatInstance(StatRepository::View().Get(Handle), mStorage).Evaluate(Source);
+        }
+
+        /// \brief Recalculates and stores the effective value of every stale attribute of the set.
+        ///
+        /// \note Meant to run on the owning thread at the end of a tick, so reads from other actors find the set
+        ///       up to date instead of calculating stale values again.
+        ///
+        /// \param Source The context used to recalculate the stats.
+        template<typename Context>
+        ZYPHRYON_INLINE void Resolve(ConstRef<Context> Source)
+        {
+            Array<UInt64, kWords> Batch    { };
+            Array<UInt64, kWords> Formulas { };
+
+            for (UInt32 Word = 0; Word < kWords; ++Word)
+            {
+                for (UInt64 Bits = mStorage.Dirty[Word] & mPresence[Word]; Bits != 0; Bits &= Bits - 1)
+                {
+                    const UInt32 Index = Word * 64 + std::countr_zero(Bits);
+
+                    if (StatRepository::View().Get(Stat(Index)).GetFormula())
+                    {
+                        Formulas[Word] |= (1ull << (Index % 64));
+                    }
+                    else
+                    {
+                        Batch[Word] |= (1ull << (Index % 64));
+                    }
+                }
+            }
+
+            Recompute(Source, Batch);
+
+            // Custom formulas may read the attributes recomputed above, so they are resolved last.
+            for (UInt32 Word = 0; Word < kWords; ++Word)
+            {
+                for (UInt64 Bits = Formulas[Word]; Bits != 0; Bits &= Bits - 1)
+                {
+                    const UInt32 Index = Word * 64 + std::countr_zero(Bits);
+                    StatInstance(StatRepository::View().Get(Stat(Index)), mStorage).Resolve(Source);
                 }
             }
-            mNotifications.clear();
         }
 
-        /// \brief Attempts to retrieve a stat by its handle.
+        /// \brief Retrieves the value of a stat that has no instance in the set.
         ///
+        /// \param Source The context used to resolve the stat if the baseline cannot be used.
         /// \param Handle The handle of the stat to retrieve.
-        /// \return A constant pointer to the stat if found, otherwise nullptr.
-        ZYPHRYON_INLINE ConstPtr<StatInstance> TryGet(Stat Handle) const
+        /// \return The default value of the stat.
+        template<typename Context>
+        ZYPHRYON_INLINE Real32 GetDefault(ConstRef<Context> Source, Stat Handle) const
         {
-            if (const auto Iterator = mRegistry.find(Handle); Iterator != mRegistry.end())
+            const UInt32 Index = Handle.GetID();
+
+            if (mBaseline && mBaseline->Contains(Handle) && !((mDiverged[Index / 64] >> (Index % 64)) & 1))
             {
-                return &* Iterator;
+                return mBaseline->Get(Handle);
             }
-            return nullptr;
+            return StatRepository::View().Get(Handle).Calculate(Source, 0.0f, 0.0f, 1.0f);
+        }
+
+        /// \brief Sets the baseline holding the default values of stats without an instance.
+        ///
+        /// \param Baseline The shared baseline to read from, or `nullptr` to resolve every default.
+        ZYPHRYON_INLINE void SetBaseline(ConstPtr<StatBaseline> Baseline)
+        {
+            mBaseline = Baseline;
+            mDiverged.fill(0);
+
+            // Bounds may read the defaults of absent stats, which now come from another baseline.
+            mStorage.Bounded.fill(0);
+        }
+
+        /// \brief Retrieves the baseline holding the default values of stats without an instance.
+        ///
+        /// \return The shared baseline, or `nullptr` if none is set.
+        ZYPHRYON_INLINE ConstPtr<StatBaseline> GetBaseline() const
+        {
+            return mBaseline;
+        }
+
+        /// \brief Marks a stat held by the set as stale, so the next read recalculates it.
+        ///
+        /// \note A stat without an instance stops reading its default from the baseline.
+        ///
+        /// \param Handle The handle of the stat to invalidate.
+        /// \return `false` if the stat was already stale, `true` otherwise.
+        ZYPHRYON_INLINE Bool Invalidate(Stat Handle)
+        {
+            if (!Contains(Handle))
+            {
+                mDiverged[Handle.GetID() / 64] |= (1ull << (Handle.GetID() % 64));
+                return true;
+            }
+            return StatInstance(StatRepository::View().Get(Handle), mStorage).Invalidate();
         }
 
         /// \brief Retrieves an existing stat or inserts a new one based on the provided archetype.
         ///
         /// \param Source    The context source used for calculation.
         /// \param Archetype The archetype defining the stat to retrieve or insert.
-        /// \return A reference to the retrieved or newly inserted stat.
+        /// \return A view over the retrieved or newly inserted stat.
         template<typename Context>
-        ZYPHRYON_INLINE Ref<StatInstance> GetOrInsert(ConstRef<Context> Source, ConstRef<StatArchetype> Archetype)
+        ZYPHRYON_INLINE StatInstance GetOrInsert(ConstRef<Context> Source, ConstRef<StatArchetype> Archetype)
         {
-            const auto [Iterator, Inserted] = mRegistry.emplace(Archetype);
-
-            Ref<StatInstance> Instance = const_cast<Ref<StatInstance>>(* Iterator);
+            const UInt32 Index    = Archetype.GetHandle().GetID();
+            StatInstance Instance(Archetype, mStorage);
 
-            if (Inserted)
+            if (!Contains(Archetype.GetHandle()))
             {
+                Reserve(Index);
+                mPresence[Index / 64] |= (1ull << (Index % 64));
+
                 if (Archetype.GetKind() == StatKind::Attribute)
                 {
-                    Instance.Resolve(Source);
+                    Instance.Invalidate();
                 }
                 else
                 {
@@ -93,10 +358,74 @@ namespace Gameplay
             return Instance;
         }
 
+        /// \brief Updates the ledger of an aggregated attribute and rebuilds the attribute from its totals.
+        ///
+        /// \note The most recent set modifier still recorded overrides the effective value until it is removed, and
+        ///       the attribute is flagged so invalidating its dependencies never recalculates over it.
+        ///
+        /// \param Target    The context used to clamp the value forced by a set modifier.
+        /// \param Instance  The view over the aggregated attribute to rebuild.
+        /// \param Action    The action to apply to the ledger of the attribute.
+        template<typename Context, typename Function>
+        ZYPHRYON_INLINE void Aggregate(ConstRef<Context> Target, StatInstance Instance, AnyRef<Function> Action)
+        {
+            const Stat                   Handle  = Instance.GetArchetype()->GetHandle();
+            Ref<Table<Stat, StatLedger>> Ledgers = GetLedgers();
+            Ref<StatLedger>              Ledger  = Ledgers[Handle];
+
+            Action(Ledger);
+
+            Instance.SetFlat(Ledger.GetFlat());
+            Instance.SetAdditive(Ledger.GetAdditive());
+            Instance.SetMultiplier(Ledger.GetMultiplier());
+            Instance.SetOverridden(false);
+            Instance.Invalidate();
+
+            if (Real32 Override; Ledger.GetOverride(Override))
+            {
+                Instance.SetEffective(Target, Override);
+                Instance.SetOverridden(true);
+            }
+
+            if (Ledger.IsEmpty())
+            {
+                Ledgers.erase(Handle);
+            }
+        }
+
+        /// \brief Retrieves the stats changed since the last poll, in the order they first changed.
+        ///
+        /// \return A span over the changed stats, which grows as further stats are published.
+        ZYPHRYON_INLINE ConstSpan<Stat> GetChanges() const
+        {
+            return mChanged;
+        }
+
+        /// \brief Checks if there are stat change events waiting to be polled.
+        ///
+        /// \return `true` if at least one stat change has been recorded, `false` otherwise.
+        ZYPHRYON_INLINE Bool HasNotifications() const
+        {
+            return !mChanged.empty();
+        }
+
         /// \brief Clears all stats from the registry.
         ZYPHRYON_INLINE void Clear()
         {
-            mRegistry.clear();
+            mPresence.fill(0);
+            mDiverged.fill(0);
+            mReported.clear();
+            mStorage.Reset();
+
+            // Ledgers still shared with a snapshot are left to it instead of being emptied.
+            if (mLedgers.use_count() > 1)
+            {
+                mLedgers = std::make_shared<Table<Stat, StatLedger>>();
+            }
+            else
+            {
+                mLedgers->clear();
+            }
         }
 
         /// \brief Publishes a stat change event for the specified stat handle and previous value.
@@ -106,56 +435,193 @@ namespace Gameplay
         /// \return `true` if the notification was successfully published, `false` if it was already recorded.
         ZYPHRYON_INLINE Bool Publish(Stat Handle, Real32 Value)
         {
-            return mNotifications.emplace(Handle, Value).second;
+            const UInt32 ID = Handle.GetID();
+
+            // A published stat already recorded its value from before its first change.
+            if ((mPublished[ID / 64] >> (ID % 64)) & 1)
+            {
+                return false;
+            }
+
+            mPublished[ID / 64] |= (1ull << (ID % 64));
+            mChanged.push_back(Handle);
+            mPrevious.push_back(Value);
+            return true;
+        }
+
+        /// \brief Discards every recorded stat change event without reporting it.
+        ZYPHRYON_INLINE void Discard()
+        {
+            mChanged.clear();
+            mPrevious.clear();
+            mPublished.fill(0);
         }
 
+        /// \brief Hints the processor to fetch the storage of a stat ahead of an upcoming read.
+        ///
+        /// \param Handle The handle of the stat that will be read.
+        void Prefetch(Stat Handle) const;
+
+        /// \brief Evaluates the default formula for every lane of a block and clamps the results.
+        ///
+        /// \param Lanes The block holding the inputs, whose effective values receive the results.
+        static void Calculate(Ref<Block> Lanes);
+
         /// \brief Iterates over all stat instances in the set.
         ///
+        /// \note The effective value of a dirty attribute stays stale until it is read through the set or polled.
+        ///
         /// \param Action The action to apply to each stat instance.
         template<typename Function>
         ZYPHRYON_INLINE void Traverse(AnyRef<Function> Action) const
         {
-            for (ConstRef<StatInstance> Instance : mRegistry)
+            ForEach(mPresence, [&](UInt32 Index)
             {
-                Action(Instance);
-            }
+                Action(StatInstance(StatRepository::View().Get(Stat(Index)), mStorage));
+            });
         }
 
+        /// \brief Loads the stats of the set from a baked snapshot, replacing its current content.
+        ///
+        /// \note Values are restored as they were saved, stale attributes stay stale and nothing is recalculated.
+        ///
+        /// \param Reader The baked snapshot to load from.
+        void Load(Ref<BakeReader> Reader);
+
+        /// \brief Saves the stats of the set to a baked snapshot.
+        ///
+        /// \note Pending notifications and the baseline are not part of the snapshot.
+        ///
+        /// \param Writer The baked snapshot to save to.
+        void Save(Ref<BakeWriter> Writer) const;
+
+        /// \brief Captures the state of the set for rollback.
+        ///
+        /// \note Only the pages of the columns that changed since the previous capture or restore are copied, and
+        ///       the ledgers are shared until the set modifies them. Pending notifications are not captured.
+        ///
+        /// \param Target The snapshot receiving the state, whose previous content is replaced.
+        void Capture(Ref<Snapshot> Target) const;
+
+        /// \brief Restores the state of the set from a rollback snapshot.
+        ///
+        /// \note Pending notifications are discarded and restored values are not reported as changes.
+        ///
+        /// \param Source The snapshot previously filled by `Capture`.
+        void Restore(ConstRef<Snapshot> Source);
+
+        /// \brief Records the memory held by the set, including the ledgers and the pages retained for rollback.
+        ///
+        /// \param Usage The report receiving the usage.
+        void Measure(Ref<MemoryUsage> Usage) const;
+
     private:
 
-        /// \brief Represents a notification of a stat change.
-        struct Notification final
+        /// \brief Retrieves the ledgers for modification, copying them first if a snapshot still shares them.
+        ///
+        /// \return A reference to the ledgers owned by the set.
+        ZYPHRYON_INLINE Ref<Table<Stat, StatLedger>> GetLedgers()
         {
-            /// \brief The handle of the stat that changed.
-            Stat   Key;
+            if (mLedgers.use_count() > 1)
+            {
+                mLedgers = std::make_shared<Table<Stat, StatLedger>>(* mLedgers);
+            }
+            return * mLedgers;
+        }
+
+        /// \brief Grows the columns to cover a stat about to be inserted, in whole blocks of lanes.
+        ///
+        /// \param Index The identifier of the stat to cover.
+        ZYPHRYON_INLINE void Reserve(UInt32 Index)
+        {
+            if (Index >= mStorage.Stride)
+            {
+                mStorage.Resize((Index + kLanes) & ~(kLanes - 1));
+            }
+        }
 
-            /// \brief The previous value of the stat before the change.
-            Real32 Value;
+        /// \brief Recomputes the effective value of the given attributes with the default formula.
+        ///
+        /// \param Source The context used to resolve the base, minimum and maximum values.
+        /// \param Batch  The bitset of attributes to recompute.
+        template<typename Context>
+        ZYPHRYON_INLINE void Recompute(ConstRef<Context> Source, ConstRef<Array<UInt64, kWords>> Batch)
+        {
+            Block Lanes;
 
-            /// \brief Generates a hash value for the notification based on its stat handle.
-            ///
-            /// \return A hash value uniquely representing the notification.
-            ZYPHRYON_INLINE UInt64 Hash() const
+            for (UInt32 Word = 0; Word < kWords; ++Word)
             {
-                return Key.Hash();
+                Trace::Increment(TraceCounter::Recomputes, std::popcount(Batch[Word]));
+
+                for (UInt64 Bits = Batch[Word]; Bits != 0;)
+                {
+                    const UInt32 First = Word * 64 + (std::countr_zero(Bits) & ~(kLanes - 1));
+
+                    for (UInt32 Lane = 0; Lane < kLanes; ++Lane)
+                    {
+                        const UInt32 Index = First + Lane;
+
+                        Lanes.Flat[Lane]       = mStorage.GetFlat()[Index];
+                        Lanes.Additive[Lane]   = mStorage.GetAdditive()[Index];
+                        Lanes.Multiplier[Lane] = mStorage.GetMultiplier()[Index];
+
+                        if ((Bits >> (Index % 64)) & 1)
+                        {
+                            ConstRef<StatArchetype> Archetype = StatRepository::View().Get(Stat(Index));
+
+                            Lanes.Base[Lane]    = Archetype.GetBase().Resolve(Source);
+                            Lanes.Minimum[Lane] = Archetype.GetMinimum().Resolve(Source);
+                            Lanes.Maximum[Lane] = Archetype.GetMaximum().Resolve(Source);
+                        }
+                        else
+                        {
+                            // Idle lanes clamp to their current value, so the kernel leaves them untouched.
+                            Lanes.Base[Lane]    = 0.0f;
+                            Lanes.Minimum[Lane] = mStorage.GetEffective()[Index];
+                            Lanes.Maximum[Lane] = mStorage.GetEffective()[Index];
+                        }
+                    }
+
+                    Calculate(Lanes);
+
+                    std::copy_n(Lanes.Effective.data(), kLanes, mStorage.GetEffective() + First);
+
+                    Bits &= ~(((1ull << kLanes) - 1) << (First % 64));
+                }
+                mStorage.Dirty[Word] &= ~Batch[Word];
             }
+        }
 
-            /// \brief Compares two notifications for equality based on their stat handles.
-            ///
-            /// \param Other The other notification to compare against.
-            /// \return `true` if the notifications refer to the same stat handle, `false` otherwise.
-            ZYPHRYON_INLINE Bool operator==(ConstRef<Notification> Other) const
+        /// \brief Invokes the provided action for the index of each bit set in the bitset.
+        ///
+        /// \param Bitset The bitset to iterate.
+        /// \param Action The action to invoke for each set bit.
+        template<typename Function>
+        ZYPHRYON_INLINE static void ForEach(ConstRef<Array<UInt64, kWords>> Bitset, AnyRef<Function> Action)
+        {
+            for (UInt32 Word = 0; Word < kWords; ++Word)
             {
-                return Key == Other.Key;
+                for (UInt64 Bits = Bitset[Word]; Bits != 0; Bits &= Bits - 1)
+                {
+                    Action(Word * 64 + std::countr_zero(Bits));
+                }
             }
-        };
+        }
 
     private:
 
         // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
         // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 
-        Set<StatInstance> mRegistry;
-        Set<Notification> mNotifications;
+        mutable StatInstance::Storage            mStorage;
+        Array<UInt64, kWords>                    mPresence;
+        Array<UInt64, kWords>                    mDiverged;
+        ConstPtr<StatBaseline>                   mBaseline;
+        std::shared_ptr<Table<Stat, StatLedger>> mLedgers;
+        Vector<Stat>                             mChanged;
+        Vector<Real32>                           mPrevious;
+        Table<Stat, Real32>                      mReported;
+        Array<UInt64, kWords>                    mPublished;
+        mutable RollbackPages<Real32>            mPages;
     };
 }
\ No newline at end of file
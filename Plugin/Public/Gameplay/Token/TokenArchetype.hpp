@@ -77,7 +77,7 @@ namespace Gameplay
 
         /// \brief Sets the path of the token.
         ///
-        /// \param Path The path to assign.
+        /// \param Path The path to assign, which must outlive the archetype (usually interned by the repository).
         ZYPHRYON_INLINE void SetPath(ConstStr8 Path)
         {
             mPath = Path;
@@ -97,7 +97,7 @@ namespace Gameplay
         ZYPHRYON_INLINE ConstStr8 GetName() const
         {
             const UInt Offset = mPath.find_last_of('.');
-            return (Offset != Str8::npos ? GetPath().substr(Offset + 1) : mPath);
+            return (Offset != ConstStr8::npos ? GetPath().substr(Offset + 1) : mPath);
         }
 
         /// \brief Retrieves the active state of the token.
@@ -116,15 +116,14 @@ namespace Gameplay
             return mHandle.IsRoot();
         }
 
-        /// \brief Extends the token archetype by increasing its size and appending a new name segment.
+        /// \brief Extends the token archetype by increasing its size and creating a child token.
         ///
-        /// \param Name The name segment to append.
-        /// \return A new token archetype with increased size and updated name.
-        ZYPHRYON_INLINE TokenArchetype Extend(ConstStr8 Name)
+        /// \param Path The full path of the child, which must outlive the returned archetype.
+        /// \return A new token archetype with increased size and the given path.
+        ZYPHRYON_INLINE TokenArchetype Extend(ConstStr8 Path)
         {
             LOG_ASSERT(mSize < Token::kDepth, "Exceeded maximum size for token.");
 
-            const ConstStr8 Path = !mPath.empty() ? Format("{}.{}", mPath, Name) : Name;
             return TokenArchetype(mHandle.With(++mSize), 0, Path);
         }
 
@@ -153,8 +152,8 @@ namespace Gameplay
         // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
         // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 
-        Token mHandle;
-        UInt8 mSize;
-        Str8  mPath;
+        Token     mHandle;
+        UInt8     mSize;
+        ConstStr8 mPath;
     };
 }
\ No newline at end of file
@@ -12,6 +12,8 @@
 // [  HEADER  ]
 // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 
+#include "Gameplay/Bake/BakeReader.hpp"
+#include "Gameplay/Bake/BakeWriter.hpp"
 #include "Gameplay/Token/Token.hpp"
 
 // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
@@ -107,6 +109,30 @@ namespace Gameplay
             }
         }
 
+        /// \brief Loads the token family from a baked resource.
+        ///
+        /// \param Reader The baked resource to load token IDs from.
+        ZYPHRYON_INLINE void Load(Ref<BakeReader> Reader)
+        {
+            for (UInt8 Index = 0, Count = Reader.Read<UInt8>(); Index < Count; ++Index)
+            {
+                mChildren.emplace_back(Token(Reader.Read<UInt32>()));
+            }
+        }
+
+        /// \brief Saves the token family to a baked resource.
+        ///
+        /// \param Writer The baked resource to save token IDs into.
+        ZYPHRYON_INLINE void Save(Ref<BakeWriter> Writer) const
+        {
+            Writer.Write(static_cast<UInt8>(mChildren.size()));
+
+            for (const Token Child : mChildren)
+            {
+                Writer.Write(Child.GetID());
+            }
+        }
+
     private:
 
         // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
@@ -0,0 +1,69 @@
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// Copyright (C) 2025 by Agustin L. Alvarez. All rights reserved.
+//
+// This work is licensed under the terms of the MIT license.
+//
+// For a copy, see <https://opensource.org/licenses/MIT>.
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [  HEADER  ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#include "Gameplay/Token/TokenLiteral.hpp"
+#include "Gameplay/Token/TokenRepository.hpp"
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [   CODE   ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+namespace Gameplay
+{
+    namespace
+    {
+        /// \brief Retrieves the head of the intrusive list of registered literals.
+        ///
+        /// \return A reference to the head of the list.
+        ZYPHRYON_INLINE Ref<Ptr<TokenLiteral>> GetLiterals()
+        {
+            static Ptr<TokenLiteral> Head = nullptr;
+            return Head;
+        }
+
+        /// \brief Retrieves the mutex guarding the list of registered literals.
+        ///
+        /// \return A reference to the mutex.
+        ZYPHRYON_INLINE Ref<std::mutex> GetLiteralsMutex()
+        {
+            static std::mutex Mutex;
+            return Mutex;
+        }
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    TokenLiteral::TokenLiteral(ConstStr8 Name, UInt64 Hash)
+        : mName   { Name },
+          mHash   { Hash },
+          mHandle { TokenRepository::View().GetByHash(Hash) }
+    {
+        std::lock_guard Guard(GetLiteralsMutex());
+
+        mNext         = GetLiterals();
+        GetLiterals() = this;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void TokenLiteral::Resolve(ConstRef<TokenRepository> Repository)
+    {
+        std::lock_guard Guard(GetLiteralsMutex());
+
+        for (Ptr<TokenLiteral> Literal = GetLiterals(); Literal; Literal = Literal->mNext)
+        {
+            Literal->mHandle = Repository.GetByHash(Literal->mHash);
+        }
+    }
+}
\ No newline at end of file
@@ -0,0 +1,107 @@
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// Copyright (C) 2025 by Agustin L. Alvarez. All rights reserved.
+//
+// This work is licensed under the terms of the MIT license.
+//
+// For a copy, see <https://opensource.org/licenses/MIT>.
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#pragma once
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [  HEADER  ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#include "Gameplay/Token/Token.hpp"
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [   CODE   ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+/// \brief Resolves a token by its full path once, returning the cached handle on every later call.
+///
+/// The path is hashed at compile time, and the handle is refreshed whenever the token repository changes.
+#define GAMEPLAY_TOKEN(Name)                                                                        \
+    ([]() -> ::Gameplay::Token                                                                      \
+    {                                                                                               \
+        static constexpr auto kHash = ::Gameplay::TokenLiteral::Hash(Name);                         \
+        static ::Gameplay::TokenLiteral Literal(Name, kHash);                                       \
+        return Literal.Get();                                                                       \
+    }())
+
+namespace Gameplay
+{
+    class TokenRepository;
+
+    /// \brief Represents a token name resolved once into a cached handle, for lookups on hot paths.
+    ///
+    /// Literals are meant to have static storage duration, usually through the `GAMEPLAY_TOKEN` macro. Every
+    /// literal registers itself on construction and is resolved again each time the token repository changes.
+    class TokenLiteral final
+    {
+    public:
+
+        /// \brief Constructs a literal and resolves it against the tokens registered so far.
+        ///
+        /// \param Name The full path of the token.
+        /// \param Hash The hash of the path, as computed by \ref TokenLiteral::Hash.
+        TokenLiteral(ConstStr8 Name, UInt64 Hash);
+
+        /// \brief Retrieves the cached token handle.
+        ///
+        /// \return The token handle, or an empty token if the name is not registered.
+        ZYPHRYON_INLINE Token Get() const
+        {
+            LOG_ASSERT(!mHandle.IsEmpty(), "Token '{}' is not registered in the repository.", mName);
+            return mHandle;
+        }
+
+        /// \brief Retrieves the full path of the token.
+        ///
+        /// \return The token path.
+        ZYPHRYON_INLINE ConstStr8 GetName() const
+        {
+            return mName;
+        }
+
+        /// \brief Retrieves the hash of the token path.
+        ///
+        /// \return The hash of the token path.
+        ZYPHRYON_INLINE UInt64 GetHash() const
+        {
+            return mHash;
+        }
+
+    public:
+
+        /// \brief Computes the hash of a token path, usable at compile time.
+        ///
+        /// \param Name The token path to hash.
+        /// \return The 64-bit FNV-1a hash of the path.
+        ZYPHRYON_INLINE static constexpr UInt64 Hash(ConstStr8 Name)
+        {
+            UInt64 Result = 0xCBF29CE484222325ull;
+
+            for (const auto Character : Name)
+            {
+                Result = (Result ^ static_cast<UInt8>(Character)) * 0x100000001B3ull;
+            }
+            return Result;
+        }
+
+        /// \brief Resolves every registered literal against the current content of a token repository.
+        ///
+        /// \param Repository The repository to resolve the literals against.
+        static void Resolve(ConstRef<TokenRepository> Repository);
+
+    private:
+
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+        ConstStr8         mName;
+        UInt64            mHash;
+        Token             mHandle;
+        Ptr<TokenLiteral> mNext;
+    };
+}
\ No newline at end of file
@@ -0,0 +1,66 @@
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// Copyright (C) 2025 by Agustin L. Alvarez. All rights reserved.
+//
+// This work is licensed under the terms of the MIT license.
+//
+// For a copy, see <https://opensource.org/licenses/MIT>.
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [  HEADER  ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#include "Gameplay/Token/TokenQuery.hpp"
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [   CODE   ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+namespace Gameplay
+{
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void TokenQuery::Compile(ConstRef<TokenFamily> Family, Match Mode)
+    {
+        ConstRef<TokenRepository> Repository = TokenRepository::View();
+
+        mMode  = Mode;
+        mSize  = 0;
+        mNever = false;
+
+        UInt32 Unknown = 0;
+
+        for (const Token Child : Family.GetChildren())
+        {
+            const UInt16 Index = Repository.GetIndex(Child);
+
+            if (Index == 0)
+            {
+                LOG_WARNING("Token '{}' is not registered, it can never be present in query.", Child.GetID());
+                ++Unknown;
+                continue;
+            }
+
+            const UInt16 Word = Index / 64;
+            const UInt64 Bit  = 1ull << (Index % 64);
+
+            // Merge tokens sharing a word, so evaluation checks each word once.
+            if (const auto Iterator = std::find(mWords.begin(), mWords.begin() + mSize, Word); Iterator != mWords.begin() + mSize)
+            {
+                mMasks[Iterator - mWords.begin()] |= Bit;
+            }
+            else
+            {
+                mWords[mSize]   = Word;
+                mMasks[mSize++] = Bit;
+            }
+        }
+
+        // Requiring a missing token, or only missing tokens, can never be satisfied. Forbidding one always is.
+        if (Unknown > 0)
+        {
+            mNever = (Mode == Match::All || (Mode == Match::Any && mSize == 0));
+        }
+    }
+}
\ No newline at end of file
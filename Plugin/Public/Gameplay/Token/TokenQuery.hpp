@@ -0,0 +1,172 @@
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// Copyright (C) 2025 by Agustin L. Alvarez. All rights reserved.
+//
+// This work is licensed under the terms of the MIT license.
+//
+// For a copy, see <https://opensource.org/licenses/MIT>.
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#pragma once
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [  HEADER  ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#include "Gameplay/Token/TokenFamily.hpp"
+#include "Gameplay/Token/TokenSet.hpp"
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [   CODE   ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+namespace Gameplay
+{
+    /// \brief Represents a token family compiled into a bitmask over the dense token indices.
+    ///
+    /// Only the words holding at least one token are kept, so a query checks a handful of words against the
+    /// presence bitset of a set instead of looking up each token.
+    ///
+    /// \note Dense indices change when the token hierarchy is rebuilt, so queries must be compiled afterwards. A token
+    ///       that is not registered can never be present, so a query needing it is compiled as never satisfied.
+    class TokenQuery final
+    {
+    public:
+
+        /// \brief Maximum number of distinct words a query can hold, one per token of a family at most.
+        static constexpr UInt32 kMaxWords = TokenFamily::kMaxChildren;
+
+        /// \brief Defines how the tokens of the query are matched against a set.
+        enum class Match : UInt8
+        {
+            All,    ///< Every token must be present.
+            Any,    ///< At least one token must be present.
+            None,   ///< No token may be present.
+        };
+
+    public:
+
+        /// \brief Default constructor, initializes an empty query.
+        ZYPHRYON_INLINE TokenQuery()
+            : mMode  { Match::All },
+              mSize  { 0 },
+              mNever { false },
+              mWords { },
+              mMasks { }
+        {
+        }
+
+        /// \brief Constructs a query by compiling the provided token family.
+        ///
+        /// \param Family The token family to compile.
+        /// \param Mode   The way tokens are matched against a set.
+        ZYPHRYON_INLINE TokenQuery(ConstRef<TokenFamily> Family, Match Mode = Match::All)
+            : TokenQuery()
+        {
+            Compile(Family, Mode);
+        }
+
+        /// \brief Compiles the provided token family into the query, replacing its previous content.
+        ///
+        /// \param Family The token family to compile.
+        /// \param Mode   The way tokens are matched against a set.
+        void Compile(ConstRef<TokenFamily> Family, Match Mode);
+
+        /// \brief Checks if the query holds no token.
+        ///
+        /// \return `true` if the query is empty, `false` otherwise or if it can never be satisfied.
+        ZYPHRYON_INLINE Bool IsEmpty() const
+        {
+            return mSize == 0 && !mNever;
+        }
+
+        /// \brief Checks if the query requires a token that is not registered, so no set can satisfy it.
+        ///
+        /// \return `true` if the query can never be satisfied, `false` otherwise.
+        ZYPHRYON_INLINE Bool IsNever() const
+        {
+            return mNever;
+        }
+
+        /// \brief Retrieves the way tokens are matched against a set.
+        ///
+        /// \return The match mode of the query.
+        ZYPHRYON_INLINE Match GetMode() const
+        {
+            return mMode;
+        }
+
+        /// \brief Evaluates the query against a token set using its match mode.
+        ///
+        /// \param Tokens The token set to evaluate.
+        /// \return `true` if the set satisfies the query, `false` otherwise.
+        ZYPHRYON_INLINE Bool Evaluate(ConstRef<TokenSet> Tokens) const
+        {
+            switch (mMode)
+            {
+            case Match::All:
+                return HasAll(Tokens);
+            case Match::Any:
+                return HasAny(Tokens);
+            case Match::None:
+                return HasNone(Tokens);
+            }
+            return false;
+        }
+
+        /// \brief Checks if every token of the query is present in the set.
+        ///
+        /// \param Tokens The token set to evaluate.
+        /// \return `true` if all tokens are present or the query is empty, `false` otherwise.
+        ZYPHRYON_INLINE Bool HasAll(ConstRef<TokenSet> Tokens) const
+        {
+            if (mNever)
+            {
+                return false;
+            }
+
+            for (UInt32 Word = 0; Word < mSize; ++Word)
+            {
+                if ((Tokens.GetPresence(mWords[Word]) & mMasks[Word]) != mMasks[Word])
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        /// \brief Checks if at least one token of the query is present in the set.
+        ///
+        /// \param Tokens The token set to evaluate.
+        /// \return `true` if any token is present, `false` otherwise or if the query is empty.
+        ZYPHRYON_INLINE Bool HasAny(ConstRef<TokenSet> Tokens) const
+        {
+            UInt64 Result = 0;
+
+            for (UInt32 Word = 0; Word < mSize; ++Word)
+            {
+                Result |= Tokens.GetPresence(mWords[Word]) & mMasks[Word];
+            }
+            return Result != 0;
+        }
+
+        /// \brief Checks if no token of the query is present in the set.
+        ///
+        /// \param Tokens The token set to evaluate.
+        /// \return `true` if no token is present or the query is empty, `false` otherwise.
+        ZYPHRYON_INLINE Bool HasNone(ConstRef<TokenSet> Tokens) const
+        {
+            return !HasAny(Tokens);
+        }
+
+    private:
+
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+        Match                    mMode;
+        UInt8                    mSize;
+        Bool                     mNever;
+        Array<UInt16, kMaxWords> mWords;
+        Array<UInt64, kMaxWords> mMasks;
+    };
+}
\ No newline at end of file
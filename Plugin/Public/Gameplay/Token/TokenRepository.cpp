@@ -23,10 +23,20 @@ namespace Gameplay
 
     void TokenRepository::Load(Ref<Content::Service> Content, ConstStr8 Filename)
     {
+        LOG_ASSERT(!mFrozen, "Cannot modify the token repository while it is frozen.");
+
         if (const Blob Data = Content.Find(Filename); Data)
         {
-            TOMLParser Parser(Data.GetText());
-            Load(Parser);
+            if (BakeReader::IsBaked(Data.GetSpan()))
+            {
+                BakeReader Reader(Data.GetSpan());
+                Load(Reader);
+            }
+            else
+            {
+                TOMLParser Parser(Data.GetText());
+                Load(Parser);
+            }
         }
         else
         {
@@ -48,8 +58,21 @@ namespace Gameplay
     // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
     // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 
+    void TokenRepository::Bake(Ref<Content::Service> Content, ConstStr8 Filename) const
+    {
+        BakeWriter Writer(BakeKind::Token);
+        Save(Writer);
+
+        Content.Save(Filename, Writer.GetData());
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
     void TokenRepository::Insert(ConstStr8 Name, Token Parent)
     {
+        LOG_ASSERT(!mFrozen, "Cannot modify the token repository while it is frozen.");
+
         for (UInt Start = 0, End = 0; End != ConstStr8::npos; Start = End + 1)
         {
             // Extract the next segment from the hierarchical name.
@@ -58,7 +81,8 @@ namespace Gameplay
             // Check if the segment already exists under the parent.
             if (const Token Token = GetByName(Name.substr(0, End)); Token.IsEmpty())
             {
-                TokenArchetype Archetype = GetMutable(Parent).Extend(Name.substr(Start, End - Start));
+                const ConstStr8 Path     = Intern(Get(Parent).GetPath(), Name.substr(Start, End - Start));
+                TokenArchetype Archetype = GetMutable(Parent).Extend(Path);
                 Parent                   = Archetype.GetHandle();
                 Insert(Move(Archetype));
             }
@@ -67,6 +91,88 @@ namespace Gameplay
                 Parent = Token;
             }
         }
+
+        Rebuild();
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void TokenRepository::Rebuild()
+    {
+        LOG_ASSERT(!mFrozen, "Cannot modify the token repository while it is frozen.");
+
+        ++mGeneration;
+
+        Vector<TokenArchetype> Sorted;
+        Sorted.reserve(mArchetypes.size());
+
+        mFirst.fill(0);
+        mSizes.fill(0);
+
+        // Lay the hierarchy out breadth first, the sorted array doubles as the work queue.
+        Sorted.emplace_back(Move(mArchetypes[mLookup[Token::kEmpty]]));
+
+        for (UInt32 Head = 0; Head < Sorted.size(); ++Head)
+        {
+            const Token Handle = Sorted[Head].GetHandle();
+            const UInt8 Size   = Sorted[Head].GetSize();
+
+            if (Head < kMaxTokens && Sorted.size() + Size <= kMaxTokens)
+            {
+                mFirst[Head] = Sorted.size();
+                mSizes[Head] = Size;
+            }
+            else if (Size > 0)
+            {
+                LOG_WARNING("Exceeded maximum number of tokens, '{}' children are not indexed.", Sorted[Head].GetPath());
+            }
+
+            for (UInt8 Child = 1; Child <= Size; ++Child)
+            {
+                Sorted.emplace_back(Move(mArchetypes[mLookup[Handle.With(Child)]]));
+            }
+        }
+
+        // Store the archetypes in dense index order, so the slot of a token matches its dense index.
+        LOG_ASSERT(Sorted.size() == mArchetypes.size(), "Token hierarchy holds unreachable archetypes.");
+
+        mArchetypes = Move(Sorted);
+        mLookup.clear();
+
+        for (UInt32 Index = 0; Index < mArchetypes.size(); ++Index)
+        {
+            mLookup.emplace(mArchetypes[Index].GetHandle(), static_cast<UInt16>(Index));
+        }
+
+        // Refresh the cached handle of every token literal.
+        TokenLiteral::Resolve(* this);
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    ConstStr8 TokenRepository::Intern(ConstStr8 Prefix, ConstStr8 Name)
+    {
+        const UInt Length = (Prefix.empty() ? 0 : Prefix.size() + 1) + Name.size();
+
+        // Blocks never grow past their reserved capacity, so views into them stay valid.
+        if (mArena.empty() || mArena.back().capacity() - mArena.back().size() < Length)
+        {
+            mArena.emplace_back().reserve(Max<UInt>(kArenaBlock, Length));
+        }
+
+        Ref<Str8>  Block  = mArena.back();
+        const UInt Offset = Block.size();
+
+        if (!Prefix.empty())
+        {
+            Block.append(Prefix);
+            Block.push_back('.');
+        }
+        Block.append(Name);
+
+        return ConstStr8(Block.data() + Offset, Length);
     }
 
     // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
@@ -74,10 +180,12 @@ namespace Gameplay
 
     void TokenRepository::Delete(Token Handle)
     {
+        LOG_ASSERT(!mFrozen, "Cannot modify the token repository while it is frozen.");
+
         Ref<TokenArchetype> Archetype = GetMutable(Handle);
 
-        // Remove the token from the lookup table.
-        mTokens.erase(Archetype.GetName());
+        // Remove the token from the name lookup table.
+        mHashes.erase(TokenLiteral::Hash(Archetype.GetPath()));
 
         // Clear the path.
         Archetype.SetPath("");
@@ -100,6 +208,8 @@ namespace Gameplay
         Root.SetSize(Collection.GetSize());
 
         LoadItemRecursive(Collection, Root.GetHandle(), Root.GetPath());
+
+        Rebuild();
     }
 
     // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
@@ -124,14 +234,7 @@ namespace Gameplay
             TokenArchetype Archetype;
             Archetype.SetHandle(Parent.With(Index + 1));
 
-            if (!Prefix.empty())
-            {
-                Archetype.SetPath(Format("{}.{}", Prefix, Node.GetString("Name")));
-            }
-            else
-            {
-                Archetype.SetPath(Node.GetString("Name"));
-            }
+            Archetype.SetPath(Intern(Prefix, Node.GetString("Name")));
 
             if (!Children.IsNull())
             {
@@ -162,4 +265,70 @@ namespace Gameplay
             }
         }
     }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void TokenRepository::Load(Ref<BakeReader> Reader)
+    {
+        if (!Reader.Open(BakeKind::Token))
+        {
+            return;
+        }
+
+        // Archetypes are baked in dense index order, starting with the root.
+        for (UInt32 Element = 0, Count = Reader.Read<UInt32>(); Element < Count && Reader.IsValid(); ++Element)
+        {
+            const Token     Handle = Reader.Read<UInt32>();
+            const UInt8     Size   = Reader.Read<UInt8>();
+            const ConstStr8 Path   = Reader.ReadString();
+
+            if (Handle == Token::kEmpty)
+            {
+                GetMutable(Handle).SetSize(Size);
+            }
+            else
+            {
+                Insert(TokenArchetype(Handle, Size, Intern("", Path)));
+            }
+        }
+
+        Rebuild();
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void TokenRepository::Save(Ref<BakeWriter> Writer) const
+    {
+        Writer.Write(static_cast<UInt32>(mArchetypes.size()));
+
+        for (ConstRef<TokenArchetype> Archetype : mArchetypes)
+        {
+            Writer.Write(Archetype.GetHandle().GetID());
+            Writer.Write(Archetype.GetSize());
+            Writer.WriteString(Archetype.GetPath());
+        }
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void TokenRepository::Measure(Ref<MemoryUsage> Usage) const
+    {
+        constexpr ConstStr8 kOwner = "TokenRepository";
+
+        Usage.RecordVector(kOwner, "Archetypes", mArchetypes);
+        Usage.RecordTable(kOwner, "Lookup", mLookup);
+        Usage.RecordTable(kOwner, "Hashes", mHashes);
+        Usage.RecordVector(kOwner, "Arena", mArena);
+
+        for (ConstRef<Str8> Name : mArena)
+        {
+            Usage.Record(kOwner, "Names", Name.capacity(), Name.size());
+        }
+
+        Usage.RecordBlock(kOwner, "Hierarchy", mFirst, mArchetypes.size() * sizeof(UInt16));
+        Usage.RecordBlock(kOwner, "Sizes", mSizes, mArchetypes.size() * sizeof(UInt8));
+    }
 }
\ No newline at end of file
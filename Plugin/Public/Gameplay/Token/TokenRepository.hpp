@@ -12,9 +12,21 @@
 // [  HEADER  ]
 // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 
+#include "Gameplay/Arsenal/GameplayContext.hpp"
+#include "Gameplay/Bake/BakeReader.hpp"
+#include "Gameplay/Bake/BakeWriter.hpp"
 #include "Gameplay/Token/TokenArchetype.hpp"
+#include "Gameplay/Token/TokenLiteral.hpp"
 #include <Zyphryon.Content/Service.hpp>
 
+#ifndef GAMEPLAY_MAX_TOKENS
+    #define GAMEPLAY_MAX_TOKENS 4096
+#endif
+
+#ifndef GAMEPLAY_TOKEN_ARENA_BLOCK
+    #define GAMEPLAY_TOKEN_ARENA_BLOCK (64 * 1024)
+#endif
+
 // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 // [   CODE   ]
 // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
@@ -22,20 +34,38 @@
 namespace Gameplay
 {
     /// \brief Manages a registry of token archetypes, allowing loading and saving from/to TOML resources.
+    ///
+    /// Archetypes are stored contiguously in dense index order, and their paths are views into a string arena
+    /// owned by the repository, so registering a token performs no per-token string allocation.
     class TokenRepository final
     {
         /// TODO: Reuse tokens from deleted tokens?
 
+    public:
+
+        /// \brief Maximum number of tokens that can be registered, including the root.
+        static constexpr UInt32 kMaxTokens  = GAMEPLAY_MAX_TOKENS;
+
+        /// \brief Number of words in a bitset holding one bit per token.
+        static constexpr UInt32 kWords      = kMaxTokens / 64;
+
+        static_assert(kMaxTokens % 64 == 0, "The capacity must be a multiple of 64, as it is tracked by 64-bit words.");
+
+        /// \brief Size in bytes of each block of the string arena holding token paths.
+        static constexpr UInt32 kArenaBlock = GAMEPLAY_TOKEN_ARENA_BLOCK;
+
     public:
 
         /// \brief Default constructor, initializes the repository with a root archetype.
         ZYPHRYON_INLINE TokenRepository()
         {
-            mArchetypes.emplace();
+            Clear();
         }
 
         /// \brief Loads token archetypes from the content service.
         ///
+        /// \note Both TOML and baked resources are accepted, baked resources are detected by their header.
+        ///
         /// \param Content  The content service to load from.
         /// \param Filename The filename of the resource to load.
         void Load(Ref<Content::Service> Content, ConstStr8 Filename);
@@ -46,6 +76,12 @@ namespace Gameplay
         /// \param Filename The filename of the resource to save.
         void Save(Ref<Content::Service> Content, ConstStr8 Filename) const;
 
+        /// \brief Bakes token archetypes into a binary resource that loads without parsing.
+        ///
+        /// \param Content  The content service to save to.
+        /// \param Filename The filename of the resource to save.
+        void Bake(Ref<Content::Service> Content, ConstStr8 Filename) const;
+
         /// \brief Inserts a new token archetype into the repository by name and optional parent.
         ///
         /// \param Name   The name of the token archetype to insert.
@@ -60,12 +96,159 @@ namespace Gameplay
         /// \brief Clears all token archetypes from the repository.
         ZYPHRYON_INLINE void Clear()
         {
-            // Clear all registered tokens.
-            mTokens.clear();
+            LOG_ASSERT(!mFrozen, "Cannot modify the token repository while it is frozen.");
+
+            // Clear all registered tokens and their paths.
+            mHashes.clear();
+            mArena.clear();
 
             // Reset the root archetype.
             mArchetypes.clear();
-            mArchetypes.emplace();
+            mLookup.clear();
+            Insert(TokenArchetype());
+
+            Rebuild();
+        }
+
+        /// \brief Freezes the repository, so it can be read from any thread without synchronization.
+        ///
+        /// \note While frozen, the repository cannot be modified until thawed, which must happen between ticks, when no
+        ///       other thread is reading.
+        ZYPHRYON_INLINE void Freeze()
+        {
+            mFrozen = true;
+        }
+
+        /// \brief Thaws the repository, allowing it to be modified again.
+        ZYPHRYON_INLINE void Thaw()
+        {
+            mFrozen = false;
+        }
+
+        /// \brief Checks if the repository is frozen.
+        ///
+        /// \return `true` if the repository is read-only, `false` otherwise.
+        ZYPHRYON_INLINE Bool IsFrozen() const
+        {
+            return mFrozen;
+        }
+
+        /// \brief Assigns a dense index to every registered token, keeping the children of a token contiguous.
+        ///
+        /// \note Indices change whenever the hierarchy changes, so tokens should be registered before any
+        ///       token set is populated. Token literals are resolved again afterwards, and the generation is bumped
+        ///       so compiled queries can tell they are stale.
+        void Rebuild();
+
+        /// \brief Retrieves the generation of the hierarchy, bumped every time dense indices are reassigned.
+        ///
+        /// \return The current generation of the hierarchy.
+        ZYPHRYON_INLINE UInt32 GetGeneration() const
+        {
+            return mGeneration;
+        }
+
+        /// \brief Retrieves the dense index of a token without hashing.
+        ///
+        /// \param Handle The token to look up.
+        /// \return The dense index of the token, or `0` (the root) if the token is not registered.
+        ZYPHRYON_INLINE UInt16 GetIndex(Token Handle) const
+        {
+            UInt16 Index = 0;
+
+            for (UInt8 Level = 0; Level < Token::kDepth; ++Level)
+            {
+                const UInt32 Value = Handle.GetLevel(Level);
+
+                if (Value == 0)
+                {
+                    break;
+                }
+
+                if (Value > mSizes[Index])
+                {
+                    return 0;
+                }
+                Index = mFirst[Index] + Value - 1;
+            }
+            return Index;
+        }
+
+        /// \brief Iterates over the dense index of a token and each of its ancestors, from the root down.
+        ///
+        /// \param Handle The token whose hierarchy to iterate.
+        /// \param Action The action to invoke with the dense index of each level.
+        template<typename Function>
+        ZYPHRYON_INLINE void Iterate(Token Handle, AnyRef<Function> Action) const
+        {
+            UInt16 Index = 0;
+
+            for (UInt8 Level = 0; Level < Token::kDepth; ++Level)
+            {
+                const UInt32 Value = Handle.GetLevel(Level);
+
+                if (Value == 0 || Value > mSizes[Index])
+                {
+                    break;
+                }
+
+                Index = mFirst[Index] + Value - 1;
+                Action(Index);
+            }
+        }
+
+        /// \brief Iterates over the ranges of dense indices holding the descendants of a token, one per level below it.
+        ///
+        /// \note Children are laid out contiguously and breadth first, so the descendants of a token at any depth form
+        ///       a single run of indices, and a whole subtree is covered by at most one range per level.
+        ///
+        /// \param Handle The token whose descendants to iterate, the root covers every registered token.
+        /// \param Action The action to invoke with the first and one past the last dense index of each range.
+        template<typename Function>
+        ZYPHRYON_INLINE void IterateDescendants(Token Handle, AnyRef<Function> Action) const
+        {
+            UInt32 First = GetIndex(Handle);
+
+            if (First == 0 && !Handle.IsEmpty())
+            {
+                return;
+            }
+
+            for (UInt32 Last = First + 1; First < Last;)
+            {
+                // Trim the leaves at both ends, their children are not indexed.
+                while (First < Last && mSizes[First] == 0)
+                {
+                    ++First;
+                }
+
+                while (Last > First && mSizes[Last - 1] == 0)
+                {
+                    --Last;
+                }
+
+                if (First == Last)
+                {
+                    break;
+                }
+
+                const UInt32 Begin = mFirst[First];
+                const UInt32 End   = mFirst[Last - 1] + mSizes[Last - 1];
+
+                Action(Begin, End);
+
+                First = Begin;
+                Last  = End;
+            }
+        }
+
+        /// \brief Retrieves the token assigned to a dense index.
+        ///
+        /// \param Index The dense index to look up.
+        /// \return The token assigned to the index.
+        ZYPHRYON_INLINE Token GetByIndex(UInt16 Index) const
+        {
+            return mArchetypes[Index].GetHandle();
         }
 
         /// \brief Retrieves a token by its name.
@@ -74,8 +257,20 @@ namespace Gameplay
         /// \return The token associated with the given name, or an empty token if not found
         ZYPHRYON_INLINE Token GetByName(ConstStr8 Name) const
         {
-            const auto Iterator = mTokens.find(Name);
-            return Iterator != mTokens.end() ? Iterator->second : Token::kEmpty;
+            const Token Handle = GetByHash(TokenLiteral::Hash(Name));
+
+            // Compare the path as well, so a hash collision never resolves to the wrong token.
+            return !Handle.IsEmpty() && Get(Handle).GetPath() == Name ? Handle : Token::kEmpty;
+        }
+
+        /// \brief Retrieves a token by the hash of its name, as computed by \ref TokenLiteral::Hash.
+        ///
+        /// \param Hash The hash of the name of the token to retrieve.
+        /// \return The token associated with the given hash, or an empty token if not found
+        ZYPHRYON_INLINE Token GetByHash(UInt64 Hash) const
+        {
+            const auto Iterator = mHashes.find(Hash);
+            return Iterator != mHashes.end() ? Iterator->second : Token::kEmpty;
         }
 
         /// \brief Retrieves a token archetype by its token.
@@ -84,10 +279,10 @@ namespace Gameplay
         /// \return A constant reference to the requested token archetype.
         ZYPHRYON_INLINE ConstRef<TokenArchetype> Get(Token Handle) const
         {
-            const auto Iterator = mArchetypes.find(Handle);
-            LOG_ASSERT(Iterator != mArchetypes.end(), "Token not found in repository");
+            const auto Iterator = mLookup.find(Handle);
+            LOG_ASSERT(Iterator != mLookup.end(), "Token not found in repository");
 
-            return * Iterator;
+            return mArchetypes[Iterator->second];
         }
 
         /// \brief Retrieves all token archetypes in the repository.
@@ -110,6 +305,16 @@ namespace Gameplay
         /// \param Parser The TOML resource to save token archetype definitions into.
         void Save(Ref<TOMLParser> Parser) const;
 
+        /// \brief Loads token archetypes from a baked resource.
+        ///
+        /// \param Reader The baked resource containing token archetype definitions.
+        void Load(Ref<BakeReader> Reader);
+
+        /// \brief Saves token archetypes to a baked resource.
+        ///
+        /// \param Writer The baked resource to save token archetype definitions into.
+        void Save(Ref<BakeWriter> Writer) const;
+
         /// \brief Retrieves a mutable reference to a token archetype by its token.
         ///
         /// \param Handle The handle of the token archetype to retrieve.
@@ -124,10 +329,25 @@ namespace Gameplay
         /// \param Archetype The token archetype to insert.
         ZYPHRYON_INLINE void Insert(AnyRef<TokenArchetype> Archetype)
         {
-            mTokens.emplace(Archetype.GetPath(), Archetype.GetHandle());
-            mArchetypes.insert(Move(Archetype));
+            if (!Archetype.GetPath().empty())
+            {
+                if (const auto [Iterator, Inserted] = mHashes.emplace(TokenLiteral::Hash(Archetype.GetPath()), Archetype.GetHandle()); !Inserted)
+                {
+                    LOG_WARNING("Token '{}' collides with another token hash.", Archetype.GetPath());
+                }
+            }
+
+            mLookup.emplace(Archetype.GetHandle(), static_cast<UInt16>(mArchetypes.size()));
+            mArchetypes.emplace_back(Move(Archetype));
         }
 
+        /// \brief Copies a token path into the string arena.
+        ///
+        /// \param Prefix The path of the parent token, or empty for a root token.
+        /// \param Name   The name segment of the token.
+        /// \return A view over the interned path, valid until the repository is cleared.
+        ConstStr8 Intern(ConstStr8 Prefix, ConstStr8 Name);
+
         /// \brief Recursively loads token archetypes from a TOML array.
         ///
         /// \param Collection The TOML array to load token archetype definitions from.
@@ -143,21 +363,39 @@ namespace Gameplay
 
     public:
 
-        /// \brief Retrieves the singleton instance of the repository.
+        /// \brief Retrieves the repository of the context current on the calling thread.
         ///
-        /// \return A reference to the singleton repository instance.
+        /// \return A reference to the repository of the current context.
         ZYPHRYON_INLINE static Ref<TokenRepository> Instance()
         {
-            static TokenRepository Singleton;
-            return Singleton;
+            return GameplayContext::Current().GetTokens();
+        }
+
+        /// \brief Retrieves the read-only view of the repository, safe to share between threads once frozen.
+        ///
+        /// \return A constant reference to the singleton repository instance.
+        ZYPHRYON_INLINE static ConstRef<TokenRepository> View()
+        {
+            return Instance();
         }
 
+        /// \brief Records the memory held by the repository.
+        ///
+        /// \param Usage The report receiving the usage.
+        void Measure(Ref<MemoryUsage> Usage) const;
+
     private:
 
         // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
         // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 
-        Set<TokenArchetype> mArchetypes;
-        TextTable<Token>    mTokens;
+        Vector<TokenArchetype>    mArchetypes;
+        Table<Token, UInt16>      mLookup;
+        Table<UInt64, Token>      mHashes;
+        Vector<Str8>              mArena;
+        Array<UInt16, kMaxTokens> mFirst;
+        Array<UInt8, kMaxTokens>  mSizes;
+        Bool                      mFrozen = false;
+        UInt32                    mGeneration = 0;
     };
 }
\ No newline at end of file
@@ -10,4 +10,111 @@
 // [  HEADER  ]
 // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 
-#include "Gameplay/Token/TokenSet.hpp"
\ No newline at end of file
+#include "Gameplay/Token/TokenSet.hpp"
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [   CODE   ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+namespace Gameplay
+{
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void TokenSet::Load(Ref<BakeReader> Reader)
+    {
+        ConstRef<TokenRepository> Repository = TokenRepository::View();
+
+        // Nothing is left to poll once loaded, so the chunks are released along with their changes.
+        mSlots.fill(0);
+        mChunks.clear();
+
+        for (UInt32 Element = 0, Count = Reader.Read<UInt32>(); Element < Count && Reader.IsValid(); ++Element)
+        {
+            const Token  Handle = Reader.Read<UInt32>();
+            const UInt16 Value  = Reader.Read<UInt16>();
+
+            // Unknown tokens map to the root, whose count must stay zero.
+            if (const UInt16 Index = Repository.GetIndex(Handle); Index != 0 && Value != 0)
+            {
+                Ref<Chunk> Chunk = GetChunk(Index);
+                Chunk.Counts[Index % kChunkSize]  = Value;
+                Chunk.Presence                   |= (1ull << (Index % 64));
+            }
+            else
+            {
+                LOG_WARNING("Discarding snapshot of unknown token {}.", Handle.GetID());
+            }
+        }
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void TokenSet::Save(Ref<BakeWriter> Writer) const
+    {
+        ConstRef<TokenRepository> Repository = TokenRepository::View();
+
+        UInt32 Count = 0;
+
+        Resolve();
+
+        for (ConstRef<Chunk> Chunk : mChunks)
+        {
+            Count += std::popcount(Chunk.Presence);
+        }
+        Writer.Write(Count);
+
+        ForEach(& Chunk::Presence, [&](UInt32 Index)
+        {
+            Writer.Write(Repository.GetByIndex(Index).GetID());
+            Writer.Write(static_cast<UInt16>(GetCount(Index)));
+        });
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void TokenSet::Capture(Ref<Snapshot> Target) const
+    {
+        Resolve();
+
+        mPages.Capture(mChunks, Target.Chunks);
+
+        Target.Size  = static_cast<UInt32>(mChunks.size());
+        Target.Slots = mSlots;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void TokenSet::Restore(ConstRef<Snapshot> Source)
+    {
+        mChunks.resize(Source.Size);
+        mPages.Restore(mChunks, Source.Chunks);
+
+        // Snapshots are captured resolved, so the chunks restored hold no pending change.
+        mSlots = Source.Slots;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void TokenSet::Measure(Ref<MemoryUsage> Usage) const
+    {
+        constexpr ConstStr8 kOwner = "TokenSet";
+
+        UInt32 Live = 0;
+
+        for (ConstRef<Chunk> Chunk : mChunks)
+        {
+            Live += std::popcount(Chunk.Presence);
+        }
+
+        Usage.RecordBlock(kOwner, "Slots", mSlots, mChunks.size() * sizeof(UInt16));
+        Usage.Record(kOwner, "Chunks", mChunks.capacity() * sizeof(Chunk), Live * (sizeof(Chunk) / kChunkSize));
+
+        const UInt64 Retained = mPages.GetRetained();
+        Usage.Record(kOwner, "Rollback", Retained, Retained);
+    }
+}
\ No newline at end of file
@@ -12,7 +12,14 @@
 // [  HEADER  ]
 // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 
-#include "Gameplay/Token/Token.hpp"
+#include "Gameplay/Arsenal/MemoryUsage.hpp"
+#include "Gameplay/Arsenal/RollbackPages.hpp"
+#include "Gameplay/Arsenal/Trace.hpp"
+#include "Gameplay/Token/TokenRepository.hpp"
+
+#ifndef GAMEPLAY_TOKEN_LAZY_ANCESTORS
+    #define GAMEPLAY_TOKEN_LAZY_ANCESTORS 0
+#endif
 
 // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 // [   CODE   ]
@@ -21,68 +28,318 @@
 namespace Gameplay
 {
     /// \brief Manages a set of tokens with associated counts.
+    ///
+    /// Counts are indexed by the dense index the repository assigns to each token, so inserting a token walks its
+    /// ancestors without hashing and querying a count is two array reads. They are stored in chunks covering 64
+    /// consecutive indices, together with the presence and change bits of those tokens. A chunk is allocated the
+    /// first time one of its tokens is touched, so an actor only pays for the parts of the hierarchy it holds, and
+    /// an actor without tokens only carries the table locating its chunks.
+    ///
+    /// When `GAMEPLAY_TOKEN_LAZY_ANCESTORS` is enabled, inserts and removes only touch the token itself and record
+    /// the net change as pending. Counts of ancestors are derived from the pending changes of their subtree when
+    /// queried, and written back when the owning arsenal resolves the set: on poll, before it tests its own tokens
+    /// and on save or capture. Reads of the presence bitset never resolve, so other actors' workers only ever read
+    /// the set, and they observe ancestors as of the last resolve.
     class TokenSet final
     {
     public:
 
+        /// \brief Maximum number of distinct tokens held by a set, one slot per registered token.
+        static constexpr UInt32 kCapacity  = TokenRepository::kMaxTokens;
+
+        /// \brief Number of words in the presence and notification bitsets.
+        static constexpr UInt32 kWords     = TokenRepository::kWords;
+
+        /// \brief Number of tokens covered by a chunk, one word of the presence bitset.
+        static constexpr UInt32 kChunkSize = 64;
+
+        /// \brief Whether ancestor counts are updated lazily rather than on every insert and remove.
+        static constexpr Bool   kLazy      = GAMEPLAY_TOKEN_LAZY_ANCESTORS;
+
+        /// \brief Structure holding the state of the tokens covered by a word of the presence bitset.
+        struct Chunk final
+        {
+            /// \brief The bits of the tokens whose count is not zero.
+            UInt64                    Presence;
+
+            /// \brief The bits of the tokens changed since the last poll.
+            UInt64                    Changes;
+
+#if GAMEPLAY_TOKEN_LAZY_ANCESTORS
+            /// \brief The bits of the tokens whose pending change is not yet applied to their ancestors.
+            UInt64                    Dirty;
+#endif
+
+            /// \brief The count of each token.
+            Array<UInt16, kChunkSize> Counts;
+
+            /// \brief The count of each token recorded before its first change since the last poll.
+            Array<UInt16, kChunkSize> Previous;
+
+#if GAMEPLAY_TOKEN_LAZY_ANCESTORS
+            /// \brief The net change of each token not yet applied to its ancestors.
+            Array<SInt32, kChunkSize> Pending;
+#endif
+        };
+
+        /// \brief Rollback pages covering the chunks.
+        using Pages = RollbackPages<Chunk>::Pages;
+
+        /// \brief Structure holding the state of a set captured for rollback.
+        struct Snapshot final
+        {
+            /// \brief The pages of the chunks.
+            Pages                 Chunks;
+
+            /// \brief The number of chunks in use.
+            UInt32                Size;
+
+            /// \brief The slot of the chunk covering each word of the bitsets.
+            Array<UInt16, kWords> Slots;
+        };
+
+    public:
+
+        /// \brief Default constructor, initializes an empty set.
+        ZYPHRYON_INLINE TokenSet()
+            : mSlots { }
+        {
+        }
+
         /// \brief Polls for changes in the token counts and invokes the provided action for each change.
         ///
+        /// \param Filter The bitset of tokens, indexed by dense index, whose changes should be reported.
         /// \param Action The action to invoke for each token whose count has changed.
         template<typename Function>
-        ZYPHRYON_INLINE void Poll(AnyRef<Function> Action)
+        ZYPHRYON_INLINE void Poll(ConstRef<Array<UInt64, kWords>> Filter, AnyRef<Function> Action)
         {
-            for (auto [Handle, Value] : mNotifications)
+            GAMEPLAY_TRACE_ZONE("TokenSet::Poll");
+
+            ConstRef<TokenRepository> Repository = TokenRepository::View();
+
+            Resolve();
+
+            // Discard the changes of tokens outside the filter before visiting any of them.
+            for (UInt32 Word = 0; Word < kWords; ++Word)
             {
-                if (const UInt32 Current = Count(Handle); Current != Value)
+                if (const UInt16 Slot = mSlots[Word]; Slot != 0)
                 {
-                    Action(Handle, Value, Current);
+                    mChunks[Slot - 1].Changes &= Filter[Word];
                 }
             }
-            mNotifications.clear();
+
+            // A token is recorded before its first change, so its chunk is always allocated here.
+            ForEach(& Chunk::Changes, [&](UInt32 Index)
+            {
+                const UInt32 Previous = GetChunk(Index).Previous[Index % kChunkSize];
+
+                if (const UInt32 Current = GetCount(Index); Current != Previous)
+                {
+                    Trace::Increment(TraceCounter::Notifications);
+                    Action(Repository.GetByIndex(Index), Previous, Current);
+                }
+            });
+
+            for (Ref<Chunk> Chunk : mChunks)
+            {
+                Chunk.Changes = 0;
+            }
+        }
+
+        /// \brief Invokes the provided action for each token whose count has changed since the last poll.
+        ///
+        /// \note The changes are left in place, so the next poll still reports them.
+        ///
+        /// \param Action The action to invoke for each token whose count has changed.
+        template<typename Function>
+        ZYPHRYON_INLINE void ForEachChange(AnyRef<Function> Action)
+        {
+            ConstRef<TokenRepository> Repository = TokenRepository::View();
+
+            Resolve();
+
+            ForEach(& Chunk::Changes, [&](UInt32 Index)
+            {
+                if (GetCount(Index) != GetChunk(Index).Previous[Index % kChunkSize])
+                {
+                    Action(Repository.GetByIndex(Index));
+                }
+            });
         }
 
         /// \brief Inserts tokens into the set, incrementing their counts by the specified amount.
         ///
+        /// \note Tokens without a dense index, either unregistered or beyond the capacity of the repository, can
+        ///       never be counted, so inserting them is discarded with a warning.
+        ///
         /// \param Handle The token handle to insert.
         /// \param Count  The amount to increment the token count by.
         ZYPHRYON_INLINE void Insert(Token Handle, UInt32 Count)
         {
-            Handle.Iterate([this, Count](Token Child)
+            const UInt16 Index = TokenRepository::View().GetIndex(Handle);
+
+            if (Index == 0)
             {
-                Ref<UInt32> Value = mRegistry[Child];
+                LOG_WARNING("Discarding insert of unregistered token {}.", Handle.GetID());
+                return;
+            }
 
-                mNotifications.emplace(Child, Exchange(Value, Value + Count));
-            });
+            const auto OnInsert = [this, Count](UInt16 Index)
+            {
+                LOG_ASSERT(GetCount(Index) + Count <= std::numeric_limits<UInt16>::max(), "Exceeded maximum token count.");
+
+                Record(Index);
+
+                Ref<Chunk> Chunk = GetChunk(Index);
+                Chunk.Counts[Index % kChunkSize] += Count;
+                Chunk.Presence                   |= (1ull << (Index % 64));
+            };
+
+#if GAMEPLAY_TOKEN_LAZY_ANCESTORS
+            OnInsert(Index);
+            Defer(Index, static_cast<SInt32>(Count));
+#else
+            TokenRepository::View().Iterate(Handle, OnInsert);
+#endif
         }
 
         /// \brief Removes tokens from the set, decrementing their counts by the specified amount.
         ///
+        /// \note Unregistered tokens are ignored, matching `Insert` which never counted them.
+        ///
         /// \param Handle The token handle to remove.
         /// \param Count  The amount to decrement the token count by.
         ZYPHRYON_INLINE void Remove(Token Handle, UInt32 Count)
         {
-            Handle.Iterate([this, Count](Token Child)
+            const UInt16 Index = TokenRepository::View().GetIndex(Handle);
+
+            if (Index == 0)
+            {
+                return;
+            }
+
+            const auto OnRemove = [this, Count](UInt16 Index)
             {
-                if (const auto Iterator = mRegistry.find(Child); Iterator != mRegistry.end())
+                const UInt32 Previous = GetCount(Index);
+
+                if (Previous == 0)
                 {
-                    mNotifications.emplace(Child, Iterator->second);
+                    return Previous;
+                }
+
+                Record(Index);
+
+                Ref<Chunk>  Chunk   = GetChunk(Index);
+                Ref<UInt16> Current = Chunk.Counts[Index % kChunkSize];
+
+                if (Previous <= Count)
+                {
+                    Current         = 0;
+                    Chunk.Presence &= ~(1ull << (Index % 64));
+                }
+                else
+                {
+                    Current -= Count;
+                }
+                return Previous - Current;
+            };
+
+#if GAMEPLAY_TOKEN_LAZY_ANCESTORS
+            // The stored count of a token with pending descendants is stale, resolve it before clamping.
+            if (GetPending(Handle) != 0)
+            {
+                Resolve();
+            }
 
-                    if (Iterator->second <= Count)
+            Defer(Index, -static_cast<SInt32>(OnRemove(Index)));
+#else
+            TokenRepository::View().Iterate(Handle, OnRemove);
+#endif
+        }
+
+        /// \brief Writes the pending changes of every token back to the counts of its ancestors.
+        ///
+        /// \note Does nothing unless ancestors are updated lazily. Ancestors whose count changes are reported by the
+        ///       next poll, as if they had been updated on insert. Writes the set even though it is const, so it must
+        ///       only be called by the thread owning the set, never from a read reaching another actor.
+        ZYPHRYON_INLINE void Resolve() const
+        {
+#if GAMEPLAY_TOKEN_LAZY_ANCESTORS
+            ConstRef<TokenRepository> Repository = TokenRepository::View();
+
+            ForEach(& Chunk::Dirty, [&](UInt32 Index)
+            {
+                const SInt32 Delta = GetChunk(Index).Pending[Index % kChunkSize];
+
+                if (Delta == 0)
+                {
+                    return;
+                }
+
+                Repository.Iterate(Repository.GetByIndex(Index), [&](UInt16 Ancestor)
+                {
+                    if (Ancestor == Index)
+                    {
+                        return;
+                    }
+
+                    Record(Ancestor);
+
+                    Ref<Chunk>  Chunk = GetChunk(Ancestor);
+                    Ref<UInt16> Count = Chunk.Counts[Ancestor % kChunkSize];
+                    Count = static_cast<UInt16>(Count + Delta);
+
+                    if (Count != 0)
                     {
-                        mRegistry.erase(Iterator);
+                        Chunk.Presence |= (1ull << (Ancestor % 64));
                     }
                     else
                     {
-                        Iterator->second -= Count;
+                        Chunk.Presence &= ~(1ull << (Ancestor % 64));
                     }
-                }
+                });
+                GetChunk(Index).Pending[Index % kChunkSize] = 0;
             });
+
+            for (Ref<Chunk> Chunk : mChunks)
+            {
+                Chunk.Dirty = 0;
+            }
+#endif
+        }
+
+        /// \brief Checks if there are token change events waiting to be polled.
+        ///
+        /// \return `true` if at least one token change has been recorded, `false` otherwise.
+        ZYPHRYON_INLINE Bool HasNotifications() const
+        {
+            return std::ranges::any_of(mChunks, [](ConstRef<Chunk> Chunk) { return Chunk.Changes != 0; });
         }
 
         /// \brief Clears all tokens from the set.
+        ///
+        /// \note Chunks are zeroed rather than released, since they hold the counts recorded for the next poll.
         ZYPHRYON_INLINE void Clear()
         {
-            mRegistry.clear();
+            for (Ref<Chunk> Chunk : mChunks)
+            {
+                Chunk.Presence = 0;
+                Chunk.Counts.fill(0);
+
+#if GAMEPLAY_TOKEN_LAZY_ANCESTORS
+                Chunk.Dirty = 0;
+                Chunk.Pending.fill(0);
+#endif
+            }
+        }
+
+        /// \brief Checks if the set holds at least one instance of a specific token.
+        ///
+        /// \param Handle The token handle to query.
+        /// \return `true` if the token is present, `false` otherwise.
+        ZYPHRYON_INLINE Bool Contains(Token Handle) const
+        {
+            return Count(Handle) != 0;
         }
 
         /// \brief Retrieves the count of a specific token in the set.
@@ -91,57 +348,248 @@ namespace Gameplay
         /// \return The count of the specified token.
         ZYPHRYON_INLINE UInt32 Count(Token Handle) const
         {
-            const auto Iterator = mRegistry.find(Handle);
-            return Iterator != mRegistry.end() ? Iterator->second : 0;
+            // Unknown tokens map to the root, whose count is always zero.
+            const UInt32 Stored = GetCount(TokenRepository::View().GetIndex(Handle));
+
+#if GAMEPLAY_TOKEN_LAZY_ANCESTORS
+            return static_cast<UInt32>(static_cast<SInt32>(Stored) + GetPending(Handle));
+#else
+            return Stored;
+#endif
+        }
+
+        /// \brief Counts the distinct tokens held by the set below the given token in the hierarchy.
+        ///
+        /// \note Counts already include descendants, use `Contains` to check whether anything is held below a token.
+        ///       Intermediate levels changed since the last resolve are not accounted for when ancestors are lazy.
+        ///
+        /// \param Handle The token whose subtree to query, excluding the token itself.
+        /// \return The number of distinct descendants present in the set.
+        ZYPHRYON_INLINE UInt32 CountUnder(Token Handle) const
+        {
+            UInt32 Total = 0;
+
+            TokenRepository::View().IterateDescendants(Handle, [&](UInt32 First, UInt32 Last)
+            {
+                for (UInt32 Word = First / 64; Word * 64 < Last; ++Word)
+                {
+                    Total += std::popcount(GetPresence(Word) & GetMask(Word, First, Last));
+                }
+            });
+            return Total;
+        }
+
+        /// \brief Iterates over the tokens held by the set below the given token in the hierarchy.
+        ///
+        /// \note Descendants are scanned as one range of the presence bitset per level, shallowest first. Like
+        ///       `GetPresence`, the scan reflects the last resolve when ancestors are lazy.
+        ///
+        /// \param Handle The token whose subtree to iterate, excluding the token itself.
+        /// \param Action The action to invoke for each descendant present and its count.
+        template<typename Function>
+        ZYPHRYON_INLINE void ForEachUnder(Token Handle, AnyRef<Function> Action) const
+        {
+            ConstRef<TokenRepository> Repository = TokenRepository::View();
+
+            Repository.IterateDescendants(Handle, [&](UInt32 First, UInt32 Last)
+            {
+                for (UInt32 Word = First / 64; Word * 64 < Last; ++Word)
+                {
+                    for (UInt64 Bits = GetPresence(Word) & GetMask(Word, First, Last); Bits != 0; Bits &= Bits - 1)
+                    {
+                        const UInt32 Index = Word * 64 + std::countr_zero(Bits);
+                        Action(Repository.GetByIndex(Index), GetCount(Index));
+                    }
+                }
+            });
+        }
+
+        /// \brief Retrieves a word of the presence bitset of the set, one bit per dense token index.
+        ///
+        /// \note Never resolves, since queries evaluate it on other actors from parallel workers. When ancestors are
+        ///       lazy it reflects the last resolve, which the owning arsenal runs before testing its own tokens.
+        ///
+        /// \param Word The index of the word, below `kWords`.
+        /// \return The presence bits of the tokens covered by the word, `0` if none of them was ever held.
+        ZYPHRYON_INLINE UInt64 GetPresence(UInt32 Word) const
+        {
+            const UInt16 Slot = mSlots[Word];
+            return (Slot != 0 ? mChunks[Slot - 1].Presence : 0);
         }
 
         /// \brief Traverses all tokens in the set, invoking the provided action for each token and its count.
         ///
+        /// \note Like `GetPresence`, the traversal reflects the last resolve when ancestors are lazy.
+        ///
         /// \tparam Function The type of the action to invoke for each token.
         template<typename Function>
         ZYPHRYON_INLINE void Traverse(AnyRef<Function> Action) const
         {
-            for (const auto [Handle, Count] : mRegistry)
+            ConstRef<TokenRepository> Repository = TokenRepository::View();
+
+            ForEach(& Chunk::Presence, [&](UInt32 Index)
             {
-                Action(Handle, Count);
-            }
+                Action(Repository.GetByIndex(Index), GetCount(Index));
+            });
         }
 
+        /// \brief Loads the token counts of the set from a baked snapshot, replacing its current content.
+        ///
+        /// \note Tokens are stored by handle rather than dense index, so snapshots survive a rebuild of the
+        ///       hierarchy. Restored counts are not reported as changes.
+        ///
+        /// \param Reader The baked snapshot to load from.
+        void Load(Ref<BakeReader> Reader);
+
+        /// \brief Saves the token counts of the set to a baked snapshot.
+        ///
+        /// \param Writer The baked snapshot to save to.
+        void Save(Ref<BakeWriter> Writer) const;
+
+        /// \brief Captures the state of the set for rollback.
+        ///
+        /// \note Only the pages of counts that changed since the previous capture or restore are copied.
+        ///
+        /// \param Target The snapshot receiving the state, whose previous content is replaced.
+        void Capture(Ref<Snapshot> Target) const;
+
+        /// \brief Restores the state of the set from a rollback snapshot, including its pending changes.
+        ///
+        /// \param Source The snapshot previously filled by `Capture`.
+        void Restore(ConstRef<Snapshot> Source);
+
+        /// \brief Records the memory held by the set, including the pages retained for rollback.
+        ///
+        /// \param Usage The report receiving the usage.
+        void Measure(Ref<MemoryUsage> Usage) const;
+
     private:
 
-        /// \brief Represents a notification for a token count change.
-        struct Notification final
+        /// \brief Retrieves the count of a token, without allocating the chunk covering it.
+        ///
+        /// \param Index The dense index of the token.
+        /// \return The count of the token, `0` if its chunk was never allocated.
+        ZYPHRYON_INLINE UInt32 GetCount(UInt32 Index) const
         {
-            /// \brief The token associated with the notification.
-            Token  Key;
+            const UInt16 Slot = mSlots[Index / kChunkSize];
+            return (Slot != 0 ? mChunks[Slot - 1].Counts[Index % kChunkSize] : 0);
+        }
 
-            /// \brief The previous count value of the token.
-            UInt32 Value;
+        /// \brief Retrieves the chunk covering a token, allocating it on first use.
+        ///
+        /// \note Allocating a chunk may relocate the others, so references into them must not be held across calls.
+        ///
+        /// \param Index The dense index of the token.
+        /// \return A reference to the chunk covering the token.
+        ZYPHRYON_INLINE Ref<Chunk> GetChunk(UInt32 Index) const
+        {
+            Ref<UInt16> Slot = mSlots[Index / kChunkSize];
 
-            /// \brief Generates a hash value for the notification based on its token.
-            ///
-            /// \return A hash value uniquely representing the notification.
-            ZYPHRYON_INLINE UInt64 Hash() const
+            if (Slot == 0)
             {
-                return Key.Hash();
+                mChunks.emplace_back(Chunk { });
+                Slot = static_cast<UInt16>(mChunks.size());
             }
+            return mChunks[Slot - 1];
+        }
+
+        /// \brief Records the count of a token before its first change since the last poll.
+        ///
+        /// \param Index The dense index of the token about to change.
+        ZYPHRYON_INLINE void Record(UInt16 Index) const
+        {
+            Ref<Chunk> Chunk = GetChunk(Index);
 
-            /// \brief Compares two notifications for equality based on their tokens.
-            ///
-            /// \param Other The other notification to compare against.
-            /// \return `true` if both notifications are for the same token, otherwise `false`.
-            ZYPHRYON_INLINE Bool operator==(ConstRef<Notification> Other) const
+            if (const UInt64 Bit = (1ull << (Index % 64)); !(Chunk.Changes & Bit))
             {
-                return Key == Other.Key;
+                Chunk.Changes                      |= Bit;
+                Chunk.Previous[Index % kChunkSize]  = Chunk.Counts[Index % kChunkSize];
             }
-        };
+        }
+
+#if GAMEPLAY_TOKEN_LAZY_ANCESTORS
+
+        /// \brief Records a change of a token that has not yet been applied to its ancestors.
+        ///
+        /// \param Index The dense index of the token that changed.
+        /// \param Delta The signed amount its count changed by.
+        ZYPHRYON_INLINE void Defer(UInt16 Index, SInt32 Delta)
+        {
+            Ref<Chunk> Chunk = GetChunk(Index);
+            Chunk.Pending[Index % kChunkSize] += Delta;
+            Chunk.Dirty                       |= (1ull << (Index % 64));
+        }
+
+        /// \brief Sums the pending changes of the descendants of a token, not yet applied to its count.
+        ///
+        /// \param Handle The token whose subtree to query.
+        /// \return The net amount the count of the token is behind.
+        ZYPHRYON_INLINE SInt32 GetPending(Token Handle) const
+        {
+            SInt32 Total = 0;
+
+            TokenRepository::View().IterateDescendants(Handle, [&](UInt32 First, UInt32 Last)
+            {
+                for (UInt32 Word = First / 64; Word * 64 < Last; ++Word)
+                {
+                    if (const UInt16 Slot = mSlots[Word]; Slot != 0)
+                    {
+                        ConstRef<Chunk> Chunk = mChunks[Slot - 1];
+
+                        for (UInt64 Bits = Chunk.Dirty & GetMask(Word, First, Last); Bits != 0; Bits &= Bits - 1)
+                        {
+                            Total += Chunk.Pending[std::countr_zero(Bits)];
+                        }
+                    }
+                }
+            });
+            return Total;
+        }
+
+#endif
+
+        /// \brief Computes the bits of a word that fall within a range of dense indices.
+        ///
+        /// \param Word  The index of the word.
+        /// \param First The first dense index of the range.
+        /// \param Last  One past the last dense index of the range.
+        /// \return The mask of the bits of the word inside the range.
+        ZYPHRYON_INLINE static UInt64 GetMask(UInt32 Word, UInt32 First, UInt32 Last)
+        {
+            const UInt32 Lower = Max(First, Word * 64) - Word * 64;
+            const UInt32 Upper = Min(Last, Word * 64 + 64) - Word * 64;
+
+            return (Upper == 64 ? ~0ull : (1ull << Upper) - 1) & (~0ull << Lower);
+        }
+
+        /// \brief Invokes the provided action for the index of each bit set in a bitset of the chunks, in order.
+        ///
+        /// \note The bits of a chunk are read before visiting them, so the action may allocate further chunks.
+        ///
+        /// \param Bitset The bitset of the chunks to iterate.
+        /// \param Action The action to invoke for each set bit.
+        template<typename Function>
+        ZYPHRYON_INLINE void ForEach(UInt64 Chunk::* Bitset, AnyRef<Function> Action) const
+        {
+            for (UInt32 Word = 0; Word < kWords; ++Word)
+            {
+                if (const UInt16 Slot = mSlots[Word]; Slot != 0)
+                {
+                    for (UInt64 Bits = mChunks[Slot - 1].*Bitset; Bits != 0; Bits &= Bits - 1)
+                    {
+                        Action(Word * 64 + std::countr_zero(Bits));
+                    }
+                }
+            }
+        }
 
     private:
 
         // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
         // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 
-        Table<Token, UInt32> mRegistry;
-        Set<Notification>    mNotifications;
+        mutable Array<UInt16, kWords> mSlots;
+        mutable Vector<Chunk>         mChunks;
+        mutable RollbackPages<Chunk>  mPages;
     };
 }
\ No newline at end of file